@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,7 +7,8 @@
 
 #include "level_zero/api/driver_experimental/public/zex_cmdlist.h"
 
-#include "level_zero/core/source/cmdlist/cmdlist.h"
+#include "level_zero/core/source/cmdlist/cmdlist_imp.h"
+#include "level_zero/core/source/device/device.h"
 
 namespace L0 {
 ZE_APIEXPORT ze_result_t ZE_APICALL
@@ -67,4 +68,44 @@ zexCommandListAppendWriteToMemory(
         return ZE_RESULT_ERROR_UNKNOWN;
     }
 }
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListSerialize(
+    ze_command_list_handle_t hCommandList,
+    const zex_command_list_relocation_desc_t *desc,
+    size_t *pSize,
+    void *pBlob) {
+    if (nullptr == hCommandList) {
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    if (nullptr == desc || nullptr == pSize) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    try {
+        return static_cast<CommandListImp *>(L0::CommandList::fromHandle(hCommandList))->serializeRelocatable(*desc, pSize, pBlob);
+    } catch (std::bad_alloc &) {
+        return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListDeserialize(
+    ze_context_handle_t hContext,
+    ze_device_handle_t hDevice,
+    const void *pBlob,
+    size_t size,
+    const zex_command_list_relocation_desc_t *desc,
+    ze_command_list_handle_t *phCommandList) {
+    if (nullptr == hContext || nullptr == hDevice) {
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    if (nullptr == pBlob || nullptr == desc || nullptr == phCommandList) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    try {
+        return CommandListImp::createFromRelocatable(L0::Device::fromHandle(hDevice), hContext, pBlob, size, *desc, phCommandList);
+    } catch (std::bad_alloc &) {
+        return ZE_RESULT_ERROR_OUT_OF_HOST_MEMORY;
+    }
+}
 } // namespace L0
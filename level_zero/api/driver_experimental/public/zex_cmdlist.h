@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -33,4 +33,20 @@ zexCommandListAppendWriteToMemory(
     zex_write_to_mem_desc_t *desc,
     void *ptr,
     uint64_t data);
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListSerialize(
+    ze_command_list_handle_t hCommandList,
+    const zex_command_list_relocation_desc_t *desc,
+    size_t *pSize,
+    void *pBlob);
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexCommandListDeserialize(
+    ze_context_handle_t hContext,
+    ze_device_handle_t hDevice,
+    const void *pBlob,
+    size_t size,
+    const zex_command_list_relocation_desc_t *desc,
+    ze_command_list_handle_t *phCommandList);
 } // namespace L0
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -54,6 +54,23 @@ typedef struct _zex_write_to_mem_desc_t {
     zex_mem_action_scope_flags_t writeScope;
 } zex_write_to_mem_desc_t;
 
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Records locations of addresses programmed by commands appended to the command list,
+/// required to serialize the command list. Can be set in `ze_command_list_flags_t`.
+#define ZEX_COMMAND_LIST_FLAG_RELOCATABLE ZEX_BIT(30)
+
+///////////////////////////////////////////////////////////////////////////////
+/// @brief Objects referenced by commands of a relocatable command list.
+/// Same objects, in the same order, must be passed when serializing and deserializing.
+typedef struct _zex_command_list_relocation_desc_t {
+    uint32_t numKernels;           ///< [in] number of kernels launched by the command list
+    ze_kernel_handle_t *phKernels; ///< [in][range(0, numKernels)] kernels launched by the command list
+    uint32_t numAllocations;       ///< [in] number of USM allocations referenced by the command list
+    const void **ppAllocations;    ///< [in][range(0, numAllocations)] base pointers of USM allocations
+    uint32_t numEvents;            ///< [in] number of events used by the command list
+    ze_event_handle_t *phEvents;   ///< [in][range(0, numEvents)] events used by the command list
+} zex_command_list_relocation_desc_t;
+
 #if defined(__cplusplus)
 } // extern "C"
 #endif
@@ -29,6 +29,34 @@ zexEventGetDeviceAddress(ze_event_handle_t event, uint64_t *completionValue, uin
     return ZE_RESULT_SUCCESS;
 }
 
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventQueryKernelTimestamps(uint32_t numEvents, ze_event_handle_t *phEvents, ze_kernel_timestamp_result_t *pKernelTimestamps, ze_kernel_timestamp_result_t *pKernelTimestampsInNs) {
+    if (numEvents == 0 || !phEvents || !pKernelTimestamps) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    for (uint32_t i = 0; i < numEvents; i++) {
+        if (!phEvents[i]) {
+            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    return Event::queryKernelTimestamps(numEvents, phEvents, pKernelTimestamps, pKernelTimestampsInNs);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventHostSynchronizeMultiple(uint32_t numEvents, ze_event_handle_t *phEvents, uint64_t timeout) {
+    if (numEvents == 0 || !phEvents) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    for (uint32_t i = 0; i < numEvents; i++) {
+        if (!phEvents[i]) {
+            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+    }
+
+    return Event::hostSynchronizeMultiple(numEvents, phEvents, timeout);
+}
+
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zexCounterBasedEventCreate(ze_context_handle_t hContext, ze_device_handle_t hDevice, uint64_t *deviceAddress, uint64_t *hostAddress, uint64_t completionValue, const ze_event_desc_t *desc, ze_event_handle_t *phEvent) {
     constexpr uint32_t counterBasedFlags = (ZE_EVENT_POOL_COUNTER_BASED_EXP_FLAG_IMMEDIATE | ZE_EVENT_POOL_COUNTER_BASED_EXP_FLAG_NON_IMMEDIATE);
@@ -17,6 +17,19 @@ zexEventGetDeviceAddress(
     uint64_t *completionValue,
     uint64_t *address);
 
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventQueryKernelTimestamps(
+    uint32_t numEvents,
+    ze_event_handle_t *phEvents,
+    ze_kernel_timestamp_result_t *pKernelTimestamps,
+    ze_kernel_timestamp_result_t *pKernelTimestampsInNs);
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zexEventHostSynchronizeMultiple(
+    uint32_t numEvents,
+    ze_event_handle_t *phEvents,
+    uint64_t timeout);
+
 ZE_APIEXPORT ze_result_t ZE_APICALL
 zexCounterBasedEventCreate(
     ze_context_handle_t hContext,
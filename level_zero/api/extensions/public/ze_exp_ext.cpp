@@ -7,6 +7,7 @@
 
 #include "level_zero/api/extensions/public/ze_exp_ext.h"
 
+#include "level_zero/core/source/cmdlist/cmdlist_imp.h"
 #include "level_zero/core/source/context/context.h"
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/driver/driver_handle.h"
@@ -200,6 +201,34 @@ ze_result_t ZE_APICALL zeImageGetDeviceOffsetExp(
     return L0::Image::fromHandle(hImage)->getDeviceOffset(pDeviceOffset);
 }
 
+ze_result_t zeCommandListGetNextCommandIdExp(
+    ze_command_list_handle_t hCommandList,
+    const ze_mutable_command_id_exp_desc_t *desc,
+    uint64_t *pCommandId) {
+    return static_cast<CommandListImp *>(L0::CommandList::fromHandle(hCommandList))->getNextCommandId(desc, pCommandId);
+}
+
+ze_result_t zeCommandListUpdateMutableCommandsExp(
+    ze_command_list_handle_t hCommandList,
+    const ze_mutable_commands_exp_desc_t *desc) {
+    return static_cast<CommandListImp *>(L0::CommandList::fromHandle(hCommandList))->updateMutableCommands(desc);
+}
+
+ze_result_t zeCommandListUpdateMutableCommandSignalEventExp(
+    ze_command_list_handle_t hCommandList,
+    uint64_t commandId,
+    ze_event_handle_t hSignalEvent) {
+    return static_cast<CommandListImp *>(L0::CommandList::fromHandle(hCommandList))->updateMutableCommandSignalEvent(commandId, hSignalEvent);
+}
+
+ze_result_t zeCommandListUpdateMutableCommandWaitEventsExp(
+    ze_command_list_handle_t hCommandList,
+    uint64_t commandId,
+    uint32_t numWaitEvents,
+    ze_event_handle_t *phWaitEvents) {
+    return static_cast<CommandListImp *>(L0::CommandList::fromHandle(hCommandList))->updateMutableCommandWaitEvents(commandId, numWaitEvents, phWaitEvents);
+}
+
 } // namespace L0
 
 extern "C" {
@@ -411,4 +440,36 @@ zeMemGetAtomicAccessAttributeExp(
     return L0::zeMemGetAtomicAccessAttributeExp(hContext, hDevice, ptr, size, pAttr);
 }
 
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeCommandListGetNextCommandIdExp(
+    ze_command_list_handle_t hCommandList,
+    const ze_mutable_command_id_exp_desc_t *desc,
+    uint64_t *pCommandId) {
+    return L0::zeCommandListGetNextCommandIdExp(hCommandList, desc, pCommandId);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeCommandListUpdateMutableCommandsExp(
+    ze_command_list_handle_t hCommandList,
+    const ze_mutable_commands_exp_desc_t *desc) {
+    return L0::zeCommandListUpdateMutableCommandsExp(hCommandList, desc);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeCommandListUpdateMutableCommandSignalEventExp(
+    ze_command_list_handle_t hCommandList,
+    uint64_t commandId,
+    ze_event_handle_t hSignalEvent) {
+    return L0::zeCommandListUpdateMutableCommandSignalEventExp(hCommandList, commandId, hSignalEvent);
+}
+
+ZE_APIEXPORT ze_result_t ZE_APICALL
+zeCommandListUpdateMutableCommandWaitEventsExp(
+    ze_command_list_handle_t hCommandList,
+    uint64_t commandId,
+    uint32_t numWaitEvents,
+    ze_event_handle_t *phWaitEvents) {
+    return L0::zeCommandListUpdateMutableCommandWaitEventsExp(hCommandList, commandId, numWaitEvents, phWaitEvents);
+}
+
 } // extern "C"
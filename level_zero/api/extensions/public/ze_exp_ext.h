@@ -170,4 +170,24 @@ ze_result_t zeImageGetDeviceOffsetExp(
     ze_image_handle_t hImage,
     uint64_t *pDeviceOffset);
 
+ze_result_t zeCommandListGetNextCommandIdExp(
+    ze_command_list_handle_t hCommandList,
+    const ze_mutable_command_id_exp_desc_t *desc,
+    uint64_t *pCommandId);
+
+ze_result_t zeCommandListUpdateMutableCommandsExp(
+    ze_command_list_handle_t hCommandList,
+    const ze_mutable_commands_exp_desc_t *desc);
+
+ze_result_t zeCommandListUpdateMutableCommandSignalEventExp(
+    ze_command_list_handle_t hCommandList,
+    uint64_t commandId,
+    ze_event_handle_t hSignalEvent);
+
+ze_result_t zeCommandListUpdateMutableCommandWaitEventsExp(
+    ze_command_list_handle_t hCommandList,
+    uint64_t commandId,
+    uint32_t numWaitEvents,
+    ze_event_handle_t *phWaitEvents);
+
 } // namespace L0
@@ -9,7 +9,10 @@
 
 #include "shared/source/built_ins/built_ins.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/device/device.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/source/utilities/thread_pool.h"
 
 #include "level_zero/core/source/device/device.h"
 #include "level_zero/core/source/kernel/kernel.h"
@@ -32,6 +35,11 @@ std::unique_lock<BuiltinFunctionsLib::MutexType> BuiltinFunctionsLib::obtainUniq
 }
 
 void BuiltinFunctionsLibImpl::initBuiltinKernel(Builtin func) {
+    this->waitForBuiltinInit(func);
+    this->loadBuiltinKernel(func);
+}
+
+void BuiltinFunctionsLibImpl::loadBuiltinKernel(Builtin func) {
     const char *kernelName = nullptr;
     NEO::EBuiltInOps::Type builtin;
 
@@ -217,22 +225,22 @@ BuiltinFunctionsLibImpl::BuiltinFunctionsLibImpl(Device *device, NEO::BuiltIns *
     if (initBuiltinsAsyncEnabled(device)) {
         this->initAsyncComplete = false;
 
-        auto initFunc = [this]() {
-            this->initBuiltinKernel(Builtin::fillBufferImmediate);
-            this->initAsync.store(true);
-        };
-
-        std::thread initAsyncThread(initFunc);
-        initAsyncThread.detach();
+        auto threadPool = device->getNEODevice()->getExecutionEnvironment()->getThreadPool();
+        for (auto &func : asyncInitBuiltins) {
+            auto initFunc = [this, func]() {
+                this->loadBuiltinKernel(func);
+            };
+            builtinsInitTasks[static_cast<uint32_t>(func)] = threadPool->enqueue(initFunc);
+        }
     }
 }
 
 Kernel *BuiltinFunctionsLibImpl::getFunction(Builtin func) {
     auto builtId = static_cast<uint32_t>(func);
 
-    this->ensureInitCompletion();
+    this->waitForBuiltinInit(func);
     if (builtins[builtId].get() == nullptr) {
-        initBuiltinKernel(func);
+        loadBuiltinKernel(func);
     }
 
     return builtins[builtId]->func.get();
@@ -241,7 +249,6 @@ Kernel *BuiltinFunctionsLibImpl::getFunction(Builtin func) {
 Kernel *BuiltinFunctionsLibImpl::getImageFunction(ImageBuiltin func) {
     auto builtId = static_cast<uint32_t>(func);
 
-    this->ensureInitCompletion();
     if (imageBuiltins[builtId].get() == nullptr) {
         initBuiltinImageKernel(func);
     }
@@ -277,11 +284,16 @@ std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> BuiltinFunctionsLibImpl::l
 
     [[maybe_unused]] ze_result_t res;
 
-    if (this->modules.size() <= builtin) {
-        this->modules.resize(builtin + 1u);
+    Module *builtinModule = nullptr;
+    {
+        std::lock_guard<std::mutex> modulesLock(this->modulesMutex);
+        if (this->modules.size() <= builtin) {
+            this->modules.resize(builtin + 1u);
+        }
+        builtinModule = this->modules[builtin].get();
     }
 
-    if (this->modules[builtin].get() == nullptr) {
+    if (builtinModule == nullptr) {
         std::unique_ptr<Module> module;
         ze_module_handle_t moduleHandle;
         ze_module_desc_t moduleDesc = {};
@@ -292,18 +304,24 @@ std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> BuiltinFunctionsLibImpl::l
         UNRECOVERABLE_IF(res != ZE_RESULT_SUCCESS);
 
         module.reset(Module::fromHandle(moduleHandle));
-        this->modules[builtin] = std::move(module);
+
+        // modules are built outside of the lock, so different builtin modules may be created in parallel
+        std::lock_guard<std::mutex> modulesLock(this->modulesMutex);
+        if (this->modules[builtin].get() == nullptr) {
+            this->modules[builtin] = std::move(module);
+        }
+        builtinModule = this->modules[builtin].get();
     }
 
     std::unique_ptr<Kernel> kernel;
     ze_kernel_handle_t kernelHandle;
     ze_kernel_desc_t kernelDesc = {};
     kernelDesc.pKernelName = builtInName;
-    res = this->modules[builtin]->createKernel(&kernelDesc, &kernelHandle);
+    res = builtinModule->createKernel(&kernelDesc, &kernelHandle);
     DEBUG_BREAK_IF(res != ZE_RESULT_SUCCESS);
 
     kernel.reset(Kernel::fromHandle(kernelHandle));
-    return std::unique_ptr<BuiltinData>(new BuiltinData{modules[builtin].get(), std::move(kernel)});
+    return std::unique_ptr<BuiltinData>(new BuiltinData{builtinModule, std::move(kernel)});
 }
 
 void BuiltinFunctionsLibImpl::ensureInitCompletion() {
@@ -312,10 +330,22 @@ void BuiltinFunctionsLibImpl::ensureInitCompletion() {
 
 void BuiltinFunctionsLibImpl::ensureInitCompletionImpl() {
     if (!this->initAsyncComplete) {
-        while (!this->initAsync.load()) {
+        for (auto &initTask : this->builtinsInitTasks) {
+            if (initTask.valid()) {
+                initTask.wait();
+            }
         }
         this->initAsyncComplete = true;
     }
 }
 
+void BuiltinFunctionsLibImpl::waitForBuiltinInit(Builtin func) {
+    auto builtId = static_cast<uint32_t>(func);
+    UNRECOVERABLE_IF(builtId >= this->builtinsInitTasks.size());
+    auto &initTask = this->builtinsInitTasks[builtId];
+    if (initTask.valid()) {
+        initTask.wait();
+    }
+}
+
 } // namespace L0
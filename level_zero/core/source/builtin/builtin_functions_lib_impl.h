@@ -9,7 +9,9 @@
 #include "level_zero/core/source/builtin/builtin_functions_lib.h"
 #include "level_zero/core/source/module/module.h"
 
+#include <array>
 #include <future>
+#include <mutex>
 #include <vector>
 
 namespace NEO {
@@ -38,19 +40,25 @@ struct BuiltinFunctionsLibImpl : BuiltinFunctionsLib {
     void initBuiltinImageKernel(ImageBuiltin func) override;
     void ensureInitCompletion() override;
     void ensureInitCompletionImpl();
+    MOCKABLE_VIRTUAL void waitForBuiltinInit(Builtin func);
     MOCKABLE_VIRTUAL std::unique_ptr<BuiltinFunctionsLibImpl::BuiltinData> loadBuiltIn(NEO::EBuiltInOps::Type builtin, const char *builtInName);
 
     static bool initBuiltinsAsyncEnabled(Device *device);
+    // only builtins used by the first fill and copy appends are prefetched, remaining builtins are loaded on first use
+    static constexpr Builtin asyncInitBuiltins[] = {Builtin::fillBufferImmediate, Builtin::copyBufferBytes};
 
   protected:
+    void loadBuiltinKernel(Builtin func);
+
     std::vector<std::unique_ptr<Module>> modules = {};
     std::unique_ptr<BuiltinData> builtins[static_cast<uint32_t>(Builtin::count)];
     std::unique_ptr<BuiltinData> imageBuiltins[static_cast<uint32_t>(ImageBuiltin::count)];
+    std::array<std::shared_future<void>, static_cast<uint32_t>(Builtin::count)> builtinsInitTasks = {};
     Device *device;
     NEO::BuiltIns *builtInsLib;
+    std::mutex modulesMutex;
 
     bool initAsyncComplete = true;
-    std::atomic_bool initAsync = false;
 };
 struct BuiltinFunctionsLibImpl::BuiltinData {
     MOCKABLE_VIRTUAL ~BuiltinData();
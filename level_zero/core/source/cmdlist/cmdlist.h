@@ -42,6 +42,49 @@ struct CmdListReturnPoint {
     NEO::GraphicsAllocation *currentCmdBuffer = nullptr;
 };
 
+struct CmdListKernelLaunchSite {
+    Kernel *kernel = nullptr;
+    NEO::GraphicsAllocation *cmdBuffer = nullptr;
+    size_t kernelStartPointerOffset = 0;
+    size_t indirectDataStartAddressOffset = 0;
+    size_t inlineDataOffset = 0; // walker inline data, its addresses are recorded as address sites
+    size_t inlineDataSize = 0;
+    bool absoluteKernelStartPointer = false;
+};
+
+struct CmdListAddressSite {
+    NEO::GraphicsAllocation *location = nullptr; // command buffer or heap holding 64-bit address
+    size_t offset = 0;
+};
+
+struct MutableEventPatchSite {
+    void *command = nullptr;    // command programming event address, recorded when the command is dispatched
+    uint64_t offsetInEvent = 0; // offset of programmed address from event base address
+    CommandToPatch::CommandType type = CommandToPatch::Invalid;
+};
+
+struct MutableEventUse {
+    std::vector<MutableEventPatchSite> patchSites;
+    uint32_t eventSize = 0;
+    uint32_t packetsInUse = 0;
+    bool usingContextEndOffset = false;
+    bool signalScope = false;
+    bool interruptMode = false;
+};
+
+struct MutableKernelCommand {
+    ze_mutable_command_exp_flags_t flags = 0;
+    Kernel *kernel = nullptr;
+    void *walker = nullptr;
+    void *inlineData = nullptr;   // leading part of cross thread data programmed in walker
+    void *indirectData = nullptr; // remaining cross thread data in indirect object heap
+    size_t inlineDataSize = 0;
+    std::vector<uint8_t> crossThreadData;
+    uint32_t groupSize[3] = {};
+    std::optional<MutableEventUse> signalEvent;
+    std::vector<MutableEventUse> waitEvents;
+};
+
 struct CommandList : _ze_command_list_handle_t {
     static constexpr uint32_t defaultNumIddsPerBlock = 64u;
     static constexpr uint32_t commandListimmediateIddsPerBlock = 1u;
@@ -56,6 +99,9 @@ struct CommandList : _ze_command_list_handle_t {
 
     using CommandsToPatch = StackVec<CommandToPatch, 16>;
     using CmdListReturnPoints = StackVec<CmdListReturnPoint, 32>;
+    using CmdListKernelLaunchSites = std::vector<CmdListKernelLaunchSite>;
+    using CmdListAddressSites = std::vector<CmdListAddressSite>;
+    using MutableKernelCommands = std::vector<MutableKernelCommand>;
 
     virtual ze_result_t close() = 0;
     virtual ze_result_t destroy() = 0;
@@ -274,6 +320,18 @@ struct CommandList : _ze_command_list_handle_t {
         return static_cast<uint32_t>(returnPoints.size());
     }
 
+    const CmdListKernelLaunchSites &getKernelLaunchSites() const {
+        return kernelLaunchSites;
+    }
+
+    const CmdListAddressSites &getRelocatableAddressSites() const {
+        return relocatableAddressSites;
+    }
+
+    const MutableKernelCommands &getMutableKernelCommands() const {
+        return mutableKernelCommands;
+    }
+
     void migrateSharedAllocations();
 
     bool getSystolicModeSupport() const {
@@ -364,6 +422,9 @@ struct CommandList : _ze_command_list_handle_t {
     NEO::CommandContainer commandContainer;
 
     CmdListReturnPoints returnPoints;
+    CmdListKernelLaunchSites kernelLaunchSites;
+    CmdListAddressSites relocatableAddressSites;
+    MutableKernelCommands mutableKernelCommands;
     NEO::StreamProperties requiredStreamState{};
     NEO::StreamProperties finalStreamState{};
     CommandsToPatch commandsToPatch{};
@@ -391,6 +452,8 @@ struct CommandList : _ze_command_list_handle_t {
     NEO::EngineGroupType engineGroupType = NEO::EngineGroupType::maxEngineGroups;
     NEO::HeapAddressModel cmdListHeapAddressModel = NEO::HeapAddressModel::privateHeaps;
     std::optional<uint32_t> ordinal = std::nullopt;
+    std::optional<size_t> pendingMutableCommandId = std::nullopt;
+    MutableKernelCommand *currentMutableCommand = nullptr;
 
     CommandListType cmdListType = CommandListType::typeRegular;
     uint32_t commandListPerThreadScratchSize[2]{};
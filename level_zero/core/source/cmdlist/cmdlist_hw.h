@@ -196,6 +196,11 @@ struct CommandListCoreFamily : public CommandListImp {
     ze_result_t executeCommandListImmediateImpl(bool performMigration, L0::CommandQueue *cmdQImmediate);
     size_t getReserveSshSize();
     void patchInOrderCmds() override;
+    bool isMutableGroupCountSupported(const MutableKernelCommand &command) const override;
+    void programMutableGroupCount(MutableKernelCommand &command, const ze_group_count_t &groupCount) override;
+    uint64_t getMutableEventAddress(const MutableEventPatchSite &patchSite) const override;
+    void programMutableEventAddress(const MutableEventPatchSite &patchSite, uint64_t address) override;
+    size_t getCommandAddressOffset(CommandToPatch::CommandType type, void *command) const override;
     bool handleCounterBasedEventOperations(Event *signalEvent);
     bool isCbEventBoundToCmdList(Event *event) const;
 
@@ -297,6 +302,11 @@ struct CommandListCoreFamily : public CommandListImp {
     void appendEventForProfilingCopyCommand(Event *event, bool beforeWalker);
     void appendSignalEventPostWalker(Event *event, void **syncCmdBuffer, CommandToPatchContainer *outTimeStampSyncCmds, bool skipBarrierForEndProfiling, bool skipAddingEventToResidency);
     virtual void programStateBaseAddress(NEO::CommandContainer &container, bool useSbaProperties);
+    void recordRelocatableKernelLaunch(Kernel &kernel, void *walkerPtr);
+    static uint32_t getCommandAddressDwordOffset(CommandToPatch::CommandType type);
+    void *getTrackedBarrierPostSync(void *postSyncCmd) const;
+    void recordEventBarrierSite(void *postSyncCmd);
+    static size_t getIndirectDataStartAddressOffset();
     void appendComputeBarrierCommand();
     NEO::PipeControlArgs createBarrierFlags();
     void appendMultiTileBarrier(NEO::Device &neoDevice);
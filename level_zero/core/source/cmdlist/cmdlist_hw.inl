@@ -109,6 +109,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::reset() {
     removeMemoryPrefetchAllocations();
     commandContainer.reset();
     clearCommandsToPatch();
+    resetRelocatableRecording();
 
     if (!isCopyOnly()) {
         printfKernelContainer.clear();
@@ -147,6 +148,11 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::reset() {
     latestOperationRequiredNonWalkerInOrderCmdsChaining = false;
 
     this->inOrderPatchCmds.clear();
+    this->kernelLaunchSites.clear();
+    this->mutableKernelCommands.clear();
+    this->pendingMutableCommandId.reset();
+    this->isClosed = false;
+    setRelocatableStreamEnd();
 
     return ZE_RESULT_SUCCESS;
 }
@@ -246,6 +252,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::initialize(Device *device, NEO
     this->commandContainer.setImmediateCmdListCsr(this->csr);
     this->commandContainer.setStateBaseAddressTracking(this->stateBaseAddressTracking);
     this->commandContainer.setUsingPrimaryBuffer(this->dispatchCmdListBatchBufferAsPrimary);
+    this->relocatableRecording = !isImmediateType() && (this->flags & ZEX_COMMAND_LIST_FLAG_RELOCATABLE);
 
     if (device->isImplicitScalingCapable() && !this->internalUsage && !isCopyOnly()) {
         this->partitionCount = static_cast<uint32_t>(neoDevice->getDeviceBitfield().count());
@@ -298,6 +305,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::initialize(Device *device, NEO
     if (this->flags & ZE_COMMAND_LIST_FLAG_IN_ORDER) {
         enableInOrderExecution();
     }
+    setRelocatableStreamEnd();
 
     if (NEO::debugManager.flags.ForceSynchronizedDispatchMode.get() != -1) {
         enableSynchronizedDispatch((NEO::debugManager.flags.ForceSynchronizedDispatchMode.get() == 1) ? NEO::SynchronizedDispatchMode::full : NEO::SynchronizedDispatchMode::disabled);
@@ -339,7 +347,11 @@ inline ze_result_t CommandListCoreFamily<gfxCoreFamily>::executeCommandListImmed
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::close() {
+    this->isClosed = true;
     commandContainer.removeDuplicatesFromResidencyContainer();
+    if (this->relocatableRecording) {
+        checkRelocatableStreamEnd();
+    }
     if (this->dispatchCmdListBatchBufferAsPrimary) {
         commandContainer.endAlignedPrimaryBuffer();
     } else {
@@ -359,6 +371,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernel(ze_kernel_h
                                                                      uint32_t numWaitEvents,
                                                                      ze_event_handle_t *phWaitEvents,
                                                                      CmdListKernelLaunchParams &launchParams, bool relaxedOrderingDispatch) {
+    RelocatableAppendScope relocatableAppend(*this);
 
     NEO::Device *neoDevice = device->getNEODevice();
     uint32_t callId = 0;
@@ -371,8 +384,18 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernel(ze_kernel_h
         callId = neoDevice->getRootDeviceEnvironment().tagsManager->currentCallCount;
     }
 
+    MutableKernelCommand *mutableCommand = nullptr;
+    if (this->pendingMutableCommandId.has_value() && !launchParams.isBuiltInKernel) {
+        mutableCommand = &this->mutableKernelCommands[*this->pendingMutableCommandId];
+        this->pendingMutableCommandId.reset();
+        this->mutableEventSites.clear();
+        this->mutableEventSitesComplete = true;
+    }
+
+    this->currentMutableCommand = mutableCommand;
     ze_result_t ret = addEventsToCmdList(numWaitEvents, phWaitEvents, launchParams.outListCommands, relaxedOrderingDispatch, true, true, launchParams.omitAddingWaitEventsResidency);
     if (ret) {
+        this->currentMutableCommand = nullptr;
         return ret;
     }
 
@@ -385,17 +408,23 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernel(ze_kernel_h
     }
 
     if (!handleCounterBasedEventOperations(event)) {
+        this->currentMutableCommand = nullptr;
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
     auto res = appendLaunchKernelWithParams(Kernel::fromHandle(kernelHandle), threadGroupDimensions,
                                             event, launchParams);
+    this->currentMutableCommand = nullptr;
 
     if (!launchParams.skipInOrderNonWalkerSignaling) {
         handleInOrderDependencyCounter(event, isInOrderNonWalkerSignalingRequired(event));
     }
 
     addToMappedEventList(event);
+
+    if (mutableCommand && mutableCommand->walker && res == ZE_RESULT_SUCCESS) {
+        recordMutableCommandEvents(*mutableCommand, event, numWaitEvents, phWaitEvents);
+    }
     if (NEO::debugManager.flags.EnableSWTags.get()) {
         neoDevice->getRootDeviceEnvironment().tagsManager->insertTag<GfxFamily, NEO::SWTags::CallNameEndTag>(
             *commandContainer.getCommandStream(),
@@ -413,6 +442,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchCooperativeKernel(
                                                                                 ze_event_handle_t hSignalEvent,
                                                                                 uint32_t numWaitEvents,
                                                                                 ze_event_handle_t *waitEventHandles, bool relaxedOrderingDispatch) {
+    this->pendingMutableCommandId.reset();
 
     ze_result_t ret = addEventsToCmdList(numWaitEvents, waitEventHandles, nullptr, relaxedOrderingDispatch, true, true, false);
     if (ret) {
@@ -447,6 +477,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelIndirect(ze_
                                                                              ze_event_handle_t hEvent,
                                                                              uint32_t numWaitEvents,
                                                                              ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    this->pendingMutableCommandId.reset();
 
     ze_result_t ret = addEventsToCmdList(numWaitEvents, phWaitEvents, nullptr, relaxedOrderingDispatch, true, true, false);
     if (ret) {
@@ -490,6 +521,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchMultipleKernelsInd
                                                                                       ze_event_handle_t hEvent,
                                                                                       uint32_t numWaitEvents,
                                                                                       ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    this->pendingMutableCommandId.reset();
 
     ze_result_t ret = addEventsToCmdList(numWaitEvents, phWaitEvents, nullptr, relaxedOrderingDispatch, true, true, false);
     if (ret) {
@@ -533,6 +565,8 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchMultipleKernelsInd
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendEventReset(ze_event_handle_t hEvent) {
+    this->pendingMutableCommandId.reset();
+    RelocatableAppendScope relocatableAppend(*this);
     auto event = Event::fromHandle(hEvent);
 
     event->disableImplicitCounterBasedMode();
@@ -595,6 +629,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryRangesBarrier(uint
                                                                             ze_event_handle_t hSignalEvent,
                                                                             uint32_t numWaitEvents,
                                                                             ze_event_handle_t *phWaitEvents) {
+    this->pendingMutableCommandId.reset();
 
     ze_result_t ret = addEventsToCmdList(numWaitEvents, phWaitEvents, nullptr, false, true, true, false);
     if (ret) {
@@ -630,6 +665,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendImageCopyFromMemory(ze_i
                                                                             ze_event_handle_t hEvent,
                                                                             uint32_t numWaitEvents,
                                                                             ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    this->pendingMutableCommandId.reset();
 
     auto image = Image::fromHandle(hDstImage);
     auto bytesPerPixel = static_cast<uint32_t>(image->getImageInfo().surfaceFormat->imageElementSizeInBytes);
@@ -782,6 +818,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendImageCopyToMemory(void *
                                                                           ze_event_handle_t hEvent,
                                                                           uint32_t numWaitEvents,
                                                                           ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    this->pendingMutableCommandId.reset();
 
     auto image = Image::fromHandle(hSrcImage);
     auto bytesPerPixel = static_cast<uint32_t>(image->getImageInfo().surfaceFormat->imageElementSizeInBytes);
@@ -942,6 +979,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendImageCopyRegion(ze_image
                                                                         ze_event_handle_t hEvent,
                                                                         uint32_t numWaitEvents,
                                                                         ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    this->pendingMutableCommandId.reset();
     auto dstImage = L0::Image::fromHandle(hDstImage);
     auto srcImage = L0::Image::fromHandle(hSrcImage);
     cl_int4 srcOffset, dstOffset;
@@ -1084,6 +1122,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendImageCopy(ze_image_handl
                                                                   ze_event_handle_t hEvent,
                                                                   uint32_t numWaitEvents,
                                                                   ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    this->pendingMutableCommandId.reset();
 
     return this->appendImageCopyRegion(hDstImage, hSrcImage, nullptr, nullptr, hEvent,
                                        numWaitEvents, phWaitEvents, relaxedOrderingDispatch);
@@ -1093,6 +1132,7 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemAdvise(ze_device_handle_t hDevice,
                                                                   const void *ptr, size_t size,
                                                                   ze_memory_advice_t advice) {
+    this->pendingMutableCommandId.reset();
     NEO::MemAdviseFlags flags{};
 
     auto allocData = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
@@ -1382,6 +1422,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopy(void *dstptr,
                                                                    uint32_t numWaitEvents,
                                                                    ze_event_handle_t *phWaitEvents,
                                                                    bool relaxedOrderingDispatch, bool forceDisableCopyOnlyInOrderSignaling) {
+    this->pendingMutableCommandId.reset();
     const bool inOrderCopyOnlySignalingAllowed = this->isInOrderExecutionEnabled() && !forceDisableCopyOnlyInOrderSignaling && isCopyOnly();
 
     NEO::Device *neoDevice = device->getNEODevice();
@@ -1581,6 +1622,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopyRegion(void *d
                                                                          uint32_t numWaitEvents,
                                                                          ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch,
                                                                          bool forceDisableCopyOnlyInOrderSignaling) {
+    this->pendingMutableCommandId.reset();
 
     const bool inOrderCopyOnlySignalingAllowed = this->isInOrderExecutionEnabled() && !forceDisableCopyOnlyInOrderSignaling && isCopyOnly();
 
@@ -1809,6 +1851,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopyKernel2d(Align
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryPrefetch(const void *ptr,
                                                                        size_t count) {
+    this->pendingMutableCommandId.reset();
     auto allocData = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(ptr);
     if (allocData) {
         return ZE_RESULT_SUCCESS;
@@ -1848,6 +1891,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryFill(void *ptr,
                                                                    ze_event_handle_t hSignalEvent,
                                                                    uint32_t numWaitEvents,
                                                                    ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    this->pendingMutableCommandId.reset();
     bool isStateless = false;
     const bool isHeapless = this->isHeaplessModeEnabled();
 
@@ -2359,6 +2403,8 @@ inline ze_result_t CommandListCoreFamily<gfxCoreFamily>::addEventsToCmdList(uint
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendSignalEvent(ze_event_handle_t hEvent) {
+    this->pendingMutableCommandId.reset();
+    RelocatableAppendScope relocatableAppend(*this);
     if (this->isInOrderExecutionEnabled()) {
         handleInOrderImplicitDependencies(isRelaxedOrderingDispatchAllowed(0));
     }
@@ -2509,6 +2555,8 @@ bool CommandListCoreFamily<gfxCoreFamily>::canSkipInOrderEventWait(Event &event,
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendWaitOnEvents(uint32_t numEvents, ze_event_handle_t *phEvent, CommandToPatchContainer *outWaitCmds,
                                                                      bool relaxedOrderingAllowed, bool trackDependencies, bool apiRequest, bool skipAddingWaitEventsToResidency) {
+    this->pendingMutableCommandId.reset();
+    RelocatableAppendScope relocatableAppend(*this);
     NEO::Device *neoDevice = device->getNEODevice();
     uint32_t callId = 0;
     if (NEO::debugManager.flags.EnableSWTags.get()) {
@@ -2675,7 +2723,7 @@ void CommandListCoreFamily<gfxCoreFamily>::appendWriteKernelTimestamp(Event *eve
     void *globalPostSyncCmd = nullptr;
     void *contextPostSyncCmd = nullptr;
 
-    if (outTimeStampSyncCmds != nullptr) {
+    if (outTimeStampSyncCmds != nullptr || this->currentMutableCommand || this->relocatableRecording) {
         globalPostSyncCmdBuffer = &globalPostSyncCmd;
         contextPostSyncCmdBuffer = &contextPostSyncCmd;
     }
@@ -2690,6 +2738,8 @@ void CommandListCoreFamily<gfxCoreFamily>::appendWriteKernelTimestamp(Event *eve
         NEO::EncodeStoreMMIO<GfxFamily>::encode(*commandContainer.getCommandStream(), RegisterOffsets::globalTimestampLdw, globalAddress, workloadPartition, globalPostSyncCmdBuffer);
         NEO::EncodeStoreMMIO<GfxFamily>::encode(*commandContainer.getCommandStream(), RegisterOffsets::gpThreadTimeRegAddressOffsetLow, contextAddress, workloadPartition, contextPostSyncCmdBuffer);
     }
+    recordEventAddressSite(CommandToPatch::TimestampEventPostSyncStoreRegMem, globalPostSyncCmd);
+    recordEventAddressSite(CommandToPatch::TimestampEventPostSyncStoreRegMem, contextPostSyncCmd);
 
     if (outTimeStampSyncCmds != nullptr) {
         CommandToPatch ctxCmd;
@@ -2746,6 +2796,9 @@ void CommandListCoreFamily<gfxCoreFamily>::appendEventForProfiling(Event *event,
 
             uint64_t baseAddr = event->getGpuAddress(this->device);
             NEO::MemorySynchronizationCommands<GfxFamily>::addAdditionalSynchronization(*commandContainer.getCommandStream(), baseAddr, false, rootDeviceEnvironment);
+            if (NEO::MemorySynchronizationCommands<GfxFamily>::getSizeForSingleAdditionalSynchronization(rootDeviceEnvironment) > 0) {
+                recordEventAddressSite(CommandToPatch::TimestampEventPostSyncStoreRegMem, nullptr);
+            }
             appendWriteKernelTimestamp(event, outTimeStampSyncCmds, beforeWalker, true, workloadPartition);
         }
 
@@ -2757,6 +2810,7 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendWriteGlobalTimestamp(
     uint64_t *dstptr, ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    this->pendingMutableCommandId.reset();
 
     ze_result_t ret = addEventsToCmdList(numWaitEvents, phWaitEvents, nullptr, false, true, true, false);
     if (ret != ZE_RESULT_SUCCESS) {
@@ -2814,6 +2868,7 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopyFromContext(
     void *dstptr, ze_context_handle_t hContextSrc, const void *srcptr,
     size_t size, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    this->pendingMutableCommandId.reset();
 
     return CommandListCoreFamily<gfxCoreFamily>::appendMemoryCopy(dstptr, srcptr, size, hSignalEvent, numWaitEvents, phWaitEvents, relaxedOrderingDispatch, false);
 }
@@ -2823,6 +2878,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendQueryKernelTimestamps(
     uint32_t numEvents, ze_event_handle_t *phEvents, void *dstptr,
     const size_t *pOffsets, ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    this->pendingMutableCommandId.reset();
 
     auto dstPtrAllocationStruct = getAlignedAllocationData(this->device, dstptr, sizeof(ze_kernel_timestamp_result_t) * numEvents, false);
     if (dstPtrAllocationStruct.alloc == nullptr) {
@@ -3267,6 +3323,10 @@ void CommandListCoreFamily<gfxCoreFamily>::programStateBaseAddress(NEO::CommandC
     };
 
     NEO::EncodeStateBaseAddress<GfxFamily>::encode(encodeStateBaseAddressArgs);
+    // heap base addresses are relocated only when programmed by command queue from stream properties
+    if (this->relocatableRecording) {
+        this->relocatableRecordingComplete = false;
+    }
 
     bool sbaTrackingEnabled = NEO::Debugger::isDebugEnabled(this->internalUsage) && this->device->getL0Debugger();
     NEO::EncodeStateBaseAddress<GfxFamily>::setSbaTrackingForL0DebuggerIfEnabled(sbaTrackingEnabled,
@@ -3296,6 +3356,8 @@ bool CommandListCoreFamily<gfxCoreFamily>::isSkippingInOrderBarrierAllowed(ze_ev
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendBarrier(ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    this->pendingMutableCommandId.reset();
+    RelocatableAppendScope relocatableAppend(*this);
     if (isInOrderExecutionEnabled() && isSkippingInOrderBarrierAllowed(hSignalEvent, numWaitEvents, phWaitEvents)) {
         if (hSignalEvent) {
             Event::fromHandle(hSignalEvent)->updateInOrderExecState(inOrderExecInfo, inOrderExecInfo->getCounterValue(), inOrderExecInfo->getAllocationOffset());
@@ -3426,8 +3488,10 @@ void CommandListCoreFamily<gfxCoreFamily>::setupFillKernelArguments(size_t baseO
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendWaitOnMemory(void *desc, void *ptr, uint64_t data, ze_event_handle_t signalEventHandle, bool useQwordData) {
+    this->pendingMutableCommandId.reset();
     using COMPARE_OPERATION = typename GfxFamily::MI_SEMAPHORE_WAIT::COMPARE_OPERATION;
 
+    RelocatableAppendScope relocatableAppend(*this);
     auto descriptor = reinterpret_cast<zex_wait_on_mem_desc_t *>(desc);
     COMPARE_OPERATION comparator;
     switch (descriptor->actionFlag) {
@@ -3493,7 +3557,9 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendWaitOnMemory(void *desc,
         UNRECOVERABLE_IF(getHighPart(data) != 0);
     }
 
-    NEO::EncodeSemaphore<GfxFamily>::addMiSemaphoreWaitCommand(*commandContainer.getCommandStream(), gpuAddress, data, comparator, false, useQwordData, indirectMode, nullptr);
+    void *semaphoreCmd = nullptr;
+    NEO::EncodeSemaphore<GfxFamily>::addMiSemaphoreWaitCommand(*commandContainer.getCommandStream(), gpuAddress, data, comparator, false, useQwordData, indirectMode, &semaphoreCmd);
+    recordRelocatableCommandAddress(CommandToPatch::WaitEventSemaphoreWait, semaphoreCmd);
 
     const auto &rootDeviceEnvironment = this->device->getNEODevice()->getRootDeviceEnvironment();
     auto allocType = srcAllocationStruct.alloc->getAllocationType();
@@ -3502,6 +3568,9 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendWaitOnMemory(void *desc,
         (allocType == NEO::AllocationType::externalHostPtr);
     if (isSystemMemoryUsed) {
         NEO::MemorySynchronizationCommands<GfxFamily>::addAdditionalSynchronization(*commandContainer.getCommandStream(), gpuAddress, true, rootDeviceEnvironment);
+        if (NEO::MemorySynchronizationCommands<GfxFamily>::getSizeForSingleAdditionalSynchronization(rootDeviceEnvironment) > 0) {
+            recordRelocatableCommandAddress(CommandToPatch::WaitEventSemaphoreWait, nullptr);
+        }
     }
 
     appendSignalEventPostWalker(signalEvent, nullptr, nullptr, false, false);
@@ -3518,6 +3587,8 @@ template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendWriteToMemory(void *desc,
                                                                       void *ptr,
                                                                       uint64_t data) {
+    this->pendingMutableCommandId.reset();
+    RelocatableAppendScope relocatableAppend(*this);
     auto descriptor = reinterpret_cast<zex_write_to_mem_desc_t *>(desc);
 
     size_t bufSize = sizeof(uint64_t);
@@ -3539,6 +3610,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendWriteToMemory(void *desc
         args.commandWithPostSync = true;
         encodeMiFlush(gpuAddress,
                       data, args);
+        recordRelocatableCommandAddress(CommandToPatch::SignalEventPostSyncStoreDataImm, nullptr);
     } else {
         NEO::PipeControlArgs args;
         args.dcFlushEnable = getDcFlushRequired(!!descriptor->writeScope);
@@ -3551,6 +3623,7 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendWriteToMemory(void *desc
             data,
             device->getNEODevice()->getRootDeviceEnvironment(),
             args);
+        recordRelocatableCommandAddress(CommandToPatch::SignalEventPostSyncPipeControl, getTrackedBarrierPostSync(args.postSyncCmd));
     }
 
     if (this->isInOrderExecutionEnabled()) {
@@ -3645,12 +3718,14 @@ void CommandListCoreFamily<gfxCoreFamily>::dispatchPostSyncCommands(const CmdLis
 
     void **outCmdBuffer = nullptr;
     void *outCmd = nullptr;
-    if (outListCommands != nullptr) {
+    if (outListCommands != nullptr || this->currentMutableCommand || this->relocatableRecording) {
         outCmdBuffer = &outCmd;
     }
 
     for (uint32_t i = 0; i < operationCount; i++) {
+        outCmd = nullptr;
         (this->*dispatchFunction)(gpuAddress, value, eventOperations.workPartitionOperation, outCmdBuffer);
+        recordEventAddressSite(CommandToPatch::SignalEventPostSyncStoreDataImm, outCmd);
         if (outListCommands != nullptr) {
             auto &cmdToPatch = outListCommands->emplace_back();
             cmdToPatch.type = CommandToPatch::CbEventTimestampClearStoreDataImm;
@@ -3686,6 +3761,7 @@ void CommandListCoreFamily<gfxCoreFamily>::dispatchPostSyncCommands(const CmdLis
         if (syncCmdBuffer != nullptr) {
             *syncCmdBuffer = pipeControlArgs.postSyncCmd;
         }
+        recordEventBarrierSite(pipeControlArgs.postSyncCmd);
     }
 
     if (eventOperations.isTimestmapEvent && !skipPartitionOffsetProgramming) {
@@ -3733,7 +3809,7 @@ void CommandListCoreFamily<gfxCoreFamily>::appendWaitOnSingleEvent(Event *event,
 
     void **outSemWaitCmdBuffer = nullptr;
     void *outSemWaitCmd = nullptr;
-    if (outWaitCmds != nullptr) {
+    if (outWaitCmds != nullptr || this->currentMutableCommand || this->relocatableRecording) {
         outSemWaitCmdBuffer = &outSemWaitCmd;
     }
 
@@ -3741,11 +3817,13 @@ void CommandListCoreFamily<gfxCoreFamily>::appendWaitOnSingleEvent(Event *event,
         if (relaxedOrderingAllowed) {
             NEO::EncodeBatchBufferStartOrEnd<GfxFamily>::programConditionalDataMemBatchBufferStart(*commandContainer.getCommandStream(), 0, gpuAddr, Event::STATE_CLEARED,
                                                                                                    NEO::CompareOperation::equal, true, false);
+            recordEventAddressSite(CommandToPatch::WaitEventSemaphoreWait, nullptr);
         } else {
             NEO::EncodeSemaphore<GfxFamily>::addMiSemaphoreWaitCommand(*commandContainer.getCommandStream(),
                                                                        gpuAddr,
                                                                        Event::STATE_CLEARED,
                                                                        COMPARE_OPERATION::COMPARE_OPERATION_SAD_NOT_EQUAL_SDD, false, false, false, outSemWaitCmdBuffer);
+            recordEventAddressSite(CommandToPatch::WaitEventSemaphoreWait, outSemWaitCmd);
 
             if (outWaitCmds != nullptr) {
                 auto &semWaitCmd = outWaitCmds->emplace_back();
@@ -3788,6 +3866,39 @@ void CommandListCoreFamily<gfxCoreFamily>::patchInOrderCmds() {
         }
     }
 }
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+uint32_t CommandListCoreFamily<gfxCoreFamily>::getCommandAddressDwordOffset(CommandToPatch::CommandType type) {
+    // first dword of 64-bit address programmed by command
+    switch (type) {
+    case CommandToPatch::SignalEventPostSyncStoreDataImm:
+        return 1u;
+    case CommandToPatch::WaitEventSemaphoreWait:
+    case CommandToPatch::TimestampEventPostSyncStoreRegMem:
+    case CommandToPatch::SignalEventPostSyncPipeControl:
+        return 2u;
+    default:
+        UNRECOVERABLE_IF(true);
+        return 0u;
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void *CommandListCoreFamily<gfxCoreFamily>::getTrackedBarrierPostSync(void *postSyncCmd) const {
+    // additional synchronization of barrier workaround also uses post sync address and is not tracked
+    const auto &rootDeviceEnvironment = this->device->getNEODevice()->getRootDeviceEnvironment();
+    if (NEO::MemorySynchronizationCommands<GfxFamily>::isBarrierWaRequired(rootDeviceEnvironment) &&
+        NEO::MemorySynchronizationCommands<GfxFamily>::getSizeForSingleAdditionalSynchronization(rootDeviceEnvironment) > 0) {
+        return nullptr;
+    }
+    return postSyncCmd;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::recordEventBarrierSite(void *postSyncCmd) {
+    recordEventAddressSite(CommandToPatch::SignalEventPostSyncPipeControl, getTrackedBarrierPostSync(postSyncCmd));
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 bool CommandListCoreFamily<gfxCoreFamily>::hasInOrderDependencies() const {
     return (inOrderExecInfo.get() && inOrderExecInfo->getCounterValue() > 0);
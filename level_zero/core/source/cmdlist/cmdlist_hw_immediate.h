@@ -38,6 +38,46 @@ struct CpuMemCopyInfo {
     CpuMemCopyInfo(void *dstPtr, void *srcPtr, size_t size) : dstPtr(dstPtr), srcPtr(srcPtr), size(size) {}
 };
 
+// Kernel launch deferred by immediate command list capture
+struct CapturedKernelAppend {
+    Kernel *kernel = nullptr;
+    const NEO::GraphicsAllocation *isaAllocation = nullptr;
+    uint64_t isaOffset = 0;
+    ze_group_count_t groupCount = {};
+    uint32_t groupSize[3] = {};
+    uint32_t slmTotalSize = 0;
+    uint32_t numThreadsPerThreadGroup = 0;
+    uint32_t perThreadDataSize = 0;
+    uint32_t threadExecutionMask = 0;
+    uint32_t requiredWorkgroupOrder = 0;
+    std::vector<uint8_t> crossThreadData;
+    std::vector<NEO::GraphicsAllocation *> residency;
+
+    // Launches with the same kernel, dispatch dimensions and SLM size are encoded the same way, except for cross thread data
+    bool isSameLaunch(const CapturedKernelAppend &other) const {
+        return kernel == other.kernel && isaAllocation == other.isaAllocation && isaOffset == other.isaOffset &&
+               groupCount.groupCountX == other.groupCount.groupCountX && groupCount.groupCountY == other.groupCount.groupCountY && groupCount.groupCountZ == other.groupCount.groupCountZ &&
+               groupSize[0] == other.groupSize[0] && groupSize[1] == other.groupSize[1] && groupSize[2] == other.groupSize[2] &&
+               slmTotalSize == other.slmTotalSize && numThreadsPerThreadGroup == other.numThreadsPerThreadGroup &&
+               perThreadDataSize == other.perThreadDataSize && threadExecutionMask == other.threadExecutionMask &&
+               requiredWorkgroupOrder == other.requiredWorkgroupOrder &&
+               crossThreadData.size() == other.crossThreadData.size();
+    }
+};
+
+// Regular command list recorded from a sequence of captured launches, i-th launch has command id i
+struct CapturedSequence {
+    std::vector<CapturedKernelAppend> launches;
+    CommandListImp *commandList = nullptr;
+    size_t baseResidencySize = 0;
+    TaskCountType taskCount = 0;
+};
+
+struct CapturedSequenceStatistics {
+    uint32_t hits = 0;   // flushes replaying existing recording
+    uint32_t misses = 0; // flushes recording new sequence
+};
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFamily> {
     using GfxFamily = typename NEO::GfxFamilyMapper<gfxCoreFamily>::GfxFamily;
@@ -157,6 +197,8 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     ze_result_t appendWriteToMemory(void *desc, void *ptr,
                                     uint64_t data) override;
 
+    ze_result_t destroy() override;
+
     ze_result_t hostSynchronize(uint64_t timeout) override;
 
     ze_result_t close() override {
@@ -180,6 +222,11 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     bool isSuitableUSMDeviceAlloc(NEO::SvmAllocationData *alloc);
     bool isSuitableUSMSharedAlloc(NEO::SvmAllocationData *alloc);
     ze_result_t performCpuMemcpy(const CpuMemCopyInfo &cpuMemCopyInfo, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents);
+    bool preferImageCopyOnCpu(ze_image_handle_t hImage, const void *hostPtr, const ze_image_region_t *pImageRegion);
+    ze_result_t performCpuImageCopy(ze_image_handle_t hImage, void *hostPtr, const ze_image_region_t *pImageRegion, bool toImage,
+                                    ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents);
+    template <typename CopyFunctionT>
+    ze_result_t performCpuCopy(CopyFunctionT &&copyFunction, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents);
     void *obtainLockedPtrFromDevice(NEO::SvmAllocationData *alloc, void *ptr, bool &lockingFailed);
     bool waitForEventsFromHost();
     TransferType getTransferType(const CpuMemCopyInfo &cpuMemCopyInfo);
@@ -188,6 +235,10 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     bool isRelaxedOrderingDispatchAllowed(uint32_t numWaitEvents) const override;
     bool skipInOrderNonWalkerSignalingAllowed(ze_event_handle_t signalEvent) const override;
 
+    const CapturedSequenceStatistics &getCaptureStatistics() const {
+        return captureStatistics;
+    }
+
   protected:
     using BaseClass::inOrderExecInfo;
 
@@ -198,11 +249,25 @@ struct CommandListCoreFamilyImmediate : public CommandListCoreFamily<gfxCoreFami
     void setupFlushMethod(const NEO::RootDeviceEnvironment &rootDeviceEnvironment) override;
     void allocateOrReuseKernelPrivateMemoryIfNeeded(Kernel *kernel, uint32_t sizePerHwThread) override;
     void handleInOrderNonWalkerSignaling(Event *event, bool &hasStallingCmds, bool &relaxedOrderingDispatch, ze_result_t &result);
+    bool isLaunchCaptureAllowed(Kernel *kernel, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, const CmdListKernelLaunchParams &launchParams) const;
+    ze_result_t captureLaunchKernel(Kernel *kernel, const ze_group_count_t &threadGroupDimensions);
+    ze_result_t flushCapturedLaunches();
+    ze_result_t recordCapturedSequence(CapturedSequence &sequence);
+    bool isCapturedSequenceIdle(const CapturedSequence &sequence);
+    void waitForCapturedSequence(const CapturedSequence &sequence);
+    void markCapturedAllocationsPending(const NEO::ResidencyContainer &residency);
 
     MOCKABLE_VIRTUAL void checkAssert();
     ComputeFlushMethodType computeFlushMethod = nullptr;
     std::atomic<bool> dependenciesPresent{false};
     bool latestFlushIsHostVisible = false;
+
+    static constexpr size_t maxCapturedLaunches = 64;
+    static constexpr size_t maxCapturedSequences = 8;
+    std::vector<CapturedKernelAppend> capturedLaunches;
+    std::vector<CapturedSequence> capturedSequences;
+    CapturedSequenceStatistics captureStatistics;
+    TaskCountType capturedLaunchesTaskCount = 0;
 };
 
 template <PRODUCT_FAMILY gfxProductFamily>
@@ -16,12 +16,14 @@
 #include "shared/source/debugger/debugger_l0.h"
 #include "shared/source/device/device.h"
 #include "shared/source/direct_submission/relaxed_ordering_helper.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/helpers/api_specific_config.h"
 #include "shared/source/helpers/bindless_heaps_helper.h"
 #include "shared/source/helpers/blit_commands_helper.h"
 #include "shared/source/helpers/completion_stamp.h"
 #include "shared/source/helpers/in_order_cmd_helpers.h"
 #include "shared/source/helpers/surface_format_info.h"
+#include "shared/source/helpers/tiled_image_copy.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
@@ -39,6 +41,7 @@
 
 #include "encode_surface_state_args.h"
 
+#include <algorithm>
 #include <cmath>
 
 namespace L0 {
@@ -50,6 +53,9 @@ CommandListCoreFamilyImmediate<gfxCoreFamily>::CommandListCoreFamilyImmediate(ui
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 void CommandListCoreFamilyImmediate<gfxCoreFamily>::checkAvailableSpace(uint32_t numEvents, bool hasRelaxedOrderingDependencies, size_t commandSize) {
+    // every other operation has to be submitted after the launches deferred by capture
+    this->flushCapturedLaunches();
+
     this->commandContainer.fillReusableAllocationLists();
 
     /* Command container might has two command buffers. If it has, one is in local memory, because relaxed ordering requires that and one in system for copying it into ring buffer.
@@ -432,6 +438,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendLaunchKernel(
     ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents,
     CmdListKernelLaunchParams &launchParams, bool relaxedOrderingDispatch) {
 
+    if (isLaunchCaptureAllowed(Kernel::fromHandle(kernelHandle), hSignalEvent, numWaitEvents, launchParams)) {
+        return captureLaunchKernel(Kernel::fromHandle(kernelHandle), threadGroupDimensions);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
     bool stallingCmdsForRelaxedOrdering = hasStallingCmdsForRelaxedOrdering(numWaitEvents, relaxedOrderingDispatch);
 
@@ -774,6 +784,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyFromMe
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (preferImageCopyOnCpu(hDstImage, srcPtr, pDstRegion)) {
+        return performCpuImageCopy(hDstImage, const_cast<void *>(srcPtr), pDstRegion, true, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -792,6 +806,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::appendImageCopyToMemo
     ze_event_handle_t hSignalEvent,
     uint32_t numWaitEvents,
     ze_event_handle_t *phWaitEvents, bool relaxedOrderingDispatch) {
+    if (preferImageCopyOnCpu(hSrcImage, dstPtr, pSrcRegion)) {
+        return performCpuImageCopy(hSrcImage, dstPtr, pSrcRegion, false, hSignalEvent, numWaitEvents, phWaitEvents);
+    }
+
     relaxedOrderingDispatch = isRelaxedOrderingDispatchAllowed(numWaitEvents);
 
     checkAvailableSpace(numWaitEvents, relaxedOrderingDispatch, commonImmediateCommandSize);
@@ -894,6 +912,10 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::hostSynchronize(uint6
 
 template <GFXCORE_FAMILY gfxCoreFamily>
 ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::hostSynchronize(uint64_t timeout) {
+    auto ret = flushCapturedLaunches();
+    if (ret != ZE_RESULT_SUCCESS) {
+        return ret;
+    }
     return hostSynchronize(timeout, this->cmdQImmediate->getTaskCount(), true);
 }
 
@@ -1011,6 +1033,16 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performCpuMemcpy(cons
         return ZE_RESULT_ERROR_UNKNOWN;
     }
 
+    const void *cpuMemcpySrcPtr = srcLockPointer ? srcLockPointer : cpuMemCopyInfo.srcPtr;
+    void *cpuMemcpyDstPtr = dstLockPointer ? dstLockPointer : cpuMemCopyInfo.dstPtr;
+
+    return performCpuCopy([&]() { memcpy_s(cpuMemcpyDstPtr, cpuMemCopyInfo.size, cpuMemcpySrcPtr, cpuMemCopyInfo.size); },
+                          hSignalEvent, numWaitEvents, phWaitEvents);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+template <typename CopyFunctionT>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performCpuCopy(CopyFunctionT &&copyFunction, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
     if (isInOrderExecutionEnabled()) {
         this->dependenciesPresent = false; // wait only for waitlist and in-order sync value
     }
@@ -1046,9 +1078,6 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performCpuMemcpy(cons
         return ZE_RESULT_ERROR_INVALID_ARGUMENT;
     }
 
-    const void *cpuMemcpySrcPtr = srcLockPointer ? srcLockPointer : cpuMemCopyInfo.srcPtr;
-    void *cpuMemcpyDstPtr = dstLockPointer ? dstLockPointer : cpuMemCopyInfo.dstPtr;
-
     if (this->dependenciesPresent || isInOrderExecutionEnabled()) {
         auto waitStatus = hostSynchronize(std::numeric_limits<uint64_t>::max(), this->cmdQImmediate->getTaskCount(), false);
 
@@ -1064,7 +1093,7 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performCpuMemcpy(cons
         signalEvent->setGpuStartTimestamp();
     }
 
-    memcpy_s(cpuMemcpyDstPtr, cpuMemCopyInfo.size, cpuMemcpySrcPtr, cpuMemCopyInfo.size);
+    copyFunction();
 
     if (signalEvent) {
         signalEvent->setGpuEndTimestamp();
@@ -1080,6 +1109,88 @@ ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performCpuMemcpy(cons
     return ZE_RESULT_SUCCESS;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::preferImageCopyOnCpu(ze_image_handle_t hImage, const void *hostPtr, const ze_image_region_t *pImageRegion) {
+    if (NEO::debugManager.flags.EnableCpuTiledImageCopy.get() != 1) {
+        return false;
+    }
+
+    auto image = Image::fromHandle(hImage);
+    auto imageInfo = image->getImageInfo();
+    auto imageType = imageInfo.imgDesc.imageType;
+    if (imageType != NEO::ImageType::image2D && imageType != NEO::ImageType::image2DArray && imageType != NEO::ImageType::image3D) {
+        return false;
+    }
+    if (imageInfo.imgDesc.numMipLevels > 1 || imageInfo.plane != GMM_NO_PLANE || imageInfo.rowPitch == 0u || imageInfo.slicePitch % imageInfo.rowPitch != 0u) {
+        return false;
+    }
+
+    if (pImageRegion && (pImageRegion->width == 0u || pImageRegion->height == 0u || pImageRegion->depth == 0u)) {
+        return false;
+    }
+
+    auto allocation = image->getAllocation();
+    if (allocation->getRootDeviceIndex() != this->device->getRootDeviceIndex()) {
+        return false;
+    }
+
+    // host side of the copy must be CPU accessible
+    auto hostPtrSize = pImageRegion ? pImageRegion->width * pImageRegion->height * pImageRegion->depth * imageInfo.surfaceFormat->imageElementSizeInBytes : imageInfo.size;
+    NEO::SvmAllocationData *allocData = nullptr;
+    this->device->getDriverHandle()->findAllocationDataForRange(hostPtr, hostPtrSize, allocData);
+    if (allocData && allocData->memoryType == InternalMemoryType::deviceUnifiedMemory) {
+        return false;
+    }
+
+    auto tilingMode = NEO::TiledImageCopy::getTilingModeForCpuAccess(*allocation);
+    if (!NEO::TiledImageCopy::isTilingModeSupported(tilingMode) || imageInfo.rowPitch % NEO::TiledImageCopy::getTileWidthInBytes(tilingMode) != 0u) {
+        return false;
+    }
+    return NEO::TiledImageCopy::getCpuPtrForImageAccess(*allocation, *this->device->getNEODevice()->getMemoryManager()) != nullptr;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::performCpuImageCopy(ze_image_handle_t hImage, void *hostPtr, const ze_image_region_t *pImageRegion, bool toImage,
+                                                                             ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    auto image = Image::fromHandle(hImage);
+    auto imageInfo = image->getImageInfo();
+    auto allocation = image->getAllocation();
+    auto elementSize = imageInfo.surfaceFormat->imageElementSizeInBytes;
+
+    ze_image_region_t region = {0, 0, 0, static_cast<uint32_t>(imageInfo.imgDesc.imageWidth), static_cast<uint32_t>(imageInfo.imgDesc.imageHeight), 1};
+    if (pImageRegion) {
+        region = *pImageRegion;
+    } else if (imageInfo.imgDesc.imageType == NEO::ImageType::image3D) {
+        region.depth = static_cast<uint32_t>(imageInfo.imgDesc.imageDepth);
+    }
+
+    NEO::TiledImageCopyParams params;
+    params.tiledPtr = NEO::TiledImageCopy::getCpuPtrForImageAccess(*allocation, *this->device->getNEODevice()->getMemoryManager());
+    params.linearPtr = hostPtr;
+    params.tiledRowPitch = imageInfo.rowPitch;
+    params.tiledQPitch = imageInfo.slicePitch / imageInfo.rowPitch;
+    params.linearRowPitch = region.width * elementSize;
+    params.linearSlicePitch = params.linearRowPitch * region.height;
+    params.tiledOrigin[0] = region.originX * elementSize;
+    params.tiledOrigin[1] = region.originY;
+    params.tiledOrigin[2] = region.originZ;
+    params.region[0] = region.width * elementSize;
+    params.region[1] = region.height;
+    params.region[2] = region.depth;
+    params.tilingMode = NEO::TiledImageCopy::getTilingModeForCpuAccess(*allocation);
+
+    auto threadsCount = NEO::TiledImageCopy::getThreadsCountForCopy(params);
+    auto threadPool = (threadsCount > 1u) ? this->device->getNEODevice()->getExecutionEnvironment()->getThreadPool() : nullptr;
+    auto copyFunction = [&]() {
+        if (toImage) {
+            NEO::TiledImageCopy::copyLinearToTiled(params, threadsCount, threadPool);
+        } else {
+            NEO::TiledImageCopy::copyTiledToLinear(params, threadsCount, threadPool);
+        }
+    };
+    return performCpuCopy(copyFunction, hSignalEvent, numWaitEvents, phWaitEvents);
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 void *CommandListCoreFamilyImmediate<gfxCoreFamily>::obtainLockedPtrFromDevice(NEO::SvmAllocationData *allocData, void *ptr, bool &lockingFailed) {
     if (!allocData) {
@@ -1335,4 +1446,198 @@ void CommandListCoreFamilyImmediate<gfxCoreFamily>::allocateOrReuseKernelPrivate
     }
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::destroy() {
+    flushCapturedLaunches();
+    for (auto &sequence : capturedSequences) {
+        waitForCapturedSequence(sequence);
+        sequence.commandList->destroy();
+    }
+    if (NEO::debugManager.flags.PrintImmediateCmdListCaptureStatistics.get() && (captureStatistics.hits + captureStatistics.misses) > 0) {
+        printf("\nImmediate command list capture: replayed %u, recorded %u sequences\n", captureStatistics.hits, captureStatistics.misses);
+    }
+    capturedSequences.clear();
+    return BaseClass::destroy();
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isLaunchCaptureAllowed(Kernel *kernel, ze_event_handle_t hSignalEvent, uint32_t numWaitEvents, const CmdListKernelLaunchParams &launchParams) const {
+    if (NEO::debugManager.flags.EnableImmediateCmdListCapture.get() != 1) {
+        return false;
+    }
+    // deferred launch must not be observable before next synchronization
+    if (hSignalEvent || numWaitEvents > 0 || this->isSyncModeQueue || isInOrderExecutionEnabled() || isCopyOnly() || this->internalUsage || this->partitionCount > 1) {
+        return false;
+    }
+    if (launchParams.isBuiltInKernel || launchParams.isIndirect || launchParams.isCooperative || launchParams.isPredicate || launchParams.isKernelSplitOperation) {
+        return false;
+    }
+    auto capabilities = L0GfxCoreHelper::getCmdListUpdateCapabilities(this->device->getNEODevice()->getRootDeviceEnvironment());
+    if ((capabilities & ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS) == 0 || GfxFamily::template isHeaplessMode<typename GfxFamily::DefaultWalkerType>()) {
+        return false;
+    }
+
+    // only cross thread data of recorded launch is patched, state heaps and per dispatch allocations are not
+    const auto &kernelDescriptor = kernel->getKernelDescriptor();
+    return kernel->getImplicitArgs() == nullptr &&
+           kernel->getSurfaceStateHeapDataSize() == 0 &&
+           kernelDescriptor.payloadMappings.samplerTable.numSamplers == 0 &&
+           kernelDescriptor.kernelAttributes.perHwThreadPrivateMemorySize == 0 &&
+           !kernelDescriptor.kernelAttributes.flags.usesPrintf &&
+           !kernelDescriptor.kernelAttributes.flags.usesAssert &&
+           !kernelDescriptor.kernelAttributes.flags.usesSyncBuffer;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::captureLaunchKernel(Kernel *kernel, const ze_group_count_t &threadGroupDimensions) {
+    // pending task count of deferred launches is valid only until csr submits anything else
+    if (!capturedLaunches.empty() && capturedLaunchesTaskCount != this->csr->peekTaskCount()) {
+        auto ret = flushCapturedLaunches();
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
+    }
+
+    // same cross thread data patching as done when launch is encoded
+    kernel->patchGlobalOffset();
+    kernel->setGroupCount(threadGroupDimensions.groupCountX, threadGroupDimensions.groupCountY, threadGroupDimensions.groupCountZ);
+
+    CapturedKernelAppend launch{};
+    launch.kernel = kernel;
+    launch.isaAllocation = kernel->getIsaAllocation();
+    launch.isaOffset = kernel->getIsaOffsetInParentAllocation();
+    launch.groupCount = threadGroupDimensions;
+    memcpy_s(launch.groupSize, sizeof(launch.groupSize), kernel->getGroupSize(), sizeof(launch.groupSize));
+    launch.slmTotalSize = kernel->getSlmTotalSize();
+    launch.numThreadsPerThreadGroup = kernel->getNumThreadsPerThreadGroup();
+    launch.perThreadDataSize = kernel->getPerThreadDataSizeForWholeThreadGroup();
+    launch.threadExecutionMask = kernel->getThreadExecutionMask();
+    launch.requiredWorkgroupOrder = kernel->getRequiredWorkgroupOrder();
+    launch.crossThreadData.assign(kernel->getCrossThreadData(), kernel->getCrossThreadData() + kernel->getCrossThreadDataSize());
+    launch.residency = kernel->getResidencyContainer();
+    markCapturedAllocationsPending(launch.residency);
+    capturedLaunches.push_back(std::move(launch));
+
+    if (capturedLaunches.size() >= maxCapturedLaunches) {
+        return flushCapturedLaunches();
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::flushCapturedLaunches() {
+    if (capturedLaunches.empty()) {
+        return ZE_RESULT_SUCCESS;
+    }
+    auto launches = std::move(capturedLaunches);
+    capturedLaunches.clear();
+
+    // recorded commands are patched in place, so only a recording not used by GPU anymore can be replayed
+    auto sequence = std::find_if(capturedSequences.begin(), capturedSequences.end(), [this, &launches](const CapturedSequence &capturedSequence) {
+        return std::equal(launches.begin(), launches.end(), capturedSequence.launches.begin(), capturedSequence.launches.end(),
+                          [](const CapturedKernelAppend &lhs, const CapturedKernelAppend &rhs) { return lhs.isSameLaunch(rhs); }) &&
+               isCapturedSequenceIdle(capturedSequence);
+    });
+
+    if (sequence != capturedSequences.end()) {
+        captureStatistics.hits++;
+    } else {
+        captureStatistics.misses++;
+        if (capturedSequences.size() >= maxCapturedSequences) {
+            auto evicted = std::find_if(capturedSequences.begin(), capturedSequences.end(), [this](const CapturedSequence &capturedSequence) {
+                return isCapturedSequenceIdle(capturedSequence);
+            });
+            if (evicted == capturedSequences.end()) {
+                evicted = capturedSequences.begin();
+                waitForCapturedSequence(*evicted);
+            }
+            evicted->commandList->destroy();
+            capturedSequences.erase(evicted);
+        }
+        CapturedSequence newSequence{};
+        newSequence.launches = launches;
+        auto ret = recordCapturedSequence(newSequence);
+        if (ret != ZE_RESULT_SUCCESS) {
+            return ret;
+        }
+        capturedSequences.push_back(std::move(newSequence));
+        sequence = capturedSequences.end() - 1;
+    }
+
+    auto &residencyContainer = sequence->commandList->getCmdContainer().getResidencyContainer();
+    residencyContainer.resize(sequence->baseResidencySize);
+    for (size_t i = 0; i < launches.size(); i++) {
+        auto patched = sequence->commandList->updateMutableCrossThreadData(i, launches[i].crossThreadData);
+        UNRECOVERABLE_IF(!patched);
+        for (auto allocation : launches[i].residency) {
+            if (allocation) {
+                residencyContainer.push_back(allocation);
+            }
+        }
+    }
+
+    auto hCommandList = sequence->commandList->toHandle();
+    auto ret = this->cmdQImmediate->executeCommandLists(1, &hCommandList, nullptr, true, nullptr, 0, nullptr);
+    sequence->taskCount = this->cmdQImmediate->getTaskCount();
+    return ret;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+ze_result_t CommandListCoreFamilyImmediate<gfxCoreFamily>::recordCapturedSequence(CapturedSequence &sequence) {
+    ze_result_t ret = ZE_RESULT_SUCCESS;
+    auto commandList = static_cast<CommandListImp *>(CommandList::create(this->device->getHwInfo().platform.eProductFamily, this->device, this->engineGroupType, 0u, ret, true));
+    if (commandList == nullptr) {
+        return ret;
+    }
+
+    for (const auto &launch : sequence.launches) {
+        ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+        commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS;
+        uint64_t commandId = 0;
+        ret = commandList->getNextCommandId(&commandIdDesc, &commandId);
+        if (ret == ZE_RESULT_SUCCESS) {
+            // arguments residency is set on each submission
+            CmdListKernelLaunchParams launchParams = {};
+            launchParams.omitAddingKernelResidency = true;
+            ret = commandList->appendLaunchKernel(launch.kernel->toHandle(), launch.groupCount, nullptr, 0, nullptr, launchParams, false);
+        }
+        if (ret != ZE_RESULT_SUCCESS) {
+            commandList->destroy();
+            return ret;
+        }
+    }
+    commandList->close();
+
+    sequence.commandList = commandList;
+    sequence.baseResidencySize = commandList->getCmdContainer().getResidencyContainer().size();
+    return ZE_RESULT_SUCCESS;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamilyImmediate<gfxCoreFamily>::isCapturedSequenceIdle(const CapturedSequence &sequence) {
+    return sequence.taskCount == 0 || *this->csr->getTagAddress() >= sequence.taskCount;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::waitForCapturedSequence(const CapturedSequence &sequence) {
+    if (sequence.taskCount > 0) {
+        this->csr->waitForCompletionWithTimeout(NEO::WaitParams{false, false, NEO::TimeoutControls::maxTimeout}, sequence.taskCount);
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamilyImmediate<gfxCoreFamily>::markCapturedAllocationsPending(const NEO::ResidencyContainer &residency) {
+    // deferred launch is submitted with next task count of immediate csr, so allocations it uses stay busy for
+    // in use checks and deferred frees until then, synchronization on command list flushes deferred launches first
+    auto lock = this->csr->obtainUniqueOwnership();
+    auto contextId = this->csr->getOsContext().getContextId();
+    capturedLaunchesTaskCount = this->csr->peekTaskCount();
+    auto pendingTaskCount = capturedLaunchesTaskCount + 1;
+    for (auto allocation : residency) {
+        if (allocation && (!allocation->isUsedByOsContext(contextId) || allocation->getTaskCount(contextId) < pendingTaskCount)) {
+            allocation->updateTaskCount(pendingTaskCount, contextId);
+        }
+    }
+}
+
 } // namespace L0
@@ -40,6 +40,32 @@ size_t CommandListCoreFamily<gfxCoreFamily>::getReserveSshSize() {
 template <GFXCORE_FAMILY gfxCoreFamily>
 void CommandListCoreFamily<gfxCoreFamily>::adjustWriteKernelTimestamp(uint64_t globalAddress, uint64_t contextAddress, uint64_t baseAddress, CommandToPatchContainer *outTimeStampSyncCmds, bool maskLsb, uint32_t mask, bool workloadPartition) {}
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamily<gfxCoreFamily>::isMutableGroupCountSupported(const MutableKernelCommand &command) const {
+    return false;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::programMutableGroupCount(MutableKernelCommand &command, const ze_group_count_t &groupCount) {
+    UNRECOVERABLE_IF(true);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+uint64_t CommandListCoreFamily<gfxCoreFamily>::getMutableEventAddress(const MutableEventPatchSite &patchSite) const {
+    UNRECOVERABLE_IF(true);
+    return 0;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::programMutableEventAddress(const MutableEventPatchSite &patchSite, uint64_t address) {
+    UNRECOVERABLE_IF(true);
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+size_t CommandListCoreFamily<gfxCoreFamily>::getCommandAddressOffset(CommandToPatch::CommandType type, void *command) const {
+    return getCommandAddressDwordOffset(type) * sizeof(uint32_t);
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 bool CommandListCoreFamily<gfxCoreFamily>::isInOrderNonWalkerSignalingRequired(const Event *event) const {
     return false;
@@ -52,6 +78,10 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
                                                                                CmdListKernelLaunchParams &launchParams) {
     UNRECOVERABLE_IF(kernel == nullptr);
     UNRECOVERABLE_IF(launchParams.skipInOrderNonWalkerSignaling);
+    // addresses programmed by kernel launch are recorded only for xe_hp and later
+    if (this->relocatableRecording) {
+        this->relocatableRecordingComplete = false;
+    }
     const auto driverHandle = static_cast<DriverHandleImp *>(device->getDriverHandle());
     const auto &kernelDescriptor = kernel->getKernelDescriptor();
     if (kernelDescriptor.kernelAttributes.flags.isInvalid) {
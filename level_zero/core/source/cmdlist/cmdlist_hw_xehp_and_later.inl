@@ -12,6 +12,7 @@
 #include "shared/source/helpers/cache_flush_xehp_and_later.inl"
 #include "shared/source/helpers/pause_on_gpu_properties.h"
 #include "shared/source/helpers/pipeline_select_helper.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/simd_helper.h"
 #include "shared/source/indirect_heap/indirect_heap.h"
 #include "shared/source/kernel/grf_config.h"
@@ -40,7 +41,7 @@ size_t CommandListCoreFamily<gfxCoreFamily>::getReserveSshSize() {
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
-void programEventL3Flush(Event *event,
+void *programEventL3Flush(Event *event,
                          Device *device,
                          uint32_t partitionCount,
                          NEO::CommandContainer &commandContainer) {
@@ -73,6 +74,7 @@ void programEventL3Flush(Event *event,
         Event::STATE_SIGNALED,
         commandContainer.getDevice()->getRootDeviceEnvironment(),
         args);
+    return args.postSyncCmd;
 }
 
 template <GFXCORE_FAMILY gfxCoreFamily>
@@ -338,8 +340,50 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
         interruptEvent,                                         // interruptEvent
     };
 
+    // indirect data of mutable command is updated in place, so it must not be shared with other dispatches
+    if (this->currentMutableCommand) {
+        commandContainer.invalidateReusableHeapData();
+    }
     NEO::EncodeDispatchKernel<GfxFamily>::encodeCommon(commandContainer, dispatchKernelArgs);
     launchParams.outWalker = dispatchKernelArgs.outWalkerPtr;
+    if (this->currentMutableCommand) {
+        commandContainer.invalidateReusableHeapData();
+    }
+
+    if (!isImmediateType() && dispatchKernelArgs.outWalkerPtr) {
+        using DefaultWalkerType = typename GfxFamily::DefaultWalkerType;
+        auto walker = reinterpret_cast<DefaultWalkerType *>(dispatchKernelArgs.outWalkerPtr);
+
+        if (this->relocatableRecording) {
+            recordRelocatableKernelLaunch(*kernel, walker);
+        }
+        if (eventAddress != 0) {
+            recordEventAddressSite(CommandToPatch::ComputeWalker, walker);
+        }
+
+        // cross thread data location is tracked only when it directly follows indirect data start address
+        if (this->currentMutableCommand && !GfxFamily::template isHeaplessMode<DefaultWalkerType>() && kernel->getImplicitArgs() == nullptr) {
+            auto &mutableCommand = *this->currentMutableCommand;
+            size_t crossThreadDataSize = kernel->getCrossThreadDataSize();
+            mutableCommand.kernel = kernel;
+            mutableCommand.walker = walker;
+            mutableCommand.crossThreadData.resize(crossThreadDataSize);
+            memcpy_s(mutableCommand.groupSize, sizeof(mutableCommand.groupSize), kernel->getGroupSize(), sizeof(mutableCommand.groupSize));
+
+            if (walker->getEmitInlineParameter()) {
+                mutableCommand.inlineData = walker->getInlineDataPointer();
+                mutableCommand.inlineDataSize = std::min(static_cast<size_t>(DefaultWalkerType::getInlineDataSize()), crossThreadDataSize);
+                memcpy_s(mutableCommand.crossThreadData.data(), crossThreadDataSize, mutableCommand.inlineData, mutableCommand.inlineDataSize);
+            }
+            if (crossThreadDataSize > mutableCommand.inlineDataSize) {
+                auto ioh = commandContainer.getIndirectHeap(NEO::HeapType::indirectObject);
+                auto iohOffsetBase = is64bit ? ioh->getHeapGpuStartOffset() : ioh->getHeapGpuBase();
+                mutableCommand.indirectData = ptrOffset(ioh->getCpuBase(), static_cast<size_t>(walker->getIndirectDataStartAddress() - iohOffsetBase));
+                memcpy_s(&mutableCommand.crossThreadData[mutableCommand.inlineDataSize], crossThreadDataSize - mutableCommand.inlineDataSize,
+                         mutableCommand.indirectData, crossThreadDataSize - mutableCommand.inlineDataSize);
+            }
+        }
+    }
 
     if (!this->isFlushTaskSubmissionEnabled) {
         this->containsStatelessUncachedResource = dispatchKernelArgs.requiresUncachedMocs;
@@ -355,7 +399,8 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
     } else if (event) {
         event->setPacketsInUse(partitionCount);
         if (l3FlushEnable) {
-            programEventL3Flush<gfxCoreFamily>(event, this->device, partitionCount, commandContainer);
+            auto l3FlushCmd = programEventL3Flush<gfxCoreFamily>(event, this->device, partitionCount, commandContainer);
+            recordEventBarrierSite(l3FlushCmd);
         }
         if (!launchParams.isKernelSplitOperation) {
             dispatchEventRemainingPacketsPostSyncOperation(event);
@@ -439,6 +484,182 @@ ze_result_t CommandListCoreFamily<gfxCoreFamily>::appendLaunchKernelWithParams(K
     return ZE_RESULT_SUCCESS;
 }
 
+template <GFXCORE_FAMILY gfxCoreFamily>
+size_t CommandListCoreFamily<gfxCoreFamily>::getIndirectDataStartAddressOffset() {
+    using DefaultWalkerType = typename GfxFamily::DefaultWalkerType;
+    // field position is found through walker accessor, so it follows walker layout of every family
+    static const size_t offset = [] {
+        DefaultWalkerType walker;
+        memset(&walker, 0, sizeof(walker));
+        walker.setIndirectDataStartAddress(DefaultWalkerType::INDIRECTDATASTARTADDRESS_ALIGN_SIZE);
+        uint32_t dword = 0u;
+        while (walker.getRawData(dword) == 0u) {
+            dword++;
+            UNRECOVERABLE_IF(dword * sizeof(uint32_t) >= sizeof(walker));
+        }
+        return dword * sizeof(uint32_t);
+    }();
+    return offset;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::recordRelocatableKernelLaunch(Kernel &kernel, void *walkerPtr) {
+    using DefaultWalkerType = typename GfxFamily::DefaultWalkerType;
+    auto walker = reinterpret_cast<DefaultWalkerType *>(walkerPtr);
+    auto cmdStream = commandContainer.getCommandStream();
+    auto &kernelDescriptor = kernel.getKernelDescriptor();
+
+    CmdListKernelLaunchSite launchSite{};
+    launchSite.kernel = &kernel;
+    launchSite.cmdBuffer = cmdStream->getGraphicsAllocation();
+    launchSite.kernelStartPointerOffset = ptrDiff(&walker->getInterfaceDescriptor(), cmdStream->getCpuBase());
+    launchSite.indirectDataStartAddressOffset = ptrDiff(walker, cmdStream->getCpuBase()) + getIndirectDataStartAddressOffset();
+    launchSite.absoluteKernelStartPointer = GfxFamily::template isHeaplessMode<DefaultWalkerType>();
+    if (walker->getEmitInlineParameter()) {
+        launchSite.inlineDataOffset = ptrDiff(walker->getInlineDataPointer(), cmdStream->getCpuBase());
+        launchSite.inlineDataSize = DefaultWalkerType::getInlineDataSize();
+    }
+    this->kernelLaunchSites.push_back(launchSite);
+
+    // addresses held in surface states, samplers and implicit args buffer are not recorded
+    if (GfxFamily::template isHeaplessMode<DefaultWalkerType>() || kernel.getImplicitArgs() != nullptr ||
+        kernel.getSurfaceStateHeapDataSize() > 0u || kernel.getImmutableData()->getDynamicStateHeapDataSize() > 0u) {
+        this->relocatableRecordingComplete = false;
+        return;
+    }
+
+    StackVec<const NEO::ArgDescPointer *, 16> pointerArgs;
+    for (const auto &arg : kernelDescriptor.payloadMappings.explicitArgs) {
+        if (arg.is<NEO::ArgDescriptor::argTPointer>()) {
+            pointerArgs.push_back(&arg.as<NEO::ArgDescPointer>());
+        }
+    }
+    for (auto implicitArg : kernelDescriptor.getImplicitArgBindlessCandidatesVec()) {
+        pointerArgs.push_back(implicitArg);
+    }
+
+    auto crossThreadData = kernel.getCrossThreadData();
+    for (auto pointerArg : pointerArgs) {
+        if (NEO::isValidOffset(pointerArg->bindless)) {
+            this->relocatableRecordingComplete = false;
+            return;
+        }
+        if (NEO::isUndefinedOffset(pointerArg->stateless)) {
+            continue;
+        }
+        size_t offset = pointerArg->stateless;
+        bool splitByInlineData = offset < launchSite.inlineDataSize && offset + sizeof(uint64_t) > launchSite.inlineDataSize;
+        if (pointerArg->pointerSize != sizeof(uint64_t) || splitByInlineData) {
+            this->relocatableRecordingComplete = false;
+            return;
+        }
+        uint64_t address = 0u;
+        memcpy_s(&address, sizeof(address), ptrOffset(crossThreadData, offset), sizeof(address));
+        if (address == 0u) {
+            continue;
+        }
+
+        if (offset < launchSite.inlineDataSize) {
+            recordRelocatableAddressSite(*cmdStream, ptrOffset(walker->getInlineDataPointer(), offset));
+        } else {
+            auto ioh = commandContainer.getIndirectHeap(NEO::HeapType::indirectObject);
+            auto iohOffsetBase = is64bit ? ioh->getHeapGpuStartOffset() : ioh->getHeapGpuBase();
+            auto indirectData = ptrOffset(ioh->getCpuBase(), static_cast<size_t>(walker->getIndirectDataStartAddress() - iohOffsetBase));
+            recordRelocatableAddressSite(*ioh, ptrOffset(indirectData, offset - launchSite.inlineDataSize));
+        }
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+bool CommandListCoreFamily<gfxCoreFamily>::isMutableGroupCountSupported(const MutableKernelCommand &command) const {
+    using DefaultWalkerType = typename GfxFamily::DefaultWalkerType;
+    // partition count and size are derived from group count when dispatch is split between tiles
+    return reinterpret_cast<const DefaultWalkerType *>(command.walker)->getPartitionType() == DefaultWalkerType::PARTITION_TYPE::PARTITION_TYPE_DISABLED;
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::programMutableGroupCount(MutableKernelCommand &command, const ze_group_count_t &groupCount) {
+    using DefaultWalkerType = typename GfxFamily::DefaultWalkerType;
+    auto walker = reinterpret_cast<DefaultWalkerType *>(command.walker);
+
+    walker->setThreadGroupIdXDimension(groupCount.groupCountX);
+    walker->setThreadGroupIdYDimension(groupCount.groupCountY);
+    walker->setThreadGroupIdZDimension(groupCount.groupCountZ);
+
+    auto neoDevice = device->getNEODevice();
+    const auto &hwInfo = neoDevice->getHardwareInfo();
+    const auto &kernelDescriptor = command.kernel->getKernelDescriptor();
+    auto &idd = walker->getInterfaceDescriptor();
+
+    auto slmSize = static_cast<uint32_t>(neoDevice->getGfxCoreHelper().computeSlmValues(hwInfo, command.kernel->getSlmTotalSize()));
+    if (NEO::debugManager.flags.OverrideSlmAllocationSize.get() != -1) {
+        slmSize = static_cast<uint32_t>(NEO::debugManager.flags.OverrideSlmAllocationSize.get());
+    }
+    idd.setSharedLocalMemorySize(slmSize);
+
+    auto threadGroupCount = groupCount.groupCountX * groupCount.groupCountY * groupCount.groupCountZ;
+    NEO::EncodeDispatchKernel<GfxFamily>::adjustInterfaceDescriptorData(idd, *neoDevice, hwInfo, threadGroupCount, kernelDescriptor.kernelAttributes.numGrfRequired, *walker);
+    NEO::EncodeDispatchKernel<GfxFamily>::appendAdditionalIDDFields(&idd, neoDevice->getRootDeviceEnvironment(), idd.getNumberOfThreadsInGpgpuThreadGroup(),
+                                                                    command.kernel->getSlmTotalSize(), command.kernel->getSlmPolicy());
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+uint64_t CommandListCoreFamily<gfxCoreFamily>::getMutableEventAddress(const MutableEventPatchSite &patchSite) const {
+    switch (patchSite.type) {
+    case CommandToPatch::ComputeWalker:
+        return reinterpret_cast<typename GfxFamily::DefaultWalkerType *>(patchSite.command)->getPostSync().getDestinationAddress();
+    case CommandToPatch::WaitEventSemaphoreWait:
+        return reinterpret_cast<typename GfxFamily::MI_SEMAPHORE_WAIT *>(patchSite.command)->getSemaphoreGraphicsAddress();
+    case CommandToPatch::SignalEventPostSyncStoreDataImm:
+        return reinterpret_cast<typename GfxFamily::MI_STORE_DATA_IMM *>(patchSite.command)->getAddress();
+    case CommandToPatch::TimestampEventPostSyncStoreRegMem:
+        return reinterpret_cast<typename GfxFamily::MI_STORE_REGISTER_MEM *>(patchSite.command)->getMemoryAddress();
+    case CommandToPatch::SignalEventPostSyncPipeControl: {
+        auto pipeControl = reinterpret_cast<typename GfxFamily::PIPE_CONTROL *>(patchSite.command);
+        return (static_cast<uint64_t>(pipeControl->getAddressHigh()) << 32) | pipeControl->getAddress();
+    }
+    default:
+        UNRECOVERABLE_IF(true);
+        return 0;
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+void CommandListCoreFamily<gfxCoreFamily>::programMutableEventAddress(const MutableEventPatchSite &patchSite, uint64_t address) {
+    switch (patchSite.type) {
+    case CommandToPatch::ComputeWalker:
+        reinterpret_cast<typename GfxFamily::DefaultWalkerType *>(patchSite.command)->getPostSync().setDestinationAddress(address);
+        break;
+    case CommandToPatch::WaitEventSemaphoreWait:
+        reinterpret_cast<typename GfxFamily::MI_SEMAPHORE_WAIT *>(patchSite.command)->setSemaphoreGraphicsAddress(address);
+        break;
+    case CommandToPatch::SignalEventPostSyncStoreDataImm:
+        reinterpret_cast<typename GfxFamily::MI_STORE_DATA_IMM *>(patchSite.command)->setAddress(address);
+        break;
+    case CommandToPatch::TimestampEventPostSyncStoreRegMem:
+        reinterpret_cast<typename GfxFamily::MI_STORE_REGISTER_MEM *>(patchSite.command)->setMemoryAddress(address);
+        break;
+    case CommandToPatch::SignalEventPostSyncPipeControl: {
+        auto pipeControl = reinterpret_cast<typename GfxFamily::PIPE_CONTROL *>(patchSite.command);
+        pipeControl->setAddress(static_cast<uint32_t>(address & 0x0000FFFFFFFFULL));
+        pipeControl->setAddressHigh(static_cast<uint32_t>(address >> 32));
+        break;
+    }
+    default:
+        UNRECOVERABLE_IF(true);
+        break;
+    }
+}
+
+template <GFXCORE_FAMILY gfxCoreFamily>
+size_t CommandListCoreFamily<gfxCoreFamily>::getCommandAddressOffset(CommandToPatch::CommandType type, void *command) const {
+    if (type == CommandToPatch::ComputeWalker) {
+        auto walker = reinterpret_cast<typename GfxFamily::DefaultWalkerType *>(command);
+        return ptrDiff(&walker->getPostSync(), walker) + sizeof(uint32_t);
+    }
+    return getCommandAddressDwordOffset(type) * sizeof(uint32_t);
+}
+
 template <GFXCORE_FAMILY gfxCoreFamily>
 void CommandListCoreFamily<gfxCoreFamily>::appendMultiPartitionPrologue(uint32_t partitionDataSize) {
     NEO::ImplicitScalingDispatch<GfxFamily>::dispatchOffsetRegister(*commandContainer.getCommandStream(),
@@ -523,7 +744,8 @@ void CommandListCoreFamily<gfxCoreFamily>::appendEventForProfilingAllWalkers(Eve
             } else {
                 if (event->getKernelCount() > 1) {
                     if (getDcFlushRequired(event->isSignalScope())) {
-                        programEventL3Flush<gfxCoreFamily>(event, this->device, this->partitionCount, this->commandContainer);
+                        auto l3FlushCmd = programEventL3Flush<gfxCoreFamily>(event, this->device, this->partitionCount, this->commandContainer);
+                        recordEventBarrierSite(l3FlushCmd);
                     }
                     dispatchEventRemainingPacketsPostSyncOperation(event);
                 }
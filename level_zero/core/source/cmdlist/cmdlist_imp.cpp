@@ -79,16 +79,19 @@ ze_result_t CommandListImp::destroy() {
 }
 
 ze_result_t CommandListImp::appendMetricMemoryBarrier() {
+    pendingMutableCommandId.reset();
 
     return device->getMetricDeviceContext().appendMetricMemoryBarrier(*this);
 }
 
 ze_result_t CommandListImp::appendMetricStreamerMarker(zet_metric_streamer_handle_t hMetricStreamer,
                                                        uint32_t value) {
+    pendingMutableCommandId.reset();
     return MetricStreamer::fromHandle(hMetricStreamer)->appendStreamerMarker(*this, value);
 }
 
 ze_result_t CommandListImp::appendMetricQueryBegin(zet_metric_query_handle_t hMetricQuery) {
+    pendingMutableCommandId.reset();
     if (isImmediateType() && isFlushTaskSubmissionEnabled) {
         this->device->activateMetricGroups();
     }
@@ -98,6 +101,7 @@ ze_result_t CommandListImp::appendMetricQueryBegin(zet_metric_query_handle_t hMe
 
 ze_result_t CommandListImp::appendMetricQueryEnd(zet_metric_query_handle_t hMetricQuery, ze_event_handle_t hSignalEvent,
                                                  uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    pendingMutableCommandId.reset();
     return MetricQuery::fromHandle(hMetricQuery)->appendEnd(*this, hSignalEvent, numWaitEvents, phWaitEvents);
 }
 
@@ -7,8 +7,10 @@
 
 #pragma once
 #include "shared/source/helpers/in_order_cmd_helpers.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
 #include "shared/source/os_interface/os_time.h"
 
+#include "level_zero/api/driver_experimental/public/zex_common.h"
 #include "level_zero/core/source/cmdlist/cmdlist.h"
 
 #include <memory>
@@ -46,7 +48,40 @@ struct CommandListImp : public CommandList {
     virtual void patchInOrderCmds() = 0;
     void enableSynchronizedDispatch(NEO::SynchronizedDispatchMode mode) { synchronizedDispatchMode = mode; }
 
+    ze_result_t serializeRelocatable(const zex_command_list_relocation_desc_t &desc, size_t *pSize, void *pBlob);
+    static ze_result_t createFromRelocatable(Device *device, ze_context_handle_t hContext, const void *blob, size_t size,
+                                             const zex_command_list_relocation_desc_t &desc, ze_command_list_handle_t *phCommandList);
+    void beginRelocatableAppend();
+    void endRelocatableAppend();
+
+    ze_result_t getNextCommandId(const ze_mutable_command_id_exp_desc_t *desc, uint64_t *pCommandId);
+    ze_result_t updateMutableCommands(const ze_mutable_commands_exp_desc_t *desc);
+    ze_result_t updateMutableCommandSignalEvent(uint64_t commandId, ze_event_handle_t hSignalEvent);
+    ze_result_t updateMutableCommandWaitEvents(uint64_t commandId, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents);
+    bool updateMutableCrossThreadData(uint64_t commandId, const std::vector<uint8_t> &crossThreadData);
+    virtual bool isMutableGroupCountSupported(const MutableKernelCommand &command) const = 0;
+    virtual void programMutableGroupCount(MutableKernelCommand &command, const ze_group_count_t &groupCount) = 0;
+    virtual uint64_t getMutableEventAddress(const MutableEventPatchSite &patchSite) const = 0;
+    virtual void programMutableEventAddress(const MutableEventPatchSite &patchSite, uint64_t address) = 0;
+    virtual size_t getCommandAddressOffset(CommandToPatch::CommandType type, void *command) const = 0;
+
   protected:
+    MutableKernelCommand *getMutableKernelCommand(uint64_t commandId, ze_mutable_command_exp_flags_t requiredFlag);
+    void recordEventAddressSite(CommandToPatch::CommandType type, void *command);
+    void recordMutableCommandEvents(MutableKernelCommand &command, Event *signalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents);
+    ze_result_t validateMutableKernelArgument(const ze_mutable_kernel_argument_exp_desc_t &desc);
+    ze_result_t validateMutableGroupCount(const ze_mutable_group_count_exp_desc_t &desc);
+    ze_result_t validateMutableGlobalOffset(const ze_mutable_global_offset_exp_desc_t &desc);
+    void updateMutableKernelArgument(const ze_mutable_kernel_argument_exp_desc_t &desc);
+    void updateMutableGroupCount(const ze_mutable_group_count_exp_desc_t &desc);
+    void updateMutableGlobalOffset(const ze_mutable_global_offset_exp_desc_t &desc);
+    void writeMutableCrossThreadData(MutableKernelCommand &command, const std::vector<uint8_t> &previousCrossThreadData);
+    void resetRelocatableRecording();
+    void setRelocatableStreamEnd();
+    void checkRelocatableStreamEnd();
+    void recordRelocatableAddressSite(NEO::LinearStream &stream, const void *address);
+    void recordRelocatableCommandAddress(CommandToPatch::CommandType type, void *command);
+
     std::shared_ptr<NEO::InOrderExecInfo> inOrderExecInfo;
     NEO::SynchronizedDispatchMode synchronizedDispatchMode = NEO::SynchronizedDispatchMode::disabled;
 
@@ -59,6 +94,35 @@ struct CommandListImp : public CommandList {
     static constexpr bool cmdListDefaultMediaSamplerClockGate = false;
     static constexpr bool cmdListDefaultGlobalAtomics = false;
     std::vector<Event *> mappedTsEventList{};
+
+    // mutable commands can be updated only after close()
+    bool isClosed = false;
+
+    // commands programming event addresses, recorded while mutable command is appended
+    std::vector<MutableEventPatchSite> mutableEventSites;
+    bool mutableEventSitesComplete = true;
+
+    // end of commands whose addresses are recorded, commands appended elsewhere make the list not relocatable
+    NEO::GraphicsAllocation *relocatableStreamBuffer = nullptr;
+    size_t relocatableStreamOffset = 0;
+    uint32_t relocatableAppendDepth = 0;
+    bool relocatableRecording = false;
+    bool relocatableRecordingComplete = true;
+};
+
+// Marks commands of one append whose addresses are recorded for serialization of relocatable command list.
+// Every address of an object used by append is recorded by the encoder programming it.
+class RelocatableAppendScope : NEO::NonCopyableOrMovableClass {
+  public:
+    explicit RelocatableAppendScope(CommandListImp &commandList) : commandList(commandList) {
+        commandList.beginRelocatableAppend();
+    }
+    ~RelocatableAppendScope() {
+        commandList.endRelocatableAppend();
+    }
+
+  protected:
+    CommandListImp &commandList;
 };
 
 } // namespace L0
@@ -24,6 +24,7 @@ struct CommandToPatch {
         PauseOnEnqueuePipeControlEnd,
         ComputeWalker,
         SignalEventPostSyncPipeControl,
+        SignalEventPostSyncStoreDataImm,
         WaitEventSemaphoreWait,
         TimestampEventPostSyncStoreRegMem,
         CbEventTimestampPostSyncSemaphoreWait,
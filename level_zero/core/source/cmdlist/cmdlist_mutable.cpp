@@ -0,0 +1,433 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/device/device.h"
+#include "shared/source/gmm_helper/gmm_helper.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/kernel/kernel_arg_descriptor.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
+
+#include "level_zero/core/source/cmdlist/cmdlist_imp.h"
+#include "level_zero/core/source/device/device.h"
+#include "level_zero/core/source/driver/driver_handle.h"
+#include "level_zero/core/source/event/event.h"
+#include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
+#include "level_zero/core/source/kernel/kernel.h"
+
+#include <algorithm>
+
+namespace L0 {
+
+namespace {
+uint64_t getAddressMask(Device *device) {
+    return maxNBitValue(device->getNEODevice()->getGmmHelper()->getAddressWidth());
+}
+
+MutableEventUse createMutableEventUse(const Event &event) {
+    MutableEventUse eventUse{};
+    eventUse.eventSize = event.getTotalEventSize();
+    eventUse.packetsInUse = event.getPacketsInUse();
+    eventUse.usingContextEndOffset = event.isUsingContextEndOffset();
+    eventUse.signalScope = event.isSignalScope();
+    eventUse.interruptMode = event.isInterruptModeEnabled();
+    return eventUse;
+}
+
+// Event packets layout and the commands programmed for the event must not depend on which event is used
+bool isMutableEventCompatible(const MutableEventUse &eventUse, const Event &event, bool signal) {
+    if (event.isCounterBased() || eventUse.eventSize != event.getTotalEventSize() || eventUse.usingContextEndOffset != event.isUsingContextEndOffset()) {
+        return false;
+    }
+    if (signal) {
+        return eventUse.signalScope == event.isSignalScope() && eventUse.interruptMode == event.isInterruptModeEnabled();
+    }
+    return true;
+}
+} // namespace
+
+ze_result_t CommandListImp::getNextCommandId(const ze_mutable_command_id_exp_desc_t *desc, uint64_t *pCommandId) {
+    if (desc == nullptr || pCommandId == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    auto capabilities = L0GfxCoreHelper::getCmdListUpdateCapabilities(device->getNEODevice()->getRootDeviceEnvironment());
+    if (isImmediateType() || isInOrderExecutionEnabled() || partitionCount > 1 || capabilities == 0) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    if ((desc->flags & ~capabilities) != 0) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+
+    MutableKernelCommand command{};
+    command.flags = (desc->flags != 0) ? desc->flags : capabilities;
+    mutableKernelCommands.push_back(std::move(command));
+
+    pendingMutableCommandId = mutableKernelCommands.size() - 1;
+    *pCommandId = mutableKernelCommands.size() - 1;
+    return ZE_RESULT_SUCCESS;
+}
+
+MutableKernelCommand *CommandListImp::getMutableKernelCommand(uint64_t commandId, ze_mutable_command_exp_flags_t requiredFlag) {
+    if (commandId >= mutableKernelCommands.size()) {
+        return nullptr;
+    }
+    auto &command = mutableKernelCommands[static_cast<size_t>(commandId)];
+    if (command.walker == nullptr || (command.flags & requiredFlag) == 0) {
+        return nullptr;
+    }
+    return &command;
+}
+
+void CommandListImp::recordEventAddressSite(CommandToPatch::CommandType type, void *command) {
+    recordRelocatableCommandAddress(type, command);
+    if (currentMutableCommand == nullptr) {
+        return;
+    }
+    if (command == nullptr) {
+        // event address is programmed by command which cannot be patched
+        mutableEventSitesComplete = false;
+        return;
+    }
+    mutableEventSites.push_back({command, 0u, type});
+}
+
+void CommandListImp::recordMutableCommandEvents(MutableKernelCommand &command, Event *signalEvent, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    constexpr ze_mutable_command_exp_flags_t eventFlags = ZE_MUTABLE_COMMAND_EXP_FLAG_SIGNAL_EVENT | ZE_MUTABLE_COMMAND_EXP_FLAG_WAIT_EVENTS;
+    if ((command.flags & eventFlags) == 0) {
+        return;
+    }
+    if (!mutableEventSitesComplete) {
+        command.flags &= ~eventFlags;
+        return;
+    }
+
+    std::vector<Event *> events;
+    events.reserve(numWaitEvents + 1);
+    events.push_back(signalEvent);
+    for (uint32_t i = 0; i < numWaitEvents; i++) {
+        events.push_back(Event::fromHandle(phWaitEvents[i]));
+    }
+
+    // recorded commands are assigned to events by programmed address, so every event has to be unique and own its packets
+    for (size_t i = 0; i < events.size(); i++) {
+        if (events[i] == nullptr) {
+            continue;
+        }
+        if (events[i]->isCounterBased() || std::find(events.begin() + i + 1, events.end(), events[i]) != events.end()) {
+            command.flags &= ~eventFlags;
+            return;
+        }
+    }
+
+    if (signalEvent) {
+        command.signalEvent = createMutableEventUse(*signalEvent);
+    }
+    for (uint32_t i = 0; i < numWaitEvents; i++) {
+        command.waitEvents.push_back(createMutableEventUse(*events[i + 1]));
+    }
+
+    auto addressMask = getAddressMask(device);
+    for (auto &patchSite : mutableEventSites) {
+        auto address = getMutableEventAddress(patchSite) & addressMask;
+        for (size_t i = 0; i < events.size(); i++) {
+            if (events[i] == nullptr) {
+                continue;
+            }
+            auto eventAddress = events[i]->getGpuAddress(device) & addressMask;
+            if (address >= eventAddress && address < eventAddress + events[i]->getTotalEventSize()) {
+                patchSite.offsetInEvent = address - eventAddress;
+                auto &eventUse = (i == 0) ? *command.signalEvent : command.waitEvents[i - 1];
+                eventUse.patchSites.push_back(patchSite);
+                break;
+            }
+        }
+    }
+}
+
+ze_result_t CommandListImp::updateMutableCommands(const ze_mutable_commands_exp_desc_t *desc) {
+    if (desc == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    if (!isClosed) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    // whole chain is validated before any command is patched, so failed update leaves command list unchanged
+    for (auto extension = reinterpret_cast<const ze_base_desc_t *>(desc->pNext); extension; extension = reinterpret_cast<const ze_base_desc_t *>(extension->pNext)) {
+        ze_result_t result = ZE_RESULT_SUCCESS;
+        switch (static_cast<uint32_t>(extension->stype)) {
+        case ZE_STRUCTURE_TYPE_MUTABLE_KERNEL_ARGUMENT_EXP_DESC:
+            result = validateMutableKernelArgument(*reinterpret_cast<const ze_mutable_kernel_argument_exp_desc_t *>(extension));
+            break;
+        case ZE_STRUCTURE_TYPE_MUTABLE_GROUP_COUNT_EXP_DESC:
+            result = validateMutableGroupCount(*reinterpret_cast<const ze_mutable_group_count_exp_desc_t *>(extension));
+            break;
+        case ZE_STRUCTURE_TYPE_MUTABLE_GLOBAL_OFFSET_EXP_DESC:
+            result = validateMutableGlobalOffset(*reinterpret_cast<const ze_mutable_global_offset_exp_desc_t *>(extension));
+            break;
+        default:
+            result = ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+            break;
+        }
+        if (result != ZE_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+
+    for (auto extension = reinterpret_cast<const ze_base_desc_t *>(desc->pNext); extension; extension = reinterpret_cast<const ze_base_desc_t *>(extension->pNext)) {
+        switch (static_cast<uint32_t>(extension->stype)) {
+        case ZE_STRUCTURE_TYPE_MUTABLE_KERNEL_ARGUMENT_EXP_DESC:
+            updateMutableKernelArgument(*reinterpret_cast<const ze_mutable_kernel_argument_exp_desc_t *>(extension));
+            break;
+        case ZE_STRUCTURE_TYPE_MUTABLE_GROUP_COUNT_EXP_DESC:
+            updateMutableGroupCount(*reinterpret_cast<const ze_mutable_group_count_exp_desc_t *>(extension));
+            break;
+        case ZE_STRUCTURE_TYPE_MUTABLE_GLOBAL_OFFSET_EXP_DESC:
+            updateMutableGlobalOffset(*reinterpret_cast<const ze_mutable_global_offset_exp_desc_t *>(extension));
+            break;
+        default:
+            UNRECOVERABLE_IF(true);
+            break;
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t CommandListImp::validateMutableKernelArgument(const ze_mutable_kernel_argument_exp_desc_t &desc) {
+    auto command = getMutableKernelCommand(desc.commandId, ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS);
+    if (command == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    const auto &explicitArgs = command->kernel->getImmutableData()->getDescriptor().payloadMappings.explicitArgs;
+    if (desc.argIndex >= explicitArgs.size()) {
+        return ZE_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX;
+    }
+
+    const auto &arg = explicitArgs[desc.argIndex];
+    if (arg.is<NEO::ArgDescriptor::argTValue>()) {
+        for (const auto &element : arg.as<NEO::ArgDescValue>().elements) {
+            if (element.sourceOffset >= desc.argSize) {
+                return ZE_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE;
+            }
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+    if (arg.is<NEO::ArgDescriptor::argTPointer>()) {
+        const auto &argAsPtr = arg.as<NEO::ArgDescPointer>();
+        // surface states and local memory offsets are not part of the walker's cross thread data
+        if (arg.getTraits().getAddressQualifier() == NEO::KernelArgMetadata::AddrLocal ||
+            NEO::isValidOffset(argAsPtr.bindful) || NEO::isValidOffset(argAsPtr.bindless)) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+        if (desc.argSize != sizeof(void *)) {
+            return ZE_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_SIZE;
+        }
+        if (desc.pArgValue && *reinterpret_cast<void *const *>(desc.pArgValue)) {
+            auto allocData = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(*reinterpret_cast<void *const *>(desc.pArgValue));
+            if (allocData == nullptr) {
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+            }
+            if (allocData->allocationFlagsProperty.flags.locallyUncachedResource) {
+                return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+            }
+            if (allocData->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex()) == nullptr) {
+                return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+            }
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+    return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+}
+
+void CommandListImp::updateMutableKernelArgument(const ze_mutable_kernel_argument_exp_desc_t &desc) {
+    auto command = getMutableKernelCommand(desc.commandId, ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS);
+    auto previousCrossThreadData = command->crossThreadData;
+    auto crossThreadData = ArrayRef<uint8_t>(command->crossThreadData.data(), command->crossThreadData.size());
+    const auto &arg = command->kernel->getImmutableData()->getDescriptor().payloadMappings.explicitArgs[desc.argIndex];
+
+    if (arg.is<NEO::ArgDescriptor::argTValue>()) {
+        for (const auto &element : arg.as<NEO::ArgDescValue>().elements) {
+            auto bytesToCopy = std::min(static_cast<size_t>(element.size), desc.argSize - element.sourceOffset);
+            auto pDst = ptrOffset(command->crossThreadData.data(), element.offset);
+            if (desc.pArgValue) {
+                memcpy_s(pDst, element.size, ptrOffset(desc.pArgValue, element.sourceOffset), bytesToCopy);
+            } else {
+                memset(pDst, 0, bytesToCopy);
+            }
+        }
+    } else {
+        uintptr_t gpuAddress = 0u;
+        auto requestedAddress = desc.pArgValue ? *reinterpret_cast<void *const *>(desc.pArgValue) : nullptr;
+        if (requestedAddress) {
+            auto allocData = device->getDriverHandle()->getSvmAllocsManager()->getSVMAlloc(requestedAddress);
+            commandContainer.addToResidencyContainer(allocData->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex()));
+            gpuAddress = reinterpret_cast<uintptr_t>(requestedAddress);
+        }
+        NEO::patchPointer(crossThreadData, arg.as<NEO::ArgDescPointer>(), gpuAddress);
+    }
+
+    writeMutableCrossThreadData(*command, previousCrossThreadData);
+}
+
+ze_result_t CommandListImp::validateMutableGroupCount(const ze_mutable_group_count_exp_desc_t &desc) {
+    auto command = getMutableKernelCommand(desc.commandId, ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_COUNT);
+    if (command == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (desc.pGroupCount == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+    const auto &groupCount = *desc.pGroupCount;
+    if (groupCount.groupCountX == 0 || groupCount.groupCountY == 0 || groupCount.groupCountZ == 0) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (command->kernel->getImmutableData()->getDescriptor().kernelAttributes.flags.usesSystolicPipelineSelectMode ||
+        !isMutableGroupCountSupported(*command)) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+void CommandListImp::updateMutableGroupCount(const ze_mutable_group_count_exp_desc_t &desc) {
+    auto command = getMutableKernelCommand(desc.commandId, ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_COUNT);
+    const auto &groupCount = *desc.pGroupCount;
+    programMutableGroupCount(*command, groupCount);
+
+    auto previousCrossThreadData = command->crossThreadData;
+    auto crossThreadData = ArrayRef<uint8_t>(command->crossThreadData.data(), command->crossThreadData.size());
+    const auto &dispatchTraits = command->kernel->getImmutableData()->getDescriptor().payloadMappings.dispatchTraits;
+
+    uint32_t groupCounts[3] = {groupCount.groupCountX, groupCount.groupCountY, groupCount.groupCountZ};
+    uint32_t globalWorkSize[3] = {groupCounts[0] * command->groupSize[0], groupCounts[1] * command->groupSize[1], groupCounts[2] * command->groupSize[2]};
+    NEO::patchVecNonPointer(crossThreadData, dispatchTraits.globalWorkSize, globalWorkSize);
+    NEO::patchVecNonPointer(crossThreadData, dispatchTraits.numWorkGroups, groupCounts);
+
+    uint32_t workDim = 1;
+    if (globalWorkSize[2] > 1) {
+        workDim = 3;
+    } else if (globalWorkSize[1] > 1) {
+        workDim = 2;
+    }
+    if (NEO::isValidOffset(dispatchTraits.workDim)) {
+        NEO::patchNonPointer<uint32_t, uint32_t>(crossThreadData, dispatchTraits.workDim, workDim);
+    }
+
+    writeMutableCrossThreadData(*command, previousCrossThreadData);
+}
+
+ze_result_t CommandListImp::validateMutableGlobalOffset(const ze_mutable_global_offset_exp_desc_t &desc) {
+    if (getMutableKernelCommand(desc.commandId, ZE_MUTABLE_COMMAND_EXP_FLAG_GLOBAL_OFFSET) == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+void CommandListImp::updateMutableGlobalOffset(const ze_mutable_global_offset_exp_desc_t &desc) {
+    auto command = getMutableKernelCommand(desc.commandId, ZE_MUTABLE_COMMAND_EXP_FLAG_GLOBAL_OFFSET);
+    auto previousCrossThreadData = command->crossThreadData;
+    const auto &dispatchTraits = command->kernel->getImmutableData()->getDescriptor().payloadMappings.dispatchTraits;
+    uint32_t globalOffsets[3] = {desc.offsetX, desc.offsetY, desc.offsetZ};
+    NEO::patchVecNonPointer(ArrayRef<uint8_t>(command->crossThreadData.data(), command->crossThreadData.size()), dispatchTraits.globalWorkOffset, globalOffsets);
+
+    writeMutableCrossThreadData(*command, previousCrossThreadData);
+}
+
+bool CommandListImp::updateMutableCrossThreadData(uint64_t commandId, const std::vector<uint8_t> &crossThreadData) {
+    auto command = getMutableKernelCommand(commandId, ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS);
+    if (command == nullptr || command->crossThreadData.size() != crossThreadData.size()) {
+        return false;
+    }
+    auto previousCrossThreadData = std::move(command->crossThreadData);
+    command->crossThreadData = crossThreadData;
+    writeMutableCrossThreadData(*command, previousCrossThreadData);
+    return true;
+}
+
+void CommandListImp::writeMutableCrossThreadData(MutableKernelCommand &command, const std::vector<uint8_t> &previousCrossThreadData) {
+    const auto size = command.crossThreadData.size();
+    size_t offset = 0;
+    while (offset < size) {
+        if (command.crossThreadData[offset] == previousCrossThreadData[offset]) {
+            offset++;
+            continue;
+        }
+        auto end = offset + 1;
+        while (end < size && command.crossThreadData[end] != previousCrossThreadData[end]) {
+            end++;
+        }
+
+        if (offset < command.inlineDataSize) {
+            auto inlineEnd = std::min(end, command.inlineDataSize);
+            memcpy_s(ptrOffset(command.inlineData, offset), inlineEnd - offset, &command.crossThreadData[offset], inlineEnd - offset);
+        }
+        if (end > command.inlineDataSize) {
+            auto start = std::max(offset, command.inlineDataSize);
+            memcpy_s(ptrOffset(command.indirectData, start - command.inlineDataSize), end - start, &command.crossThreadData[start], end - start);
+        }
+        offset = end;
+    }
+}
+
+ze_result_t CommandListImp::updateMutableCommandSignalEvent(uint64_t commandId, ze_event_handle_t hSignalEvent) {
+    auto command = getMutableKernelCommand(commandId, ZE_MUTABLE_COMMAND_EXP_FLAG_SIGNAL_EVENT);
+    if (command == nullptr || !command->signalEvent.has_value()) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (hSignalEvent == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+    }
+    auto event = Event::fromHandle(hSignalEvent);
+    auto &eventUse = *command->signalEvent;
+    if (!isMutableEventCompatible(eventUse, *event, true)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    auto eventAddress = event->getGpuAddress(device);
+    for (const auto &patchSite : eventUse.patchSites) {
+        programMutableEventAddress(patchSite, eventAddress + patchSite.offsetInEvent);
+    }
+    commandContainer.addToResidencyContainer(event->getPoolAllocation(device));
+
+    event->resetKernelCountAndPacketUsedCount();
+    event->setPacketsInUse(eventUse.packetsInUse);
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t CommandListImp::updateMutableCommandWaitEvents(uint64_t commandId, uint32_t numWaitEvents, ze_event_handle_t *phWaitEvents) {
+    auto command = getMutableKernelCommand(commandId, ZE_MUTABLE_COMMAND_EXP_FLAG_WAIT_EVENTS);
+    if (command == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+    if (numWaitEvents != command->waitEvents.size()) {
+        return ZE_RESULT_ERROR_INVALID_SIZE;
+    }
+    if (numWaitEvents > 0 && phWaitEvents == nullptr) {
+        return ZE_RESULT_ERROR_INVALID_NULL_POINTER;
+    }
+
+    for (uint32_t i = 0; i < numWaitEvents; i++) {
+        if (phWaitEvents[i] == nullptr) {
+            return ZE_RESULT_ERROR_INVALID_NULL_HANDLE;
+        }
+        if (!isMutableEventCompatible(command->waitEvents[i], *Event::fromHandle(phWaitEvents[i]), false)) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+    }
+
+    for (uint32_t i = 0; i < numWaitEvents; i++) {
+        auto event = Event::fromHandle(phWaitEvents[i]);
+        auto eventAddress = event->getGpuAddress(device);
+        for (const auto &patchSite : command->waitEvents[i].patchSites) {
+            programMutableEventAddress(patchSite, eventAddress + patchSite.offsetInEvent);
+        }
+        commandContainer.addToResidencyContainer(event->getPoolAllocation(device));
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+} // namespace L0
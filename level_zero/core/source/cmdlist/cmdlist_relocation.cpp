@@ -0,0 +1,605 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_container/relocatable_command_buffer.h"
+#include "shared/source/command_stream/linear_stream.h"
+#include "shared/source/device/device.h"
+#include "shared/source/gmm_helper/gmm_helper.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/indirect_heap/indirect_heap.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/unified_memory_manager.h"
+
+#include "level_zero/core/source/cmdlist/cmdlist_imp.h"
+#include "level_zero/core/source/device/device.h"
+#include "level_zero/core/source/driver/driver_handle.h"
+#include "level_zero/core/source/event/event.h"
+#include "level_zero/core/source/kernel/kernel.h"
+
+#include <algorithm>
+#include <type_traits>
+
+namespace L0 {
+
+namespace {
+using namespace NEO::RelocatableCommandBuffer;
+
+enum class RelocatableObjectType : uint32_t {
+    commandBuffer = 0, // index of command buffer
+    heap,              // heap type
+    heapOffsetBase,    // heap type, base of offsets relative to the heap
+    kernelIsa,         // kernel index
+    kernelIsaOffset,   // kernel index, kernel start pointer relative to instruction heap base
+    kernelAllocation,  // kernel index, subIndex is position in kernel immutable data residency
+    usmAllocation,     // index of USM allocation
+    event              // index of event
+};
+
+struct RelocatableObject {
+    RelocatableObjectType type;
+    uint32_t index;
+    uint32_t subIndex;
+    uint32_t reserved;
+};
+
+struct RelocatableCommandListState {
+    uint32_t productFamily;
+    uint32_t deviceId;
+    uint32_t engineGroupType;
+    uint32_t flags;
+    uint32_t ordinal;
+    uint32_t preemptionMode;
+    uint32_t perThreadScratchSize[2];
+    int64_t currentSurfaceStateBaseAddress;
+    int64_t currentDynamicStateBaseAddress;
+    int64_t currentIndirectObjectBaseAddress;
+    int64_t currentBindingTablePoolBaseAddress;
+    bool slmEnabled;
+    bool containsAnyKernel;
+    bool containsCooperativeKernels;
+    bool requiresQueueUncachedMocs;
+    bool containsStatelessUncachedResource;
+    bool indirectAllocationsAllowed;
+    bool indirectHostAllocationsAllowed;
+    bool indirectSharedAllocationsAllowed;
+    bool indirectDeviceAllocationsAllowed;
+    NEO::StreamProperties requiredStreamState;
+    NEO::StreamProperties finalStreamState;
+};
+static_assert(std::is_trivially_copyable_v<RelocatableCommandListState>);
+
+// user data sections follow command buffer and heap sections in this order
+enum UserDataSection : uint32_t {
+    stateSection = 0,
+    objectsSection,
+    residencySection,
+    userDataSectionsCount
+};
+
+constexpr NEO::HeapType relocatableHeapTypes[] = {NEO::HeapType::surfaceState, NEO::HeapType::dynamicState, NEO::HeapType::indirectObject};
+constexpr SectionType relocatableHeapSections[] = {SectionType::surfaceStateHeap, SectionType::dynamicStateHeap, SectionType::indirectObjectHeap};
+
+size_t getEventSize(const Event &event) {
+    return std::max(event.getMaxPacketsCount() * event.getSinglePacketSize(), event.getCompletionFieldOffset() + sizeof(uint64_t));
+}
+
+uint64_t getAddressMask(Device *device) {
+    return maxNBitValue(device->getNEODevice()->getGmmHelper()->getAddressWidth());
+}
+} // namespace
+
+void CommandListImp::resetRelocatableRecording() {
+    relocatableAddressSites.clear();
+    relocatableAppendDepth = 0u;
+    relocatableRecordingComplete = true;
+}
+
+void CommandListImp::setRelocatableStreamEnd() {
+    auto cmdStream = commandContainer.getCommandStream();
+    relocatableStreamBuffer = cmdStream->getGraphicsAllocation();
+    relocatableStreamOffset = cmdStream->getUsed();
+}
+
+void CommandListImp::checkRelocatableStreamEnd() {
+    auto cmdStream = commandContainer.getCommandStream();
+    if (cmdStream->getGraphicsAllocation() != relocatableStreamBuffer || cmdStream->getUsed() != relocatableStreamOffset) {
+        relocatableRecordingComplete = false;
+    }
+}
+
+void CommandListImp::recordRelocatableAddressSite(NEO::LinearStream &stream, const void *address) {
+    relocatableAddressSites.push_back({stream.getGraphicsAllocation(), ptrDiff(address, stream.getCpuBase())});
+}
+
+void CommandListImp::recordRelocatableCommandAddress(CommandToPatch::CommandType type, void *command) {
+    if (!relocatableRecording) {
+        return;
+    }
+    if (command == nullptr) {
+        // address is programmed by command which is not returned by encoder
+        relocatableRecordingComplete = false;
+        return;
+    }
+    recordRelocatableAddressSite(*commandContainer.getCommandStream(), ptrOffset(command, getCommandAddressOffset(type, command)));
+}
+
+void CommandListImp::beginRelocatableAppend() {
+    if (!relocatableRecording || relocatableAppendDepth++ > 0u) {
+        return;
+    }
+    checkRelocatableStreamEnd();
+}
+
+void CommandListImp::endRelocatableAppend() {
+    if (!relocatableRecording || --relocatableAppendDepth > 0u) {
+        return;
+    }
+    setRelocatableStreamEnd();
+}
+
+ze_result_t CommandListImp::serializeRelocatable(const zex_command_list_relocation_desc_t &desc, size_t *pSize, void *pBlob) {
+    auto &cmdBuffers = commandContainer.getCmdBufferAllocations();
+    auto cmdStream = commandContainer.getCommandStream();
+
+    bool unsupportedState = isImmediateType() || isInOrderExecutionEnabled() || this->dispatchCmdListBatchBufferAsPrimary || commandContainer.isUsingPrimaryBuffer() ||
+                            (this->cmdListHeapAddressModel != NEO::HeapAddressModel::privateHeaps) || (this->partitionCount > 1) ||
+                            !commandsToPatch.empty() || !returnPoints.empty() || !printfKernelContainer.empty() || !hostPtrMap.empty() ||
+                            !ownedPrivateAllocations.empty() || !patternAllocations.empty() || this->kernelWithAssertAppended ||
+                            !commandContainer.getSshAllocations().empty() || !commandContainer.getDeallocationContainer().empty() ||
+                            !this->relocatableRecording || !this->relocatableRecordingComplete ||
+                            (cmdBuffers.size() != 1u) || (cmdStream->getGraphicsAllocation() != cmdBuffers.back());
+    if (unsupportedState) {
+        return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+    }
+    if ((desc.numKernels > 0 && desc.phKernels == nullptr) ||
+        (desc.numAllocations > 0 && desc.ppAllocations == nullptr) ||
+        (desc.numEvents > 0 && desc.phEvents == nullptr)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    Writer writer;
+    std::vector<RelocatableObject> objects;
+    std::vector<RelocatableObject> residency;
+    auto addAllocation = [&](uint64_t gpuAddress, uint64_t size, RelocatableObjectType type, uint32_t index, uint32_t subIndex) {
+        objects.push_back({type, index, subIndex, 0u});
+        return writer.addAllocation(gpuAddress, size);
+    };
+
+    struct LocationSection {
+        const NEO::GraphicsAllocation *location;
+        uint32_t sectionIndex;
+        size_t size;
+    };
+    std::vector<LocationSection> locationSections;
+
+    // commands chained between command buffers are not relocated, so only single command buffer is stored
+    auto cmdBuffer = cmdBuffers[0];
+    auto cmdBufferIndex = addAllocation(cmdBuffer->getGpuAddress(), cmdBuffer->getUnderlyingBufferSize(), RelocatableObjectType::commandBuffer, 0u, 0u);
+    auto cmdBufferSection = writer.addSection(SectionType::commandBuffer, cmdBufferIndex, cmdBuffer->getUnderlyingBuffer(), cmdStream->getUsed());
+    locationSections.push_back({cmdBuffer, cmdBufferSection, cmdStream->getUsed()});
+
+    std::vector<NEO::GraphicsAllocation *> ownAllocations(cmdBuffers.begin(), cmdBuffers.end());
+    uint32_t iohOffsetBaseIndex = invalidIndex;
+    uint64_t iohOffsetBase = 0u;
+    for (uint32_t i = 0; i < std::size(relocatableHeapTypes); i++) {
+        auto heap = commandContainer.getIndirectHeap(relocatableHeapTypes[i]);
+        if (heap == nullptr) {
+            continue;
+        }
+        auto allocation = heap->getGraphicsAllocation();
+        auto allocationIndex = addAllocation(allocation->getGpuAddress(), allocation->getUnderlyingBufferSize(), RelocatableObjectType::heap, static_cast<uint32_t>(relocatableHeapTypes[i]), 0u);
+        auto sectionIndex = writer.addSection(relocatableHeapSections[i], allocationIndex, heap->getCpuBase(), heap->getUsed());
+        locationSections.push_back({allocation, sectionIndex, heap->getUsed()});
+        ownAllocations.push_back(allocation);
+
+        if (relocatableHeapTypes[i] == NEO::HeapType::indirectObject) {
+            iohOffsetBase = heap->getHeapGpuStartOffset();
+            iohOffsetBaseIndex = addAllocation(iohOffsetBase, 0u, RelocatableObjectType::heapOffsetBase, static_cast<uint32_t>(NEO::HeapType::indirectObject), 0u);
+        }
+    }
+
+    auto rootDeviceIndex = device->getRootDeviceIndex();
+    std::vector<uint32_t> kernelIsaIndices(desc.numKernels);
+    std::vector<uint32_t> kernelIsaOffsetIndices(desc.numKernels);
+    for (uint32_t i = 0; i < desc.numKernels; i++) {
+        auto kernel = Kernel::fromHandle(desc.phKernels[i]);
+        auto isa = kernel->getIsaAllocation();
+        auto isaOffset = kernel->getIsaOffsetInParentAllocation();
+        kernelIsaIndices[i] = addAllocation(isa->getGpuAddress() + isaOffset, kernel->getImmutableData()->getIsaSize(), RelocatableObjectType::kernelIsa, i, 0u);
+        kernelIsaOffsetIndices[i] = addAllocation(isa->getGpuAddressToPatch() + isaOffset, 0u, RelocatableObjectType::kernelIsaOffset, i, 0u);
+
+        auto &kernelAllocations = kernel->getImmutableData()->getResidencyContainer();
+        for (uint32_t j = 0; j < kernelAllocations.size(); j++) {
+            if (kernelAllocations[j] == nullptr || kernelAllocations[j] == isa) {
+                continue;
+            }
+            addAllocation(kernelAllocations[j]->getGpuAddress(), kernelAllocations[j]->getUnderlyingBufferSize(), RelocatableObjectType::kernelAllocation, i, j);
+        }
+    }
+
+    auto svmAllocsManager = device->getDriverHandle()->getSvmAllocsManager();
+    for (uint32_t i = 0; i < desc.numAllocations; i++) {
+        auto allocData = svmAllocsManager->getSVMAlloc(desc.ppAllocations[i]);
+        if (allocData == nullptr) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        auto allocation = allocData->gpuAllocations.getGraphicsAllocation(rootDeviceIndex);
+        addAllocation(allocation->getGpuAddress(), allocData->size, RelocatableObjectType::usmAllocation, i, 0u);
+    }
+
+    for (uint32_t i = 0; i < desc.numEvents; i++) {
+        auto event = Event::fromHandle(desc.phEvents[i]);
+        if (event->isCounterBased()) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+        addAllocation(event->getGpuAddress(device), getEventSize(*event), RelocatableObjectType::event, i, 0u);
+    }
+
+    // every allocation used by the command list must be recreated on deserialization
+    for (auto allocation : commandContainer.getResidencyContainer()) {
+        if (allocation == nullptr || std::find(ownAllocations.begin(), ownAllocations.end(), allocation) != ownAllocations.end()) {
+            continue;
+        }
+        bool found = false;
+        for (uint32_t i = 0; i < desc.numKernels && !found; i++) {
+            auto kernel = Kernel::fromHandle(desc.phKernels[i]);
+            if (kernel->getIsaAllocation() == allocation) {
+                residency.push_back({RelocatableObjectType::kernelIsa, i, 0u, 0u});
+                found = true;
+                break;
+            }
+            auto &kernelAllocations = kernel->getImmutableData()->getResidencyContainer();
+            auto it = std::find(kernelAllocations.begin(), kernelAllocations.end(), allocation);
+            if (it != kernelAllocations.end()) {
+                residency.push_back({RelocatableObjectType::kernelAllocation, i, static_cast<uint32_t>(it - kernelAllocations.begin()), 0u});
+                found = true;
+            }
+        }
+        for (uint32_t i = 0; i < desc.numAllocations && !found; i++) {
+            auto allocData = svmAllocsManager->getSVMAlloc(desc.ppAllocations[i]);
+            if (allocData->gpuAllocations.getGraphicsAllocation(rootDeviceIndex) == allocation) {
+                residency.push_back({RelocatableObjectType::usmAllocation, i, 0u, 0u});
+                found = true;
+            }
+        }
+        for (uint32_t i = 0; i < desc.numEvents && !found; i++) {
+            if (Event::fromHandle(desc.phEvents[i])->getPoolAllocation(device) == allocation) {
+                residency.push_back({RelocatableObjectType::event, i, 0u, 0u});
+                found = true;
+            }
+        }
+        if (!found) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+    }
+
+    auto addressMask = getAddressMask(device);
+    for (auto &launchSite : kernelLaunchSites) {
+        auto kernelIt = std::find_if(desc.phKernels, desc.phKernels + desc.numKernels, [&](ze_kernel_handle_t hKernel) { return Kernel::fromHandle(hKernel) == launchSite.kernel; });
+        if (kernelIt == desc.phKernels + desc.numKernels || launchSite.cmdBuffer != cmdBuffer) {
+            return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+        }
+        auto kernelIndex = static_cast<uint32_t>(kernelIt - desc.phKernels);
+        auto cmdBufferBase = cmdBuffer->getUnderlyingBuffer();
+
+        auto kernel = Kernel::fromHandle(*kernelIt);
+        if (launchSite.absoluteKernelStartPointer) {
+            auto kernelStartPointer = *reinterpret_cast<const uint64_t *>(ptrOffset(cmdBufferBase, launchSite.kernelStartPointerOffset)) & addressMask;
+            auto isaAddress = (kernel->getIsaAllocation()->getGpuAddress() + kernel->getIsaOffsetInParentAllocation()) & addressMask;
+            if (kernelStartPointer < isaAddress) {
+                return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+            }
+            writer.addRelocation(RelocationType::address64, cmdBufferSection, launchSite.kernelStartPointerOffset, kernelIsaIndices[kernelIndex], kernelStartPointer - isaAddress);
+        } else {
+            auto kernelStartPointer = *reinterpret_cast<const uint32_t *>(ptrOffset(cmdBufferBase, launchSite.kernelStartPointerOffset));
+            auto isaOffsetBase = kernel->getIsaAllocation()->getGpuAddressToPatch() + kernel->getIsaOffsetInParentAllocation();
+            if (kernelStartPointer < isaOffsetBase) {
+                return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+            }
+            writer.addRelocation(RelocationType::address32, cmdBufferSection, launchSite.kernelStartPointerOffset, kernelIsaOffsetIndices[kernelIndex], kernelStartPointer - isaOffsetBase);
+        }
+
+        if (iohOffsetBaseIndex != invalidIndex) {
+            auto indirectDataStartAddress = *reinterpret_cast<const uint32_t *>(ptrOffset(cmdBufferBase, launchSite.indirectDataStartAddressOffset));
+            if (indirectDataStartAddress < iohOffsetBase) {
+                return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+            }
+            writer.addRelocation(RelocationType::address32, cmdBufferSection, launchSite.indirectDataStartAddressOffset, iohOffsetBaseIndex, indirectDataStartAddress - iohOffsetBase);
+        }
+    }
+
+    for (auto &addressSite : relocatableAddressSites) {
+        auto sectionIt = std::find_if(locationSections.begin(), locationSections.end(), [&](const LocationSection &section) { return section.location == addressSite.location; });
+        if (sectionIt == locationSections.end() || addressSite.offset + sizeof(uint64_t) > sectionIt->size ||
+            !writer.addAddressRelocation(sectionIt->sectionIndex, addressSite.offset, addressMask)) {
+            return ZE_RESULT_ERROR_UNSUPPORTED_FEATURE;
+        }
+    }
+
+    auto &hwInfo = device->getHwInfo();
+    RelocatableCommandListState state{};
+    state.productFamily = static_cast<uint32_t>(hwInfo.platform.eProductFamily);
+    state.deviceId = hwInfo.platform.usDeviceID;
+    state.engineGroupType = static_cast<uint32_t>(this->engineGroupType);
+    state.flags = this->flags;
+    state.ordinal = this->ordinal.value_or(invalidIndex);
+    state.preemptionMode = static_cast<uint32_t>(this->commandListPreemptionMode);
+    state.perThreadScratchSize[0] = this->commandListPerThreadScratchSize[0];
+    state.perThreadScratchSize[1] = this->commandListPerThreadScratchSize[1];
+    state.currentSurfaceStateBaseAddress = this->currentSurfaceStateBaseAddress;
+    state.currentDynamicStateBaseAddress = this->currentDynamicStateBaseAddress;
+    state.currentIndirectObjectBaseAddress = this->currentIndirectObjectBaseAddress;
+    state.currentBindingTablePoolBaseAddress = this->currentBindingTablePoolBaseAddress;
+    state.slmEnabled = this->commandListSLMEnabled;
+    state.containsAnyKernel = this->containsAnyKernel;
+    state.containsCooperativeKernels = this->containsCooperativeKernelsFlag;
+    state.requiresQueueUncachedMocs = this->requiresQueueUncachedMocs;
+    state.containsStatelessUncachedResource = this->containsStatelessUncachedResource;
+    state.indirectAllocationsAllowed = this->indirectAllocationsAllowed;
+    state.indirectHostAllocationsAllowed = this->unifiedMemoryControls.indirectHostAllocationsAllowed;
+    state.indirectSharedAllocationsAllowed = this->unifiedMemoryControls.indirectSharedAllocationsAllowed;
+    state.indirectDeviceAllocationsAllowed = this->unifiedMemoryControls.indirectDeviceAllocationsAllowed;
+    state.requiredStreamState = this->requiredStreamState;
+    state.finalStreamState = this->finalStreamState;
+
+    writer.addSection(SectionType::userData, invalidIndex, &state, sizeof(state));
+    writer.addSection(SectionType::userData, invalidIndex, objects.data(), objects.size() * sizeof(RelocatableObject));
+    writer.addSection(SectionType::userData, invalidIndex, residency.data(), residency.size() * sizeof(RelocatableObject));
+
+    auto blobSize = writer.getBlobSize();
+    if (pBlob == nullptr) {
+        *pSize = blobSize;
+        return ZE_RESULT_SUCCESS;
+    }
+    if (*pSize < blobSize) {
+        return ZE_RESULT_ERROR_INVALID_SIZE;
+    }
+    writer.serialize(pBlob);
+    *pSize = blobSize;
+    return ZE_RESULT_SUCCESS;
+}
+
+ze_result_t CommandListImp::createFromRelocatable(Device *device, ze_context_handle_t hContext, const void *blob, size_t size,
+                                                  const zex_command_list_relocation_desc_t &desc, ze_command_list_handle_t *phCommandList) {
+    Reader reader;
+    if (!reader.initialize(blob, size)) {
+        return ZE_RESULT_ERROR_INVALID_NATIVE_BINARY;
+    }
+
+    uint32_t cmdBufferSection = invalidIndex;
+    std::vector<uint32_t> heapSections;
+    std::vector<uint32_t> userDataSections;
+    for (uint32_t i = 0; i < reader.getSectionsCount(); i++) {
+        auto type = reader.getSection(i).type;
+        if (type == SectionType::commandBuffer) {
+            if (cmdBufferSection != invalidIndex) {
+                return ZE_RESULT_ERROR_INVALID_NATIVE_BINARY;
+            }
+            cmdBufferSection = i;
+        } else if (type == SectionType::userData) {
+            userDataSections.push_back(i);
+        } else {
+            heapSections.push_back(i);
+        }
+    }
+    if (cmdBufferSection == invalidIndex || userDataSections.size() != userDataSectionsCount ||
+        reader.getSection(userDataSections[stateSection]).size != sizeof(RelocatableCommandListState) ||
+        reader.getSection(userDataSections[objectsSection]).size != reader.getAllocationsCount() * sizeof(RelocatableObject) ||
+        reader.getSection(userDataSections[residencySection]).size % sizeof(RelocatableObject) != 0u) {
+        return ZE_RESULT_ERROR_INVALID_NATIVE_BINARY;
+    }
+
+    RelocatableCommandListState state{};
+    memcpy_s(&state, sizeof(state), reader.getSectionData(userDataSections[stateSection]), sizeof(state));
+    auto &hwInfo = device->getHwInfo();
+    if (state.productFamily != static_cast<uint32_t>(hwInfo.platform.eProductFamily) || state.deviceId != hwInfo.platform.usDeviceID ||
+        state.engineGroupType >= static_cast<uint32_t>(NEO::EngineGroupType::maxEngineGroups)) {
+        return ZE_RESULT_ERROR_INVALID_NATIVE_BINARY;
+    }
+    if ((desc.numKernels > 0 && desc.phKernels == nullptr) ||
+        (desc.numAllocations > 0 && desc.ppAllocations == nullptr) ||
+        (desc.numEvents > 0 && desc.phEvents == nullptr)) {
+        return ZE_RESULT_ERROR_INVALID_ARGUMENT;
+    }
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    auto commandList = static_cast<CommandListImp *>(CommandList::create(hwInfo.platform.eProductFamily, device, static_cast<NEO::EngineGroupType>(state.engineGroupType),
+                                                                         state.flags, result, false));
+    if (commandList == nullptr) {
+        return result;
+    }
+    auto cleanupAndReturn = [commandList](ze_result_t result) {
+        commandList->destroy();
+        return result;
+    };
+
+    auto &container = commandList->getCmdContainer();
+    auto &cmdBuffers = container.getCmdBufferAllocations();
+    auto rootDeviceIndex = device->getRootDeviceIndex();
+    auto svmAllocsManager = device->getDriverHandle()->getSvmAllocsManager();
+
+    auto getKernel = [&](const RelocatableObject &object) -> Kernel * {
+        return object.index < desc.numKernels ? Kernel::fromHandle(desc.phKernels[object.index]) : nullptr;
+    };
+    auto getUsmAllocation = [&](const RelocatableObject &object, size_t requiredSize) -> NEO::GraphicsAllocation * {
+        if (object.index >= desc.numAllocations) {
+            return nullptr;
+        }
+        auto allocData = svmAllocsManager->getSVMAlloc(desc.ppAllocations[object.index]);
+        return (allocData && allocData->size >= requiredSize) ? allocData->gpuAllocations.getGraphicsAllocation(rootDeviceIndex) : nullptr;
+    };
+    auto getEvent = [&](const RelocatableObject &object) -> Event * {
+        return object.index < desc.numEvents ? Event::fromHandle(desc.phEvents[object.index]) : nullptr;
+    };
+    auto getKernelAllocation = [&](const RelocatableObject &object) -> NEO::GraphicsAllocation * {
+        auto kernel = getKernel(object);
+        if (kernel == nullptr || object.subIndex >= kernel->getImmutableData()->getResidencyContainer().size()) {
+            return nullptr;
+        }
+        return kernel->getImmutableData()->getResidencyContainer()[object.subIndex];
+    };
+
+    std::vector<RelocatableObject> objects(reader.getAllocationsCount());
+    memcpy_s(objects.data(), objects.size() * sizeof(RelocatableObject), reader.getSectionData(userDataSections[objectsSection]), objects.size() * sizeof(RelocatableObject));
+    std::vector<uint64_t> newAddresses(objects.size());
+    for (uint32_t i = 0; i < objects.size(); i++) {
+        auto &object = objects[i];
+        auto &oldAllocation = reader.getAllocation(i);
+
+        switch (object.type) {
+        case RelocatableObjectType::commandBuffer:
+            if (object.index >= cmdBuffers.size()) {
+                return cleanupAndReturn(ZE_RESULT_ERROR_INVALID_NATIVE_BINARY);
+            }
+            newAddresses[i] = cmdBuffers[object.index]->getGpuAddress();
+            break;
+        case RelocatableObjectType::heap:
+        case RelocatableObjectType::heapOffsetBase: {
+            auto heapType = static_cast<NEO::HeapType>(object.index);
+            auto heapIt = std::find(std::begin(relocatableHeapTypes), std::end(relocatableHeapTypes), heapType);
+            auto heap = (heapIt != std::end(relocatableHeapTypes)) ? container.getIndirectHeap(heapType) : nullptr;
+            if (heap == nullptr) {
+                return cleanupAndReturn(ZE_RESULT_ERROR_INVALID_NATIVE_BINARY);
+            }
+            newAddresses[i] = (object.type == RelocatableObjectType::heap) ? heap->getGraphicsAllocation()->getGpuAddress() : heap->getHeapGpuStartOffset();
+            break;
+        }
+        case RelocatableObjectType::kernelIsa:
+        case RelocatableObjectType::kernelIsaOffset: {
+            auto kernel = getKernel(object);
+            if (kernel == nullptr || (object.type == RelocatableObjectType::kernelIsa && kernel->getImmutableData()->getIsaSize() != oldAllocation.size)) {
+                return cleanupAndReturn(ZE_RESULT_ERROR_INVALID_ARGUMENT);
+            }
+            auto isa = kernel->getIsaAllocation();
+            auto isaBase = (object.type == RelocatableObjectType::kernelIsa) ? isa->getGpuAddress() : isa->getGpuAddressToPatch();
+            newAddresses[i] = isaBase + kernel->getIsaOffsetInParentAllocation();
+            break;
+        }
+        case RelocatableObjectType::kernelAllocation: {
+            auto allocation = getKernelAllocation(object);
+            if (allocation == nullptr || allocation->getUnderlyingBufferSize() < oldAllocation.size) {
+                return cleanupAndReturn(ZE_RESULT_ERROR_INVALID_ARGUMENT);
+            }
+            newAddresses[i] = allocation->getGpuAddress();
+            break;
+        }
+        case RelocatableObjectType::usmAllocation: {
+            auto allocation = getUsmAllocation(object, static_cast<size_t>(oldAllocation.size));
+            if (allocation == nullptr) {
+                return cleanupAndReturn(ZE_RESULT_ERROR_INVALID_ARGUMENT);
+            }
+            newAddresses[i] = allocation->getGpuAddress();
+            break;
+        }
+        case RelocatableObjectType::event: {
+            auto event = getEvent(object);
+            if (event == nullptr || event->isCounterBased() || getEventSize(*event) < oldAllocation.size) {
+                return cleanupAndReturn(ZE_RESULT_ERROR_INVALID_ARGUMENT);
+            }
+            newAddresses[i] = event->getGpuAddress(device);
+            break;
+        }
+        default:
+            return cleanupAndReturn(ZE_RESULT_ERROR_INVALID_NATIVE_BINARY);
+        }
+    }
+
+    auto addressMask = getAddressMask(device);
+    auto cmdStream = container.getCommandStream();
+    auto cmdBufferSectionSize = static_cast<size_t>(reader.getSection(cmdBufferSection).size);
+    if (cmdBufferSectionSize > cmdStream->getMaxAvailableSpace() || cmdBufferSectionSize < cmdStream->getUsed()) {
+        return cleanupAndReturn(ZE_RESULT_ERROR_INVALID_NATIVE_BINARY);
+    }
+    memcpy_s(cmdStream->getCpuBase(), cmdStream->getMaxAvailableSpace(), reader.getSectionData(cmdBufferSection), cmdBufferSectionSize);
+    reader.applyRelocations(cmdBufferSection, cmdStream->getCpuBase(), newAddresses.data(), addressMask);
+    cmdStream->getSpace(cmdBufferSectionSize - cmdStream->getUsed());
+
+    for (auto sectionIndex : heapSections) {
+        auto sectionType = reader.getSection(sectionIndex).type;
+        auto sectionIt = std::find(std::begin(relocatableHeapSections), std::end(relocatableHeapSections), sectionType);
+        auto heap = (sectionIt != std::end(relocatableHeapSections)) ? container.getIndirectHeap(relocatableHeapTypes[sectionIt - std::begin(relocatableHeapSections)]) : nullptr;
+        auto sectionSize = static_cast<size_t>(reader.getSection(sectionIndex).size);
+        if (heap == nullptr || sectionSize > heap->getMaxAvailableSpace() || sectionSize < heap->getUsed()) {
+            return cleanupAndReturn(ZE_RESULT_ERROR_INVALID_NATIVE_BINARY);
+        }
+        memcpy_s(heap->getCpuBase(), heap->getMaxAvailableSpace(), reader.getSectionData(sectionIndex), sectionSize);
+        reader.applyRelocations(sectionIndex, heap->getCpuBase(), newAddresses.data(), addressMask);
+        heap->getSpace(sectionSize - heap->getUsed());
+    }
+
+    std::vector<RelocatableObject> residency(static_cast<size_t>(reader.getSection(userDataSections[residencySection]).size / sizeof(RelocatableObject)));
+    memcpy_s(residency.data(), residency.size() * sizeof(RelocatableObject), reader.getSectionData(userDataSections[residencySection]), residency.size() * sizeof(RelocatableObject));
+    for (auto &object : residency) {
+        NEO::GraphicsAllocation *allocation = nullptr;
+        if (object.type == RelocatableObjectType::kernelIsa) {
+            auto kernel = getKernel(object);
+            allocation = kernel ? kernel->getIsaAllocation() : nullptr;
+        } else if (object.type == RelocatableObjectType::kernelAllocation) {
+            allocation = getKernelAllocation(object);
+        } else if (object.type == RelocatableObjectType::usmAllocation) {
+            allocation = getUsmAllocation(object, 0u);
+        } else if (object.type == RelocatableObjectType::event) {
+            auto event = getEvent(object);
+            allocation = event ? event->getPoolAllocation(device) : nullptr;
+        }
+        if (allocation == nullptr) {
+            return cleanupAndReturn(ZE_RESULT_ERROR_INVALID_ARGUMENT);
+        }
+        container.addToResidencyContainer(allocation);
+    }
+    container.removeDuplicatesFromResidencyContainer();
+
+    // heap base addresses tracked in stream properties follow the heaps to their new location
+    auto relocateHeapBase = [&](int64_t &baseAddress) {
+        for (uint32_t i = 0; i < objects.size(); i++) {
+            if (objects[i].type == RelocatableObjectType::heap && static_cast<int64_t>(reader.getAllocation(i).gpuAddress) == baseAddress) {
+                baseAddress = static_cast<int64_t>(newAddresses[i]);
+                return;
+            }
+        }
+    };
+    for (auto streamState : {&state.requiredStreamState, &state.finalStreamState}) {
+        relocateHeapBase(streamState->stateBaseAddress.surfaceStateBaseAddress.value);
+        relocateHeapBase(streamState->stateBaseAddress.bindingTablePoolBaseAddress.value);
+        relocateHeapBase(streamState->stateBaseAddress.dynamicStateBaseAddress.value);
+        relocateHeapBase(streamState->stateBaseAddress.indirectObjectBaseAddress.value);
+    }
+    relocateHeapBase(state.currentSurfaceStateBaseAddress);
+    relocateHeapBase(state.currentBindingTablePoolBaseAddress);
+    relocateHeapBase(state.currentDynamicStateBaseAddress);
+    relocateHeapBase(state.currentIndirectObjectBaseAddress);
+
+    commandList->commandListPreemptionMode = static_cast<NEO::PreemptionMode>(state.preemptionMode);
+    commandList->commandListPerThreadScratchSize[0] = state.perThreadScratchSize[0];
+    commandList->commandListPerThreadScratchSize[1] = state.perThreadScratchSize[1];
+    commandList->currentSurfaceStateBaseAddress = state.currentSurfaceStateBaseAddress;
+    commandList->currentDynamicStateBaseAddress = state.currentDynamicStateBaseAddress;
+    commandList->currentIndirectObjectBaseAddress = state.currentIndirectObjectBaseAddress;
+    commandList->currentBindingTablePoolBaseAddress = state.currentBindingTablePoolBaseAddress;
+    commandList->commandListSLMEnabled = state.slmEnabled;
+    commandList->containsAnyKernel = state.containsAnyKernel;
+    commandList->containsCooperativeKernelsFlag = state.containsCooperativeKernels;
+    commandList->requiresQueueUncachedMocs = state.requiresQueueUncachedMocs;
+    commandList->containsStatelessUncachedResource = state.containsStatelessUncachedResource;
+    commandList->indirectAllocationsAllowed = state.indirectAllocationsAllowed;
+    commandList->unifiedMemoryControls.indirectHostAllocationsAllowed = state.indirectHostAllocationsAllowed;
+    commandList->unifiedMemoryControls.indirectSharedAllocationsAllowed = state.indirectSharedAllocationsAllowed;
+    commandList->unifiedMemoryControls.indirectDeviceAllocationsAllowed = state.indirectDeviceAllocationsAllowed;
+    commandList->requiredStreamState = state.requiredStreamState;
+    commandList->finalStreamState = state.finalStreamState;
+    if (state.ordinal != invalidIndex) {
+        commandList->setOrdinal(state.ordinal);
+    }
+    commandList->setCmdListContext(hContext);
+
+    *phCommandList = commandList->toHandle();
+    return ZE_RESULT_SUCCESS;
+}
+
+} // namespace L0
@@ -34,12 +34,21 @@ void *ExtensionFunctionAddressHelper::getExtensionFunctionAddress(std::string fu
     RETURN_FUNC_PTR_IF_EXIST(zexCommandListAppendWaitOnMemory);
     RETURN_FUNC_PTR_IF_EXIST(zexCommandListAppendWaitOnMemory64);
     RETURN_FUNC_PTR_IF_EXIST(zexCommandListAppendWriteToMemory);
+    RETURN_FUNC_PTR_IF_EXIST(zexCommandListSerialize);
+    RETURN_FUNC_PTR_IF_EXIST(zexCommandListDeserialize);
 
     RETURN_FUNC_PTR_IF_EXIST(zexCounterBasedEventCreate);
     RETURN_FUNC_PTR_IF_EXIST(zexEventGetDeviceAddress);
+    RETURN_FUNC_PTR_IF_EXIST(zexEventQueryKernelTimestamps);
+    RETURN_FUNC_PTR_IF_EXIST(zexEventHostSynchronizeMultiple);
 
     RETURN_FUNC_PTR_IF_EXIST(zeMemGetPitchFor2dImage);
     RETURN_FUNC_PTR_IF_EXIST(zeImageGetDeviceOffsetExp);
+
+    RETURN_FUNC_PTR_IF_EXIST(zeCommandListGetNextCommandIdExp);
+    RETURN_FUNC_PTR_IF_EXIST(zeCommandListUpdateMutableCommandsExp);
+    RETURN_FUNC_PTR_IF_EXIST(zeCommandListUpdateMutableCommandSignalEventExp);
+    RETURN_FUNC_PTR_IF_EXIST(zeCommandListUpdateMutableCommandWaitEventsExp);
 #undef RETURN_FUNC_PTR_IF_EXIST
 
     return ExtensionFunctionAddressHelper::getAdditionalExtensionFunctionAddress(functionName);
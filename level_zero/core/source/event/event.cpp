@@ -17,6 +17,7 @@
 #include "shared/source/helpers/constants.h"
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/string.h"
+#include "shared/source/helpers/timestamp_conversion.h"
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/memory_operations_handler.h"
@@ -33,6 +34,9 @@
 #include "level_zero/core/source/event/event_impl.inl"
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 
+#include <algorithm>
+#include <map>
+#include <numeric>
 #include <set>
 
 namespace L0 {
@@ -381,6 +385,206 @@ ze_result_t EventPool::openEventPoolIpcHandle(const ze_ipc_event_pool_handle_t &
     return ZE_RESULT_SUCCESS;
 }
 
+ze_result_t Event::hostSynchronizeMultiple(uint32_t numEvents, ze_event_handle_t *phEvents, uint64_t timeout) {
+    if (NEO::debugManager.flags.OverrideEventSynchronizeTimeout.get() != -1) {
+        timeout = NEO::debugManager.flags.OverrideEventSynchronizeTimeout.get();
+    }
+
+    // counter based events sharing a counter complete in order of their signal values,
+    // only the one with the highest value is waited on, the rest is released once it completes
+    std::vector<Event *> pendingEvents;
+    std::vector<Event *> coveredEvents;
+    std::map<std::pair<const NEO::InOrderExecInfo *, uint32_t>, size_t> counterWaits;
+    pendingEvents.reserve(numEvents);
+    for (uint32_t i = 0; i < numEvents; i++) {
+        auto event = Event::fromHandle(phEvents[i]);
+        if (!event->isCounterBased() || !event->inOrderExecInfo) {
+            pendingEvents.push_back(event);
+            continue;
+        }
+        auto [counterWait, inserted] = counterWaits.emplace(std::make_pair(event->inOrderExecInfo.get(), event->inOrderAllocationOffset), pendingEvents.size());
+        if (inserted) {
+            pendingEvents.push_back(event);
+            continue;
+        }
+        auto &waitedEvent = pendingEvents[counterWait->second];
+        if (event->getInOrderExecSignalValueWithSubmissionCounter() > waitedEvent->getInOrderExecSignalValueWithSubmissionCounter()) {
+            std::swap(event, waitedEvent);
+        }
+        coveredEvents.push_back(event);
+    }
+
+    auto waitStartTime = std::chrono::high_resolution_clock::now();
+    auto lastHangCheckTime = waitStartTime;
+    StackVec<NEO::CommandStreamReceiver *, 4> csrsToCheck;
+    constexpr uint32_t maxPausesBetweenPasses = 1024u;
+    uint32_t pausesBetweenPasses = NEO::WaitUtils::waitCount;
+    while (true) {
+        if (pendingEvents.empty()) {
+            if (coveredEvents.empty()) {
+                return ZE_RESULT_SUCCESS;
+            }
+            pendingEvents.swap(coveredEvents);
+        }
+
+        auto currentTime = std::chrono::high_resolution_clock::now();
+        uint64_t timeDiff = std::chrono::duration_cast<std::chrono::nanoseconds>(currentTime - waitStartTime).count();
+        if (pendingEvents.size() == 1u) {
+            // single wait left, use event's own wait which may block in KMD instead of polling
+            auto remainingTimeout = (timeout == std::numeric_limits<uint64_t>::max()) ? timeout : timeout - std::min(timeout, timeDiff);
+            auto ret = pendingEvents[0]->hostSynchronize(remainingTimeout);
+            if (ret != ZE_RESULT_SUCCESS) {
+                return ret;
+            }
+            pendingEvents.clear();
+            continue;
+        }
+
+        auto pendingEventsCount = pendingEvents.size();
+        pendingEvents.erase(std::remove_if(pendingEvents.begin(), pendingEvents.end(), [](Event *event) {
+                                return event->hostSynchronizePoll() == ZE_RESULT_SUCCESS;
+                            }),
+                            pendingEvents.end());
+        if (pendingEvents.empty()) {
+            continue;
+        }
+
+        // back off while no event completes, pause count is doubled after every idle pass
+        if (pendingEvents.size() < pendingEventsCount) {
+            pausesBetweenPasses = NEO::WaitUtils::waitCount;
+        } else {
+            pausesBetweenPasses = std::min(std::max(pausesBetweenPasses * 2, 1u), maxPausesBetweenPasses);
+        }
+        for (uint32_t i = 0; i < pausesBetweenPasses; i++) {
+            NEO::CpuIntrinsics::pause();
+        }
+        if (pausesBetweenPasses == maxPausesBetweenPasses) {
+            std::this_thread::yield();
+        }
+
+        currentTime = std::chrono::high_resolution_clock::now();
+        if (std::chrono::duration_cast<std::chrono::microseconds>(currentTime - lastHangCheckTime) >= pendingEvents[0]->gpuHangCheckPeriod) {
+            lastHangCheckTime = currentTime;
+            csrsToCheck.clear();
+            for (auto event : pendingEvents) {
+                if (std::find(csrsToCheck.begin(), csrsToCheck.end(), event->csrs[0]) == csrsToCheck.end()) {
+                    csrsToCheck.push_back(event->csrs[0]);
+                }
+            }
+            for (auto csr : csrsToCheck) {
+                if (csr->isGpuHangDetected()) {
+                    return ZE_RESULT_ERROR_DEVICE_LOST;
+                }
+            }
+        }
+
+        if (timeout == std::numeric_limits<uint64_t>::max()) {
+            continue;
+        }
+        timeDiff = std::chrono::duration_cast<std::chrono::nanoseconds>(currentTime - waitStartTime).count();
+        if (timeDiff >= timeout) {
+            return ZE_RESULT_NOT_READY;
+        }
+    }
+}
+
+ze_result_t Event::queryKernelTimestamps(uint32_t numEvents, ze_event_handle_t *phEvents, ze_kernel_timestamp_result_t *pKernelTimestamps,
+                                         ze_kernel_timestamp_result_t *pKernelTimestampsInNs) {
+    ze_result_t status = ZE_RESULT_SUCCESS;
+
+    // Packets of adjacent events from the same pool are copied from event pool memory in one pass and read from that copy
+    std::vector<uint32_t> eventsOrder(numEvents);
+    std::iota(eventsOrder.begin(), eventsOrder.end(), 0u);
+    std::sort(eventsOrder.begin(), eventsOrder.end(), [phEvents](uint32_t lhs, uint32_t rhs) {
+        auto lhsEvent = Event::fromHandle(phEvents[lhs]);
+        auto rhsEvent = Event::fromHandle(phEvents[rhs]);
+        return std::make_pair(castToUint64(lhsEvent->eventPool), castToUint64(lhsEvent->getHostAddress())) < std::make_pair(castToUint64(rhsEvent->eventPool), castToUint64(rhsEvent->getHostAddress()));
+    });
+
+    std::vector<uint8_t> packetsCopy;
+    uint32_t firstInRun = 0;
+    while (firstInRun < numEvents) {
+        auto firstEvent = Event::fromHandle(phEvents[eventsOrder[firstInRun]]);
+        auto runStart = castToUint64(firstEvent->getHostAddress());
+        auto runEnd = runStart + firstEvent->getPacketsToWaitSize();
+        uint32_t eventsInRun = 1;
+        bool runCopied = false;
+        if (firstEvent->eventPool != nullptr && runStart != 0u) {
+            while (firstInRun + eventsInRun < numEvents) {
+                auto event = Event::fromHandle(phEvents[eventsOrder[firstInRun + eventsInRun]]);
+                auto eventStart = castToUint64(event->getHostAddress());
+                if (event->eventPool != firstEvent->eventPool || eventStart > runEnd + event->getTotalEventSize()) {
+                    break;
+                }
+                runEnd = std::max(runEnd, eventStart + event->getPacketsToWaitSize());
+                eventsInRun++;
+            }
+            packetsCopy.resize(static_cast<size_t>(runEnd - runStart));
+            runCopied = !packetsCopy.empty();
+            if (runCopied) {
+                memcpy_s(packetsCopy.data(), packetsCopy.size(), firstEvent->getHostAddress(), packetsCopy.size());
+            }
+        }
+
+        for (uint32_t i = firstInRun; i < firstInRun + eventsInRun; i++) {
+            auto eventIndex = eventsOrder[i];
+            auto event = Event::fromHandle(phEvents[eventIndex]);
+            auto eventStatus = runCopied ? event->queryKernelTimestampFromPackets(ptrOffset(packetsCopy.data(), static_cast<size_t>(castToUint64(event->getHostAddress()) - runStart)), &pKernelTimestamps[eventIndex])
+                                         : event->queryKernelTimestamp(&pKernelTimestamps[eventIndex]);
+            if (eventStatus != ZE_RESULT_SUCCESS) {
+                pKernelTimestamps[eventIndex] = {};
+                status = ZE_RESULT_NOT_READY;
+            }
+        }
+        firstInRun += eventsInRun;
+    }
+
+    if (pKernelTimestampsInNs == nullptr) {
+        return status;
+    }
+
+    // Global and context intervals of consecutive events from the same device are staged together and converted in one pass
+    constexpr uint32_t intervalsPerEvent = 2u;
+    constexpr uint32_t maxEventsInBatch = static_cast<uint32_t>(NEO::TimestampConversion::batchSize / intervalsPerEvent);
+    uint64_t startTicks[NEO::TimestampConversion::batchSize];
+    uint64_t endTicks[NEO::TimestampConversion::batchSize];
+    uint64_t startNs[NEO::TimestampConversion::batchSize];
+    uint64_t endNs[NEO::TimestampConversion::batchSize];
+
+    uint32_t firstEvent = 0;
+    while (firstEvent < numEvents) {
+        auto device = Event::fromHandle(phEvents[firstEvent])->device;
+        uint32_t eventsInBatch = 1;
+        while ((firstEvent + eventsInBatch < numEvents) && (eventsInBatch < maxEventsInBatch) &&
+               (Event::fromHandle(phEvents[firstEvent + eventsInBatch])->device == device)) {
+            eventsInBatch++;
+        }
+
+        for (uint32_t i = 0; i < eventsInBatch; i++) {
+            const auto &timestamps = pKernelTimestamps[firstEvent + i];
+            startTicks[intervalsPerEvent * i] = timestamps.global.kernelStart;
+            endTicks[intervalsPerEvent * i] = timestamps.global.kernelEnd;
+            startTicks[intervalsPerEvent * i + 1] = timestamps.context.kernelStart;
+            endTicks[intervalsPerEvent * i + 1] = timestamps.context.kernelEnd;
+        }
+
+        auto neoDevice = device->getNEODevice();
+        const auto resolution = neoDevice->getDeviceInfo().profilingTimerResolution;
+        const auto validBitsMask = maxNBitValue(neoDevice->getHardwareInfo().capabilityTable.kernelTimestampValidBits);
+        NEO::TimestampConversion::convertIntervalsToNs(startTicks, endTicks, startNs, endNs, intervalsPerEvent * eventsInBatch, resolution, validBitsMask);
+
+        for (uint32_t i = 0; i < eventsInBatch; i++) {
+            auto &timestampsInNs = pKernelTimestampsInNs[firstEvent + i];
+            timestampsInNs.global.kernelStart = startNs[intervalsPerEvent * i];
+            timestampsInNs.global.kernelEnd = endNs[intervalsPerEvent * i];
+            timestampsInNs.context.kernelStart = startNs[intervalsPerEvent * i + 1];
+            timestampsInNs.context.kernelEnd = endNs[intervalsPerEvent * i + 1];
+        }
+        firstEvent += eventsInBatch;
+    }
+    return status;
+}
+
 ze_result_t Event::destroy() {
     delete this;
     return ZE_RESULT_SUCCESS;
@@ -81,9 +81,13 @@ struct Event : _ze_event_handle_t {
     virtual ze_result_t destroy();
     virtual ze_result_t hostSignal() = 0;
     virtual ze_result_t hostSynchronize(uint64_t timeout) = 0;
+    // Single completion check of hostSynchronize, used to poll multiple events; timeout override does not apply
+    virtual ze_result_t hostSynchronizePoll() { return queryStatus(); }
     virtual ze_result_t queryStatus() = 0;
     virtual ze_result_t reset() = 0;
     virtual ze_result_t queryKernelTimestamp(ze_kernel_timestamp_result_t *dstptr) = 0;
+    // Same as queryKernelTimestamp, but event packets are read from given host copy of event memory
+    virtual ze_result_t queryKernelTimestampFromPackets(const void *packetsCopy, ze_kernel_timestamp_result_t *dstptr) { return queryKernelTimestamp(dstptr); }
     virtual ze_result_t queryTimestampsExp(Device *device, uint32_t *count, ze_kernel_timestamp_result_t *timestamps) = 0;
     virtual ze_result_t queryKernelTimestampsExt(Device *device, uint32_t *pCount, ze_event_query_kernel_timestamps_results_ext_properties_t *pResults) = 0;
     virtual ze_result_t getEventPool(ze_event_pool_handle_t *phEventPool) = 0;
@@ -115,6 +119,12 @@ struct Event : _ze_event_handle_t {
 
     static Event *fromHandle(ze_event_handle_t handle) { return static_cast<Event *>(handle); }
 
+    // Queries kernel timestamps of many events in one call, optionally converting them to nanoseconds in batches
+    static ze_result_t queryKernelTimestamps(uint32_t numEvents, ze_event_handle_t *phEvents, ze_kernel_timestamp_result_t *pKernelTimestamps,
+                                             ze_kernel_timestamp_result_t *pKernelTimestampsInNs);
+    // Waits until all events are signaled, counter based events sharing a counter are waited on once for the highest value
+    static ze_result_t hostSynchronizeMultiple(uint32_t numEvents, ze_event_handle_t *phEvents, uint64_t timeout);
+
     inline ze_event_handle_t toHandle() { return this; }
 
     MOCKABLE_VIRTUAL NEO::GraphicsAllocation *getPoolAllocation(Device *device) const;
@@ -157,6 +167,9 @@ struct Event : _ze_event_handle_t {
     void setSinglePacketSize(size_t size) {
         singlePacketSize = size;
     }
+    uint32_t getTotalEventSize() const {
+        return totalEventSize;
+    }
     size_t getTimestampSizeInDw() const {
         return timestampSizeInDw;
     }
@@ -287,6 +300,9 @@ struct Event : _ze_event_handle_t {
     uint32_t getPacketsToWait() const {
         return this->signalAllEventPackets ? getMaxPacketsCount() : getPacketsInUse();
     }
+    size_t getPacketsToWaitSize() const {
+        return getPacketsToWait() * this->singlePacketSize;
+    }
 
   protected:
     Event(int index, Device *device) : device(device), index(index) {}
@@ -33,12 +33,14 @@ struct EventImp : public Event {
     ze_result_t hostSignal() override;
 
     ze_result_t hostSynchronize(uint64_t timeout) override;
+    ze_result_t hostSynchronizePoll() override;
 
     ze_result_t queryStatus() override;
 
     ze_result_t reset() override;
 
     ze_result_t queryKernelTimestamp(ze_kernel_timestamp_result_t *dstptr) override;
+    ze_result_t queryKernelTimestampFromPackets(const void *packetsCopy, ze_kernel_timestamp_result_t *dstptr) override;
     ze_result_t queryTimestampsExp(Device *device, uint32_t *count, ze_kernel_timestamp_result_t *timestamps) override;
     ze_result_t queryKernelTimestampsExt(Device *device, uint32_t *pCount, ze_event_query_kernel_timestamps_results_ext_properties_t *pResults) override;
     ze_result_t getEventPool(ze_event_pool_handle_t *phEventPool) override;
@@ -63,9 +65,12 @@ struct EventImp : public Event {
     bool handlePreQueryStatusOperationsAndCheckCompletion();
 
     ze_result_t calculateProfilingData();
+    void assignKernelTimestampResult(ze_kernel_timestamp_result_t &result);
     ze_result_t queryStatusEventPackets();
+    ze_result_t queryStatusEventPacketsCopy(const void *packetsCopy);
     ze_result_t queryCounterBasedEventStatus();
     void handleSuccessfulHostSynchronization();
+    void handleHostSynchronizeCompletion();
     MOCKABLE_VIRTUAL ze_result_t hostEventSetValue(TagSizeT eventValue);
     ze_result_t hostEventSetValueTimestamps(TagSizeT eventVal);
     MOCKABLE_VIRTUAL void assignKernelEventCompletionData(void *address);
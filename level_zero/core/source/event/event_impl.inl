@@ -11,6 +11,7 @@
 #include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/sub_device.h"
 #include "shared/source/helpers/hw_info.h"
+#include "shared/source/helpers/timestamp_conversion.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/os_interface/os_context.h"
@@ -304,6 +305,22 @@ ze_result_t EventImp<TagSizeT>::queryStatusEventPackets() {
     return ZE_RESULT_SUCCESS;
 }
 
+template <typename TagSizeT>
+ze_result_t EventImp<TagSizeT>::queryStatusEventPacketsCopy(const void *packetsCopy) {
+    // copy does not change, so completion fields are checked once without waiting
+    auto completionField = ptrOffset(packetsCopy, this->getCompletionFieldOffset());
+    for (uint32_t i = 0; i < this->getPacketsToWait(); i++) {
+        if (*static_cast<const TagSizeT *>(completionField) == static_cast<TagSizeT>(Event::STATE_CLEARED)) {
+            return ZE_RESULT_NOT_READY;
+        }
+        completionField = ptrOffset(completionField, this->singlePacketSize);
+    }
+
+    handleSuccessfulHostSynchronization();
+
+    return ZE_RESULT_SUCCESS;
+}
+
 template <typename TagSizeT>
 bool EventImp<TagSizeT>::handlePreQueryStatusOperationsAndCheckCompletion() {
     if (this->eventPoolAllocation) {
@@ -521,6 +538,34 @@ ze_result_t EventImp<TagSizeT>::waitForUserFence(uint64_t timeout) {
     return ZE_RESULT_SUCCESS;
 }
 
+template <typename TagSizeT>
+void EventImp<TagSizeT>::handleHostSynchronizeCompletion() {
+    if (this->getKernelWithPrintfDeviceMutex() != nullptr) {
+        std::lock_guard<std::mutex> lock(*this->getKernelWithPrintfDeviceMutex());
+        if (!this->getKernelForPrintf().expired()) {
+            this->getKernelForPrintf().lock()->printPrintfOutput(true);
+        }
+        this->resetKernelForPrintf();
+        this->resetKernelWithPrintfDeviceMutex();
+    }
+    if (device->getNEODevice()->getRootDeviceEnvironment().assertHandler.get()) {
+        device->getNEODevice()->getRootDeviceEnvironment().assertHandler->printAssertAndAbort();
+    }
+}
+
+template <typename TagSizeT>
+ze_result_t EventImp<TagSizeT>::hostSynchronizePoll() {
+    if (this->csrs[0]->getType() == NEO::CommandStreamReceiverType::CSR_AUB) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    auto ret = queryStatus();
+    if (ret == ZE_RESULT_SUCCESS) {
+        handleHostSynchronizeCompletion();
+    }
+    return ret;
+}
+
 template <typename TagSizeT>
 ze_result_t EventImp<TagSizeT>::hostSynchronize(uint64_t timeout) {
     std::chrono::microseconds elapsedTimeSinceGpuHangCheck{0};
@@ -546,17 +591,7 @@ ze_result_t EventImp<TagSizeT>::hostSynchronize(uint64_t timeout) {
             ret = queryStatus();
         }
         if (ret == ZE_RESULT_SUCCESS) {
-            if (this->getKernelWithPrintfDeviceMutex() != nullptr) {
-                std::lock_guard<std::mutex> lock(*this->getKernelWithPrintfDeviceMutex());
-                if (!this->getKernelForPrintf().expired()) {
-                    this->getKernelForPrintf().lock()->printPrintfOutput(true);
-                }
-                this->resetKernelForPrintf();
-                this->resetKernelWithPrintfDeviceMutex();
-            }
-            if (device->getNEODevice()->getRootDeviceEnvironment().assertHandler.get()) {
-                device->getNEODevice()->getRootDeviceEnvironment().assertHandler->printAssertAndAbort();
-            }
+            handleHostSynchronizeCompletion();
             return ret;
         }
 
@@ -627,16 +662,37 @@ void EventImp<TagSizeT>::resetDeviceCompletionData(bool resetAllPackets) {
 
 template <typename TagSizeT>
 ze_result_t EventImp<TagSizeT>::queryKernelTimestamp(ze_kernel_timestamp_result_t *dstptr) {
-
-    ze_kernel_timestamp_result_t &result = *dstptr;
-
     if (queryStatus() != ZE_RESULT_SUCCESS) {
         return ZE_RESULT_NOT_READY;
     }
 
     assignKernelEventCompletionData(hostAddress);
     calculateProfilingData();
+    assignKernelTimestampResult(*dstptr);
+    return ZE_RESULT_SUCCESS;
+}
+
+template <typename TagSizeT>
+ze_result_t EventImp<TagSizeT>::queryKernelTimestampFromPackets(const void *packetsCopy, ze_kernel_timestamp_result_t *dstptr) {
+    if (this->tbxMode || this->metricNotification != nullptr || isCounterBased() || this->inOrderExecInfo.get()) {
+        // event memory is downloaded or written during status query, or completion is signaled by counter outside of packets,
+        // so copy taken before status query may be stale
+        return queryKernelTimestamp(dstptr);
+    }
+
+    // completion is checked in the same copy as timestamps, host cached completion may be newer than the copy
+    if (queryStatusEventPacketsCopy(packetsCopy) != ZE_RESULT_SUCCESS) {
+        return ZE_RESULT_NOT_READY;
+    }
+
+    assignKernelEventCompletionData(const_cast<void *>(packetsCopy));
+    calculateProfilingData();
+    assignKernelTimestampResult(*dstptr);
+    return ZE_RESULT_SUCCESS;
+}
 
+template <typename TagSizeT>
+void EventImp<TagSizeT>::assignKernelTimestampResult(ze_kernel_timestamp_result_t &result) {
     auto eventTsSetFunc = [&](uint64_t &timestampFieldToCopy, uint64_t &timestampFieldForWriting) {
         memcpy_s(&(timestampFieldForWriting), sizeof(uint64_t), static_cast<void *>(&timestampFieldToCopy), sizeof(uint64_t));
     };
@@ -653,7 +709,6 @@ ze_result_t EventImp<TagSizeT>::queryKernelTimestamp(ze_kernel_timestamp_result_
         eventTsSetFunc(globalEndTS, result.context.kernelEnd);
         eventTsSetFunc(globalEndTS, result.global.kernelEnd);
     }
-    return ZE_RESULT_SUCCESS;
 }
 
 template <typename TagSizeT>
@@ -713,16 +768,7 @@ void EventImp<TagSizeT>::getSynchronizedKernelTimestamps(ze_synchronized_timesta
     const auto maxKernelTsValue = maxNBitValue(hwInfo.capabilityTable.kernelTimestampValidBits);
 
     auto getDuration = [&](uint64_t startTs, uint64_t endTs) {
-        const uint64_t maxValue = maxKernelTsValue;
-        startTs &= maxValue;
-        endTs &= maxValue;
-
-        if (startTs > endTs) {
-            // Resolve overflows
-            return endTs + (maxValue - startTs);
-        } else {
-            return endTs - startTs;
-        }
+        return NEO::TimestampConversion::getDurationInTicks(startTs, endTs, maxKernelTsValue);
     };
 
     const auto &referenceHostTsInNs = referenceTs.cpuTimeinNS;
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,7 @@ struct _ze_kernel_handle_t {};
 
 namespace NEO {
 class Device;
+class IsaAllocationCache;
 struct KernelInfo;
 class MemoryManager;
 } // namespace NEO
@@ -51,6 +52,8 @@ struct KernelImmutableData {
     uint32_t getIsaSize() const;
     NEO::GraphicsAllocation *getIsaGraphicsAllocation() const;
     void setIsaPerKernelAllocation(NEO::GraphicsAllocation *allocation);
+    void setIsaSharedAllocation(NEO::GraphicsAllocation *allocation, NEO::IsaAllocationCache *cache);
+    bool isIsaSharedAllocation() const { return isaAllocationCache != nullptr; }
     inline NEO::GraphicsAllocation *getIsaParentAllocation() const { return isaParentAllocation; }
     inline void setIsaParentAllocation(NEO::GraphicsAllocation *allocation) { isaParentAllocation = allocation; };
     inline size_t getIsaOffsetInParentAllocation() const { return isaSubAllocationOffset; }
@@ -88,6 +91,7 @@ struct KernelImmutableData {
     NEO::KernelInfo *kernelInfo = nullptr;
     NEO::KernelDescriptor *kernelDescriptor = nullptr;
     std::unique_ptr<NEO::GraphicsAllocation> isaGraphicsAllocation = nullptr;
+    NEO::IsaAllocationCache *isaAllocationCache = nullptr; // owner of shared isaGraphicsAllocation
     NEO::GraphicsAllocation *isaParentAllocation = nullptr;
     size_t isaSubAllocationOffset = 0lu;
     size_t isaSubAllocationSize = 0lu;
@@ -33,6 +33,7 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
+#include "shared/source/program/isa_allocation_cache.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/work_size_info.h"
 #include "shared/source/utilities/arrayref.h"
@@ -59,7 +60,9 @@ namespace L0 {
 KernelImmutableData::KernelImmutableData(L0::Device *l0device) : device(l0device) {}
 
 KernelImmutableData::~KernelImmutableData() {
-    if (nullptr != isaGraphicsAllocation) {
+    if (nullptr != isaAllocationCache) {
+        isaAllocationCache->release(isaGraphicsAllocation.release());
+    } else if (nullptr != isaGraphicsAllocation) {
         this->getDevice()->getNEODevice()->getMemoryManager()->freeGraphicsMemory(isaGraphicsAllocation.release());
     }
     crossThreadDataTemplate.reset();
@@ -247,6 +250,15 @@ void KernelImmutableData::setIsaPerKernelAllocation(NEO::GraphicsAllocation *all
     this->isaGraphicsAllocation.reset(allocation);
 }
 
+void KernelImmutableData::setIsaSharedAllocation(NEO::GraphicsAllocation *allocation, NEO::IsaAllocationCache *cache) {
+    DEBUG_BREAK_IF(this->isaParentAllocation != nullptr);
+    DEBUG_BREAK_IF(this->isaGraphicsAllocation != nullptr);
+    this->isaGraphicsAllocation.reset(allocation);
+    this->isaAllocationCache = cache;
+    // cache uploads ISA before handing out the allocation
+    this->isaCopiedToAllocation = true;
+}
+
 ze_result_t KernelImp::getBaseAddress(uint64_t *baseAddress) {
     if (baseAddress) {
         auto gmmHelper = module->getDevice()->getNEODevice()->getGmmHelper();
@@ -269,6 +281,8 @@ KernelImp::~KernelImp() {
     if (printfBuffer != nullptr) {
         // not allowed to call virtual function on destructor, so calling printOutput directly
         PrintfHandler::printOutput(kernelImmData, this->printfBuffer, module->getDevice(), false);
+        // printf strings map is owned by module and may be released together with this kernel
+        PrintfHandler::flushAsyncOutput(module->getDevice());
         module->getDevice()->getNEODevice()->getMemoryManager()->freeGraphicsMemory(printfBuffer);
     }
 
@@ -39,6 +39,7 @@
 #include "shared/source/memory_manager/memory_operations_handler.h"
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/os_interface/os_context.h"
+#include "shared/source/program/isa_allocation_cache.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/source/program/program_initialization.h"
 
@@ -53,6 +54,7 @@
 #include "program_debug_data.h"
 
 #include <algorithm>
+#include <atomic>
 #include <list>
 #include <memory>
 #include <unordered_map>
@@ -309,18 +311,12 @@ ze_result_t ModuleTranslationUnit::createFromNativeBinary(const char *input, siz
         PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "%s\n", decodeErrors.c_str());
         return ZE_RESULT_ERROR_MODULE_BUILD_FAILURE;
     } else {
-        this->irBinary = makeCopy(reinterpret_cast<const char *>(singleDeviceBinary.intermediateRepresentation.begin()), singleDeviceBinary.intermediateRepresentation.size());
         this->irBinarySize = singleDeviceBinary.intermediateRepresentation.size();
         this->options = singleDeviceBinary.buildOptions.str();
         if (singleDeviceBinary.format == NEO::DeviceBinaryFormat::zebin) {
             this->options += " " + NEO::CompilerOptions::enableZebin.str();
         }
 
-        if (false == singleDeviceBinary.debugData.empty()) {
-            this->debugData = makeCopy(reinterpret_cast<const char *>(singleDeviceBinary.debugData.begin()), singleDeviceBinary.debugData.size());
-            this->debugDataSize = singleDeviceBinary.debugData.size();
-        }
-
         this->isGeneratedByIgc = singleDeviceBinary.generator == NEO::GeneratorType::igc;
 
         bool rebuild = NEO::debugManager.flags.RebuildPrecompiledKernels.get() && irBinarySize != 0;
@@ -329,17 +325,35 @@ ze_result_t ModuleTranslationUnit::createFromNativeBinary(const char *input, siz
             driverHandle->clearErrorDescription();
             return ZE_RESULT_ERROR_INVALID_NATIVE_BINARY;
         }
-        if ((false == singleDeviceBinary.deviceBinary.empty()) && (false == rebuild)) {
-            this->unpackedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(singleDeviceBinary.deviceBinary.begin()), singleDeviceBinary.deviceBinary.size());
+        bool useDeviceBinary = (false == singleDeviceBinary.deviceBinary.empty()) && (false == rebuild);
+
+        // Unpacked parts are views into the input. When device binary is used, packed binary has to be retained anyway,
+        // so its single copy is shared by all parts lying within it instead of copying each of them.
+        auto packedBinary = singleDeviceBinary.packedTargetDeviceBinary.empty() ? archive : singleDeviceBinary.packedTargetDeviceBinary;
+        std::shared_ptr<char[]> packedBinaryCopy;
+        if (useDeviceBinary) {
+            packedBinaryCopy = makeCopy<char>(packedBinary.begin(), packedBinary.size());
+        }
+        auto retainPart = [&](ArrayRef<const uint8_t> part) -> std::shared_ptr<char[]> {
+            if (packedBinaryCopy && part.begin() >= packedBinary.begin() && part.end() <= packedBinary.end()) {
+                return std::shared_ptr<char[]>(packedBinaryCopy, packedBinaryCopy.get() + (part.begin() - packedBinary.begin()));
+            }
+            return makeCopy<char>(part.begin(), part.size());
+        };
+
+        this->irBinary = retainPart(singleDeviceBinary.intermediateRepresentation);
+
+        if (false == singleDeviceBinary.debugData.empty()) {
+            this->debugData = retainPart(singleDeviceBinary.debugData);
+            this->debugDataSize = singleDeviceBinary.debugData.size();
+        }
+
+        if (useDeviceBinary) {
+            this->unpackedDeviceBinary = retainPart(singleDeviceBinary.deviceBinary);
             this->unpackedDeviceBinarySize = singleDeviceBinary.deviceBinary.size();
             // If the Native Binary was an Archive, then packedTargetDeviceBinary will be the packed Binary for the Target Device.
-            if (singleDeviceBinary.packedTargetDeviceBinary.size() > 0) {
-                this->packedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(singleDeviceBinary.packedTargetDeviceBinary.begin()), singleDeviceBinary.packedTargetDeviceBinary.size());
-                this->packedDeviceBinarySize = singleDeviceBinary.packedTargetDeviceBinary.size();
-            } else {
-                this->packedDeviceBinary = makeCopy<char>(reinterpret_cast<const char *>(archive.begin()), archive.size());
-                this->packedDeviceBinarySize = archive.size();
-            }
+            this->packedDeviceBinary = packedBinaryCopy;
+            this->packedDeviceBinarySize = packedBinary.size();
         }
     }
 
@@ -503,6 +517,8 @@ void ModuleTranslationUnit::processDebugData() {
 ModuleImp::ModuleImp(Device *device, ModuleBuildLog *moduleBuildLog, ModuleType type)
     : device(device), translationUnit(std::make_unique<ModuleTranslationUnit>(device)),
       moduleBuildLog(moduleBuildLog), kernelsIsaParentRegion(nullptr), type(type) {
+    static std::atomic<uint64_t> dynamicLinkIdsCounter{0u};
+    this->dynamicLinkId = ++dynamicLinkIdsCounter;
     auto &gfxCoreHelper = device->getGfxCoreHelper();
     auto &hwInfo = device->getHwInfo();
     this->isaAllocationPageSize = gfxCoreHelper.useSystemMemoryPlacementForISA(hwInfo) ? MemoryConstants::pageSize : MemoryConstants::pageSize64k;
@@ -790,6 +806,19 @@ ze_result_t ModuleImp::allocateKernelImmutableDatas(size_t kernelsCount) {
 ze_result_t ModuleImp::setIsaGraphicsAllocations() {
     size_t kernelsCount = this->kernelImmDatas.size();
 
+    if (auto isaAllocationCache = this->getIsaAllocationCacheForSharing(); isaAllocationCache != nullptr) {
+        auto neoDevice = this->device->getNEODevice();
+        for (auto i = 0lu; i < kernelsCount; i++) {
+            auto kernelInfo = this->translationUnit->programInfo.kernelInfos[i];
+            auto allocation = isaAllocationCache->acquire(*neoDevice, NEO::AllocationType::kernelIsa, kernelInfo->heapInfo.pKernelHeap, kernelInfo->heapInfo.kernelHeapSize);
+            if (allocation == nullptr) {
+                return ZE_RESULT_ERROR_OUT_OF_DEVICE_MEMORY;
+            }
+            this->kernelImmDatas[i]->setIsaSharedAllocation(allocation, isaAllocationCache);
+        }
+        return ZE_RESULT_SUCCESS;
+    }
+
     auto kernelsChunks = std::vector<std::pair<size_t, size_t>>(kernelsCount);
     size_t kernelsIsaTotalSize = 0lu;
     for (auto i = 0lu; i < kernelsCount; i++) {
@@ -829,6 +858,18 @@ ze_result_t ModuleImp::setIsaGraphicsAllocations() {
     return ZE_RESULT_SUCCESS;
 }
 
+NEO::IsaAllocationCache *ModuleImp::getIsaAllocationCacheForSharing() const {
+    if (NEO::debugManager.flags.EnableKernelIsaDeduplication.get() != 1 || this->type != ModuleType::user || this->device->getL0Debugger()) {
+        return nullptr;
+    }
+    // relocated ISA is specific to its module, only ISA uploaded as is may be shared
+    auto &linkerInput = this->translationUnit->programInfo.linkerInput;
+    if (linkerInput && linkerInput->getTraits().requiresPatchingOfInstructionSegments) {
+        return nullptr;
+    }
+    return this->device->getNEODevice()->getIsaAllocationCache();
+}
+
 size_t ModuleImp::computeKernelIsaAllocationAlignedSizeWithPadding(size_t isaSize, bool lastKernel) {
     auto isaPadding = lastKernel ? this->device->getGfxCoreHelper().getPaddingForISAAllocation() : 0u;
     auto kernelStartPointerAlignment = this->device->getGfxCoreHelper().getKernelIsaPointerAlignment();
@@ -1394,6 +1435,9 @@ ze_result_t ModuleImp::performDynamicLink(uint32_t numModules,
         moduleLinkLog = ModuleBuildLog::create();
         *phLinkLog = moduleLinkLog->toHandle();
     }
+    if (NEO::debugManager.flags.EnableDynamicLinkSymbolTable.get() == 1) {
+        return performDynamicLinkWithSymbolTable(numModules, phModules, moduleLinkLog);
+    }
     for (auto i = 0u; i < numModules; i++) {
         auto moduleId = static_cast<ModuleImp *>(Module::fromHandle(phModules[i]));
         // Add all provided Module's Exported Functions Surface to each Module to allow for all symbols
@@ -1489,40 +1533,174 @@ ze_result_t ModuleImp::performDynamicLink(uint32_t numModules,
         moduleId->isFullyLinked = true;
     }
 
-    {
-        NEO::ExternalFunctionInfosT externalFunctionInfos;
-        NEO::FunctionDependenciesT extFuncDependencies;
-        NEO::KernelDependenciesT kernelDependencies;
-        NEO::KernelDescriptorMapT nameToKernelDescriptor;
-        for (auto i = 0u; i < numModules; i++) {
-            auto moduleId = static_cast<ModuleImp *>(Module::fromHandle(phModules[i]));
-            auto &programInfo = moduleId->translationUnit->programInfo;
-
-            auto toPtrVec = [](auto &inVec, auto &outPtrVec) {
-                auto pos = outPtrVec.size();
-                outPtrVec.resize(pos + inVec.size());
-                for (size_t i = 0; i < inVec.size(); i++) {
-                    outPtrVec[pos + i] = &inVec[i];
-                }
-            };
-            toPtrVec(programInfo.externalFunctions, externalFunctionInfos);
-            if (programInfo.linkerInput) {
-                toPtrVec(programInfo.linkerInput->getFunctionDependencies(), extFuncDependencies);
-                toPtrVec(programInfo.linkerInput->getKernelDependencies(), kernelDependencies);
+    return resolveDynamicLinkDependencies(numModules, phModules);
+}
+
+ze_result_t ModuleImp::resolveDynamicLinkDependencies(uint32_t numModules, ze_module_handle_t *phModules) {
+    const auto driverHandle = static_cast<DriverHandleImp *>((this->getDevice())->getDriverHandle());
+    NEO::ExternalFunctionInfosT externalFunctionInfos;
+    NEO::FunctionDependenciesT extFuncDependencies;
+    NEO::KernelDependenciesT kernelDependencies;
+    NEO::KernelDescriptorMapT nameToKernelDescriptor;
+    for (auto i = 0u; i < numModules; i++) {
+        auto moduleId = static_cast<ModuleImp *>(Module::fromHandle(phModules[i]));
+        auto &programInfo = moduleId->translationUnit->programInfo;
+
+        auto toPtrVec = [](auto &inVec, auto &outPtrVec) {
+            auto pos = outPtrVec.size();
+            outPtrVec.resize(pos + inVec.size());
+            for (size_t i = 0; i < inVec.size(); i++) {
+                outPtrVec[pos + i] = &inVec[i];
             }
+        };
+        toPtrVec(programInfo.externalFunctions, externalFunctionInfos);
+        if (programInfo.linkerInput) {
+            toPtrVec(programInfo.linkerInput->getFunctionDependencies(), extFuncDependencies);
+            toPtrVec(programInfo.linkerInput->getKernelDependencies(), kernelDependencies);
+        }
+
+        for (auto &kernelInfo : programInfo.kernelInfos) {
+            auto &kd = kernelInfo->kernelDescriptor;
+            nameToKernelDescriptor[kd.kernelMetadata.kernelName] = &kd;
+        }
+    }
+    auto error = NEO::resolveExternalDependencies(externalFunctionInfos, kernelDependencies, extFuncDependencies, nameToKernelDescriptor);
+    if (error != NEO::RESOLVE_SUCCESS) {
+        driverHandle->clearErrorDescription();
+        return ZE_RESULT_ERROR_MODULE_LINK_FAILURE;
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+void ModuleImp::prepareIsaSegmentsForPatching() {
+    if (!patchedIsaTempStorage.empty()) {
+        return;
+    }
+    auto &compilerProductHelper = this->device->getNEODevice()->getCompilerProductHelper();
+    patchedIsaTempStorage.reserve(kernelImmDatas.size());
+    for (size_t i = 0; i < kernelImmDatas.size(); i++) {
+        const auto kernelInfo = this->translationUnit->programInfo.kernelInfos.at(i);
+        auto &kernHeapInfo = kernelInfo->heapInfo;
+        const char *originalIsa = reinterpret_cast<const char *>(kernHeapInfo.pKernelHeap);
+        patchedIsaTempStorage.push_back(std::vector<char>(originalIsa, originalIsa + kernHeapInfo.kernelHeapSize));
 
-            for (auto &kernelInfo : programInfo.kernelInfos) {
-                auto &kd = kernelInfo->kernelDescriptor;
-                nameToKernelDescriptor[kd.kernelMetadata.kernelName] = &kd;
+        uintptr_t isaAddressToPatch = 0;
+        if (compilerProductHelper.isHeaplessModeEnabled()) {
+            isaAddressToPatch = static_cast<uintptr_t>(kernelImmDatas.at(i)->getIsaGraphicsAllocation()->getGpuAddress() +
+                                                       kernelImmDatas.at(i)->getIsaOffsetInParentAllocation());
+        } else {
+            isaAddressToPatch = static_cast<uintptr_t>(kernelImmDatas.at(i)->getIsaGraphicsAllocation()->getGpuAddressToPatch() +
+                                                       kernelImmDatas.at(i)->getIsaOffsetInParentAllocation());
+        }
+
+        isaSegmentsForPatching.push_back(NEO::Linker::PatchableSegment{patchedIsaTempStorage.rbegin()->data(), isaAddressToPatch, kernHeapInfo.kernelHeapSize});
+    }
+}
+
+ze_result_t ModuleImp::performDynamicLinkWithSymbolTable(uint32_t numModules, ze_module_handle_t *phModules, ModuleBuildLog *moduleLinkLog) {
+    const auto driverHandle = static_cast<DriverHandleImp *>((this->getDevice())->getDriverHandle());
+
+    std::vector<ModuleImp *> modules(numModules);
+    std::vector<uint64_t> linkedModuleIds(numModules);
+    uint32_t functionSymbolExportEnabledCounter = 0;
+    for (auto i = 0u; i < numModules; i++) {
+        modules[i] = static_cast<ModuleImp *>(Module::fromHandle(phModules[i]));
+        linkedModuleIds[i] = modules[i]->dynamicLinkId;
+        functionSymbolExportEnabledCounter += static_cast<uint32_t>(modules[i]->isFunctionSymbolExportEnabled);
+    }
+    std::sort(linkedModuleIds.begin(), linkedModuleIds.end());
+
+    // Modules already linked against exactly the same set of modules have nothing to resolve, patch nor make resident
+    std::vector<ModuleImp *> modulesToLink;
+    for (auto module : modules) {
+        if (!module->isFullyLinked || module->dynamicLinkedModuleIds != linkedModuleIds) {
+            modulesToLink.push_back(module);
+        }
+    }
+    if (modulesToLink.empty()) {
+        return ZE_RESULT_SUCCESS;
+    }
+
+    NEO::DynamicLinkSymbolTable symbolTable;
+    for (auto module : modules) {
+        symbolTable.addModuleSymbols(module, module->symbols);
+    }
+
+    NEO::ResolvedExternals resolvedExternals;
+    std::vector<ModuleImp *> modulesToPatch;
+    for (auto module : modulesToLink) {
+        for (auto exportingModule : modules) {
+            if (nullptr != exportingModule->exportedFunctionsSurface) {
+                module->importedSymbolAllocations.insert(exportingModule->exportedFunctionsSurface);
+            }
+        }
+        for (auto &kernImmData : module->kernelImmDatas) {
+            kernImmData->getResidencyContainer().insert(kernImmData->getResidencyContainer().end(), module->importedSymbolAllocations.begin(),
+                                                        module->importedSymbolAllocations.end());
+        }
+
+        if (module->isFullyLinked) {
+            continue;
+        }
+
+        size_t numResolvedSymbols = 0u;
+        std::vector<std::string> unresolvedSymbolLogMessages;
+        if (module->translationUnit->programInfo.linkerInput && module->translationUnit->programInfo.linkerInput->getTraits().requiresPatchingOfInstructionSegments) {
+            module->prepareIsaSegmentsForPatching();
+            for (const auto &unresolvedExternal : module->unresolvedExternalsInfo) {
+                auto &relocation = unresolvedExternal.unresolvedRelocation;
+                if (moduleLinkLog) {
+                    std::stringstream logMessage;
+                    logMessage << "Module <" << module << ">: "
+                               << " Unresolved Symbol <" << relocation.symbolName << ">";
+                    unresolvedSymbolLogMessages.push_back(logMessage.str());
+                }
+                auto definition = symbolTable.findDefinition(relocation.symbolName);
+                if (definition == nullptr) {
+                    continue;
+                }
+                auto relocAddress = ptrOffset(module->isaSegmentsForPatching[unresolvedExternal.instructionsSegmentId].hostPointer,
+                                              static_cast<uintptr_t>(relocation.offset));
+                resolvedExternals.push_back({relocAddress, definition->gpuAddress, &relocation});
+                numResolvedSymbols++;
+
+                if (moduleLinkLog) {
+                    std::stringstream logMessage;
+                    logMessage << " Successfully Resolved Thru Dynamic Link to Module <" << definition->exportingModule << ">";
+                    unresolvedSymbolLogMessages.back().append(logMessage.str());
+                }
             }
         }
-        auto error = NEO::resolveExternalDependencies(externalFunctionInfos, kernelDependencies, extFuncDependencies, nameToKernelDescriptor);
-        if (error != NEO::RESOLVE_SUCCESS) {
+        if (moduleLinkLog) {
+            for (auto &logMessage : unresolvedSymbolLogMessages) {
+                moduleLinkLog->appendString(logMessage.c_str(), logMessage.size());
+            }
+        }
+        if (numResolvedSymbols != module->unresolvedExternalsInfo.size()) {
             driverHandle->clearErrorDescription();
+            if (functionSymbolExportEnabledCounter == 0) {
+                driverHandle->setErrorDescription("Dynamic Link Not Supported Without Compiler flag %s\n", BuildOptions::enableLibraryCompile.str().c_str());
+                PRINT_DEBUG_STRING(NEO::debugManager.flags.PrintDebugMessages.get(), stderr, "Dynamic Link Not Supported Without Compiler flag %s\n", BuildOptions::enableLibraryCompile.str().c_str());
+            }
             return ZE_RESULT_ERROR_MODULE_LINK_FAILURE;
         }
+        modulesToPatch.push_back(module);
     }
-    return ZE_RESULT_SUCCESS;
+
+    NEO::patchResolvedExternals(resolvedExternals, NEO::getThreadsCountForPatching(resolvedExternals.size()),
+                                device->getNEODevice()->getExecutionEnvironment()->getThreadPool());
+    for (auto module : modulesToPatch) {
+        module->copyPatchedSegments(module->isaSegmentsForPatching);
+        module->isFullyLinked = true;
+    }
+
+    auto result = resolveDynamicLinkDependencies(numModules, phModules);
+    if (result == ZE_RESULT_SUCCESS) {
+        for (auto module : modulesToLink) {
+            module->dynamicLinkedModuleIds = linkedModuleIds;
+        }
+    }
+    return result;
 }
 
 bool ModuleImp::populateHostGlobalSymbolsMap(std::unordered_map<std::string, std::string> &devToHostNameMapping) {
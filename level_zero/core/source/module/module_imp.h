@@ -22,6 +22,7 @@
 #include <string>
 
 namespace NEO {
+class IsaAllocationCache;
 struct KernelDescriptor;
 
 namespace Zebin::Debug {
@@ -71,16 +72,17 @@ struct ModuleTranslationUnit {
 
     std::string buildLog;
 
-    std::unique_ptr<char[]> irBinary;
+    // Binaries created from native binary may alias single copy of the input
+    std::shared_ptr<char[]> irBinary;
     size_t irBinarySize = 0U;
 
-    std::unique_ptr<char[]> unpackedDeviceBinary;
+    std::shared_ptr<char[]> unpackedDeviceBinary;
     size_t unpackedDeviceBinarySize = 0U;
 
-    std::unique_ptr<char[]> packedDeviceBinary;
+    std::shared_ptr<char[]> packedDeviceBinary;
     size_t packedDeviceBinarySize = 0U;
 
-    std::unique_ptr<char[]> debugData;
+    std::shared_ptr<char[]> debugData;
     size_t debugDataSize = 0U;
     std::vector<char *> alignedvIsas;
 
@@ -169,6 +171,9 @@ struct ModuleImp : public Module {
     ze_result_t allocateKernelImmutableDatas(size_t kernelsCount);
     ze_result_t initializeKernelImmutableDatas();
     void copyPatchedSegments(const NEO::Linker::PatchableSegments &isaSegmentsForPatching);
+    void prepareIsaSegmentsForPatching();
+    ze_result_t performDynamicLinkWithSymbolTable(uint32_t numModules, ze_module_handle_t *phModules, ModuleBuildLog *moduleLinkLog);
+    ze_result_t resolveDynamicLinkDependencies(uint32_t numModules, ze_module_handle_t *phModules);
     void verifyDebugCapabilities();
     void checkIfPrivateMemoryPerDispatchIsNeeded() override;
     NEO::Zebin::Debug::Segments getZebinSegments();
@@ -178,6 +183,7 @@ struct ModuleImp : public Module {
     void notifyModuleDestroy();
     bool populateHostGlobalSymbolsMap(std::unordered_map<std::string, std::string> &devToHostNameMapping);
     ze_result_t setIsaGraphicsAllocations();
+    NEO::IsaAllocationCache *getIsaAllocationCacheForSharing() const;
     void transferIsaSegmentsToAllocation(NEO::Device *neoDevice, const NEO::Linker::PatchableSegments *isaSegmentsForPatching);
     std::pair<const void *, size_t> getKernelHeapPointerAndSize(const std::unique_ptr<KernelImmutableData> &kernelImmData, const NEO::Linker::PatchableSegments *isaSegmentsForPatching);
     MOCKABLE_VIRTUAL size_t computeKernelIsaAllocationAlignedSizeWithPadding(size_t isaSize, bool lastKernel);
@@ -219,6 +225,9 @@ struct ModuleImp : public Module {
 
     NEO::Linker::PatchableSegments isaSegmentsForPatching;
     std::vector<std::vector<char>> patchedIsaTempStorage;
+
+    uint64_t dynamicLinkId = 0u;                  // unique per module, never reused after module destruction
+    std::vector<uint64_t> dynamicLinkedModuleIds; // sorted ids of modules in last successful dynamic link
 };
 
 bool moveBuildOption(std::string &dstOptionsSet, std::string &srcOptionSet, NEO::ConstStringRef dstOptionName, NEO::ConstStringRef srcOptionName);
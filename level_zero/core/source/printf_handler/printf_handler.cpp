@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -14,6 +14,7 @@
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/program/print_formatter.h"
+#include "shared/source/program/printf_drainer.h"
 
 #include "level_zero/core/source/device/device_imp.h"
 
@@ -68,17 +69,30 @@ void PrintfHandler::printOutput(const KernelImmutableData *kernelData,
         }
     }
 
-    NEO::PrintFormatter printfFormatter{
-        printfOutputBuffer,
-        printfOutputSize,
-        using32BitGpuPointers,
-        usesStringMap ? &kernelData->getDescriptor().kernelMetadata.printfStringsMap : nullptr};
-    printfFormatter.printKernelOutput();
+    auto printfStringsMap = usesStringMap ? &kernelData->getDescriptor().kernelMetadata.printfStringsMap : nullptr;
+    auto printfDrainer = device->getNEODevice()->getExecutionEnvironment()->getPrintfDrainer();
+    if (printfDrainer) {
+        printfDrainer->submit(printfOutputBuffer, printfOutputSize, using32BitGpuPointers, printfStringsMap);
+    } else {
+        NEO::PrintFormatter printfFormatter{
+            printfOutputBuffer,
+            printfOutputSize,
+            using32BitGpuPointers,
+            printfStringsMap};
+        printfFormatter.printKernelOutput();
+    }
 
     *reinterpret_cast<uint32_t *>(printfBuffer->getUnderlyingBuffer()) =
         PrintfHandler::printfSurfaceInitialDataSize;
 }
 
+void PrintfHandler::flushAsyncOutput(Device *device) {
+    auto printfDrainer = device->getNEODevice()->getExecutionEnvironment()->printfDrainer.get();
+    if (printfDrainer) {
+        printfDrainer->flush();
+    }
+}
+
 size_t PrintfHandler::getPrintBufferSize() {
     return PrintfHandler::printfBufferSize;
 }
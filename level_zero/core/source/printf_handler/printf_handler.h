@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -25,6 +25,8 @@ struct PrintfHandler {
     static NEO::GraphicsAllocation *createPrintfBuffer(Device *device);
     static void printOutput(const KernelImmutableData *kernelData,
                             NEO::GraphicsAllocation *printfBuffer, Device *device, bool useInternalBlitter);
+    // Waits until output submitted to async printf drainer is written, string maps referenced by it must outlive this call
+    static void flushAsyncOutput(Device *device);
     static size_t getPrintBufferSize();
 
   protected:
@@ -22,6 +22,7 @@ namespace L0 {
 
 template <>
 ze_result_t CommandListCoreFamily<IGFX_XE_HPC_CORE>::appendMemoryPrefetch(const void *ptr, size_t size) {
+    this->pendingMutableCommandId.reset();
     auto svmAllocMgr = device->getDriverHandle()->getSvmAllocsManager();
     auto allocData = svmAllocMgr->getSVMAlloc(ptr);
 
@@ -175,6 +175,9 @@ struct WhiteBox<L0::CommandListCoreFamilyImmediate<gfxCoreFamily>>
     using BaseClass::appendLaunchKernelWithParams;
     using BaseClass::appendMemoryCopyBlitRegion;
     using BaseClass::clearCommandsToPatch;
+    using BaseClass::capturedLaunches;
+    using BaseClass::capturedLaunchesTaskCount;
+    using BaseClass::capturedSequences;
     using BaseClass::cmdListHeapAddressModel;
     using BaseClass::cmdListType;
     using BaseClass::cmdQImmediate;
@@ -190,6 +193,7 @@ struct WhiteBox<L0::CommandListCoreFamilyImmediate<gfxCoreFamily>>
     using BaseClass::enablePatching;
     using BaseClass::engineGroupType;
     using BaseClass::eventSignalPipeControl;
+    using BaseClass::flushCapturedLaunches;
     using BaseClass::finalStreamState;
     using BaseClass::frontEndStateTracking;
     using BaseClass::getDcFlushRequired;
@@ -202,6 +206,7 @@ struct WhiteBox<L0::CommandListCoreFamilyImmediate<gfxCoreFamily>>
     using BaseClass::inOrderPatchCmds;
     using BaseClass::isBcsSplitNeeded;
     using BaseClass::isFlushTaskSubmissionEnabled;
+    using BaseClass::isLaunchCaptureAllowed;
     using BaseClass::isInOrderNonWalkerSignalingRequired;
     using BaseClass::isQwordInOrderCounter;
     using BaseClass::isSyncModeQueue;
@@ -307,6 +312,11 @@ struct MockCommandList : public CommandList {
     ADDMETHOD_NOBASE(close, ze_result_t, ZE_RESULT_SUCCESS, ());
     ADDMETHOD_NOBASE(destroy, ze_result_t, ZE_RESULT_SUCCESS, ());
     ADDMETHOD_NOBASE_VOIDRETURN(patchInOrderCmds, (void));
+    ADDMETHOD_CONST_NOBASE(isMutableGroupCountSupported, bool, true, (const MutableKernelCommand &command));
+    ADDMETHOD_NOBASE_VOIDRETURN(programMutableGroupCount, (MutableKernelCommand & command, const ze_group_count_t &groupCount));
+    ADDMETHOD_CONST_NOBASE(getMutableEventAddress, uint64_t, 0u, (const MutableEventPatchSite &patchSite));
+    ADDMETHOD_CONST_NOBASE(getCommandAddressOffset, size_t, 0u, (CommandToPatch::CommandType type, void *command));
+    ADDMETHOD_NOBASE_VOIDRETURN(programMutableEventAddress, (const MutableEventPatchSite &patchSite, uint64_t address));
 
     ADDMETHOD_NOBASE(appendLaunchKernel, ze_result_t, ZE_RESULT_SUCCESS,
                      (ze_kernel_handle_t kernelHandle,
@@ -137,7 +137,8 @@ HWTEST_F(TestBuiltinFunctionsLibImpl, whenCreateBuiltinFunctionsLibThenImmediate
     lib.ensureInitCompletion();
     EXPECT_TRUE(lib.initAsyncComplete);
     for (uint32_t builtId = 0; builtId < static_cast<uint32_t>(Builtin::count); builtId++) {
-        if (builtId == static_cast<uint32_t>(Builtin::fillBufferImmediate)) {
+        if (builtId == static_cast<uint32_t>(Builtin::fillBufferImmediate) ||
+            builtId == static_cast<uint32_t>(Builtin::copyBufferBytes)) {
             EXPECT_NE(nullptr, lib.builtins[builtId]);
         } else {
             EXPECT_EQ(nullptr, lib.builtins[builtId]);
@@ -145,10 +146,62 @@ HWTEST_F(TestBuiltinFunctionsLibImpl, whenCreateBuiltinFunctionsLibThenImmediate
     }
     uint32_t builtId = static_cast<uint32_t>(Builtin::count) + 1;
     EXPECT_THROW(lib.initBuiltinKernel(static_cast<L0::Builtin>(builtId)), std::exception);
+}
+
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenAsyncInitEnabledWhenGettingAsyncInitializedFunctionThenOnlyThisFunctionIsAwaited) {
+    struct MockBuiltinFunctionsLibImpl : public BuiltinFunctionsLibImpl {
+        using BuiltinFunctionsLibImpl::BuiltinFunctionsLibImpl;
+        using BuiltinFunctionsLibImpl::builtins;
+        using BuiltinFunctionsLibImpl::builtinsInitTasks;
+        using BuiltinFunctionsLibImpl::initAsyncComplete;
+    };
+
+    VariableBackup<UltHwConfig> backup(&ultHwConfig);
+    ultHwConfig.useinitBuiltinsAsyncEnabled = true;
+    MockBuiltinFunctionsLibImpl lib(device, device->getNEODevice()->getBuiltIns());
+
+    EXPECT_TRUE(lib.builtinsInitTasks[static_cast<uint32_t>(Builtin::fillBufferImmediate)].valid());
+    EXPECT_TRUE(lib.builtinsInitTasks[static_cast<uint32_t>(Builtin::copyBufferBytes)].valid());
+    EXPECT_FALSE(lib.builtinsInitTasks[static_cast<uint32_t>(Builtin::fillBufferMiddle)].valid());
+
+    auto fillKernel = lib.getFunction(Builtin::fillBufferImmediate);
+    EXPECT_NE(nullptr, fillKernel);
+    EXPECT_EQ(std::future_status::ready, lib.builtinsInitTasks[static_cast<uint32_t>(Builtin::fillBufferImmediate)].wait_for(std::chrono::seconds(0)));
+    EXPECT_FALSE(lib.initAsyncComplete);
+
+    EXPECT_NE(nullptr, lib.getFunction(Builtin::fillBufferMiddle));
+    EXPECT_FALSE(lib.initAsyncComplete);
+}
+
+HWTEST_F(TestBuiltinFunctionsLibImpl, givenAsyncInitEnabledWhenAccessingBuiltinThroughAnyPathThenItsInitTaskIsAwaitedFirst) {
+    struct MockBuiltinFunctionsLibImpl : public BuiltinFunctionsLibImpl {
+        using BuiltinFunctionsLibImpl::BuiltinFunctionsLibImpl;
+        using BuiltinFunctionsLibImpl::builtins;
+
+        void waitForBuiltinInit(Builtin func) override {
+            waitForBuiltinInitCalled[static_cast<uint32_t>(func)]++;
+            BuiltinFunctionsLibImpl::waitForBuiltinInit(func);
+        }
+        std::array<uint32_t, static_cast<uint32_t>(Builtin::count)> waitForBuiltinInitCalled = {};
+    };
+
+    VariableBackup<UltHwConfig> backup(&ultHwConfig);
+    ultHwConfig.useinitBuiltinsAsyncEnabled = true;
+    MockBuiltinFunctionsLibImpl lib(device, device->getNEODevice()->getBuiltIns());
+
+    for (auto &func : BuiltinFunctionsLibImpl::asyncInitBuiltins) {
+        auto builtId = static_cast<uint32_t>(func);
+
+        EXPECT_NE(nullptr, lib.getFunction(func));
+        EXPECT_EQ(1u, lib.waitForBuiltinInitCalled[builtId]);
+
+        lib.initBuiltinKernel(func);
+        EXPECT_EQ(2u, lib.waitForBuiltinInitCalled[builtId]);
+        EXPECT_NE(nullptr, lib.builtins[builtId]);
+    }
 
-    /* std::async may create a detached thread - completion of the scheduled task can be ensured,
-       but there is no way to ensure that actual OS thread exited and its resources are freed */
-    MemoryManagement::fastLeaksDetectionMode = MemoryManagement::LeakDetectionMode::TURN_OFF_LEAK_DETECTION;
+    lib.initBuiltinKernel(Builtin::fillBufferMiddle);
+    EXPECT_EQ(1u, lib.waitForBuiltinInitCalled[static_cast<uint32_t>(Builtin::fillBufferMiddle)]);
 }
 
 HWTEST_F(TestBuiltinFunctionsLibImpl, givenHeaplessBuiltinsWhenInitBuiltinKernelThenCorrectArgumentsArePassed) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2022-2023 Intel Corporation
+ * Copyright (C) 2022-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,8 +9,10 @@
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/gfx_core_helper.h"
+#include "shared/source/helpers/heap_base_address_model.h"
 #include "shared/source/helpers/register_offsets.h"
 #include "shared/test/common/cmd_parse/gen_cmd_parse.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/test_macros/hw_test.h"
@@ -19,6 +21,8 @@
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 #include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
 #include "level_zero/core/test/unit_tests/mocks/mock_cmdlist.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_kernel.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_module.h"
 
 namespace L0 {
 namespace ult {
@@ -1453,5 +1457,343 @@ HWTEST_F(ImmediateCommandListAppendWriteToMem, givenAppendWriteToMemWithScopeThe
     ASSERT_TRUE(postSyncFound);
 }
 
+using CommandListRelocationTest = Test<CommandListWaitOnMemFixture>;
+
+HWTEST_F(CommandListRelocationTest, givenClosedCommandListWhenSerializedAndDeserializedWithOtherAllocationThenAddressesAreRelocated) {
+    using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
+    using POST_SYNC_OPERATION = typename PIPE_CONTROL::POST_SYNC_OPERATION;
+
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DispatchCmdlistCmdBufferPrimary.set(0);
+    debugManager.flags.SelectCmdListHeapAddressModel.set(static_cast<int32_t>(NEO::HeapAddressModel::privateHeaps));
+    debugManager.flags.EnableStateBaseAddressTracking.set(1);
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::CommandList> srcCommandList(CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, ZEX_COMMAND_LIST_FLAG_RELOCATABLE, result, false));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    zex_write_to_mem_desc_t writeDesc = {};
+    uint64_t data = 0xabc;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, srcCommandList->appendWriteToMemory(reinterpret_cast<void *>(&writeDesc), ptr, data));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, srcCommandList->close());
+
+    const void *allocations[] = {ptr};
+    zex_command_list_relocation_desc_t relocationDesc = {0u, nullptr, 1u, allocations, 0u, nullptr};
+    size_t blobSize = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandListSerialize(srcCommandList->toHandle(), &relocationDesc, &blobSize, nullptr));
+    ASSERT_NE(0u, blobSize);
+
+    std::vector<uint64_t> blob(alignUp(blobSize, sizeof(uint64_t)) / sizeof(uint64_t));
+    size_t tooSmallSize = blobSize - 1;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_SIZE, zexCommandListSerialize(srcCommandList->toHandle(), &relocationDesc, &tooSmallSize, blob.data()));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandListSerialize(srcCommandList->toHandle(), &relocationDesc, &blobSize, blob.data()));
+
+    void *dstPtr = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->allocDeviceMem(device->toHandle(), &deviceDesc, sizeof(uint32_t), 1u, &dstPtr));
+    auto dstAllocation = driverHandle->getSvmAllocsManager()->getSVMAlloc(dstPtr)->gpuAllocations.getGraphicsAllocation(device->getRootDeviceIndex());
+
+    const void *dstAllocations[] = {dstPtr};
+    relocationDesc.ppAllocations = dstAllocations;
+    ze_command_list_handle_t hDstCommandList = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandListDeserialize(context->toHandle(), device->toHandle(), blob.data(), blobSize, &relocationDesc, &hDstCommandList));
+    ASSERT_NE(nullptr, hDstCommandList);
+    auto dstCommandList = CommandList::fromHandle(hDstCommandList);
+
+    auto &dstContainer = dstCommandList->getCmdContainer();
+    auto &dstResidency = dstContainer.getResidencyContainer();
+    EXPECT_NE(dstResidency.end(), std::find(dstResidency.begin(), dstResidency.end(), dstAllocation));
+    EXPECT_EQ(srcCommandList->getCmdContainer().getCommandStream()->getUsed(), dstContainer.getCommandStream()->getUsed());
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::Parse::parseCommandBuffer(
+        cmdList, dstContainer.getCommandStream()->getCpuBase(), dstContainer.getCommandStream()->getUsed()));
+
+    auto gmmHelper = device->getNEODevice()->getGmmHelper();
+    bool postSyncFound = false;
+    for (auto it : findAll<PIPE_CONTROL *>(cmdList.begin(), cmdList.end())) {
+        auto cmd = genCmdCast<PIPE_CONTROL *>(*it);
+        if (cmd->getPostSyncOperation() == POST_SYNC_OPERATION::POST_SYNC_OPERATION_WRITE_IMMEDIATE_DATA) {
+            EXPECT_EQ(gmmHelper->decanonize(dstAllocation->getGpuAddress()), gmmHelper->decanonize(NEO::UnitTestHelper<FamilyType>::getPipeControlPostSyncAddress(*cmd)));
+            EXPECT_EQ(data, cmd->getImmediateData());
+            postSyncFound = true;
+        }
+    }
+    EXPECT_TRUE(postSyncFound);
+
+    dstCommandList->destroy();
+    context->freeMem(dstPtr);
+}
+
+HWTEST_F(CommandListRelocationTest, givenAllocationUsedByCommandListNotPassedWhenSerializingThenUnsupportedFeatureIsReturned) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DispatchCmdlistCmdBufferPrimary.set(0);
+    debugManager.flags.SelectCmdListHeapAddressModel.set(static_cast<int32_t>(NEO::HeapAddressModel::privateHeaps));
+    debugManager.flags.EnableStateBaseAddressTracking.set(1);
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::CommandList> srcCommandList(CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, ZEX_COMMAND_LIST_FLAG_RELOCATABLE, result, false));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    zex_write_to_mem_desc_t writeDesc = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, srcCommandList->appendWriteToMemory(reinterpret_cast<void *>(&writeDesc), ptr, 0xabc));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, srcCommandList->close());
+
+    zex_command_list_relocation_desc_t relocationDesc = {};
+    size_t blobSize = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, zexCommandListSerialize(srcCommandList->toHandle(), &relocationDesc, &blobSize, nullptr));
+}
+
+HWTEST_F(CommandListRelocationTest, givenCommandListCreatedWithoutRelocatableFlagWhenSerializingThenUnsupportedFeatureIsReturned) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DispatchCmdlistCmdBufferPrimary.set(0);
+    debugManager.flags.SelectCmdListHeapAddressModel.set(static_cast<int32_t>(NEO::HeapAddressModel::privateHeaps));
+    debugManager.flags.EnableStateBaseAddressTracking.set(1);
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::CommandList> srcCommandList(CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, 0u, result, false));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    zex_write_to_mem_desc_t writeDesc = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, srcCommandList->appendWriteToMemory(reinterpret_cast<void *>(&writeDesc), ptr, 0xabc));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, srcCommandList->close());
+    EXPECT_TRUE(srcCommandList->getRelocatableAddressSites().empty());
+
+    const void *allocations[] = {ptr};
+    zex_command_list_relocation_desc_t relocationDesc = {0u, nullptr, 1u, allocations, 0u, nullptr};
+    size_t blobSize = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, zexCommandListSerialize(srcCommandList->toHandle(), &relocationDesc, &blobSize, nullptr));
+}
+
+HWTEST_F(CommandListRelocationTest, givenCommandAppendedWithoutRecordingAddressesWhenSerializingThenUnsupportedFeatureIsReturned) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DispatchCmdlistCmdBufferPrimary.set(0);
+    debugManager.flags.SelectCmdListHeapAddressModel.set(static_cast<int32_t>(NEO::HeapAddressModel::privateHeaps));
+    debugManager.flags.EnableStateBaseAddressTracking.set(1);
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::CommandList> srcCommandList(CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, ZEX_COMMAND_LIST_FLAG_RELOCATABLE, result, false));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    zex_write_to_mem_desc_t writeDesc = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, srcCommandList->appendWriteToMemory(reinterpret_cast<void *>(&writeDesc), ptr, 0xabc));
+    EXPECT_EQ(1u, srcCommandList->getRelocatableAddressSites().size());
+    srcCommandList->getCmdContainer().getCommandStream()->getSpace(sizeof(uint64_t));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, srcCommandList->close());
+
+    const void *allocations[] = {ptr};
+    zex_command_list_relocation_desc_t relocationDesc = {0u, nullptr, 1u, allocations, 0u, nullptr};
+    size_t blobSize = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, zexCommandListSerialize(srcCommandList->toHandle(), &relocationDesc, &blobSize, nullptr));
+}
+
+HWTEST_F(CommandListRelocationTest, givenEventSignaledAndWaitedWhenSerializedAndDeserializedWithOtherEventThenEventAddressesAreRelocated) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DispatchCmdlistCmdBufferPrimary.set(0);
+    debugManager.flags.SelectCmdListHeapAddressModel.set(static_cast<int32_t>(NEO::HeapAddressModel::privateHeaps));
+    debugManager.flags.EnableStateBaseAddressTracking.set(1);
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::CommandList> srcCommandList(CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, ZEX_COMMAND_LIST_FLAG_RELOCATABLE, result, false));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    auto hEvent = event->toHandle();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, srcCommandList->appendSignalEvent(hEvent));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, srcCommandList->appendWaitOnEvents(1, &hEvent, nullptr, false, true, false, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, srcCommandList->close());
+
+    auto gmmHelper = device->getNEODevice()->getGmmHelper();
+    auto srcCmdStream = srcCommandList->getCmdContainer().getCommandStream();
+    auto srcEventAddress = gmmHelper->decanonize(event->getGpuAddress(device));
+    const auto &addressSites = srcCommandList->getRelocatableAddressSites();
+    ASSERT_LE(2u, addressSites.size());
+    for (const auto &addressSite : addressSites) {
+        EXPECT_EQ(srcCmdStream->getGraphicsAllocation(), addressSite.location);
+        auto address = gmmHelper->decanonize(*reinterpret_cast<uint64_t *>(ptrOffset(srcCmdStream->getCpuBase(), addressSite.offset)));
+        EXPECT_LE(srcEventAddress, address);
+        EXPECT_GT(srcEventAddress + event->getTotalEventSize(), address);
+    }
+
+    ze_event_handle_t events[] = {hEvent};
+    zex_command_list_relocation_desc_t relocationDesc = {0u, nullptr, 0u, nullptr, 1u, events};
+    size_t blobSize = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandListSerialize(srcCommandList->toHandle(), &relocationDesc, &blobSize, nullptr));
+    std::vector<uint64_t> blob(alignUp(blobSize, sizeof(uint64_t)) / sizeof(uint64_t));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandListSerialize(srcCommandList->toHandle(), &relocationDesc, &blobSize, blob.data()));
+
+    ze_event_desc_t eventDesc = {};
+    eventDesc.index = 1;
+    eventDesc.wait = ZE_EVENT_SCOPE_FLAG_HOST;
+    std::unique_ptr<Event> dstEvent(getHelper<L0GfxCoreHelper>().createEvent(eventPool.get(), &eventDesc, device));
+    events[0] = dstEvent->toHandle();
+    ze_command_list_handle_t hDstCommandList = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandListDeserialize(context->toHandle(), device->toHandle(), blob.data(), blobSize, &relocationDesc, &hDstCommandList));
+    ASSERT_NE(nullptr, hDstCommandList);
+    auto dstCommandList = CommandList::fromHandle(hDstCommandList);
+
+    auto dstCmdStream = dstCommandList->getCmdContainer().getCommandStream();
+    auto dstEventAddress = gmmHelper->decanonize(dstEvent->getGpuAddress(device));
+    for (const auto &addressSite : addressSites) {
+        auto srcAddress = gmmHelper->decanonize(*reinterpret_cast<uint64_t *>(ptrOffset(srcCmdStream->getCpuBase(), addressSite.offset)));
+        auto dstAddress = gmmHelper->decanonize(*reinterpret_cast<uint64_t *>(ptrOffset(dstCmdStream->getCpuBase(), addressSite.offset)));
+        EXPECT_EQ(srcAddress - srcEventAddress, dstAddress - dstEventAddress);
+    }
+
+    dstCommandList->destroy();
+}
+
+HWTEST_F(CommandListRelocationTest, givenWriteToMemoryAppendedToCopyCommandListWhenSerializingThenUnsupportedFeatureIsReturned) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DispatchCmdlistCmdBufferPrimary.set(0);
+    debugManager.flags.SelectCmdListHeapAddressModel.set(static_cast<int32_t>(NEO::HeapAddressModel::privateHeaps));
+    debugManager.flags.EnableStateBaseAddressTracking.set(1);
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::CommandList> srcCommandList(CommandList::create(productFamily, device, NEO::EngineGroupType::copy, ZEX_COMMAND_LIST_FLAG_RELOCATABLE, result, false));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    // address of MI_FLUSH_DW post sync is not recorded
+    zex_write_to_mem_desc_t writeDesc = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, srcCommandList->appendWriteToMemory(reinterpret_cast<void *>(&writeDesc), ptr, 0xabc));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, srcCommandList->close());
+
+    const void *allocations[] = {ptr};
+    zex_command_list_relocation_desc_t relocationDesc = {0u, nullptr, 1u, allocations, 0u, nullptr};
+    size_t blobSize = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, zexCommandListSerialize(srcCommandList->toHandle(), &relocationDesc, &blobSize, nullptr));
+}
+
+HWTEST_F(CommandListRelocationTest, givenCommandListUsingMultipleCommandBuffersWhenSerializingThenUnsupportedFeatureIsReturned) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DispatchCmdlistCmdBufferPrimary.set(0);
+    debugManager.flags.SelectCmdListHeapAddressModel.set(static_cast<int32_t>(NEO::HeapAddressModel::privateHeaps));
+    debugManager.flags.EnableStateBaseAddressTracking.set(1);
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::CommandList> srcCommandList(CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, ZEX_COMMAND_LIST_FLAG_RELOCATABLE, result, false));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    zex_write_to_mem_desc_t writeDesc = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, srcCommandList->appendWriteToMemory(reinterpret_cast<void *>(&writeDesc), ptr, 0xabc));
+    srcCommandList->getCmdContainer().allocateNextCommandBuffer();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, srcCommandList->appendWriteToMemory(reinterpret_cast<void *>(&writeDesc), ptr, 0xdef));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, srcCommandList->close());
+    EXPECT_EQ(2u, srcCommandList->getCmdContainer().getCmdBufferAllocations().size());
+
+    const void *allocations[] = {ptr};
+    zex_command_list_relocation_desc_t relocationDesc = {0u, nullptr, 1u, allocations, 0u, nullptr};
+    size_t blobSize = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, zexCommandListSerialize(srcCommandList->toHandle(), &relocationDesc, &blobSize, nullptr));
+}
+
+HWTEST2_F(CommandListRelocationTest, givenKernelLaunchRecordedWhenSerializedAndDeserializedWithOtherAllocationThenKernelAddressesAreRelocated, IsAtLeastXeHpCore) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DispatchCmdlistCmdBufferPrimary.set(0);
+    debugManager.flags.SelectCmdListHeapAddressModel.set(static_cast<int32_t>(NEO::HeapAddressModel::privateHeaps));
+    debugManager.flags.EnableStateBaseAddressTracking.set(1);
+
+    auto mockModule = std::make_unique<Mock<Module>>(device, nullptr);
+    Mock<::L0::KernelImp> mockKernel;
+    mockKernel.module = mockModule.get();
+    mockKernel.crossThreadDataSize = 0x60u;
+    memset(mockKernel.crossThreadData.get(), 0, mockKernel.crossThreadDataSize);
+    mockKernel.descriptor.kernelAttributes.flags.passInlineData = true;
+
+    constexpr uint16_t pointerArgOffset = 0x50u;
+    mockKernel.descriptor.payloadMappings.explicitArgs.resize(1);
+    auto &pointerArg = mockKernel.descriptor.payloadMappings.explicitArgs[0].as<NEO::ArgDescPointer>(true);
+    pointerArg.stateless = pointerArgOffset;
+    pointerArg.pointerSize = sizeof(uint64_t);
+    auto srcAddress = castToUint64(ptr);
+    memcpy(ptrOffset(mockKernel.crossThreadData.get(), pointerArgOffset), &srcAddress, sizeof(srcAddress));
+
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::CommandList> srcCommandList(CommandList::create(productFamily, device, NEO::EngineGroupType::renderCompute, ZEX_COMMAND_LIST_FLAG_RELOCATABLE, result, false));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, srcCommandList->appendLaunchKernel(mockKernel.toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, srcCommandList->close());
+
+    auto &srcContainer = srcCommandList->getCmdContainer();
+    auto srcCmdStream = srcContainer.getCommandStream();
+    auto srcIoh = srcContainer.getIndirectHeap(NEO::HeapType::indirectObject);
+    ASSERT_EQ(1u, srcCommandList->getKernelLaunchSites().size());
+    const auto &launchSite = srcCommandList->getKernelLaunchSites()[0];
+
+    GenCmdList cmdList;
+    ASSERT_TRUE(FamilyType::Parse::parseCommandBuffer(cmdList, srcCmdStream->getCpuBase(), srcCmdStream->getUsed()));
+    auto walkerIt = find<DefaultWalkerType *>(cmdList.begin(), cmdList.end());
+    ASSERT_NE(cmdList.end(), walkerIt);
+    auto walker = genCmdCast<DefaultWalkerType *>(*walkerIt);
+
+    EXPECT_EQ(ptrDiff(&walker->getInterfaceDescriptor(), srcCmdStream->getCpuBase()), launchSite.kernelStartPointerOffset);
+    auto indirectDataStartAddress = walker->getIndirectDataStartAddress();
+    walker->setIndirectDataStartAddress(indirectDataStartAddress + DefaultWalkerType::INDIRECTDATASTARTADDRESS_ALIGN_SIZE);
+    EXPECT_EQ(indirectDataStartAddress + DefaultWalkerType::INDIRECTDATASTARTADDRESS_ALIGN_SIZE,
+              *reinterpret_cast<uint32_t *>(ptrOffset(srcCmdStream->getCpuBase(), launchSite.indirectDataStartAddressOffset)));
+    walker->setIndirectDataStartAddress(indirectDataStartAddress);
+
+    ASSERT_EQ(1u, srcCommandList->getRelocatableAddressSites().size());
+    const auto &addressSite = srcCommandList->getRelocatableAddressSites()[0];
+    EXPECT_EQ(srcIoh->getGraphicsAllocation(), addressSite.location);
+    EXPECT_EQ(srcAddress, *reinterpret_cast<uint64_t *>(ptrOffset(srcIoh->getCpuBase(), addressSite.offset)));
+
+    ze_kernel_handle_t kernels[] = {mockKernel.toHandle()};
+    const void *allocations[] = {ptr};
+    zex_command_list_relocation_desc_t relocationDesc = {1u, kernels, 1u, allocations, 0u, nullptr};
+    size_t blobSize = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandListSerialize(srcCommandList->toHandle(), &relocationDesc, &blobSize, nullptr));
+    std::vector<uint64_t> blob(alignUp(blobSize, sizeof(uint64_t)) / sizeof(uint64_t));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandListSerialize(srcCommandList->toHandle(), &relocationDesc, &blobSize, blob.data()));
+
+    void *dstPtr = nullptr;
+    ze_device_mem_alloc_desc_t deviceDesc = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, context->allocDeviceMem(device->toHandle(), &deviceDesc, sizeof(uint32_t), 1u, &dstPtr));
+
+    const void *dstAllocations[] = {dstPtr};
+    relocationDesc.ppAllocations = dstAllocations;
+    ze_command_list_handle_t hDstCommandList = nullptr;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCommandListDeserialize(context->toHandle(), device->toHandle(), blob.data(), blobSize, &relocationDesc, &hDstCommandList));
+    ASSERT_NE(nullptr, hDstCommandList);
+    auto dstCommandList = CommandList::fromHandle(hDstCommandList);
+
+    auto &dstContainer = dstCommandList->getCmdContainer();
+    auto dstIoh = dstContainer.getIndirectHeap(NEO::HeapType::indirectObject);
+    auto gmmHelper = device->getNEODevice()->getGmmHelper();
+    EXPECT_EQ(gmmHelper->decanonize(castToUint64(dstPtr)), gmmHelper->decanonize(*reinterpret_cast<uint64_t *>(ptrOffset(dstIoh->getCpuBase(), addressSite.offset))));
+
+    auto dstWalker = reinterpret_cast<DefaultWalkerType *>(ptrOffset(dstContainer.getCommandStream()->getCpuBase(), ptrDiff(walker, srcCmdStream->getCpuBase())));
+    EXPECT_EQ(indirectDataStartAddress - srcIoh->getHeapGpuStartOffset() + dstIoh->getHeapGpuStartOffset(), dstWalker->getIndirectDataStartAddress());
+
+    dstCommandList->destroy();
+    context->freeMem(dstPtr);
+}
+
+HWTEST_F(CommandListRelocationTest, givenImmediateCommandListWhenSerializingThenUnsupportedFeatureIsReturned) {
+    ze_command_queue_desc_t queueDesc = {};
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::CommandList> immediateCommandList(CommandList::createImmediate(productFamily, device, &queueDesc, false, NEO::EngineGroupType::renderCompute, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    zex_command_list_relocation_desc_t relocationDesc = {};
+    size_t blobSize = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, zexCommandListSerialize(immediateCommandList->toHandle(), &relocationDesc, &blobSize, nullptr));
+}
+
+HWTEST_F(CommandListRelocationTest, givenInvalidArgumentsWhenDeserializingThenErrorIsReturned) {
+    zex_command_list_relocation_desc_t relocationDesc = {};
+    ze_command_list_handle_t hCommandList = nullptr;
+    std::vector<uint64_t> blob(64, 0u);
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, zexCommandListDeserialize(nullptr, device->toHandle(), blob.data(), blob.size() * sizeof(uint64_t), &relocationDesc, &hCommandList));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, zexCommandListDeserialize(context->toHandle(), device->toHandle(), nullptr, blob.size() * sizeof(uint64_t), &relocationDesc, &hCommandList));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NATIVE_BINARY, zexCommandListDeserialize(context->toHandle(), device->toHandle(), blob.data(), blob.size() * sizeof(uint64_t), &relocationDesc, &hCommandList));
+    EXPECT_EQ(nullptr, hCommandList);
+}
+
 } // namespace ult
 } // namespace L0
@@ -0,0 +1,523 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/kernel/kernel_arg_descriptor.h"
+#include "shared/test/common/cmd_parse/gen_cmd_parse.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/libult/ult_command_stream_receiver.h"
+#include "shared/test/common/mocks/mock_graphics_allocation.h"
+#include "shared/test/common/test_macros/hw_test.h"
+
+#include "level_zero/core/source/cmdlist/cmdlist_hw.h"
+#include "level_zero/core/source/event/event.h"
+#include "level_zero/core/test/unit_tests/fixtures/device_fixture.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_cmdlist.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_kernel.h"
+#include "level_zero/core/test/unit_tests/mocks/mock_module.h"
+
+namespace L0 {
+namespace ult {
+
+struct MutableCommandListFixture : public DeviceFixture {
+    void setUp() {
+        DeviceFixture::setUp();
+
+        mockModule = std::unique_ptr<Module>(new Mock<Module>(device, nullptr));
+        mockKernel.module = mockModule.get();
+        mockKernel.crossThreadDataSize = 0x60u;
+        memset(mockKernel.crossThreadData.get(), 0, mockKernel.crossThreadDataSize);
+        mockKernel.descriptor.kernelAttributes.flags.passInlineData = true;
+
+        auto &dispatchTraits = mockKernel.descriptor.payloadMappings.dispatchTraits;
+        for (uint16_t i = 0; i < 3; i++) {
+            dispatchTraits.numWorkGroups[i] = i * sizeof(uint32_t);
+            dispatchTraits.globalWorkOffset[i] = 0x10u + i * sizeof(uint32_t);
+        }
+
+        NEO::ArgDescValue::Element element{};
+        element.offset = valueArgOffset;
+        element.size = sizeof(uint32_t);
+        mockKernel.descriptor.payloadMappings.explicitArgs.resize(1);
+        mockKernel.descriptor.payloadMappings.explicitArgs[0].as<NEO::ArgDescValue>(true).elements.push_back(element);
+    }
+
+    void tearDown() {
+        mockModule.reset();
+        DeviceFixture::tearDown();
+    }
+
+    template <GFXCORE_FAMILY gfxCoreFamily>
+    std::unique_ptr<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>> createCommandList() {
+        auto commandList = std::make_unique<WhiteBox<::L0::CommandListCoreFamily<gfxCoreFamily>>>();
+        EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->initialize(device, NEO::EngineGroupType::compute, 0u));
+        return commandList;
+    }
+
+    uint32_t readCrossThreadData(const MutableKernelCommand &command, size_t offset) {
+        uint32_t value = 0;
+        if (offset < command.inlineDataSize) {
+            memcpy(&value, ptrOffset(command.inlineData, offset), sizeof(value));
+        } else {
+            memcpy(&value, ptrOffset(command.indirectData, offset - command.inlineDataSize), sizeof(value));
+        }
+        return value;
+    }
+
+    static constexpr uint16_t valueArgOffset = 0x50u;
+    Mock<::L0::KernelImp> mockKernel;
+    std::unique_ptr<Module> mockModule;
+};
+
+using MutableCommandListTest = Test<MutableCommandListFixture>;
+
+HWTEST2_F(MutableCommandListTest, givenMutableKernelCommandWhenUpdatingArgumentGroupCountAndGlobalOffsetThenWalkerAndCrossThreadDataArePatched, IsAtLeastXeHpCore) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+
+    auto commandList = createCommandList<gfxCoreFamily>();
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    uint64_t commandId = std::numeric_limits<uint64_t>::max();
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, &commandId));
+    EXPECT_EQ(0u, commandId);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(mockKernel.toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->close());
+
+    const auto &mutableCommand = commandList->getMutableKernelCommands()[commandId];
+    ASSERT_NE(nullptr, mutableCommand.walker);
+    EXPECT_LT(mutableCommand.inlineDataSize, static_cast<size_t>(valueArgOffset));
+    auto walker = reinterpret_cast<DefaultWalkerType *>(mutableCommand.walker);
+
+    uint32_t argValue = 0x1234u;
+    ze_mutable_kernel_argument_exp_desc_t argumentDesc = {ZE_STRUCTURE_TYPE_MUTABLE_KERNEL_ARGUMENT_EXP_DESC};
+    argumentDesc.commandId = commandId;
+    argumentDesc.argIndex = 0;
+    argumentDesc.argSize = sizeof(argValue);
+    argumentDesc.pArgValue = &argValue;
+
+    ze_group_count_t newGroupCount{4, 2, 1};
+    ze_mutable_group_count_exp_desc_t groupCountDesc = {ZE_STRUCTURE_TYPE_MUTABLE_GROUP_COUNT_EXP_DESC, &argumentDesc};
+    groupCountDesc.commandId = commandId;
+    groupCountDesc.pGroupCount = &newGroupCount;
+
+    ze_mutable_global_offset_exp_desc_t globalOffsetDesc = {ZE_STRUCTURE_TYPE_MUTABLE_GLOBAL_OFFSET_EXP_DESC, &groupCountDesc};
+    globalOffsetDesc.commandId = commandId;
+    globalOffsetDesc.offsetX = 5;
+    globalOffsetDesc.offsetY = 6;
+    globalOffsetDesc.offsetZ = 7;
+
+    ze_mutable_commands_exp_desc_t mutableCommandsDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMANDS_EXP_DESC, &globalOffsetDesc};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateMutableCommands(&mutableCommandsDesc));
+
+    EXPECT_EQ(4u, walker->getThreadGroupIdXDimension());
+    EXPECT_EQ(2u, walker->getThreadGroupIdYDimension());
+    EXPECT_EQ(1u, walker->getThreadGroupIdZDimension());
+
+    EXPECT_EQ(4u, readCrossThreadData(mutableCommand, 0x0u));
+    EXPECT_EQ(2u, readCrossThreadData(mutableCommand, 0x4u));
+    EXPECT_EQ(1u, readCrossThreadData(mutableCommand, 0x8u));
+    EXPECT_EQ(5u, readCrossThreadData(mutableCommand, 0x10u));
+    EXPECT_EQ(6u, readCrossThreadData(mutableCommand, 0x14u));
+    EXPECT_EQ(7u, readCrossThreadData(mutableCommand, 0x18u));
+    EXPECT_EQ(argValue, readCrossThreadData(mutableCommand, valueArgOffset));
+}
+
+HWTEST2_F(MutableCommandListTest, givenMutableKernelCommandWhenUpdatingSignalEventThenEventAddressesInCommandsArePatched, IsAtLeastXeHpCore) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+
+    auto commandList = createCommandList<gfxCoreFamily>();
+
+    ze_event_pool_desc_t eventPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+    eventPoolDesc.count = 2;
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    auto eventPool = std::unique_ptr<L0::EventPool>(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+    eventDesc.index = 0;
+    auto event0 = std::unique_ptr<L0::Event>(L0::Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+    eventDesc.index = 1;
+    auto event1 = std::unique_ptr<L0::Event>(L0::Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_SIGNAL_EVENT;
+    uint64_t commandId = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, &commandId));
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(mockKernel.toHandle(), groupCount, event0->toHandle(), 0, nullptr, launchParams, false));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->close());
+
+    const auto &mutableCommand = commandList->getMutableKernelCommands()[commandId];
+    ASSERT_TRUE(mutableCommand.signalEvent.has_value());
+    EXPECT_FALSE(mutableCommand.signalEvent->patchSites.empty());
+
+    auto walker = reinterpret_cast<DefaultWalkerType *>(mutableCommand.walker);
+    auto postSyncAddress = walker->getPostSync().getDestinationAddress();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateMutableCommandSignalEvent(commandId, event1->toHandle()));
+    EXPECT_EQ(postSyncAddress + (event1->getGpuAddress(device) - event0->getGpuAddress(device)), walker->getPostSync().getDestinationAddress());
+    EXPECT_EQ(mutableCommand.signalEvent->packetsInUse, event1->getPacketsInUse());
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, commandList->updateMutableCommandSignalEvent(commandId, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableCommandWaitEvents(commandId, 0, nullptr));
+}
+
+HWTEST2_F(MutableCommandListTest, givenMutableKernelCommandWhenUpdatingWaitEventsThenRecordedSemaphoresArePatched, IsAtLeastXeHpCore) {
+    using MI_SEMAPHORE_WAIT = typename FamilyType::MI_SEMAPHORE_WAIT;
+
+    auto commandList = createCommandList<gfxCoreFamily>();
+
+    ze_event_pool_desc_t eventPoolDesc = {ZE_STRUCTURE_TYPE_EVENT_POOL_DESC};
+    eventPoolDesc.count = 2;
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    auto eventPool = std::unique_ptr<L0::EventPool>(L0::EventPool::create(driverHandle.get(), context, 0, nullptr, &eventPoolDesc, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    ze_event_desc_t eventDesc = {ZE_STRUCTURE_TYPE_EVENT_DESC};
+    eventDesc.index = 0;
+    auto event0 = std::unique_ptr<L0::Event>(L0::Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+    eventDesc.index = 1;
+    auto event1 = std::unique_ptr<L0::Event>(L0::Event::create<typename FamilyType::TimestampPacketType>(eventPool.get(), &eventDesc, device));
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_WAIT_EVENTS;
+    uint64_t commandId = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, &commandId));
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    auto hWaitEvent = event0->toHandle();
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(mockKernel.toHandle(), groupCount, nullptr, 1, &hWaitEvent, launchParams, false));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->close());
+
+    const auto &mutableCommand = commandList->getMutableKernelCommands()[commandId];
+    ASSERT_EQ(1u, mutableCommand.waitEvents.size());
+    const auto &patchSites = mutableCommand.waitEvents[0].patchSites;
+    ASSERT_FALSE(patchSites.empty());
+    for (const auto &patchSite : patchSites) {
+        EXPECT_EQ(CommandToPatch::WaitEventSemaphoreWait, patchSite.type);
+        auto semaphore = reinterpret_cast<MI_SEMAPHORE_WAIT *>(patchSite.command);
+        EXPECT_EQ(event0->getGpuAddress(device) + patchSite.offsetInEvent, semaphore->getSemaphoreGraphicsAddress());
+    }
+
+    hWaitEvent = event1->toHandle();
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateMutableCommandWaitEvents(commandId, 1, &hWaitEvent));
+    for (const auto &patchSite : patchSites) {
+        auto semaphore = reinterpret_cast<MI_SEMAPHORE_WAIT *>(patchSite.command);
+        EXPECT_EQ(event1->getGpuAddress(device) + patchSite.offsetInEvent, semaphore->getSemaphoreGraphicsAddress());
+    }
+}
+
+HWTEST2_F(MutableCommandListTest, givenPendingMutableCommandIdWhenOtherCommandIsAppendedThenNextKernelIsNotMutable, IsAtLeastXeHpCore) {
+    auto commandList = createCommandList<gfxCoreFamily>();
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    uint64_t commandId = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, &commandId));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendBarrier(nullptr, 0, nullptr, false));
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(mockKernel.toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->close());
+
+    EXPECT_EQ(nullptr, commandList->getMutableKernelCommands()[commandId].walker);
+}
+
+HWTEST2_F(MutableCommandListTest, givenMutableKernelCommandWhenUpdatingGroupCountThenInterfaceDescriptorMatchesNewAppend, IsAtLeastXeHpCore) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+
+    auto commandList = createCommandList<gfxCoreFamily>();
+    mockKernel.slmArgsTotalSize = 0x400u;
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_COUNT;
+    uint64_t commandId = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, &commandId));
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(mockKernel.toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->close());
+
+    ze_group_count_t newGroupCount{64, 4, 1};
+    ze_mutable_group_count_exp_desc_t groupCountDesc = {ZE_STRUCTURE_TYPE_MUTABLE_GROUP_COUNT_EXP_DESC};
+    groupCountDesc.commandId = commandId;
+    groupCountDesc.pGroupCount = &newGroupCount;
+    ze_mutable_commands_exp_desc_t mutableCommandsDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMANDS_EXP_DESC, &groupCountDesc};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateMutableCommands(&mutableCommandsDesc));
+
+    auto referenceCommandList = createCommandList<gfxCoreFamily>();
+    ASSERT_EQ(ZE_RESULT_SUCCESS, referenceCommandList->getNextCommandId(&commandIdDesc, &commandId));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, referenceCommandList->appendLaunchKernel(mockKernel.toHandle(), newGroupCount, nullptr, 0, nullptr, launchParams, false));
+    mockKernel.slmArgsTotalSize = 0u;
+
+    auto walker = reinterpret_cast<DefaultWalkerType *>(commandList->getMutableKernelCommands()[commandId].walker);
+    auto referenceWalker = reinterpret_cast<DefaultWalkerType *>(referenceCommandList->getMutableKernelCommands()[commandId].walker);
+    ASSERT_NE(nullptr, referenceWalker);
+    EXPECT_EQ(0, memcmp(&referenceWalker->getInterfaceDescriptor(), &walker->getInterfaceDescriptor(), sizeof(typename FamilyType::INTERFACE_DESCRIPTOR_DATA)));
+}
+
+HWTEST2_F(MutableCommandListTest, givenInvalidMutableCommandUpdatesWhenUpdatingThenErrorIsReturned, IsAtLeastXeHpCore) {
+    auto commandList = createCommandList<gfxCoreFamily>();
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_KERNEL_ARGUMENTS;
+    uint64_t commandId = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_POINTER, commandList->getNextCommandId(&commandIdDesc, nullptr));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, &commandId));
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(mockKernel.toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->close());
+
+    uint32_t argValue = 0;
+    ze_mutable_kernel_argument_exp_desc_t argumentDesc = {ZE_STRUCTURE_TYPE_MUTABLE_KERNEL_ARGUMENT_EXP_DESC};
+    argumentDesc.commandId = commandId + 1;
+    argumentDesc.argSize = sizeof(argValue);
+    argumentDesc.pArgValue = &argValue;
+    ze_mutable_commands_exp_desc_t mutableCommandsDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMANDS_EXP_DESC, &argumentDesc};
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableCommands(&mutableCommandsDesc));
+
+    argumentDesc.commandId = commandId;
+    argumentDesc.argIndex = 1;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_KERNEL_ARGUMENT_INDEX, commandList->updateMutableCommands(&mutableCommandsDesc));
+
+    ze_group_count_t newGroupCount{2, 1, 1};
+    ze_mutable_group_count_exp_desc_t groupCountDesc = {ZE_STRUCTURE_TYPE_MUTABLE_GROUP_COUNT_EXP_DESC};
+    groupCountDesc.commandId = commandId;
+    groupCountDesc.pGroupCount = &newGroupCount;
+    mutableCommandsDesc.pNext = &groupCountDesc;
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableCommands(&mutableCommandsDesc));
+
+    ze_mutable_group_size_exp_desc_t groupSizeDesc = {ZE_STRUCTURE_TYPE_MUTABLE_GROUP_SIZE_EXP_DESC};
+    groupSizeDesc.commandId = commandId;
+    mutableCommandsDesc.pNext = &groupSizeDesc;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->updateMutableCommands(&mutableCommandsDesc));
+}
+
+HWTEST2_F(MutableCommandListTest, givenCommandListNotClosedWhenUpdatingMutableCommandsThenInvalidArgumentIsReturned, IsAtLeastXeHpCore) {
+    auto commandList = createCommandList<gfxCoreFamily>();
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    uint64_t commandId = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, &commandId));
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(mockKernel.toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+
+    const auto &mutableCommand = commandList->getMutableKernelCommands()[commandId];
+    uint32_t argValue = 0x1234u;
+    ze_mutable_kernel_argument_exp_desc_t argumentDesc = {ZE_STRUCTURE_TYPE_MUTABLE_KERNEL_ARGUMENT_EXP_DESC};
+    argumentDesc.commandId = commandId;
+    argumentDesc.argSize = sizeof(argValue);
+    argumentDesc.pArgValue = &argValue;
+    ze_mutable_commands_exp_desc_t mutableCommandsDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMANDS_EXP_DESC, &argumentDesc};
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableCommands(&mutableCommandsDesc));
+    EXPECT_NE(argValue, readCrossThreadData(mutableCommand, valueArgOffset));
+
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->close());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->updateMutableCommands(&mutableCommandsDesc));
+    EXPECT_EQ(argValue, readCrossThreadData(mutableCommand, valueArgOffset));
+
+    commandList->reset();
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableCommands(&mutableCommandsDesc));
+}
+
+HWTEST2_F(MutableCommandListTest, givenValidUpdateFollowedByInvalidUpdateInChainWhenUpdatingMutableCommandsThenNothingIsPatched, IsAtLeastXeHpCore) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+
+    auto commandList = createCommandList<gfxCoreFamily>();
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    uint64_t commandId = 0;
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->getNextCommandId(&commandIdDesc, &commandId));
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(mockKernel.toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, commandList->close());
+
+    const auto &mutableCommand = commandList->getMutableKernelCommands()[commandId];
+    auto walker = reinterpret_cast<DefaultWalkerType *>(mutableCommand.walker);
+    auto crossThreadDataBefore = mutableCommand.crossThreadData;
+
+    ze_group_count_t invalidGroupCount{0, 1, 1};
+    ze_mutable_group_count_exp_desc_t groupCountDesc = {ZE_STRUCTURE_TYPE_MUTABLE_GROUP_COUNT_EXP_DESC};
+    groupCountDesc.commandId = commandId;
+    groupCountDesc.pGroupCount = &invalidGroupCount;
+
+    uint32_t argValue = 0x1234u;
+    ze_mutable_kernel_argument_exp_desc_t argumentDesc = {ZE_STRUCTURE_TYPE_MUTABLE_KERNEL_ARGUMENT_EXP_DESC, &groupCountDesc};
+    argumentDesc.commandId = commandId;
+    argumentDesc.argSize = sizeof(argValue);
+    argumentDesc.pArgValue = &argValue;
+
+    ze_mutable_commands_exp_desc_t mutableCommandsDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMANDS_EXP_DESC, &argumentDesc};
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, commandList->updateMutableCommands(&mutableCommandsDesc));
+
+    EXPECT_EQ(crossThreadDataBefore, mutableCommand.crossThreadData);
+    EXPECT_NE(argValue, readCrossThreadData(mutableCommand, valueArgOffset));
+    EXPECT_EQ(1u, walker->getThreadGroupIdXDimension());
+}
+
+HWTEST2_F(MutableCommandListTest, givenImmediateCommandListOrNoUpdateCapabilityWhenGettingNextCommandIdThenUnsupportedFeatureIsReturned, IsAtLeastXeHpCore) {
+    DebugManagerStateRestore restorer;
+
+    ze_command_queue_desc_t queueDesc = {};
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    std::unique_ptr<L0::CommandList> immediateCommandList(CommandList::createImmediate(productFamily, device, &queueDesc, false, NEO::EngineGroupType::compute, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    ze_mutable_command_id_exp_desc_t commandIdDesc = {ZE_STRUCTURE_TYPE_MUTABLE_COMMAND_ID_EXP_DESC};
+    uint64_t commandId = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, static_cast<CommandListImp *>(immediateCommandList.get())->getNextCommandId(&commandIdDesc, &commandId));
+
+    auto commandList = createCommandList<gfxCoreFamily>();
+    commandIdDesc.flags = ZE_MUTABLE_COMMAND_EXP_FLAG_GROUP_SIZE;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->getNextCommandId(&commandIdDesc, &commandId));
+
+    debugManager.flags.OverrideCmdListUpdateCapability.set(0);
+    commandIdDesc.flags = 0;
+    EXPECT_EQ(ZE_RESULT_ERROR_UNSUPPORTED_FEATURE, commandList->getNextCommandId(&commandIdDesc, &commandId));
+    EXPECT_TRUE(commandList->getMutableKernelCommands().empty());
+}
+
+HWTEST2_F(MutableCommandListTest, givenImmediateCmdListCaptureEnabledWhenSameLaunchSequenceIsFlushedTwiceThenRecordedCommandListIsReplayedWithNewArguments, IsAtLeastXeHpCore) {
+    using ImmediateCommandList = WhiteBox<::L0::CommandListCoreFamilyImmediate<gfxCoreFamily>>;
+    DebugManagerStateRestore restorer;
+
+    auto &ultCsr = neoDevice->getUltCommandStreamReceiver<FamilyType>();
+    ultCsr.callBaseWaitForCompletionWithTimeout = false;
+    ultCsr.returnWaitForCompletionWithTimeout = NEO::WaitStatus::ready;
+
+    ze_command_queue_desc_t queueDesc = {};
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    auto commandList = static_cast<ImmediateCommandList *>(CommandList::createImmediate(productFamily, device, &queueDesc, false, NEO::EngineGroupType::compute, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    EXPECT_FALSE(commandList->isLaunchCaptureAllowed(&mockKernel, nullptr, 0, launchParams));
+
+    debugManager.flags.EnableImmediateCmdListCapture.set(1);
+    if (!commandList->isLaunchCaptureAllowed(&mockKernel, nullptr, 0, launchParams)) {
+        commandList->destroy();
+        GTEST_SKIP();
+    }
+    auto hSignalEvent = reinterpret_cast<ze_event_handle_t>(0x1234);
+    EXPECT_FALSE(commandList->isLaunchCaptureAllowed(&mockKernel, hSignalEvent, 0, launchParams));
+    launchParams.isCooperative = true;
+    EXPECT_FALSE(commandList->isLaunchCaptureAllowed(&mockKernel, nullptr, 0, launchParams));
+    launchParams.isCooperative = false;
+
+    NEO::MockGraphicsAllocation argAllocation;
+    mockKernel.residencyContainer.push_back(&argAllocation);
+    auto contextId = ultCsr.getOsContext().getContextId();
+
+    for (uint32_t iteration = 0; iteration < 2; iteration++) {
+        uint32_t argValue = 0x100u + iteration;
+        memcpy(ptrOffset(mockKernel.crossThreadData.get(), valueArgOffset), &argValue, sizeof(argValue));
+        EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(mockKernel.toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+        EXPECT_EQ(1u, commandList->capturedLaunches.size());
+        EXPECT_EQ(ultCsr.peekTaskCount() + 1, argAllocation.getTaskCount(contextId));
+        EXPECT_TRUE(device->getNEODevice()->getMemoryManager()->allocInUse(argAllocation));
+
+        EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->flushCapturedLaunches());
+        EXPECT_TRUE(commandList->capturedLaunches.empty());
+        ASSERT_EQ(1u, commandList->capturedSequences.size());
+        EXPECT_EQ(ultCsr.peekTaskCount(), commandList->capturedSequences[0].taskCount);
+        EXPECT_EQ(iteration, commandList->getCaptureStatistics().hits);
+        EXPECT_EQ(1u, commandList->getCaptureStatistics().misses);
+
+        auto recordedCommandList = commandList->capturedSequences[0].commandList;
+        const auto &mutableCommand = recordedCommandList->getMutableKernelCommands()[0];
+        EXPECT_EQ(argValue, readCrossThreadData(mutableCommand, valueArgOffset));
+
+        *ultCsr.getTagAddress() = ultCsr.peekTaskCount();
+    }
+
+    // recording still used by GPU is not patched, launches are recorded again
+    *ultCsr.getTagAddress() = 0;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(mockKernel.toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->flushCapturedLaunches());
+    EXPECT_EQ(2u, commandList->capturedSequences.size());
+
+    // SLM size is part of encoded launch
+    *ultCsr.getTagAddress() = ultCsr.peekTaskCount();
+    mockKernel.slmArgsTotalSize = 0x400u;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(mockKernel.toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->flushCapturedLaunches());
+    EXPECT_EQ(3u, commandList->capturedSequences.size());
+    mockKernel.slmArgsTotalSize = 0u;
+
+    groupCount.groupCountX = 2;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(mockKernel.toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->flushCapturedLaunches());
+    EXPECT_EQ(4u, commandList->capturedSequences.size());
+    EXPECT_EQ(1u, commandList->getCaptureStatistics().hits);
+    EXPECT_EQ(4u, commandList->getCaptureStatistics().misses);
+
+    commandList->destroy();
+    mockKernel.residencyContainer.pop_back();
+}
+
+HWTEST2_F(MutableCommandListTest, givenCapturedLaunchWhenCsrSubmittedOtherWorkBeforeNextCaptureThenCapturedLaunchIsFlushedFirst, IsAtLeastXeHpCore) {
+    using ImmediateCommandList = WhiteBox<::L0::CommandListCoreFamilyImmediate<gfxCoreFamily>>;
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableImmediateCmdListCapture.set(1);
+
+    auto &ultCsr = neoDevice->getUltCommandStreamReceiver<FamilyType>();
+    ultCsr.callBaseWaitForCompletionWithTimeout = false;
+    ultCsr.returnWaitForCompletionWithTimeout = NEO::WaitStatus::ready;
+
+    ze_command_queue_desc_t queueDesc = {};
+    ze_result_t result = ZE_RESULT_SUCCESS;
+    auto commandList = static_cast<ImmediateCommandList *>(CommandList::createImmediate(productFamily, device, &queueDesc, false, NEO::EngineGroupType::compute, result));
+    ASSERT_EQ(ZE_RESULT_SUCCESS, result);
+
+    ze_group_count_t groupCount{1, 1, 1};
+    CmdListKernelLaunchParams launchParams = {};
+    if (!commandList->isLaunchCaptureAllowed(&mockKernel, nullptr, 0, launchParams)) {
+        commandList->destroy();
+        GTEST_SKIP();
+    }
+
+    NEO::MockGraphicsAllocation argAllocation;
+    mockKernel.residencyContainer.push_back(&argAllocation);
+    auto contextId = ultCsr.getOsContext().getContextId();
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(mockKernel.toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(1u, commandList->capturedLaunches.size());
+    EXPECT_EQ(ultCsr.peekTaskCount(), commandList->capturedLaunchesTaskCount);
+
+    // pending task count of captured launch got consumed by other submission
+    ultCsr.taskCount++;
+    *ultCsr.getTagAddress() = ultCsr.peekTaskCount();
+    EXPECT_FALSE(device->getNEODevice()->getMemoryManager()->allocInUse(argAllocation));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, commandList->appendLaunchKernel(mockKernel.toHandle(), groupCount, nullptr, 0, nullptr, launchParams, false));
+    EXPECT_EQ(1u, commandList->capturedLaunches.size());
+    ASSERT_EQ(1u, commandList->capturedSequences.size());
+    EXPECT_EQ(1u, commandList->capturedSequences[0].launches.size());
+    EXPECT_EQ(ultCsr.peekTaskCount(), commandList->capturedLaunchesTaskCount);
+    EXPECT_EQ(ultCsr.peekTaskCount() + 1, argAllocation.getTaskCount(contextId));
+    EXPECT_TRUE(device->getNEODevice()->getMemoryManager()->allocInUse(argAllocation));
+
+    commandList->destroy();
+    mockKernel.residencyContainer.pop_back();
+}
+
+} // namespace ult
+} // namespace L0
@@ -5498,5 +5498,12 @@ TEST(ExtensionLookupTest, givenLookupMapWhenAskingForBindlessImageExtensionFunct
     EXPECT_NE(nullptr, ExtensionFunctionAddressHelper::getExtensionFunctionAddress("zeImageGetDeviceOffsetExp"));
 }
 
+TEST(ExtensionLookupTest, givenLookupMapWhenAskingForMutableCommandListExtensionFunctionsThenValidPointersReturned) {
+    EXPECT_NE(nullptr, ExtensionFunctionAddressHelper::getExtensionFunctionAddress("zeCommandListGetNextCommandIdExp"));
+    EXPECT_NE(nullptr, ExtensionFunctionAddressHelper::getExtensionFunctionAddress("zeCommandListUpdateMutableCommandsExp"));
+    EXPECT_NE(nullptr, ExtensionFunctionAddressHelper::getExtensionFunctionAddress("zeCommandListUpdateMutableCommandSignalEventExp"));
+    EXPECT_NE(nullptr, ExtensionFunctionAddressHelper::getExtensionFunctionAddress("zeCommandListUpdateMutableCommandWaitEventsExp"));
+}
+
 } // namespace ult
 } // namespace L0
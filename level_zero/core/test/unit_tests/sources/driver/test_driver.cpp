@@ -821,7 +821,7 @@ TEST(DriverTest, givenProgramDebuggingEnvVarValue2WhenCreatingDriverThenEnablePr
     L0::globalDriver = nullptr;
 }
 
-TEST(DriverTest, givenBuiltinsAsyncInitEnabledWhenCreatingDriverThenMakeSureBuiltinsInitIsCompletedOnExitOfDriverHandleInitialization) {
+TEST(DriverTest, givenBuiltinsAsyncInitEnabledWhenCreatingDriverThenBuiltinsInitIsCompletedOnDemand) {
     VariableBackup<UltHwConfig> backup(&ultHwConfig);
     ultHwConfig.useinitBuiltinsAsyncEnabled = true;
 
@@ -844,15 +844,12 @@ TEST(DriverTest, givenBuiltinsAsyncInitEnabledWhenCreatingDriverThenMakeSureBuil
 
     if (builtinFunctionsLib) {
         auto builtinsLibIpl = static_cast<MockBuiltinFunctionsLibImpl *>(builtinFunctionsLib);
+        builtinsLibIpl->ensureInitCompletion();
         EXPECT_TRUE(builtinsLibIpl->initAsyncComplete);
     }
 
     delete driverHandle;
     L0::globalDriver = nullptr;
-
-    /* std::async may create a detached thread - completion of the scheduled task can be ensured,
-       but there is no way to ensure that actual OS thread exited and its resources are freed */
-    MemoryManagement::fastLeaksDetectionMode = MemoryManagement::LeakDetectionMode::TURN_OFF_LEAK_DETECTION;
 }
 
 TEST(DriverTest, givenInvalidCompilerEnvironmentThenDependencyUnavailableErrorIsReturned) {
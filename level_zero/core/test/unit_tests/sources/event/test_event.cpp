@@ -2450,6 +2450,137 @@ HWCMDTEST_F(IGFX_GEN9_CORE, TimestampEventCreate, givenEventTimestampsWhenQueryK
     EXPECT_EQ(data.globalEnd, result.global.kernelEnd);
 }
 
+HWCMDTEST_F(IGFX_GEN9_CORE, TimestampEventCreate, givenMultipleEventsWhenQueryingKernelTimestampsInBatchThenTicksAndNanosecondsAreReturnedForEachEvent) {
+    typename MockTimestampPackets32::Packet data[2] = {};
+    data[0].contextStart = 1u;
+    data[0].contextEnd = 2u;
+    data[0].globalStart = 3u;
+    data[0].globalEnd = 5u;
+    data[1].contextStart = 10u;
+    data[1].contextEnd = 20u;
+    data[1].globalStart = 30u;
+    data[1].globalEnd = 50u;
+
+    eventDesc.index = 1;
+    auto secondEvent = std::unique_ptr<EventImp<uint32_t>>(static_cast<EventImp<uint32_t> *>(L0::Event::create<uint32_t>(eventPool.get(), &eventDesc, device)));
+    ASSERT_NE(nullptr, secondEvent);
+
+    event->hostAddress = &data[0];
+    secondEvent->hostAddress = &data[1];
+
+    ze_event_handle_t events[] = {event->toHandle(), secondEvent->toHandle()};
+    ze_kernel_timestamp_result_t results[2] = {};
+    ze_kernel_timestamp_result_t resultsInNs[2] = {};
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventQueryKernelTimestamps(2u, events, results, resultsInNs));
+
+    const auto resolution = device->getNEODevice()->getDeviceInfo().profilingTimerResolution;
+    for (uint32_t i = 0; i < 2; i++) {
+        EXPECT_EQ(data[i].contextStart, results[i].context.kernelStart);
+        EXPECT_EQ(data[i].contextEnd, results[i].context.kernelEnd);
+        EXPECT_EQ(data[i].globalStart, results[i].global.kernelStart);
+        EXPECT_EQ(data[i].globalEnd, results[i].global.kernelEnd);
+
+        auto contextStartNs = static_cast<uint64_t>(data[i].contextStart * resolution);
+        auto globalStartNs = static_cast<uint64_t>(data[i].globalStart * resolution);
+        EXPECT_EQ(contextStartNs, resultsInNs[i].context.kernelStart);
+        EXPECT_EQ(contextStartNs + static_cast<uint64_t>((data[i].contextEnd - data[i].contextStart) * resolution), resultsInNs[i].context.kernelEnd);
+        EXPECT_EQ(globalStartNs, resultsInNs[i].global.kernelStart);
+        EXPECT_EQ(globalStartNs + static_cast<uint64_t>((data[i].globalEnd - data[i].globalStart) * resolution), resultsInNs[i].global.kernelEnd);
+    }
+}
+
+HWCMDTEST_F(IGFX_GEN9_CORE, TimestampEventCreate, givenNotSignaledEventInBatchWhenQueryingKernelTimestampsThenNotReadyIsReturnedAndOtherEventsAreFilled) {
+    typename MockTimestampPackets32::Packet data[2] = {};
+    data[0].contextStart = 1u;
+    data[0].contextEnd = 2u;
+    data[0].globalStart = 3u;
+    data[0].globalEnd = 4u;
+    data[1].contextStart = Event::STATE_CLEARED;
+    data[1].contextEnd = Event::STATE_CLEARED;
+    data[1].globalStart = Event::STATE_CLEARED;
+    data[1].globalEnd = Event::STATE_CLEARED;
+
+    eventDesc.index = 1;
+    auto secondEvent = std::unique_ptr<EventImp<uint32_t>>(static_cast<EventImp<uint32_t> *>(L0::Event::create<uint32_t>(eventPool.get(), &eventDesc, device)));
+    ASSERT_NE(nullptr, secondEvent);
+
+    event->hostAddress = &data[0];
+    secondEvent->hostAddress = &data[1];
+
+    ze_event_handle_t events[] = {event->toHandle(), secondEvent->toHandle()};
+    ze_kernel_timestamp_result_t results[2] = {};
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, zexEventQueryKernelTimestamps(2u, events, results, nullptr));
+    EXPECT_EQ(data[0].globalStart, results[0].global.kernelStart);
+    EXPECT_EQ(data[0].globalEnd, results[0].global.kernelEnd);
+    EXPECT_EQ(0u, results[1].global.kernelStart);
+    EXPECT_EQ(0u, results[1].global.kernelEnd);
+}
+
+HWCMDTEST_F(IGFX_GEN9_CORE, TimestampEventCreate, givenEventsFromSamePoolPassedInReverseOrderWhenQueryingKernelTimestampsInBatchThenResultsFollowOrderOfHandles) {
+    typename MockTimestampPackets32::Packet data[2] = {};
+    data[0].contextStart = 1u;
+    data[0].contextEnd = 2u;
+    data[0].globalStart = 3u;
+    data[0].globalEnd = 4u;
+    data[1].contextStart = 10u;
+    data[1].contextEnd = 20u;
+    data[1].globalStart = 30u;
+    data[1].globalEnd = 40u;
+
+    eventDesc.index = 1;
+    auto secondEvent = std::unique_ptr<EventImp<uint32_t>>(static_cast<EventImp<uint32_t> *>(L0::Event::create<uint32_t>(eventPool.get(), &eventDesc, device)));
+    ASSERT_NE(nullptr, secondEvent);
+
+    event->hostAddress = &data[0];
+    secondEvent->hostAddress = &data[1];
+
+    ze_event_handle_t events[] = {secondEvent->toHandle(), event->toHandle()};
+    ze_kernel_timestamp_result_t results[2] = {};
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventQueryKernelTimestamps(2u, events, results, nullptr));
+    EXPECT_EQ(data[1].globalStart, results[0].global.kernelStart);
+    EXPECT_EQ(data[1].contextEnd, results[0].context.kernelEnd);
+    EXPECT_EQ(data[0].globalStart, results[1].global.kernelStart);
+    EXPECT_EQ(data[0].contextEnd, results[1].context.kernelEnd);
+    EXPECT_TRUE(event->isAlreadyCompleted());
+    EXPECT_TRUE(secondEvent->isAlreadyCompleted());
+}
+
+HWCMDTEST_F(IGFX_GEN9_CORE, TimestampEventCreate, givenCounterBasedEventCompletedAfterPacketsWereCopiedWhenQueryingKernelTimestampFromPacketsThenTimestampsAreReadFromEventMemory) {
+    typename MockTimestampPackets32::Packet data = {};
+    data.contextStart = 1u;
+    data.contextEnd = 2u;
+    data.globalStart = 3u;
+    data.globalEnd = 4u;
+    typename MockTimestampPackets32::Packet packetsCopy = {};
+    event->hostAddress = &data;
+
+    MockTagAllocator<DeviceAllocNodeType<true>> tagAllocator(0, neoDevice->getMemoryManager());
+    auto inOrderExecInfo = std::make_shared<NEO::InOrderExecInfo>(tagAllocator.getTag(), nullptr, *neoDevice->getMemoryManager(), 1, 0, false, false);
+    event->enableCounterBasedMode(true, ZE_EVENT_POOL_COUNTER_BASED_EXP_FLAG_IMMEDIATE);
+    event->updateInOrderExecState(inOrderExecInfo, 1, 0);
+
+    // packets were copied before kernel completed, counter is updated after the copy
+    *inOrderExecInfo->getBaseHostAddress() = 1;
+
+    ze_kernel_timestamp_result_t result = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, event->queryKernelTimestampFromPackets(&packetsCopy, &result));
+    EXPECT_EQ(data.globalStart, result.global.kernelStart);
+    EXPECT_EQ(data.globalEnd, result.global.kernelEnd);
+}
+
+TEST_F(TimestampEventCreate, givenInvalidArgumentsWhenQueryingKernelTimestampsInBatchThenErrorIsReturned) {
+    ze_event_handle_t events[] = {event->toHandle(), nullptr};
+    ze_kernel_timestamp_result_t results[2] = {};
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexEventQueryKernelTimestamps(0u, events, results, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexEventQueryKernelTimestamps(1u, nullptr, results, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexEventQueryKernelTimestamps(1u, events, nullptr, nullptr));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, zexEventQueryKernelTimestamps(2u, events, results, nullptr));
+}
+
 TEST_F(TimestampEventUsedPacketSignalCreate, givenEventWhenQueryingTimestampExpThenCorrectDataSet) {
     typename MockTimestampPackets32::Packet packetData[2];
     event->setPacketsInUse(2u);
@@ -3416,6 +3547,56 @@ HWTEST_F(EventTests, givenStandaloneCbEventAndTbxModeWhenSynchronizingThenHandle
     zeEventDestroy(handle);
 }
 
+TEST_F(EventTests, givenCounterBasedEventsSharingCounterWhenSynchronizingMultipleEventsThenOnlyEventWithHighestValueIsWaitedOn) {
+    uint64_t counterValue = 1;
+    uint64_t *hostAddress = &counterValue;
+    uint64_t *gpuAddress = ptrOffset(&counterValue, 64);
+
+    ze_event_desc_t eventDesc = {};
+    ze_event_handle_t handles[2] = {};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCounterBasedEventCreate(context, device, gpuAddress, hostAddress, 2, &eventDesc, &handles[0]));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexCounterBasedEventCreate(context, device, gpuAddress, hostAddress, 1, &eventDesc, &handles[1]));
+    auto highestValueEvent = Event::fromHandle(handles[0]);
+    auto lowerValueEvent = Event::fromHandle(handles[1]);
+    lowerValueEvent->updateInOrderExecState(highestValueEvent->getInOrderExecInfo(), 1, 0);
+
+    EXPECT_EQ(ZE_RESULT_NOT_READY, zexEventHostSynchronizeMultiple(2u, handles, 0));
+    EXPECT_FALSE(highestValueEvent->isAlreadyCompleted());
+    EXPECT_FALSE(lowerValueEvent->isAlreadyCompleted());
+
+    counterValue = 2;
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventHostSynchronizeMultiple(2u, handles, 0));
+    EXPECT_TRUE(highestValueEvent->isAlreadyCompleted());
+    EXPECT_TRUE(lowerValueEvent->isAlreadyCompleted());
+
+    zeEventDestroy(handles[0]);
+    zeEventDestroy(handles[1]);
+}
+
+TEST_F(EventTests, givenRegularEventsWhenSynchronizingMultipleEventsThenSuccessIsReturnedOnlyWhenAllEventsAreSignaled) {
+    eventDesc.index = 1;
+    auto firstEvent = zeUniquePtr(whiteboxCast(getHelper<L0GfxCoreHelper>().createEvent(eventPool.get(), &eventDesc, device)));
+    eventDesc.index = 2;
+    auto secondEvent = zeUniquePtr(whiteboxCast(getHelper<L0GfxCoreHelper>().createEvent(eventPool.get(), &eventDesc, device)));
+    ASSERT_NE(nullptr, firstEvent);
+    ASSERT_NE(nullptr, secondEvent);
+    ze_event_handle_t handles[] = {firstEvent->toHandle(), secondEvent->toHandle()};
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, firstEvent->hostSignal());
+    EXPECT_EQ(ZE_RESULT_NOT_READY, zexEventHostSynchronizeMultiple(2u, handles, 0));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, secondEvent->hostSignal());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, zexEventHostSynchronizeMultiple(2u, handles, 0));
+}
+
+TEST_F(EventTests, givenInvalidArgumentsWhenSynchronizingMultipleEventsThenErrorIsReturned) {
+    ze_event_handle_t handles[] = {event->toHandle(), nullptr};
+
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexEventHostSynchronizeMultiple(0u, handles, 0));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_ARGUMENT, zexEventHostSynchronizeMultiple(1u, nullptr, 0));
+    EXPECT_EQ(ZE_RESULT_ERROR_INVALID_NULL_HANDLE, zexEventHostSynchronizeMultiple(2u, handles, 0));
+}
+
 HWTEST_F(EventTests, givenInOrderEventWithHostAllocWhenHostSynchronizeIsCalledThenAllocationIsDonwloadedOnlyAfterEventWasUsedOnGpu) {
     debugManager.flags.InOrderDuplicatedCounterStorageEnabled.set(1);
 
@@ -19,6 +19,7 @@
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/kernel/implicit_args_helper.h"
 #include "shared/source/os_interface/os_inc_base.h"
+#include "shared/source/program/isa_allocation_cache.h"
 #include "shared/source/program/kernel_info.h"
 #include "shared/test/common/compiler_interface/linker_mock.h"
 #include "shared/test/common/device_binary_format/patchtokens_tests.h"
@@ -2255,6 +2256,81 @@ TEST_F(ModuleDynamicLinkTests, givenModuleWithFunctionDependenciesWhenOtherModul
     EXPECT_EQ(ZE_RESULT_ERROR_MODULE_LINK_FAILURE, res);
 }
 
+TEST_F(ModuleDynamicLinkTests, givenDynamicLinkSymbolTableEnabledWhenSymbolIsDefinedByMultipleModulesThenFirstModuleDefinitionIsPatchedAndRelinkOfSameModulesIsSkipped) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.EnableDynamicLinkSymbolTable.set(1);
+    NEO::debugManager.flags.DynamicLinkPatchingThreads.set(2);
+
+    uint64_t gpuAddress = 0x12345;
+    uint32_t offsets[] = {0x20, 0x40, 0x44};
+
+    char kernelHeap[MemoryConstants::pageSize] = {};
+    auto kernelInfo = std::make_unique<NEO::KernelInfo>();
+    kernelInfo->heapInfo.pKernelHeap = kernelHeap;
+    kernelInfo->heapInfo.kernelHeapSize = MemoryConstants::pageSize;
+    module0->getTranslationUnit()->programInfo.kernelInfos.push_back(kernelInfo.release());
+
+    auto linkerInput = std::make_unique<::WhiteBox<NEO::LinkerInput>>();
+    linkerInput->traits.requiresPatchingOfInstructionSegments = true;
+    module0->getTranslationUnit()->programInfo.linkerInput = std::move(linkerInput);
+
+    NEO::Linker::RelocationInfo::Type types[] = {NEO::Linker::RelocationInfo::Type::address, NEO::Linker::RelocationInfo::Type::addressLow, NEO::Linker::RelocationInfo::Type::addressHigh};
+    for (auto i = 0u; i < 3u; i++) {
+        NEO::Linker::RelocationInfo unresolvedRelocation;
+        unresolvedRelocation.symbolName = "unresolved";
+        unresolvedRelocation.offset = offsets[i];
+        unresolvedRelocation.type = types[i];
+        module0->unresolvedExternalsInfo.push_back({unresolvedRelocation});
+        module0->unresolvedExternalsInfo[i].instructionsSegmentId = 0u;
+    }
+
+    auto kernelImmData = std::make_unique<WhiteBox<::L0::KernelImmutableData>>(device);
+    kernelImmData->isaGraphicsAllocation.reset(neoDevice->getMemoryManager()->allocateGraphicsMemoryWithProperties(
+        {device->getRootDeviceIndex(), MemoryConstants::pageSize, NEO::AllocationType::kernelIsa, neoDevice->getDeviceBitfield()}));
+    auto isaPtr = kernelImmData->getIsaGraphicsAllocation()->getUnderlyingBuffer();
+    module0->kernelImmDatas.push_back(std::move(kernelImmData));
+
+    NEO::SymbolInfo symbolInfo{};
+    module1->symbols["unresolved"] = NEO::Linker::RelocatedSymbol<NEO::SymbolInfo>{symbolInfo, gpuAddress};
+    module2->symbols["unresolved"] = NEO::Linker::RelocatedSymbol<NEO::SymbolInfo>{symbolInfo, gpuAddress + 0x1000};
+
+    MockGraphicsAllocation exportedFunctionsSurface;
+    module1->exportedFunctionsSurface = &exportedFunctionsSurface;
+
+    std::vector<ze_module_handle_t> hModules = {module0->toHandle(), module1->toHandle(), module2->toHandle()};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, module0->performDynamicLink(3, hModules.data(), nullptr));
+    EXPECT_TRUE(module0->isFullyLinked);
+    EXPECT_EQ(gpuAddress, *reinterpret_cast<uint64_t *>(ptrOffset(isaPtr, offsets[0])));
+    EXPECT_EQ(static_cast<uint32_t>(gpuAddress), *reinterpret_cast<uint32_t *>(ptrOffset(isaPtr, offsets[1])));
+    EXPECT_EQ(static_cast<uint32_t>(gpuAddress >> 32), *reinterpret_cast<uint32_t *>(ptrOffset(isaPtr, offsets[2])));
+
+    auto &residencyContainer = module0->kernelImmDatas[0]->getResidencyContainer();
+    auto residencyContainerSize = residencyContainer.size();
+    EXPECT_NE(residencyContainer.end(), std::find(residencyContainer.begin(), residencyContainer.end(), &exportedFunctionsSurface));
+
+    std::vector<ze_module_handle_t> hModulesReordered = {module2->toHandle(), module1->toHandle(), module0->toHandle()};
+    EXPECT_EQ(ZE_RESULT_SUCCESS, module0->performDynamicLink(3, hModulesReordered.data(), nullptr));
+    EXPECT_EQ(residencyContainerSize, residencyContainer.size());
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, module0->performDynamicLink(2, hModules.data(), nullptr));
+    EXPECT_EQ(residencyContainerSize + 1, residencyContainer.size());
+}
+
+TEST_F(ModuleDynamicLinkTests, givenDynamicLinkSymbolTableEnabledWhenSymbolIsNotDefinedByAnyModuleThenLinkFailureIsReturnedAndSegmentsAreNotPatched) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.EnableDynamicLinkSymbolTable.set(1);
+
+    NEO::Linker::RelocationInfo unresolvedRelocation;
+    unresolvedRelocation.symbolName = "unresolved";
+    module0->unresolvedExternalsInfo.push_back({unresolvedRelocation});
+    module0->translationUnit->programInfo.linkerInput.reset(new ::WhiteBox<NEO::LinkerInput>());
+
+    std::vector<ze_module_handle_t> hModules = {module0->toHandle(), module1->toHandle()};
+    EXPECT_EQ(ZE_RESULT_ERROR_MODULE_LINK_FAILURE, module0->performDynamicLink(2, hModules.data(), nullptr));
+    EXPECT_FALSE(module0->isFullyLinked);
+    EXPECT_TRUE(module0->dynamicLinkedModuleIds.empty());
+}
+
 TEST_F(ModuleFunctionPointerTests, givenModuleWithExportedSymbolThenGetFunctionPointerReturnsGpuAddressToFunction) {
 
     uint64_t gpuAddress = 0x12345;
@@ -3064,6 +3140,29 @@ HWTEST_F(ModuleTranslationUnitTest, WhenCreatingFromZebinThenAppendAllowZebinFla
     EXPECT_STREQ(expectedOptions.c_str(), moduleTu.options.c_str());
 }
 
+HWTEST_F(ModuleTranslationUnitTest, givenZebinWithSpirvWhenCreatingFromNativeBinaryThenUnpackedPartsShareSingleCopyOfInput) {
+    ZebinTestData::ValidEmptyProgram zebin;
+    const uint8_t spirvData[30] = {0xd};
+    zebin.appendSection(NEO::Zebin::Elf::SHT_ZEBIN_SPIRV, NEO::Zebin::Elf::SectionNames::spv, spirvData);
+    zebin.elfHeader->machine = device->getNEODevice()->getHardwareInfo().platform.eProductFamily;
+
+    L0::ModuleTranslationUnit moduleTu(this->device);
+    auto result = moduleTu.createFromNativeBinary(reinterpret_cast<const char *>(zebin.storage.data()), zebin.storage.size());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+
+    ASSERT_NE(nullptr, moduleTu.packedDeviceBinary);
+    EXPECT_NE(reinterpret_cast<const char *>(zebin.storage.data()), moduleTu.packedDeviceBinary.get());
+    EXPECT_EQ(zebin.storage.size(), moduleTu.packedDeviceBinarySize);
+    EXPECT_EQ(moduleTu.packedDeviceBinary.get(), moduleTu.unpackedDeviceBinary.get());
+    EXPECT_EQ(zebin.storage.size(), moduleTu.unpackedDeviceBinarySize);
+
+    ASSERT_EQ(sizeof(spirvData), moduleTu.irBinarySize);
+    EXPECT_GT(moduleTu.irBinary.get(), moduleTu.packedDeviceBinary.get());
+    EXPECT_LT(moduleTu.irBinary.get(), moduleTu.packedDeviceBinary.get() + moduleTu.packedDeviceBinarySize);
+    EXPECT_EQ(0, memcmp(spirvData, moduleTu.irBinary.get(), sizeof(spirvData)));
+    EXPECT_EQ(3, moduleTu.packedDeviceBinary.use_count());
+}
+
 HWTEST2_F(ModuleTranslationUnitTest, givenLargeGrfAndSimd16WhenProcessingBinaryThenKernelGroupSizeReducedToFitWithinSubslice, IsWithinXeGfxFamily) {
     std::string validZeInfo = std::string("version :\'") + versionToString(NEO::Zebin::ZeInfo::zeInfoDecoderVersion) + R"===('
 kernels:
@@ -3996,6 +4095,55 @@ TEST_F(ModuleIsaAllocationsInSystemMemoryTest, givenKernelIsaWhichCouldFitInPage
     EXPECT_EQ(kernelImmDatas[1]->getIsaGraphicsAllocation()->getMemoryPool(), isaAllocationMemoryPool);
 }
 
+TEST_F(ModuleIsaAllocationsInSystemMemoryTest, givenKernelIsaDeduplicationEnabledWhenModulesWithIdenticalKernelIsaAreInitializedThenIsaAllocationIsSharedUntilLastUserIsDestroyed) {
+    debugManager.flags.EnableKernelIsaDeduplication.set(1);
+
+    uint8_t isa[0x40];
+    uint8_t otherIsa[0x40];
+    memset(isa, 0xab, sizeof(isa));
+    memset(otherIsa, 0xcd, sizeof(otherIsa));
+
+    auto addKernelInfo = [](MockModule &module, const void *kernelHeap, size_t kernelHeapSize) {
+        auto kernelInfo = new KernelInfo{};
+        kernelInfo->heapInfo.pKernelHeap = kernelHeap;
+        kernelInfo->heapInfo.kernelHeapSize = static_cast<uint32_t>(kernelHeapSize);
+        module.translationUnit->programInfo.kernelInfos.push_back(kernelInfo);
+    };
+    addKernelInfo(*this->mockModule, isa, sizeof(isa));
+    addKernelInfo(*this->mockModule, otherIsa, sizeof(otherIsa));
+
+    auto secondModule = std::make_unique<MockModule>(this->device, nullptr, ModuleType::user);
+    secondModule->translationUnit.reset(new MockModuleTranslationUnit{this->device});
+    addKernelInfo(*secondModule, isa, sizeof(isa));
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, this->mockModule->initializeKernelImmutableDatas());
+    EXPECT_EQ(ZE_RESULT_SUCCESS, secondModule->initializeKernelImmutableDatas());
+
+    auto &kernelImmDatas = this->mockModule->getKernelImmutableDataVector();
+    auto &secondKernelImmDatas = secondModule->getKernelImmutableDataVector();
+    auto sharedAllocation = kernelImmDatas[0]->getIsaGraphicsAllocation();
+    EXPECT_EQ(nullptr, kernelImmDatas[0]->getIsaParentAllocation());
+    EXPECT_TRUE(kernelImmDatas[0]->isIsaSharedAllocation());
+    EXPECT_TRUE(kernelImmDatas[0]->isIsaCopiedToAllocation());
+    EXPECT_EQ(sharedAllocation, secondKernelImmDatas[0]->getIsaGraphicsAllocation());
+    EXPECT_NE(sharedAllocation, kernelImmDatas[1]->getIsaGraphicsAllocation());
+
+    auto isaAllocationCache = this->neoDevice->getIsaAllocationCache();
+    auto statistics = isaAllocationCache->getStatistics();
+    EXPECT_EQ(2u, statistics.uploads);
+    EXPECT_EQ(1u, statistics.hits);
+    EXPECT_EQ(sharedAllocation->getUnderlyingBufferSize(), statistics.savedBytes);
+    EXPECT_EQ(2u, statistics.liveAllocations);
+
+    secondModule->translationUnit.reset();
+    secondModule.reset();
+    EXPECT_EQ(2u, isaAllocationCache->getStatistics().liveAllocations);
+    EXPECT_EQ(sharedAllocation, kernelImmDatas[0]->getIsaGraphicsAllocation());
+
+    this->mockModule->getKernelImmutableDataVectorRef().clear();
+    EXPECT_EQ(0u, isaAllocationCache->getStatistics().liveAllocations);
+}
+
 HWTEST_F(ModuleIsaAllocationsInSystemMemoryTest, givenMultipleKernelIsasWhichFitInSinglePageAndDebuggerEnabledWhenKernelImmutableDatasAreInitializedThenKernelIsasGetSeparateAllocations) {
     this->givenMultipleKernelIsasWhichFitInSinglePageAndDebuggerEnabledWhenKernelImmutableDatasAreInitializedThenKernelIsasGetSeparateAllocations<FamilyType>();
 }
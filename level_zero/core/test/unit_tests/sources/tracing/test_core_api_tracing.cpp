@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -195,12 +195,9 @@ TEST_F(ZeApiTracingCoreTests, WhenCallingTracerWrapperWithOnePrologAndNoEpilogWi
     ze_command_list_handle_t commandListHandle = commandList.toHandle();
     tracerParams.phCommandList = &commandListHandle;
 
-    std::vector<APITracerCallbackStateImp<ze_pfnCommandListCloseCb_t>> prologCallbacks;
-    std::vector<APITracerCallbackStateImp<ze_pfnCommandListCloseCb_t>> epilogCallbacks;
-    APITracerCallbackStateImp<ze_pfnCommandListCloseCb_t> prologCallback;
-    prologCallback.currentApiCallback = prologCbs.CommandList.pfnCloseCb;
-    prologCallback.pUserData = &userData;
-    prologCallbacks.push_back(prologCallback);
+    TracerCallbackEntry prologEntry = {reinterpret_cast<TracerCallbackPtr>(prologCbs.CommandList.pfnCloseCb), &userData, 0u};
+    APITracerCallbacksImp<ze_pfnCommandListCloseCb_t> prologCallbacks = {&prologEntry, 1u, 1u};
+    APITracerCallbacksImp<ze_pfnCommandListCloseCb_t> epilogCallbacks;
     ze_pfnCommandListCloseCb_t apiOrdinal = {};
 
     result = apiTracerWrapperImp(zeCommandListClose, &tracerParams, apiOrdinal, prologCallbacks, epilogCallbacks, *tracerParams.phCommandList);
@@ -221,16 +218,10 @@ TEST_F(ZeApiTracingCoreTests, WhenCallingTracerWrapperWithOneSetOfPrologEpilogsW
     ze_command_list_handle_t commandListHandle = commandList.toHandle();
     tracerParams.phCommandList = &commandListHandle;
 
-    std::vector<APITracerCallbackStateImp<ze_pfnCommandListCloseCb_t>> prologCallbacks;
-    std::vector<APITracerCallbackStateImp<ze_pfnCommandListCloseCb_t>> epilogCallbacks;
-    APITracerCallbackStateImp<ze_pfnCommandListCloseCb_t> prologCallback;
-    APITracerCallbackStateImp<ze_pfnCommandListCloseCb_t> epilogCallback;
-    prologCallback.currentApiCallback = prologCbs.CommandList.pfnCloseCb;
-    epilogCallback.currentApiCallback = epilogCbs.CommandList.pfnCloseCb;
-    prologCallback.pUserData = &userData;
-    epilogCallback.pUserData = &userData;
-    prologCallbacks.push_back(prologCallback);
-    epilogCallbacks.push_back(epilogCallback);
+    TracerCallbackEntry prologEntry = {reinterpret_cast<TracerCallbackPtr>(prologCbs.CommandList.pfnCloseCb), &userData, 0u};
+    TracerCallbackEntry epilogEntry = {reinterpret_cast<TracerCallbackPtr>(epilogCbs.CommandList.pfnCloseCb), &userData, 0u};
+    APITracerCallbacksImp<ze_pfnCommandListCloseCb_t> prologCallbacks = {&prologEntry, 1u, 1u};
+    APITracerCallbacksImp<ze_pfnCommandListCloseCb_t> epilogCallbacks = {&epilogEntry, 1u, 1u};
     ze_pfnCommandListCloseCb_t apiOrdinal = {};
 
     result = apiTracerWrapperImp(zeCommandListClose, &tracerParams, apiOrdinal, prologCallbacks, epilogCallbacks, *tracerParams.phCommandList);
@@ -251,16 +242,10 @@ TEST_F(ZeApiTracingCoreTests, WhenCallingTracerWrapperWithOneSetOfPrologEpilogsW
     ze_command_list_handle_t commandListHandle = commandList.toHandle();
     tracerParams.phCommandList = &commandListHandle;
 
-    std::vector<APITracerCallbackStateImp<ze_pfnCommandListCloseCb_t>> prologCallbacks;
-    std::vector<APITracerCallbackStateImp<ze_pfnCommandListCloseCb_t>> epilogCallbacks;
-    APITracerCallbackStateImp<ze_pfnCommandListCloseCb_t> prologCallback;
-    APITracerCallbackStateImp<ze_pfnCommandListCloseCb_t> epilogCallback;
-    prologCallback.currentApiCallback = prologCbs.CommandList.pfnCloseCb;
-    epilogCallback.currentApiCallback = epilogCbs.CommandList.pfnCloseCb;
-    prologCallback.pUserData = &userData;
-    epilogCallback.pUserData = &userData;
-    prologCallbacks.push_back(prologCallback);
-    epilogCallbacks.push_back(epilogCallback);
+    TracerCallbackEntry prologEntry = {reinterpret_cast<TracerCallbackPtr>(prologCbs.CommandList.pfnCloseCb), &userData, 0u};
+    TracerCallbackEntry epilogEntry = {reinterpret_cast<TracerCallbackPtr>(epilogCbs.CommandList.pfnCloseCb), &userData, 0u};
+    APITracerCallbacksImp<ze_pfnCommandListCloseCb_t> prologCallbacks = {&prologEntry, 1u, 1u};
+    APITracerCallbacksImp<ze_pfnCommandListCloseCb_t> epilogCallbacks = {&epilogEntry, 1u, 1u};
     ze_pfnCommandListCloseCb_t apiOrdinal = {};
 
     result = apiTracerWrapperImp(zeCommandListClose, &tracerParams, apiOrdinal, prologCallbacks, epilogCallbacks, *tracerParams.phCommandList);
@@ -280,16 +265,10 @@ TEST_F(ZeApiTracingCoreTests, WhenCallingTracerWrapperWithOneSetOfPrologEpilogsW
     ze_command_list_handle_t commandListHandle = commandList.toHandle();
     tracerParams.phCommandList = &commandListHandle;
 
-    std::vector<APITracerCallbackStateImp<ze_pfnCommandListCloseCb_t>> prologCallbacks;
-    std::vector<APITracerCallbackStateImp<ze_pfnCommandListCloseCb_t>> epilogCallbacks;
-    APITracerCallbackStateImp<ze_pfnCommandListCloseCb_t> prologCallback;
-    APITracerCallbackStateImp<ze_pfnCommandListCloseCb_t> epilogCallback;
-    prologCallback.currentApiCallback = prologCbs.CommandList.pfnCloseCb;
-    epilogCallback.currentApiCallback = epilogCbs.CommandList.pfnCloseCb;
-    prologCallback.pUserData = nullptr;
-    epilogCallback.pUserData = nullptr;
-    prologCallbacks.push_back(prologCallback);
-    epilogCallbacks.push_back(epilogCallback);
+    TracerCallbackEntry prologEntry = {reinterpret_cast<TracerCallbackPtr>(prologCbs.CommandList.pfnCloseCb), nullptr, 0u};
+    TracerCallbackEntry epilogEntry = {reinterpret_cast<TracerCallbackPtr>(epilogCbs.CommandList.pfnCloseCb), nullptr, 0u};
+    APITracerCallbacksImp<ze_pfnCommandListCloseCb_t> prologCallbacks = {&prologEntry, 1u, 1u};
+    APITracerCallbacksImp<ze_pfnCommandListCloseCb_t> epilogCallbacks = {&epilogEntry, 1u, 1u};
     ze_pfnCommandListCloseCb_t apiOrdinal = {};
 
     result = apiTracerWrapperImp(zeCommandListClose, &tracerParams, apiOrdinal, prologCallbacks, epilogCallbacks, *tracerParams.phCommandList);
@@ -310,16 +289,10 @@ TEST_F(ZeApiTracingCoreTests, WhenCallingTracerWrapperWithOneSetOfPrologEpilogsW
     ze_command_list_handle_t commandListHandle = commandList.toHandle();
     tracerParams.phCommandList = &commandListHandle;
 
-    std::vector<APITracerCallbackStateImp<ze_pfnCommandListCloseCb_t>> prologCallbacks;
-    std::vector<APITracerCallbackStateImp<ze_pfnCommandListCloseCb_t>> epilogCallbacks;
-    APITracerCallbackStateImp<ze_pfnCommandListCloseCb_t> prologCallback;
-    APITracerCallbackStateImp<ze_pfnCommandListCloseCb_t> epilogCallback;
-    prologCallback.currentApiCallback = prologCbs.CommandList.pfnCloseCb;
-    epilogCallback.currentApiCallback = epilogCbs.CommandList.pfnCloseCb;
-    prologCallback.pUserData = &userData;
-    epilogCallback.pUserData = &userData;
-    prologCallbacks.push_back(prologCallback);
-    epilogCallbacks.push_back(epilogCallback);
+    TracerCallbackEntry prologEntry = {reinterpret_cast<TracerCallbackPtr>(prologCbs.CommandList.pfnCloseCb), &userData, 0u};
+    TracerCallbackEntry epilogEntry = {reinterpret_cast<TracerCallbackPtr>(epilogCbs.CommandList.pfnCloseCb), &userData, 0u};
+    APITracerCallbacksImp<ze_pfnCommandListCloseCb_t> prologCallbacks = {&prologEntry, 1u, 1u};
+    APITracerCallbacksImp<ze_pfnCommandListCloseCb_t> epilogCallbacks = {&epilogEntry, 1u, 1u};
     ze_pfnCommandListCloseCb_t apiOrdinal = {};
 
     result = callHandleTracerRecursion(zeCommandListClose, commandListHandle);
@@ -337,5 +310,44 @@ TEST_F(ZeApiTracingCoreTests, WhenCallingTracerWrapperWithOneSetOfPrologEpilogsW
     L0::tracingInProgress = 0;
 }
 
+TEST_F(ZeApiTracingCoreTests, GivenZeroOneOrFourEnabledTracersWhenCallbackTableIsCreatedThenOnlyNonNullCallbacksAreStoredPerApiWithTracerIndices) {
+    constexpr size_t closeOrdinal = offsetof(zet_core_callbacks_t, CommandList.pfnCloseCb) / sizeof(TracerCallbackPtr);
+    constexpr size_t appendLaunchKernelOrdinal = offsetof(zet_core_callbacks_t, CommandList.pfnAppendLaunchKernelCb) / sizeof(TracerCallbackPtr);
+    int userData[4] = {};
+    tracer_array_entry_t tracerEntries[4] = {};
+    for (size_t i = 0; i < 4; i++) {
+        tracerEntries[i].pUserData = &userData[i];
+        tracerEntries[i].corePrologues.CommandList.pfnCloseCb = onEnterCommandListCloseWithUserData;
+        if (i % 2 == 1) {
+            tracerEntries[i].coreEpilogues.CommandList.pfnCloseCb = onExitCommandListCloseWithUserData;
+        }
+    }
+    tracerEntries[3].corePrologues.CommandList.pfnAppendLaunchKernelCb = onEnterCommandListAppendLaunchKernel;
+
+    for (size_t tracerCount : {0u, 1u, 4u}) {
+        std::unique_ptr<TracerCallbackTable> table(TracerCallbackTable::create(tracerEntries, tracerCount));
+        tracer_array_t tracerArray = {tracerCount, tracerEntries, table.get()};
+        EXPECT_EQ(tracerCount, table->tracerCount);
+
+        APITracerCallbackDataImp<ze_pfnCommandListCloseCb_t> closeCallbacks;
+        getApiTracerCallbacks(closeCallbacks, &tracerArray, closeOrdinal);
+        ASSERT_EQ(tracerCount, closeCallbacks.prologCallbacks.count);
+        ASSERT_EQ(tracerCount / 2, closeCallbacks.epilogCallbacks.count);
+        for (size_t i = 0; i < closeCallbacks.prologCallbacks.count; i++) {
+            EXPECT_EQ(i, closeCallbacks.prologCallbacks.entries[i].tracerIndex);
+            EXPECT_EQ(&userData[i], closeCallbacks.prologCallbacks.entries[i].pUserData);
+        }
+        for (size_t i = 0; i < closeCallbacks.epilogCallbacks.count; i++) {
+            EXPECT_EQ(2 * i + 1, closeCallbacks.epilogCallbacks.entries[i].tracerIndex);
+            EXPECT_EQ(&userData[2 * i + 1], closeCallbacks.epilogCallbacks.entries[i].pUserData);
+        }
+
+        APITracerCallbackDataImp<ze_pfnCommandListAppendLaunchKernelCb_t> appendLaunchKernelCallbacks;
+        getApiTracerCallbacks(appendLaunchKernelCallbacks, &tracerArray, appendLaunchKernelOrdinal);
+        EXPECT_EQ(tracerCount == 4u ? 1u : 0u, appendLaunchKernelCallbacks.prologCallbacks.count);
+        EXPECT_EQ(0u, appendLaunchKernelCallbacks.epilogCallbacks.count);
+    }
+}
+
 } // namespace ult
 } // namespace L0
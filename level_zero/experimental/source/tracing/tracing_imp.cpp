@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,8 +8,11 @@
 #include "level_zero/experimental/source/tracing/tracing_imp.h"
 
 #include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/sleep.h"
 
+#include <cstring>
+
 namespace L0 {
 
 thread_local ze_bool_t tracingInProgress = 0;
@@ -134,6 +137,34 @@ bool ThreadPrivateTracerData::testAndSetThreadTracerDataInitializedAndOnList(voi
 
 bool APITracerContextImp::isTracingEnabled() { return driverDdiTable.enableTracing; }
 
+static TracerCallbackPtr getTracerCallback(const zet_core_callbacks_t &callbacks, size_t apiOrdinal) {
+    TracerCallbackPtr callback = nullptr;
+    memcpy(&callback, ptrOffset(&callbacks, apiOrdinal * sizeof(TracerCallbackPtr)), sizeof(TracerCallbackPtr));
+    return callback;
+}
+
+TracerCallbackTable *TracerCallbackTable::create(const tracer_array_entry_t *tracerArrayEntries, size_t tracerArrayCount) {
+    auto table = new TracerCallbackTable;
+    table->tracerCount = tracerArrayCount;
+
+    for (size_t apiOrdinal = 0; apiOrdinal < apiOrdinalsCount; apiOrdinal++) {
+        table->prologOffsets[apiOrdinal] = table->prologs.size();
+        table->epilogOffsets[apiOrdinal] = table->epilogs.size();
+        for (size_t i = 0; i < tracerArrayCount; i++) {
+            auto &tracerEntry = tracerArrayEntries[i];
+            if (auto prolog = getTracerCallback(tracerEntry.corePrologues, apiOrdinal)) {
+                table->prologs.push_back({prolog, tracerEntry.pUserData, i});
+            }
+            if (auto epilog = getTracerCallback(tracerEntry.coreEpilogues, apiOrdinal)) {
+                table->epilogs.push_back({epilog, tracerEntry.pUserData, i});
+            }
+        }
+    }
+    table->prologOffsets[apiOrdinalsCount] = table->prologs.size();
+    table->epilogOffsets[apiOrdinalsCount] = table->epilogs.size();
+    return table;
+}
+
 //
 // Walk the list of per-thread private data structures, testing
 // whether any of them reference this array.
@@ -167,6 +198,7 @@ size_t APITracerContextImp::testAndFreeRetiredTracers() {
         if (testForTracerArrayReferences(retiringTracerArray))
             continue;
         this->retiringTracerArrayList.remove(retiringTracerArray);
+        delete retiringTracerArray->callbackTable;
         delete[] retiringTracerArray->tracerArrayEntries;
         delete retiringTracerArray;
     }
@@ -193,6 +225,11 @@ size_t APITracerContextImp::updateTracerArrays() {
             newTracerArray->tracerArrayEntries[i] = (*itr)->tracerFunctions;
             i++;
         }
+        //
+        // precompile per API callback lists, so traced calls only index
+        // into the table of the array they have acquired
+        //
+        newTracerArray->callbackTable = TracerCallbackTable::create(newTracerArray->tracerArrayEntries, newTracerArrayCount);
 
     } else {
         newTracerArray = &emptyTracerArray;
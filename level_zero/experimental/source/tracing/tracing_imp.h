@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2020-2023 Intel Corporation
+ * Copyright (C) 2020-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,8 @@
 
 #pragma once
 
+#include "shared/source/utilities/stackvec.h"
+
 #include "level_zero/experimental/source/tracing/tracing.h"
 #include "level_zero/experimental/source/tracing/tracing_barrier_imp.h"
 #include "level_zero/experimental/source/tracing/tracing_cmdlist_imp.h"
@@ -26,8 +28,11 @@
 
 #include "ze_ddi_tables.h"
 
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <list>
 #include <mutex>
 #include <vector>
@@ -46,9 +51,34 @@ typedef struct TracerArrayEntry {
     void *pUserData;
 } tracer_array_entry_t;
 
+using TracerCallbackPtr = void (*)();
+
+// Non-null callback of a single enabled tracer
+struct TracerCallbackEntry {
+    TracerCallbackPtr callback;
+    void *pUserData;
+    size_t tracerIndex; // slot of instance user data shared by prolog and epilog of the tracer
+};
+
+// Callbacks of all enabled tracers flattened per API ordinal - position of the callback in zet_core_callbacks_t.
+// Built once whenever set of enabled tracers changes and immutable afterwards.
+struct TracerCallbackTable {
+    static constexpr size_t apiOrdinalsCount = sizeof(zet_core_callbacks_t) / sizeof(TracerCallbackPtr);
+    static_assert(sizeof(zet_core_callbacks_t) % sizeof(TracerCallbackPtr) == 0, "zet_core_callbacks_t expected to contain only callbacks");
+
+    static TracerCallbackTable *create(const tracer_array_entry_t *tracerArrayEntries, size_t tracerArrayCount);
+
+    size_t tracerCount = 0u;
+    std::array<size_t, apiOrdinalsCount + 1> prologOffsets = {};
+    std::array<size_t, apiOrdinalsCount + 1> epilogOffsets = {};
+    std::vector<TracerCallbackEntry> prologs;
+    std::vector<TracerCallbackEntry> epilogs;
+};
+
 typedef struct TracerArray {
     size_t tracerArrayCount;
     tracer_array_entry_t *tracerArrayEntries;
+    TracerCallbackTable *callbackTable;
 } tracer_array_t;
 
 enum TracingState {
@@ -109,7 +139,7 @@ struct APITracerContextImp : APITracerContext {
 
   private:
     std::mutex traceTableMutex;
-    tracer_array_t emptyTracerArray = {0, NULL};
+    tracer_array_t emptyTracerArray = {0, NULL, NULL};
     std::atomic<tracer_array_t *> activeTracerArray;
 
     //
@@ -134,20 +164,37 @@ struct APITracerContextImp : APITracerContext {
 extern thread_local ThreadPrivateTracerData myThreadPrivateTracerData;
 
 template <class T>
-class APITracerCallbackStateImp {
+class APITracerCallbacksImp {
   public:
-    T currentApiCallback;
-    void *pUserData;
+    const TracerCallbackEntry *entries = nullptr;
+    size_t count = 0u;
+    size_t tracerCount = 0u;
 };
 
 template <class T>
 class APITracerCallbackDataImp {
   public:
     T apiOrdinal = {};
-    std::vector<L0::APITracerCallbackStateImp<T>> prologCallbacks;
-    std::vector<L0::APITracerCallbackStateImp<T>> epilogCallbacks;
+    APITracerCallbacksImp<T> prologCallbacks;
+    APITracerCallbacksImp<T> epilogCallbacks;
 };
 
+template <class T>
+inline void getApiTracerCallbacks(APITracerCallbackDataImp<T> &perApiCallbackData, const tracer_array_t *tracerArray, size_t apiOrdinal) {
+    if (tracerArray == nullptr || tracerArray->callbackTable == nullptr) {
+        return;
+    }
+    auto &table = *tracerArray->callbackTable;
+    auto &prologs = perApiCallbackData.prologCallbacks;
+    prologs.entries = table.prologs.data() + table.prologOffsets[apiOrdinal];
+    prologs.count = table.prologOffsets[apiOrdinal + 1] - table.prologOffsets[apiOrdinal];
+    prologs.tracerCount = table.tracerCount;
+    auto &epilogs = perApiCallbackData.epilogCallbacks;
+    epilogs.entries = table.epilogs.data() + table.epilogOffsets[apiOrdinal];
+    epilogs.count = table.epilogOffsets[apiOrdinal + 1] - table.epilogOffsets[apiOrdinal];
+    epilogs.tracerCount = table.tracerCount;
+}
+
 #define ZE_HANDLE_TRACER_RECURSION(ze_api_ptr, ...) \
     do {                                            \
         if (L0::tracingInProgress) {                \
@@ -156,55 +203,31 @@ class APITracerCallbackDataImp {
         L0::tracingInProgress = 1;                  \
     } while (0)
 
-#define ZE_GEN_TRACER_ARRAY_ENTRY(callbackPtr, tracerArray, tracerArrayIndex, callbackType, callbackCategory, callbackFunction) \
-    do {                                                                                                                        \
-        callbackPtr = tracerArray->tracerArrayEntries[tracerArrayIndex].callbackType.callbackCategory.callbackFunction;         \
-    } while (0)
-
-#define ZE_GEN_PER_API_CALLBACK_STATE(perApiCallbackData, tracerType, callbackCategory, callbackFunctionType)                               \
-    L0::tracer_array_t *currentTracerArray;                                                                                                 \
-    currentTracerArray = (L0::tracer_array_t *)L0::pGlobalAPITracerContextImp->getActiveTracersList();                                      \
-    if (currentTracerArray) {                                                                                                               \
-        for (size_t i = 0; i < currentTracerArray->tracerArrayCount; i++) {                                                                 \
-            tracerType prologueCallbackPtr;                                                                                                 \
-            tracerType epilogue_callback_ptr;                                                                                               \
-            ZE_GEN_TRACER_ARRAY_ENTRY(prologueCallbackPtr, currentTracerArray, i, corePrologues, callbackCategory, callbackFunctionType);   \
-            ZE_GEN_TRACER_ARRAY_ENTRY(epilogue_callback_ptr, currentTracerArray, i, coreEpilogues, callbackCategory, callbackFunctionType); \
-                                                                                                                                            \
-            L0::APITracerCallbackStateImp<tracerType> prologCallback;                                                                       \
-            prologCallback.currentApiCallback = prologueCallbackPtr;                                                                        \
-            prologCallback.pUserData = currentTracerArray->tracerArrayEntries[i].pUserData;                                                 \
-            perApiCallbackData.prologCallbacks.push_back(prologCallback);                                                                   \
-                                                                                                                                            \
-            L0::APITracerCallbackStateImp<tracerType> epilogCallback;                                                                       \
-            epilogCallback.currentApiCallback = epilogue_callback_ptr;                                                                      \
-            epilogCallback.pUserData = currentTracerArray->tracerArrayEntries[i].pUserData;                                                 \
-            perApiCallbackData.epilogCallbacks.push_back(epilogCallback);                                                                   \
-        }                                                                                                                                   \
-    }
+#define ZE_GEN_PER_API_CALLBACK_STATE(perApiCallbackData, tracerType, callbackCategory, callbackFunctionType)                    \
+    L0::getApiTracerCallbacks(perApiCallbackData,                                                                                \
+                              static_cast<L0::tracer_array_t *>(L0::pGlobalAPITracerContextImp->getActiveTracersList()),         \
+                              offsetof(zet_core_callbacks_t, callbackCategory.callbackFunctionType) / sizeof(L0::TracerCallbackPtr))
 
-template <typename TFunctionPointer, typename TParams, typename TTracer, typename TTracerPrologCallbacks, typename TTracerEpilogCallbacks, typename... Args>
+template <typename TFunctionPointer, typename TParams, typename TTracer, typename... Args>
 ze_result_t apiTracerWrapperImp(TFunctionPointer zeApiPtr,
                                 TParams paramsStruct,
                                 TTracer apiOrdinal,
-                                TTracerPrologCallbacks prologCallbacks,
-                                TTracerEpilogCallbacks epilogCallbacks,
+                                const APITracerCallbacksImp<TTracer> &prologCallbacks,
+                                const APITracerCallbacksImp<TTracer> &epilogCallbacks,
                                 Args &&...args) {
     ze_result_t ret = ZE_RESULT_SUCCESS;
-    std::vector<APITracerCallbackStateImp<TTracer>> *callbacksPrologs = &prologCallbacks;
 
-    std::vector<void *> ppTracerInstanceUserData;
-    ppTracerInstanceUserData.resize(callbacksPrologs->size());
+    StackVec<void *, 8> ppTracerInstanceUserData;
+    ppTracerInstanceUserData.resize(std::max(prologCallbacks.tracerCount, epilogCallbacks.tracerCount), nullptr);
 
-    for (size_t i = 0; i < callbacksPrologs->size(); i++) {
-        if (callbacksPrologs->at(i).currentApiCallback != nullptr)
-            callbacksPrologs->at(i).currentApiCallback(paramsStruct, ret, callbacksPrologs->at(i).pUserData, &ppTracerInstanceUserData[i]);
+    for (size_t i = 0; i < prologCallbacks.count; i++) {
+        auto &callback = prologCallbacks.entries[i];
+        reinterpret_cast<TTracer>(callback.callback)(paramsStruct, ret, callback.pUserData, &ppTracerInstanceUserData[callback.tracerIndex]);
     }
     ret = zeApiPtr(args...);
-    std::vector<APITracerCallbackStateImp<TTracer>> *callbacksEpilogs = &epilogCallbacks;
-    for (size_t i = 0; i < callbacksEpilogs->size(); i++) {
-        if (callbacksEpilogs->at(i).currentApiCallback != nullptr)
-            callbacksEpilogs->at(i).currentApiCallback(paramsStruct, ret, callbacksEpilogs->at(i).pUserData, &ppTracerInstanceUserData[i]);
+    for (size_t i = 0; i < epilogCallbacks.count; i++) {
+        auto &callback = epilogCallbacks.entries[i];
+        reinterpret_cast<TTracer>(callback.callback)(paramsStruct, ret, callback.pUserData, &ppTracerInstanceUserData[callback.tracerIndex]);
     }
     L0::tracingInProgress = 0;
     L0::pGlobalAPITracerContextImp->releaseActivetracersList();
@@ -8,6 +8,7 @@
 #include "level_zero/tools/source/debug/debug_session_imp.h"
 
 #include "shared/source/built_ins/sip.h"
+#include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/gmm_helper/gmm_helper.h"
 #include "shared/source/helpers/basic_math.h"
@@ -16,11 +17,14 @@
 #include "shared/source/helpers/sleep.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/os_interface/os_interface.h"
+#include "shared/source/utilities/thread_pool.h"
 
 #include "level_zero/core/source/device/device_imp.h"
 #include "level_zero/core/source/gfx_core_helpers/l0_gfx_core_helper.h"
 #include "level_zero/include/zet_intel_gpu_debug.h"
 
+#include <algorithm>
+
 namespace L0 {
 
 DebugSession::DebugSession(const zet_debug_config_t &config, Device *device) : connectedDevice(device), config(config) {
@@ -400,10 +404,27 @@ DebugSessionImp::Error DebugSessionImp::resumeThreadsWithinDevice(uint32_t devic
     DEBUG_BREAK_IF(sipCommandResult != true);
 
     auto result = resumeImp(resumeThreadIds, deviceIndex);
+    invalidateStateSaveAreaCache(resumeThreadIds);
+
+    if (resumeThreadIds.size() > 1 && isThreadAll(apiThread) && stateSaveAreaCacheEnabled) {
+        // read only slots of resumed threads, slot is read again until its sr counter is updated
+        {
+            std::lock_guard<std::mutex> cacheLock(stateSaveAreaCacheMutex);
+            auto stateSaveArea = readThreadSlotsFromStateSaveArea(memoryHandle, resumeThreadIds);
 
-    // For resume(ALL) and multiple threads to resume - read whole state save area
-    // to avoid multiple calls to KMD
-    if (resumeThreadIds.size() > 1 && isThreadAll(apiThread)) {
+            for (auto &threadID : resumeThreadIds) {
+                while (stateSaveArea != nullptr && checkThreadIsResumed(threadID, stateSaveArea) == false) {
+                    stateSaveAreaCache[memoryHandle].validThreadSlots[calculateThreadSlotIndex(threadID)] = false;
+                    stateSaveArea = readThreadSlotsFromStateSaveArea(memoryHandle, {threadID});
+                }
+                allThreads[threadID]->resumeThread();
+            }
+        }
+        // slots of running threads are stale
+        invalidateStateSaveAreaCache(resumeThreadIds);
+    } else if (resumeThreadIds.size() > 1 && isThreadAll(apiThread)) {
+        // For resume(ALL) and multiple threads to resume - read whole state save area
+        // to avoid multiple calls to KMD
 
         auto gpuVa = getContextStateSaveAreaGpuVa(memoryHandle);
         auto stateSaveAreaSize = getContextStateSaveAreaSize(memoryHandle);
@@ -916,6 +937,7 @@ void DebugSessionImp::resumeAccidentallyStoppedThreads(const std::vector<EuThrea
             [[maybe_unused]] auto writeSipCommandResult = writeResumeCommand(threadIdsPerDevice[i]);
             DEBUG_BREAK_IF(writeSipCommandResult != true);
             resumeImp(threadIdsPerDevice[i], i);
+            invalidateStateSaveAreaCache(threadIdsPerDevice[i]);
         }
 
         for (auto &threadID : threadIdsPerDevice[i]) {
@@ -1093,9 +1115,117 @@ uint32_t DebugSessionImp::typeToRegsetFlags(uint32_t type) {
     }
 }
 
+size_t DebugSessionImp::calculateThreadSlotIndex(EuThread::ThreadId threadId) {
+    auto pStateSaveAreaHeader = getStateSaveAreaHeader();
+    return ((threadId.slice * pStateSaveAreaHeader->regHeader.num_subslices_per_slice + threadId.subslice) * pStateSaveAreaHeader->regHeader.num_eus_per_subslice + threadId.eu) * pStateSaveAreaHeader->regHeader.num_threads_per_eu + threadId.thread;
+}
+
 size_t DebugSessionImp::calculateThreadSlotOffset(EuThread::ThreadId threadId) {
     auto pStateSaveAreaHeader = getStateSaveAreaHeader();
-    return pStateSaveAreaHeader->versionHeader.size * 8 + pStateSaveAreaHeader->regHeader.state_area_offset + ((((threadId.slice * pStateSaveAreaHeader->regHeader.num_subslices_per_slice + threadId.subslice) * pStateSaveAreaHeader->regHeader.num_eus_per_subslice + threadId.eu) * pStateSaveAreaHeader->regHeader.num_threads_per_eu + threadId.thread) * pStateSaveAreaHeader->regHeader.state_save_size);
+    return pStateSaveAreaHeader->versionHeader.size * 8 + pStateSaveAreaHeader->regHeader.state_area_offset + calculateThreadSlotIndex(threadId) * pStateSaveAreaHeader->regHeader.state_save_size;
+}
+
+const void *DebugSessionImp::readThreadSlotsFromStateSaveArea(uint64_t memoryHandle, const std::vector<EuThread::ThreadId> &threadIds) {
+    auto stateSaveAreaHeader = getStateSaveAreaHeader();
+    auto gpuVa = getContextStateSaveAreaGpuVa(memoryHandle);
+    auto stateSaveAreaSize = getContextStateSaveAreaSize(memoryHandle);
+    if (stateSaveAreaHeader == nullptr || gpuVa == 0 || stateSaveAreaSize == 0) {
+        return nullptr;
+    }
+
+    auto &cacheEntry = stateSaveAreaCache[memoryHandle];
+    if (cacheEntry.gpuVa != gpuVa || cacheEntry.data.size() != stateSaveAreaSize) {
+        cacheEntry.gpuVa = gpuVa;
+        cacheEntry.data.assign(stateSaveAreaSize, 0);
+        cacheEntry.validThreadSlots.clear();
+    }
+
+    std::vector<size_t> slotsToRead;
+    for (const auto &threadId : threadIds) {
+        auto slot = calculateThreadSlotIndex(threadId);
+        if (slot >= cacheEntry.validThreadSlots.size()) {
+            cacheEntry.validThreadSlots.resize(slot + 1, false);
+        }
+        if (!cacheEntry.validThreadSlots[slot]) {
+            slotsToRead.push_back(slot);
+        }
+    }
+    if (slotsToRead.empty()) {
+        return cacheEntry.data.data();
+    }
+    std::sort(slotsToRead.begin(), slotsToRead.end());
+    slotsToRead.erase(std::unique(slotsToRead.begin(), slotsToRead.end()), slotsToRead.end());
+
+    // adjacent thread slots are read with single access to limit number of calls to KMD
+    const size_t slotsOffset = stateSaveAreaHeader->versionHeader.size * 8 + stateSaveAreaHeader->regHeader.state_area_offset;
+    const size_t slotSize = stateSaveAreaHeader->regHeader.state_save_size;
+    std::vector<std::pair<size_t, size_t>> ranges;
+    for (size_t i = 0; i < slotsToRead.size();) {
+        auto firstSlot = slotsToRead[i];
+        auto slotsCount = 1u;
+        while (i + slotsCount < slotsToRead.size() && slotsToRead[i + slotsCount] == firstSlot + slotsCount) {
+            slotsCount++;
+        }
+        auto offset = slotsOffset + firstSlot * slotSize;
+        auto size = slotsCount * slotSize;
+        if (offset + size > stateSaveAreaSize) {
+            PRINT_DEBUGGER_ERROR_LOG("Thread slot outside of context state save area\n", "");
+            DEBUG_BREAK_IF(true);
+            return nullptr;
+        }
+        ranges.emplace_back(offset, size);
+        i += slotsCount;
+    }
+
+    PRINT_DEBUGGER_INFO_LOG("Reading %zu thread slots in %zu ranges from state save area\n", slotsToRead.size(), ranges.size());
+    if (readStateSaveAreaRanges(memoryHandle, cacheEntry.data.data(), gpuVa, ranges) != ZE_RESULT_SUCCESS) {
+        return nullptr;
+    }
+
+    for (auto slot : slotsToRead) {
+        cacheEntry.validThreadSlots[slot] = true;
+    }
+    return cacheEntry.data.data();
+}
+
+ze_result_t DebugSessionImp::readStateSaveAreaRanges(uint64_t memoryHandle, char *stateSaveArea, uint64_t gpuVa, const std::vector<std::pair<size_t, size_t>> &ranges) {
+    size_t readersCount = defaultStateSaveAreaReadThreads;
+    if (NEO::debugManager.flags.DebuggerStateSaveAreaReadThreads.get() > 0) {
+        readersCount = static_cast<size_t>(NEO::debugManager.flags.DebuggerStateSaveAreaReadThreads.get());
+    }
+    readersCount = std::min(readersCount, ranges.size());
+
+    std::vector<ze_result_t> results(readersCount, ZE_RESULT_SUCCESS);
+    auto readRanges = [&](size_t reader) {
+        for (auto i = reader; i < ranges.size() && results[reader] == ZE_RESULT_SUCCESS; i += readersCount) {
+            auto &range = ranges[i];
+            results[reader] = readGpuMemory(memoryHandle, stateSaveArea + range.first, range.second, gpuVa + range.first);
+        }
+    };
+    connectedDevice->getNEODevice()->getExecutionEnvironment()->getThreadPool()->parallelFor(readersCount, readRanges);
+
+    for (auto result : results) {
+        if (result != ZE_RESULT_SUCCESS) {
+            return result;
+        }
+    }
+    return ZE_RESULT_SUCCESS;
+}
+
+void DebugSessionImp::invalidateStateSaveAreaCache(const std::vector<EuThread::ThreadId> &threadIds) {
+    std::lock_guard<std::mutex> cacheLock(stateSaveAreaCacheMutex);
+    if (stateSaveAreaCache.empty() || stateSaveAreaHeader.empty()) {
+        return;
+    }
+    for (auto &cacheEntry : stateSaveAreaCache) {
+        auto &validThreadSlots = cacheEntry.second.validThreadSlots;
+        for (const auto &threadId : threadIds) {
+            auto slot = calculateThreadSlotIndex(threadId);
+            if (slot < validThreadSlots.size()) {
+                validThreadSlots[slot] = false;
+            }
+        }
+    }
 }
 
 size_t DebugSessionImp::calculateRegisterOffsetInThreadSlot(const SIP::regset_desc *regdesc, uint32_t start) {
@@ -1314,6 +1444,37 @@ ze_result_t DebugSessionImp::registersAccessHelper(const EuThread *thread, const
     auto threadSlotOffset = calculateThreadSlotOffset(thread->getThreadId());
     auto startRegOffset = threadSlotOffset + calculateRegisterOffsetInThreadSlot(regdesc, start);
 
+    if (stateSaveAreaCacheEnabled && thread->isStopped()) {
+        std::lock_guard<std::mutex> cacheLock(stateSaveAreaCacheMutex);
+        // SIP command register is polled and its writes make SIP update thread slot, it always accesses memory directly
+        if (regdesc == &getStateSaveAreaHeader()->regHeader.cmd) {
+            if (write) {
+                auto cacheEntry = stateSaveAreaCache.find(thread->getMemoryHandle());
+                auto slot = calculateThreadSlotIndex(thread->getThreadId());
+                if (cacheEntry != stateSaveAreaCache.end() && slot < cacheEntry->second.validThreadSlots.size()) {
+                    cacheEntry->second.validThreadSlots[slot] = false;
+                }
+            }
+        } else if (write) {
+            if (writeGpuMemory(thread->getMemoryHandle(), static_cast<const char *>(pRegisterValues), count * regdesc->bytes, gpuVa + startRegOffset) != ZE_RESULT_SUCCESS) {
+                return ZE_RESULT_ERROR_UNKNOWN;
+            }
+            auto cacheEntry = stateSaveAreaCache.find(thread->getMemoryHandle());
+            auto slot = calculateThreadSlotIndex(thread->getThreadId());
+            if (cacheEntry != stateSaveAreaCache.end() && slot < cacheEntry->second.validThreadSlots.size() && cacheEntry->second.validThreadSlots[slot]) {
+                memcpy_s(cacheEntry->second.data.data() + startRegOffset, count * regdesc->bytes, pRegisterValues, count * regdesc->bytes);
+            }
+            return ZE_RESULT_SUCCESS;
+        } else {
+            auto stateSaveArea = readThreadSlotsFromStateSaveArea(thread->getMemoryHandle(), {thread->getThreadId()});
+            if (stateSaveArea == nullptr) {
+                return ZE_RESULT_ERROR_UNKNOWN;
+            }
+            memcpy_s(pRegisterValues, count * regdesc->bytes, ptrOffset(stateSaveArea, startRegOffset), count * regdesc->bytes);
+            return ZE_RESULT_SUCCESS;
+        }
+    }
+
     int ret = 0;
     if (write) {
         ret = writeGpuMemory(thread->getMemoryHandle(), static_cast<const char *>(pRegisterValues), count * regdesc->bytes, gpuVa + startRegOffset);
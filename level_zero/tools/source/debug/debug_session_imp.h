@@ -19,6 +19,7 @@
 #include <condition_variable>
 #include <mutex>
 #include <queue>
+#include <unordered_map>
 #include <unordered_set>
 
 namespace SIP {
@@ -40,6 +41,7 @@ struct DebugSessionImp : DebugSession {
 
     DebugSessionImp(const zet_debug_config_t &config, Device *device) : DebugSession(config, device) {
         tileAttachEnabled = NEO::debugManager.flags.ExperimentalEnableTileAttach.get();
+        stateSaveAreaCacheEnabled = NEO::debugManager.flags.DebuggerEnableStateSaveAreaCache.get() == 1;
     }
 
     ze_result_t interrupt(ze_device_thread_t thread) override;
@@ -124,6 +126,7 @@ struct DebugSessionImp : DebugSession {
     const SIP::regset_desc *typeToRegsetDesc(uint32_t type);
     uint32_t getRegisterSize(uint32_t type) override;
 
+    size_t calculateThreadSlotIndex(EuThread::ThreadId threadId);
     size_t calculateThreadSlotOffset(EuThread::ThreadId threadId);
     size_t calculateRegisterOffsetInThreadSlot(const SIP::regset_desc *const regdesc, uint32_t start);
 
@@ -149,6 +152,19 @@ struct DebugSessionImp : DebugSession {
         return timeDifferenceMs;
     }
 
+    struct StateSaveAreaCacheEntry {
+        uint64_t gpuVa = 0;
+        std::vector<char> data;
+        std::vector<bool> validThreadSlots;
+    };
+
+    // Returns state save area of VM with slots of given threads up to date, other slots may be stale.
+    // Must be called with stateSaveAreaCacheMutex held, returned memory is valid until it is released.
+    const void *readThreadSlotsFromStateSaveArea(uint64_t memoryHandle, const std::vector<EuThread::ThreadId> &threadIds);
+    MOCKABLE_VIRTUAL ze_result_t readStateSaveAreaRanges(uint64_t memoryHandle, char *stateSaveArea, uint64_t gpuVa, const std::vector<std::pair<size_t, size_t>> &ranges);
+    void invalidateStateSaveAreaCache(const std::vector<EuThread::ThreadId> &threadIds);
+    bool isStateSaveAreaCacheEnabled() const { return stateSaveAreaCacheEnabled; }
+
     void allocateStateSaveAreaMemory(size_t size) {
         if (stateSaveAreaMemory.size() < size) {
             stateSaveAreaMemory.resize(size);
@@ -171,6 +187,11 @@ struct DebugSessionImp : DebugSession {
     bool sipSupportsSlm = false;
     std::vector<char> stateSaveAreaMemory;
 
+    std::unordered_map<uint64_t, StateSaveAreaCacheEntry> stateSaveAreaCache;
+    std::mutex stateSaveAreaCacheMutex;
+    bool stateSaveAreaCacheEnabled = false;
+    constexpr static uint32_t defaultStateSaveAreaReadThreads = 4;
+
     std::vector<std::pair<DebugSessionImp *, bool>> tileSessions; // DebugSession, attached
     bool tileAttachEnabled = false;
     bool tileSessionsEnabled = false;
@@ -175,6 +175,14 @@ void DebugSessionLinux::checkStoppedThreadsAndGenerateEvents(const std::vector<E
     const auto &threadsToCheck = threadsWithAttention.size() > 0 ? threadsWithAttention : threads;
     stoppedThreadsToReport.reserve(threadsToCheck.size());
 
+    // sr idents of all checked threads are read with batched accesses to their slots
+    const void *stateSaveArea = nullptr;
+    std::unique_lock<std::mutex> cacheLock;
+    if (stateSaveAreaCacheEnabled) {
+        cacheLock = std::unique_lock<std::mutex>(stateSaveAreaCacheMutex);
+        stateSaveArea = readThreadSlotsFromStateSaveArea(memoryHandle, threadsToCheck);
+    }
+
     const auto regSize = std::max(getRegisterSize(ZET_DEBUG_REGSET_TYPE_CR_INTEL_GPU), 64u);
     auto cr0 = std::make_unique<uint32_t[]>(regSize / sizeof(uint32_t));
     auto regDesc = typeToRegsetDesc(ZET_DEBUG_REGSET_TYPE_CR_INTEL_GPU);
@@ -183,7 +191,9 @@ void DebugSessionLinux::checkStoppedThreadsAndGenerateEvents(const std::vector<E
         SIP::sr_ident srMagic = {{0}};
         srMagic.count = 0;
 
-        if (readSystemRoutineIdent(allThreads[threadId].get(), memoryHandle, srMagic)) {
+        auto srIdentRead = stateSaveArea ? readSystemRoutineIdentFromMemory(allThreads[threadId].get(), stateSaveArea, srMagic)
+                                         : readSystemRoutineIdent(allThreads[threadId].get(), memoryHandle, srMagic);
+        if (srIdentRead) {
             bool wasStopped = allThreads[threadId]->isStopped();
             bool checkIfStopped = true;
 
@@ -204,6 +214,13 @@ void DebugSessionLinux::checkStoppedThreadsAndGenerateEvents(const std::vector<E
         }
     }
 
+    if (cacheLock.owns_lock()) {
+        cacheLock.unlock();
+        // slots of threads which are not stopped may change
+        std::vector<EuThread::ThreadId> notStoppedThreads;
+        getNotStoppedThreads(threadsToCheck, notStoppedThreads);
+        invalidateStateSaveAreaCache(notStoppedThreads);
+    }
     generateEventsForStoppedThreads(stoppedThreadsToReport);
 }
 
@@ -626,8 +643,10 @@ void DebugSessionLinux::updateStoppedThreadsAndCheckTriggerEvents(AttentionEvent
         auto gpuVa = getContextStateSaveAreaGpuVa(vmHandle);
         auto stateSaveAreaSize = getContextStateSaveAreaSize(vmHandle);
         auto stateSaveReadResult = ZE_RESULT_ERROR_UNKNOWN;
+        const void *stateSaveArea = stateSaveAreaMemory.data();
 
         std::unique_lock<std::mutex> lock;
+        std::unique_lock<std::mutex> cacheLock;
 
         if (tileSessionsEnabled) {
             lock = getThreadStateMutexForTileSession(tileIndex);
@@ -640,8 +659,14 @@ void DebugSessionLinux::updateStoppedThreadsAndCheckTriggerEvents(AttentionEvent
             std::vector<EuThread::ThreadId> newThreads;
             getNotStoppedThreads(threadsWithAttention, newThreads);
 
-            if (newThreads.size() > 0) {
+            if (newThreads.size() > 0 && stateSaveAreaCacheEnabled && !tileSessionsEnabled) {
+                // only slots of threads which were not stopped before are read
+                cacheLock = std::unique_lock<std::mutex>(stateSaveAreaCacheMutex);
+                stateSaveArea = readThreadSlotsFromStateSaveArea(vmHandle, newThreads);
+                stateSaveReadResult = stateSaveArea ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_UNKNOWN;
+            } else if (newThreads.size() > 0) {
                 allocateStateSaveAreaMemory(stateSaveAreaSize);
+                stateSaveArea = stateSaveAreaMemory.data();
                 stateSaveReadResult = readGpuMemory(vmHandle, stateSaveAreaMemory.data(), stateSaveAreaSize, gpuVa);
             }
         } else {
@@ -655,12 +680,20 @@ void DebugSessionLinux::updateStoppedThreadsAndCheckTriggerEvents(AttentionEvent
                 updateContextAndLrcHandlesForThreadsWithAttention(threadId, attention);
 
                 if (tileSessionsEnabled) {
-                    addThreadToNewlyStoppedFromRaisedAttentionForTileSession(threadId, vmHandle, stateSaveAreaMemory.data(), tileIndex);
+                    addThreadToNewlyStoppedFromRaisedAttentionForTileSession(threadId, vmHandle, stateSaveArea, tileIndex);
                 } else {
-                    addThreadToNewlyStoppedFromRaisedAttention(threadId, vmHandle, stateSaveAreaMemory.data());
+                    addThreadToNewlyStoppedFromRaisedAttention(threadId, vmHandle, stateSaveArea);
                 }
             }
         }
+
+        if (cacheLock.owns_lock()) {
+            cacheLock.unlock();
+            // slots of threads which are not stopped may change
+            std::vector<EuThread::ThreadId> notStoppedThreads;
+            getNotStoppedThreads(threadsWithAttention, notStoppedThreads);
+            invalidateStateSaveAreaCache(notStoppedThreads);
+        }
     }
     if (tileSessionsEnabled) {
         checkTriggerEventsForAttentionForTileSession(tileIndex);
@@ -1132,15 +1132,29 @@ void DebugSessionLinuxi915::handlePageFaultEvent(prelim_drm_i915_debug_event_pag
 
     auto gpuVa = getContextStateSaveAreaGpuVa(vmHandle);
     auto stateSaveAreaSize = getContextStateSaveAreaSize(vmHandle);
-    allocateStateSaveAreaMemory(stateSaveAreaSize);
-    auto stateSaveReadResult = readGpuMemory(vmHandle, stateSaveAreaMemory.data(), stateSaveAreaSize, gpuVa);
+    const void *stateSaveArea = nullptr;
+    auto stateSaveReadResult = ZE_RESULT_ERROR_UNKNOWN;
+    std::unique_lock<std::mutex> lock;
+    std::unique_lock<std::mutex> cacheLock;
+    if (stateSaveAreaCacheEnabled && !tileSessionsEnabled) {
+        // thread state is locked before state save area cache
+        lock = std::unique_lock<std::mutex>(threadStateMutex);
+        cacheLock = std::unique_lock<std::mutex>(stateSaveAreaCacheMutex);
+        stateSaveArea = readThreadSlotsFromStateSaveArea(vmHandle, stoppedThreads);
+        stateSaveReadResult = stateSaveArea ? ZE_RESULT_SUCCESS : ZE_RESULT_ERROR_UNKNOWN;
+    } else {
+        allocateStateSaveAreaMemory(stateSaveAreaSize);
+        stateSaveArea = stateSaveAreaMemory.data();
+        stateSaveReadResult = readGpuMemory(vmHandle, stateSaveAreaMemory.data(), stateSaveAreaSize, gpuVa);
+    }
     if (stateSaveReadResult == ZE_RESULT_SUCCESS) {
 
-        std::unique_lock<std::mutex> lock;
-        if (tileSessionsEnabled) {
-            lock = std::unique_lock<std::mutex>(static_cast<TileDebugSessionLinuxi915 *>(tileSessions[tileIndex].first)->threadStateMutex);
-        } else {
-            lock = std::unique_lock<std::mutex>(threadStateMutex);
+        if (!lock.owns_lock()) {
+            if (tileSessionsEnabled) {
+                lock = std::unique_lock<std::mutex>(static_cast<TileDebugSessionLinuxi915 *>(tileSessions[tileIndex].first)->threadStateMutex);
+            } else {
+                lock = std::unique_lock<std::mutex>(threadStateMutex);
+            }
         }
         for (auto &threadId : threadsWithPF) {
             PRINT_DEBUGGER_INFO_LOG("PageFault event for thread %s", EuThread::toString(threadId).c_str());
@@ -1152,12 +1166,21 @@ void DebugSessionLinuxi915::handlePageFaultEvent(prelim_drm_i915_debug_event_pag
         }
         for (auto &threadId : stoppedThreads) {
             if (tileSessionsEnabled) {
-                static_cast<TileDebugSessionLinuxi915 *>(tileSessions[tileIndex].first)->addThreadToNewlyStoppedFromRaisedAttention(threadId, vmHandle, stateSaveAreaMemory.data());
+                static_cast<TileDebugSessionLinuxi915 *>(tileSessions[tileIndex].first)->addThreadToNewlyStoppedFromRaisedAttention(threadId, vmHandle, stateSaveArea);
             } else {
-                addThreadToNewlyStoppedFromRaisedAttention(threadId, vmHandle, stateSaveAreaMemory.data());
+                addThreadToNewlyStoppedFromRaisedAttention(threadId, vmHandle, stateSaveArea);
             }
         }
     }
+    if (cacheLock.owns_lock()) {
+        cacheLock.unlock();
+        std::vector<EuThread::ThreadId> notStoppedThreads;
+        getNotStoppedThreads(stoppedThreads, notStoppedThreads);
+        invalidateStateSaveAreaCache(notStoppedThreads);
+    }
+    if (lock.owns_lock()) {
+        lock.unlock();
+    }
 
     if (tileSessionsEnabled) {
         static_cast<TileDebugSessionLinuxi915 *>(tileSessions[tileIndex].first)->checkTriggerEventsForAttention();
@@ -1135,6 +1135,122 @@ TEST(DebugSessionTest, givenMultipleStoppedThreadsWhenResumeAllCalledThenStateSa
     }
 }
 
+struct StateSaveAreaReadsCountingDebugSession : public MockDebugSession {
+    using MockDebugSession::MockDebugSession;
+
+    ze_result_t readGpuMemory(uint64_t memoryHandle, char *output, size_t size, uint64_t gpuVa) override {
+        {
+            std::lock_guard<std::mutex> lock(readSizesMutex);
+            readSizes.push_back(size);
+        }
+        return MockDebugSession::readGpuMemory(memoryHandle, output, size, gpuVa);
+    }
+
+    std::mutex readSizesMutex;
+    std::vector<size_t> readSizes;
+};
+
+TEST(DebugSessionTest, givenStateSaveAreaCacheEnabledWhenResumeAllCalledThenOnlySlotsOfResumedThreadsAreReadAndInvalidated) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.DebuggerEnableStateSaveAreaCache.set(1);
+
+    zet_debug_config_t config = {};
+    config.pid = 0x1234;
+    auto hwInfo = *NEO::defaultHwInfo.get();
+    hwInfo.gtSystemInfo.EUCount = 8;
+    hwInfo.gtSystemInfo.ThreadCount = 8 * hwInfo.gtSystemInfo.EUCount;
+
+    NEO::MockDevice *neoDevice(NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo, 0));
+    MockDeviceImp deviceImp(neoDevice, neoDevice->getExecutionEnvironment());
+
+    auto sessionMock = std::make_unique<StateSaveAreaReadsCountingDebugSession>(config, &deviceImp);
+    ASSERT_TRUE(sessionMock->stateSaveAreaCacheEnabled);
+    auto pStateSaveAreaHeader = reinterpret_cast<SIP::StateSaveAreaHeader *>(sessionMock->stateSaveAreaHeader.data());
+    auto size = pStateSaveAreaHeader->versionHeader.size * 8 +
+                pStateSaveAreaHeader->regHeader.state_area_offset +
+                pStateSaveAreaHeader->regHeader.state_save_size * 16;
+    sessionMock->stateSaveAreaHeader.resize(size);
+    pStateSaveAreaHeader = reinterpret_cast<SIP::StateSaveAreaHeader *>(sessionMock->stateSaveAreaHeader.data());
+
+    auto threadCount = hwInfo.gtSystemInfo.ThreadCount / hwInfo.gtSystemInfo.EUCount;
+    for (uint32_t i = 0; i < threadCount; i++) {
+        EuThread::ThreadId thread(0, 0, 0, 0, i);
+        sessionMock->allThreads[thread]->stopThread(1u);
+        sessionMock->allThreads[thread]->reportAsStopped();
+    }
+
+    ze_device_thread_t threadAll = {UINT32_MAX, UINT32_MAX, UINT32_MAX, UINT32_MAX};
+    auto result = sessionMock->resume(threadAll);
+
+    EXPECT_EQ(ZE_RESULT_SUCCESS, result);
+    EXPECT_EQ(threadCount, sessionMock->checkThreadIsResumedFromPassedSaveAreaCalled);
+
+    // slots of threads from EU0 are adjacent and read with single access instead of whole state save area
+    ASSERT_EQ(1u, sessionMock->readSizes.size());
+    EXPECT_EQ(threadCount * pStateSaveAreaHeader->regHeader.state_save_size, sessionMock->readSizes[0]);
+
+    auto &validThreadSlots = sessionMock->stateSaveAreaCache[1u].validThreadSlots;
+    for (uint32_t i = 0; i < threadCount; i++) {
+        EuThread::ThreadId thread(0, 0, 0, 0, i);
+        EXPECT_TRUE(sessionMock->allThreads[thread]->isRunning());
+        EXPECT_FALSE(validThreadSlots[i]);
+    }
+}
+
+TEST(DebugSessionTest, givenStateSaveAreaCacheWhenReadingThreadSlotsThenOnlyMissingSlotsAreReadInMergedRangesInParallel) {
+    DebugManagerStateRestore restorer;
+    NEO::debugManager.flags.DebuggerStateSaveAreaReadThreads.set(2);
+
+    zet_debug_config_t config = {};
+    config.pid = 0x1234;
+    auto hwInfo = *NEO::defaultHwInfo.get();
+
+    NEO::MockDevice *neoDevice(NEO::MockDevice::createWithNewExecutionEnvironment<NEO::MockDevice>(&hwInfo, 0));
+    MockDeviceImp deviceImp(neoDevice, neoDevice->getExecutionEnvironment());
+
+    auto sessionMock = std::make_unique<StateSaveAreaReadsCountingDebugSession>(config, &deviceImp);
+    auto pStateSaveAreaHeader = reinterpret_cast<SIP::StateSaveAreaHeader *>(sessionMock->stateSaveAreaHeader.data());
+    auto size = pStateSaveAreaHeader->versionHeader.size * 8 +
+                pStateSaveAreaHeader->regHeader.state_area_offset +
+                pStateSaveAreaHeader->regHeader.state_save_size * 16;
+    sessionMock->stateSaveAreaHeader.resize(size);
+    pStateSaveAreaHeader = reinterpret_cast<SIP::StateSaveAreaHeader *>(sessionMock->stateSaveAreaHeader.data());
+    const size_t slotSize = pStateSaveAreaHeader->regHeader.state_save_size;
+
+    EuThread::ThreadId thread0(0, 0, 0, 0, 0);
+    EuThread::ThreadId thread1(0, 0, 0, 0, 1);
+    EuThread::ThreadId thread5(0, 0, 0, 0, 5);
+    auto srMagicOffset = sessionMock->calculateThreadSlotOffset(thread5) + pStateSaveAreaHeader->regHeader.sr_magic_offset;
+    SIP::sr_ident srMagic = {{0}};
+    strcpy_s(srMagic.magic, sizeof(srMagic.magic), "srmagic");
+    srMagic.count = 3;
+    sessionMock->writeGpuMemory(0, reinterpret_cast<char *>(&srMagic), sizeof(srMagic), reinterpret_cast<uint64_t>(sessionMock->stateSaveAreaHeader.data()) + srMagicOffset);
+
+    std::lock_guard<std::mutex> cacheLock(sessionMock->stateSaveAreaCacheMutex);
+    auto stateSaveArea = sessionMock->readThreadSlotsFromStateSaveArea(1u, {thread5, thread0, thread1});
+    ASSERT_NE(nullptr, stateSaveArea);
+    std::sort(sessionMock->readSizes.begin(), sessionMock->readSizes.end());
+    EXPECT_EQ((std::vector<size_t>{slotSize, 2 * slotSize}), sessionMock->readSizes);
+
+    SIP::sr_ident cachedSrMagic = {{0}};
+    memcpy_s(&cachedSrMagic, sizeof(cachedSrMagic), ptrOffset(stateSaveArea, srMagicOffset), sizeof(cachedSrMagic));
+    EXPECT_STREQ("srmagic", cachedSrMagic.magic);
+    EXPECT_EQ(3u, cachedSrMagic.count);
+
+    sessionMock->readSizes.clear();
+    EXPECT_EQ(stateSaveArea, sessionMock->readThreadSlotsFromStateSaveArea(1u, {thread0, thread5}));
+    EXPECT_TRUE(sessionMock->readSizes.empty());
+
+    sessionMock->stateSaveAreaCache[1u].validThreadSlots[5] = false;
+    EXPECT_EQ(stateSaveArea, sessionMock->readThreadSlotsFromStateSaveArea(1u, {thread0, thread5}));
+    EXPECT_EQ(std::vector<size_t>{slotSize}, sessionMock->readSizes);
+
+    sessionMock->readMemoryResult = ZE_RESULT_ERROR_UNKNOWN;
+    sessionMock->stateSaveAreaCache[1u].validThreadSlots[5] = false;
+    EXPECT_EQ(nullptr, sessionMock->readThreadSlotsFromStateSaveArea(1u, {thread5}));
+    EXPECT_FALSE(sessionMock->stateSaveAreaCache[1u].validThreadSlots[5]);
+}
+
 TEST(DebugSessionTest, givenMultipleStoppedThreadsAndInvalidStateSaveAreaWhenResumeAllCalledThenThreadsAreSwitchedToResumed) {
     zet_debug_config_t config = {};
     config.pid = 0x1234;
@@ -2591,6 +2707,46 @@ TEST_F(DebugSessionRegistersAccessTest, givenReadGpuMemoryErrorWhenRegistersAcce
     EXPECT_EQ(ZE_RESULT_ERROR_UNKNOWN, ret);
 }
 
+TEST_F(DebugSessionRegistersAccessTest, givenStateSaveAreaCacheEnabledWhenAccessingRegistersOfStoppedThreadThenCachedSlotIsUsedUntilInvalidated) {
+    {
+        auto pStateSaveAreaHeader = reinterpret_cast<SIP::StateSaveAreaHeader *>(session->stateSaveAreaHeader.data());
+        auto size = pStateSaveAreaHeader->versionHeader.size * 8 +
+                    pStateSaveAreaHeader->regHeader.state_area_offset +
+                    pStateSaveAreaHeader->regHeader.state_save_size * 16;
+        session->stateSaveAreaHeader.resize(size);
+    }
+    session->stateSaveAreaCacheEnabled = true;
+
+    auto pStateSaveAreaHeader = reinterpret_cast<SIP::StateSaveAreaHeader *>(session->stateSaveAreaHeader.data());
+    auto *regdesc = &pStateSaveAreaHeader->regHeader.grf;
+    auto r0Address = reinterpret_cast<uint64_t>(session->stateSaveAreaHeader.data()) + session->calculateThreadSlotOffset(stoppedThreadId) + regdesc->offset;
+    auto thread = session->allThreads[stoppedThreadId].get();
+
+    std::vector<uint8_t> r0(regdesc->bytes, 0xab);
+    session->writeGpuMemory(0, reinterpret_cast<char *>(r0.data()), r0.size(), r0Address);
+
+    std::vector<uint8_t> readR0(regdesc->bytes, 0);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->registersAccessHelper(thread, regdesc, 0, 1, readR0.data(), false));
+    EXPECT_EQ(r0, readR0);
+
+    // memory changed behind the cache is not visible until slot is invalidated
+    std::vector<uint8_t> memoryR0(regdesc->bytes, 0xcd);
+    session->writeGpuMemory(0, reinterpret_cast<char *>(memoryR0.data()), memoryR0.size(), r0Address);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->registersAccessHelper(thread, regdesc, 0, 1, readR0.data(), false));
+    EXPECT_EQ(r0, readR0);
+
+    std::vector<uint8_t> writtenR0(regdesc->bytes, 0x11);
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->registersAccessHelper(thread, regdesc, 0, 1, writtenR0.data(), true));
+    EXPECT_EQ(0, memcmp(writtenR0.data(), reinterpret_cast<void *>(r0Address), writtenR0.size()));
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->registersAccessHelper(thread, regdesc, 0, 1, readR0.data(), false));
+    EXPECT_EQ(writtenR0, readR0);
+
+    session->writeGpuMemory(0, reinterpret_cast<char *>(memoryR0.data()), memoryR0.size(), r0Address);
+    session->invalidateStateSaveAreaCache({stoppedThreadId});
+    EXPECT_EQ(ZE_RESULT_SUCCESS, session->registersAccessHelper(thread, regdesc, 0, 1, readR0.data(), false));
+    EXPECT_EQ(memoryR0, readR0);
+}
+
 TEST_F(DebugSessionRegistersAccessTest, givenNoStateSaveAreaWhenReadRegisterCalledThenErrorUnknownReturned) {
     session->stateSaveAreaHeader.clear();
 
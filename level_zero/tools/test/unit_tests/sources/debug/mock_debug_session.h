@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Intel Corporation
+ * Copyright (C) 2021-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -158,13 +158,18 @@ struct MockDebugSession : public L0::DebugSessionImp {
     using L0::DebugSessionImp::generateEventsAndResumeStoppedThreads;
     using L0::DebugSessionImp::generateEventsForPendingInterrupts;
     using L0::DebugSessionImp::generateEventsForStoppedThreads;
+    using L0::DebugSessionImp::invalidateStateSaveAreaCache;
     using L0::DebugSessionImp::getRegisterSize;
     using L0::DebugSessionImp::getStateSaveAreaHeader;
     using L0::DebugSessionImp::newAttentionRaised;
     using L0::DebugSessionImp::readSbaRegisters;
+    using L0::DebugSessionImp::readThreadSlotsFromStateSaveArea;
     using L0::DebugSessionImp::registersAccessHelper;
     using L0::DebugSessionImp::resumeAccidentallyStoppedThreads;
     using L0::DebugSessionImp::sendInterrupts;
+    using L0::DebugSessionImp::stateSaveAreaCache;
+    using L0::DebugSessionImp::stateSaveAreaCacheEnabled;
+    using L0::DebugSessionImp::stateSaveAreaCacheMutex;
     using L0::DebugSessionImp::stateSaveAreaMemory;
     using L0::DebugSessionImp::typeToRegsetDesc;
     using L0::DebugSessionImp::validateAndSetStateSaveAreaHeader;
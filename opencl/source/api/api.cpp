@@ -3903,7 +3903,9 @@ CL_API_ENTRY void *CL_API_CALL clHostMemAllocINTEL(
         return nullptr;
     }
 
-    auto allocationFromPool = neoContext->getHostMemAllocPool().createUnifiedMemoryAllocation(size, unifiedMemoryProperties);
+    auto poolsManager = neoContext->getHostMemAllocPoolsManager();
+    auto allocationFromPool = poolsManager ? poolsManager->createUnifiedMemoryAllocation(size, unifiedMemoryProperties)
+                                           : neoContext->getHostMemAllocPool().createUnifiedMemoryAllocation(size, unifiedMemoryProperties);
     if (allocationFromPool) {
         return allocationFromPool;
     }
@@ -3957,7 +3959,9 @@ CL_API_ENTRY void *CL_API_CALL clDeviceMemAllocINTEL(
 
     unifiedMemoryProperties.device = &neoDevice->getDevice();
 
-    auto allocationFromPool = neoContext->getDeviceMemAllocPool().createUnifiedMemoryAllocation(size, unifiedMemoryProperties);
+    auto poolsManager = neoContext->getDeviceMemAllocPoolsManager();
+    auto allocationFromPool = poolsManager ? poolsManager->createUnifiedMemoryAllocation(size, unifiedMemoryProperties)
+                                           : neoContext->getDeviceMemAllocPool().createUnifiedMemoryAllocation(size, unifiedMemoryProperties);
     if (allocationFromPool) {
         return allocationFromPool;
     }
@@ -4043,6 +4047,12 @@ CL_API_ENTRY cl_int CL_API_CALL clMemFreeCommon(cl_context context,
         return CL_SUCCESS;
     }
 
+    for (auto poolsManager : {neoContext->getDeviceMemAllocPoolsManager(), neoContext->getHostMemAllocPoolsManager()}) {
+        if (ptr && poolsManager && poolsManager->freeSVMAlloc(const_cast<void *>(ptr), blocking)) {
+            return CL_SUCCESS;
+        }
+    }
+
     if (ptr && !neoContext->getSVMAllocsManager()->freeSVMAlloc(const_cast<void *>(ptr), blocking)) {
         return CL_INVALID_VALUE;
     }
@@ -4116,6 +4126,11 @@ CL_API_ENTRY cl_int CL_API_CALL clGetMemAllocInfoINTEL(
         if (auto basePtrFromHostPool = pContext->getHostMemAllocPool().getPooledAllocationBasePtr(ptr)) {
             return changeGetInfoStatusToCLResultType(info.set<uint64_t>(castToUint64(basePtrFromHostPool)));
         }
+        for (auto poolsManager : {pContext->getDeviceMemAllocPoolsManager(), pContext->getHostMemAllocPoolsManager()}) {
+            if (auto basePtrFromPoolsManager = poolsManager ? poolsManager->getPooledAllocationBasePtr(ptr) : nullptr) {
+                return changeGetInfoStatusToCLResultType(info.set<uint64_t>(castToUint64(basePtrFromPoolsManager)));
+            }
+        }
         return changeGetInfoStatusToCLResultType(info.set<uint64_t>(unifiedMemoryAllocation->gpuAllocations.getDefaultGraphicsAllocation()->getGpuAddress()));
     }
     case CL_MEM_ALLOC_SIZE_INTEL: {
@@ -4128,6 +4143,11 @@ CL_API_ENTRY cl_int CL_API_CALL clGetMemAllocInfoINTEL(
         if (auto sizeFromHostPool = pContext->getHostMemAllocPool().getPooledAllocationSize(ptr)) {
             return changeGetInfoStatusToCLResultType(info.set<size_t>(sizeFromHostPool));
         }
+        for (auto poolsManager : {pContext->getDeviceMemAllocPoolsManager(), pContext->getHostMemAllocPoolsManager()}) {
+            if (auto sizeFromPoolsManager = poolsManager ? poolsManager->getPooledAllocationSize(ptr) : 0u) {
+                return changeGetInfoStatusToCLResultType(info.set<size_t>(sizeFromPoolsManager));
+            }
+        }
         return changeGetInfoStatusToCLResultType(info.set<size_t>(unifiedMemoryAllocation->size));
     }
     case CL_MEM_ALLOC_FLAGS_INTEL: {
@@ -26,6 +26,7 @@
 #include "shared/source/helpers/string.h"
 #include "shared/source/helpers/timestamp_packet.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
+#include "shared/source/memory_manager/memory_pool.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/source/utilities/api_intercept.h"
@@ -1036,6 +1037,21 @@ bool CommandQueue::bufferCpuCopyAllowed(Buffer *buffer, cl_command_type commandT
     return false;
 }
 
+bool CommandQueue::imageCpuCopyAllowed(Image *image, cl_command_type commandType, cl_bool blocking, GraphicsAllocation *mapAllocation,
+                                       cl_uint numEventsInWaitList, const cl_event *eventWaitList) {
+    // CPU copy stalls the pipeline, so it is used only when caller waits for completion anyway and there are no dependencies
+    if (blocking == CL_FALSE || numEventsInWaitList > 0) {
+        return false;
+    }
+
+    // host memory must be CPU accessible, e.g. it can't be device USM
+    if (mapAllocation && !MemoryPoolHelper::isSystemMemoryPool(mapAllocation->getMemoryPool())) {
+        return false;
+    }
+
+    return image->isTiledCopyOnCpuAllowed(device->getRootDeviceIndex());
+}
+
 bool CommandQueue::queueDependenciesClearRequired() const {
     return isOOQEnabled() || debugManager.flags.OmitTimestampPacketDependencies.get();
 }
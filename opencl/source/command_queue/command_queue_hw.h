@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -457,6 +457,9 @@ class CommandQueueHw : public CommandQueue {
     cl_int enqueueReadWriteBufferOnCpuWithoutMemoryTransfer(cl_command_type commandType, Buffer *buffer,
                                                             size_t offset, size_t size, void *ptr, cl_uint numEventsInWaitList,
                                                             const cl_event *eventWaitList, cl_event *event);
+    cl_int enqueueReadWriteImageOnCpu(cl_command_type commandType, Image *image, const size_t *origin, const size_t *region,
+                                      size_t hostRowPitch, size_t hostSlicePitch, void *ptr, cl_uint numEventsInWaitList,
+                                      const cl_event *eventWaitList, cl_event *event);
     cl_int enqueueMarkerForReadWriteOperation(MemObj *memObj, void *ptr, cl_command_type commandType, cl_bool blocking, cl_uint numEventsInWaitList,
                                               const cl_event *eventWaitList, cl_event *event);
 
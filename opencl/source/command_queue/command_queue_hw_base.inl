@@ -85,6 +85,21 @@ cl_int CommandQueueHw<Family>::enqueueReadWriteBufferOnCpuWithoutMemoryTransfer(
     return retVal;
 }
 
+template <typename Family>
+cl_int CommandQueueHw<Family>::enqueueReadWriteImageOnCpu(cl_command_type commandType, Image *image, const size_t *origin, const size_t *region,
+                                                         size_t hostRowPitch, size_t hostSlicePitch, void *ptr, cl_uint numEventsInWaitList,
+                                                         const cl_event *eventWaitList, cl_event *event) {
+    cl_int retVal = CL_SUCCESS;
+    EventsRequest eventsRequest(numEventsInWaitList, eventWaitList, event);
+
+    TransferProperties transferProperties(image, commandType, 0, true, const_cast<size_t *>(origin), const_cast<size_t *>(region), ptr, true, getDevice().getRootDeviceIndex());
+    auto elementSize = image->getSurfaceFormatInfo().surfaceFormat.imageElementSizeInBytes;
+    transferProperties.hostRowPitch = hostRowPitch ? hostRowPitch : region[0] * elementSize;
+    transferProperties.hostSlicePitch = hostSlicePitch ? hostSlicePitch : transferProperties.hostRowPitch * region[1];
+    cpuDataTransferHandler(transferProperties, eventsRequest, retVal);
+    return retVal;
+}
+
 template <typename Family>
 cl_int CommandQueueHw<Family>::enqueueMarkerForReadWriteOperation(MemObj *memObj, void *ptr, cl_command_type commandType, cl_bool blocking, cl_uint numEventsInWaitList,
                                                                   const cl_event *eventWaitList, cl_event *event) {
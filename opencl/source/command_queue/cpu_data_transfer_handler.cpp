@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -160,6 +160,15 @@ void *CommandQueue::cpuDataTransferHandler(TransferProperties &transferPropertie
             eventCompleted = true;
             modifySimulationFlags = true;
             break;
+        case CL_COMMAND_READ_IMAGE:
+            castToObjectOrAbort<Image>(transferProperties.memObj)->copyOnCpuWithTiling(transferProperties.ptr, transferProperties.hostRowPitch, transferProperties.hostSlicePitch, transferProperties.offset, transferProperties.size, false, getDevice().getRootDeviceIndex());
+            eventCompleted = true;
+            break;
+        case CL_COMMAND_WRITE_IMAGE:
+            castToObjectOrAbort<Image>(transferProperties.memObj)->copyOnCpuWithTiling(transferProperties.ptr, transferProperties.hostRowPitch, transferProperties.hostSlicePitch, transferProperties.offset, transferProperties.size, true, getDevice().getRootDeviceIndex());
+            eventCompleted = true;
+            modifySimulationFlags = true;
+            break;
         case CL_COMMAND_MARKER:
             break;
         default:
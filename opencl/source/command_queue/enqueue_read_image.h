@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -55,6 +55,11 @@ cl_int CommandQueueHw<GfxFamily>::enqueueReadImage(
                                                   numEventsInWaitList, eventWaitList, event);
     }
 
+    if (imageCpuCopyAllowed(srcImage, cmdType, blockingRead, mapAllocation, numEventsInWaitList, eventWaitList)) {
+        return enqueueReadWriteImageOnCpu(cmdType, srcImage, origin, region, inputRowPitch, inputSlicePitch, ptr,
+                                          numEventsInWaitList, eventWaitList, event);
+    }
+
     size_t hostPtrSize = calculateHostPtrSizeForImage(region, inputRowPitch, inputSlicePitch, srcImage);
     void *dstPtr = ptr;
 
@@ -495,6 +495,12 @@ void Context::initializeUsmAllocationPools() {
     if (!(svmMemoryManager && this->isSingleDeviceContext())) {
         return;
     }
+    if (debugManager.flags.EnableUsmAllocationPoolsManager.get() == 1) {
+        usmDeviceMemAllocPoolsManager = std::make_unique<UsmMemAllocPoolsManager>(svmMemoryManager, InternalMemoryType::deviceUnifiedMemory);
+        usmHostMemAllocPoolsManager = std::make_unique<UsmMemAllocPoolsManager>(svmMemoryManager, InternalMemoryType::hostUnifiedMemory);
+        return;
+    }
+
     auto &productHelper = getDevices()[0]->getProductHelper();
     bool enabled = productHelper.isUsmPoolAllocatorSupported();
     size_t poolSize = 2 * MemoryConstants::megaByte;
@@ -531,6 +537,8 @@ void Context::initializeUsmAllocationPools() {
 void Context::cleanupUsmAllocationPools() {
     usmDeviceMemAllocPool.cleanup();
     usmHostMemAllocPool.cleanup();
+    usmDeviceMemAllocPoolsManager.reset();
+    usmHostMemAllocPoolsManager.reset();
 }
 
 bool Context::BufferPoolAllocator::isAggregatedSmallBuffersEnabled(Context *context) const {
@@ -246,6 +246,12 @@ class Context : public BaseObject<_cl_context> {
     UsmMemAllocPool &getHostMemAllocPool() {
         return usmHostMemAllocPool;
     }
+    UsmMemAllocPoolsManager *getDeviceMemAllocPoolsManager() {
+        return usmDeviceMemAllocPoolsManager.get();
+    }
+    UsmMemAllocPoolsManager *getHostMemAllocPoolsManager() {
+        return usmHostMemAllocPoolsManager.get();
+    }
 
     TagAllocatorBase *getMultiRootDeviceTimestampPacketAllocator();
     std::unique_lock<std::mutex> obtainOwnershipForMultiRootDeviceAllocator();
@@ -293,6 +299,8 @@ class Context : public BaseObject<_cl_context> {
     BufferPoolAllocator smallBufferPoolAllocator;
     UsmDeviceMemAllocPool usmDeviceMemAllocPool;
     UsmHostMemAllocPool usmHostMemAllocPool;
+    std::unique_ptr<UsmMemAllocPoolsManager> usmDeviceMemAllocPoolsManager;
+    std::unique_ptr<UsmMemAllocPoolsManager> usmHostMemAllocPoolsManager;
 
     uint32_t maxRootDeviceIndex = std::numeric_limits<uint32_t>::max();
     cl_bool preferD3dSharedResources = 0u;
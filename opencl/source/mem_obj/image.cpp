@@ -21,6 +21,7 @@
 #include "shared/source/helpers/gfx_core_helper.h"
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/tiled_image_copy.h"
 #include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/memory_manager/migration_sync_data.h"
@@ -952,6 +953,56 @@ void Image::transferDataFromHostPtr(MemObjSizeArray &copySize, MemObjOffsetArray
                  copySize, copyOffset);
 }
 
+bool Image::isTiledCopyOnCpuAllowed(uint32_t rootDeviceIndex) {
+    if (debugManager.flags.EnableCpuTiledImageCopy.get() != 1) {
+        return false;
+    }
+    if (imageDesc.image_type != CL_MEM_OBJECT_IMAGE2D && imageDesc.image_type != CL_MEM_OBJECT_IMAGE2D_ARRAY && imageDesc.image_type != CL_MEM_OBJECT_IMAGE3D) {
+        return false;
+    }
+    if (isMipMapped(imageDesc) || imageDesc.num_samples > 1 || associatedMemObject != nullptr || isNV12Image(&imageFormat) || !allowCpuAccess() || memoryManager == nullptr) {
+        return false;
+    }
+    if (imageDesc.image_row_pitch == 0u || imageDesc.image_slice_pitch % imageDesc.image_row_pitch != 0u) {
+        return false;
+    }
+    auto graphicsAllocation = multiGraphicsAllocation.getGraphicsAllocation(rootDeviceIndex);
+    auto tilingMode = TiledImageCopy::getTilingModeForCpuAccess(*graphicsAllocation);
+    if (!TiledImageCopy::isTilingModeSupported(tilingMode) || imageDesc.image_row_pitch % TiledImageCopy::getTileWidthInBytes(tilingMode) != 0u) {
+        return false;
+    }
+    return TiledImageCopy::getCpuPtrForImageAccess(*graphicsAllocation, *memoryManager) != nullptr;
+}
+
+void Image::copyOnCpuWithTiling(void *hostPtr, size_t hostRowPitch, size_t hostSlicePitch, const MemObjOffsetArray &origin, const MemObjSizeArray &region,
+                                bool toImage, uint32_t rootDeviceIndex) {
+    auto graphicsAllocation = multiGraphicsAllocation.getGraphicsAllocation(rootDeviceIndex);
+    auto elementSize = surfaceFormatInfo.surfaceFormat.imageElementSizeInBytes;
+
+    TiledImageCopyParams params;
+    params.tiledPtr = TiledImageCopy::getCpuPtrForImageAccess(*graphicsAllocation, *memoryManager);
+    params.linearPtr = hostPtr;
+    params.tiledRowPitch = imageDesc.image_row_pitch;
+    params.tiledQPitch = imageDesc.image_slice_pitch / imageDesc.image_row_pitch;
+    params.linearRowPitch = hostRowPitch;
+    params.linearSlicePitch = hostSlicePitch;
+    params.tiledOrigin[0] = origin[0] * elementSize;
+    params.tiledOrigin[1] = origin[1];
+    params.tiledOrigin[2] = origin[2];
+    params.region[0] = region[0] * elementSize;
+    params.region[1] = region[1];
+    params.region[2] = region[2];
+    params.tilingMode = TiledImageCopy::getTilingModeForCpuAccess(*graphicsAllocation);
+
+    auto threadsCount = TiledImageCopy::getThreadsCountForCopy(params);
+    auto threadPool = (threadsCount > 1u) ? executionEnvironment->getThreadPool() : nullptr;
+    if (toImage) {
+        TiledImageCopy::copyLinearToTiled(params, threadsCount, threadPool);
+    } else {
+        TiledImageCopy::copyTiledToLinear(params, threadsCount, threadPool);
+    }
+}
+
 cl_int Image::writeNV12Planes(const void *hostPtr, size_t hostPtrRowPitch, uint32_t rootDeviceIndex) {
     CommandQueue *cmdQ = context->getSpecialQueue(rootDeviceIndex);
     size_t origin[3] = {0, 0, 0};
@@ -186,6 +186,10 @@ class Image : public MemObj {
     static cl_int validateRegionAndOrigin(const size_t *origin, const size_t *region, const cl_image_desc &imgDesc);
 
     cl_int writeNV12Planes(const void *hostPtr, size_t hostPtrRowPitch, uint32_t rootDeviceIndex);
+    // Host accessible images may be written and read by CPU copy swizzling data to/from image tiling
+    bool isTiledCopyOnCpuAllowed(uint32_t rootDeviceIndex);
+    void copyOnCpuWithTiling(void *hostPtr, size_t hostRowPitch, size_t hostSlicePitch, const MemObjOffsetArray &origin, const MemObjSizeArray &region,
+                             bool toImage, uint32_t rootDeviceIndex);
     void setMcsSurfaceInfo(const McsSurfaceInfo &info) { mcsSurfaceInfo = info; }
     const McsSurfaceInfo &getMcsSurfaceInfo() { return mcsSurfaceInfo; }
     void setPlane(const GMM_YUV_PLANE_ENUM plane) { this->plane = plane; }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,7 @@
 #include "shared/source/helpers/basic_math.h"
 #include "shared/source/memory_manager/allocations_list.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/memory_manager/memory_pool.h"
 #include "shared/source/memory_manager/migration_sync_data.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/unit_test_helper.h"
@@ -752,3 +753,54 @@ HWTEST_F(EnqueueWriteImageTest, givenMultiRootDeviceImageWhenNonBlockedEnqueueWr
     pCmdQ1->release();
     pImage->release();
 }
+
+HWTEST_F(EnqueueWriteImageTest, givenCpuTiledImageCopyEnabledAndTiledImageInSystemMemoryWhenBlockingWriteAndReadImageThenDataIsSwizzledOnCpu) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableCpuTiledImageCopy.set(1);
+
+    constexpr size_t rowPitch = 2048u;
+    constexpr size_t height = 32u;
+    cl_image_desc imageDesc = Image2dDefaults::imageDesc;
+    imageDesc.image_width = rowPitch / sizeof(float);
+    imageDesc.image_height = height;
+    std::unique_ptr<Image> image(Image2dHelper<>::create(context, &imageDesc));
+    auto allocation = image->getGraphicsAllocation(pClDevice->getRootDeviceIndex());
+    auto gmm = allocation->getDefaultGmm();
+    if (gmm == nullptr || !MemoryPoolHelper::isSystemMemoryPool(allocation->getMemoryPool()) ||
+        allocation->getUnderlyingBuffer() == nullptr || allocation->getUnderlyingBufferSize() < rowPitch * height) {
+        GTEST_SKIP();
+    }
+    image->setImageRowPitch(rowPitch);
+    image->setImageSlicePitch(rowPitch * height);
+    gmm->isCompressionEnabled = false;
+    auto &resourceFlags = gmm->gmmResourceInfo->getResourceFlags()->Info;
+    resourceFlags.Linear = 0;
+    resourceFlags.TiledX = 0;
+    resourceFlags.Tile4 = 0;
+    resourceFlags.TiledY = 1;
+    resourceFlags.TiledYf = 0;
+    resourceFlags.TiledYs = 0;
+
+    std::vector<uint8_t> srcData(rowPitch * height);
+    for (size_t i = 0; i < srcData.size(); i++) {
+        srcData[i] = static_cast<uint8_t>(i % 251);
+    }
+    std::vector<uint8_t> dstData(srcData.size(), 0u);
+    size_t origin[] = {0, 0, 0};
+    size_t region[] = {imageDesc.image_width, height, 1};
+
+    MockCommandQueueHw<FamilyType> cmdQ(context, pClDevice, nullptr);
+    auto retVal = cmdQ.enqueueWriteImage(image.get(), CL_TRUE, origin, region, 0, 0, srcData.data(), nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_TRUE(cmdQ.cpuDataTransferHandlerCalled);
+
+    // TileY stores 16 byte wide columns of 32 rows contiguously
+    auto storage = static_cast<uint8_t *>(allocation->getUnderlyingBuffer());
+    EXPECT_EQ(0, memcmp(storage, srcData.data(), 16));
+    EXPECT_EQ(0, memcmp(storage + 16, srcData.data() + rowPitch, 16));
+    EXPECT_EQ(0, memcmp(storage + 512, srcData.data() + 16, 16));
+
+    retVal = cmdQ.enqueueReadImage(image.get(), CL_TRUE, origin, region, 0, 0, dstData.data(), nullptr, 0, nullptr, nullptr);
+    EXPECT_EQ(CL_SUCCESS, retVal);
+    EXPECT_EQ(srcData, dstData);
+}
@@ -620,6 +620,10 @@ class CommandStreamReceiverMock : public CommandStreamReceiver {
         return QueueThrottle::MEDIUM;
     }
 
+    SubmissionGapHistogram *getDirectSubmissionGapHistogram() override {
+        return nullptr;
+    }
+
     std::map<const void *, size_t> residency;
     std::unique_ptr<ExecutionEnvironment> mockExecutionEnvironment;
     bool passResidencyCallToBaseClass = true;
@@ -183,6 +183,7 @@ void CommandContainer::removeDuplicatesFromResidencyContainer() {
 
 void CommandContainer::reset() {
     setDirtyStateForAllHeaps(true);
+    invalidateReusableHeapData();
     slmSize = std::numeric_limits<uint32_t>::max();
     getResidencyContainer().clear();
     if (getHeapHelper()) {
@@ -291,11 +292,42 @@ void CommandContainer::createAndAssignNewHeap(HeapType heapType, size_t size) {
         getDeallocationContainer().push_back(oldAlloc);
     }
     setIndirectHeapAllocation(heapType, newAlloc);
+    reusableHeapData[heapType].invalidate();
     if (oldBase != newBase) {
         setHeapDirty(heapType);
     }
 }
 
+void CommandContainer::invalidateReusableHeapData() {
+    for (auto &heapData : reusableHeapData) {
+        heapData.invalidate();
+    }
+}
+
+bool ReusableHeapData::isMatching(const GraphicsAllocation *currentHeapAllocation, const void *data, size_t dataSize, const void *extraData, size_t extraDataSize) const {
+    if (heapAllocation == nullptr || heapAllocation != currentHeapAllocation ||
+        storedDataSize != dataSize || storedData.size() != dataSize + extraDataSize) {
+        return false;
+    }
+    if (dataSize > 0u && memcmp(storedData.data(), data, dataSize) != 0) {
+        return false;
+    }
+    return extraDataSize == 0u || memcmp(storedData.data() + dataSize, extraData, extraDataSize) == 0;
+}
+
+void ReusableHeapData::store(GraphicsAllocation *currentHeapAllocation, uint64_t offset, const void *data, size_t dataSize, const void *extraData, size_t extraDataSize) {
+    storedData.resize(dataSize + extraDataSize);
+    if (dataSize > 0u) {
+        memcpy_s(storedData.data(), dataSize, data, dataSize);
+    }
+    if (extraDataSize > 0u) {
+        memcpy_s(storedData.data() + dataSize, extraDataSize, extraData, extraDataSize);
+    }
+    storedDataSize = dataSize;
+    heapAllocation = currentHeapAllocation;
+    heapOffset = offset;
+}
+
 void CommandContainer::handleCmdBufferAllocations(size_t startIndex) {
     if (immediateReusableAllocationList != nullptr && !immediateReusableAllocationList->peekIsEmpty() && reusableAllocationList != nullptr) {
         reusableAllocationList->splice(*immediateReusableAllocationList->detachNodes());
@@ -58,6 +58,18 @@ struct HeapReserveArguments {
     size_t alignment = 0;
 };
 
+// Describes data most recently written to a heap, so an identical following dispatch may point to it instead of copying it again
+struct ReusableHeapData {
+    bool isMatching(const GraphicsAllocation *currentHeapAllocation, const void *data, size_t dataSize, const void *extraData, size_t extraDataSize) const;
+    void store(GraphicsAllocation *currentHeapAllocation, uint64_t offset, const void *data, size_t dataSize, const void *extraData, size_t extraDataSize);
+    void invalidate() { heapAllocation = nullptr; }
+
+    std::vector<uint8_t> storedData;
+    GraphicsAllocation *heapAllocation = nullptr;
+    uint64_t heapOffset = 0u;
+    size_t storedDataSize = 0u;
+};
+
 class CommandContainer : public NonCopyableOrMovableClass {
   public:
     enum class ErrorCode {
@@ -204,6 +216,9 @@ class CommandContainer : public NonCopyableOrMovableClass {
 
     void *findCpuBaseForCmdBufferAddress(void *cmdBufferAddress);
 
+    ReusableHeapData &getReusableHeapData(HeapType heapType) { return reusableHeapData[heapType]; }
+    void invalidateReusableHeapData();
+
   protected:
     size_t getAlignedCmdBufferSize() const;
     size_t getMaxUsableSpace() const {
@@ -217,6 +232,7 @@ class CommandContainer : public NonCopyableOrMovableClass {
     void alignPrimaryEnding(void *endPtr, size_t exactUsedSize);
 
     GraphicsAllocation *allocationIndirectHeaps[HeapType::numTypes] = {};
+    ReusableHeapData reusableHeapData[HeapType::numTypes];
 
     CmdBufferContainer cmdBufferAllocations;
     ResidencyContainer residencyContainer;
@@ -32,6 +32,7 @@
 #include "shared/source/kernel/kernel_descriptor.h"
 #include "shared/source/os_interface/product_helper.h"
 #include "shared/source/program/kernel_info.h"
+#include "shared/source/utilities/stackvec.h"
 
 #include "encode_surface_state.inl"
 #include "encode_surface_state_args.h"
@@ -52,6 +53,7 @@ uint32_t EncodeStates<Family>::copySamplerState(IndirectHeap *dsh,
     auto borderColorSize = samplerStateOffset - borderColorOffset;
 
     SAMPLER_STATE *dstSamplerState = nullptr;
+    StackVec<SAMPLER_STATE, 16> bindlessSamplerStates;
     uint32_t samplerStateOffsetInDsh = 0;
 
     dsh->align(EncodeStates<Family>::alignIndirectStatePointer);
@@ -80,9 +82,9 @@ uint32_t EncodeStates<Family>::copySamplerState(IndirectHeap *dsh,
             borderColorOffsetInDsh = bindlessHeapHelper->getAlphaBorderColorOffset();
         }
         dsh->align(INTERFACE_DESCRIPTOR_DATA::SAMPLERSTATEPOINTER_ALIGN_SIZE);
-        auto samplerStateInDsh = bindlessHeapHelper->allocateSSInHeap(sizeSamplerState, nullptr, BindlessHeapsHelper::BindlesHeapType::globalDsh);
-        dstSamplerState = reinterpret_cast<SAMPLER_STATE *>(samplerStateInDsh.ssPtr);
-        samplerStateOffsetInDsh = static_cast<uint32_t>(samplerStateInDsh.surfaceStateOffset);
+        // sampler states are programmed locally first, so identical states can share slot in global DSH
+        bindlessSamplerStates.resize(samplerCount);
+        dstSamplerState = bindlessSamplerStates.begin();
     }
 
     auto &helper = rootDeviceEnvironment.getHelper<ProductHelper>();
@@ -96,6 +98,11 @@ uint32_t EncodeStates<Family>::copySamplerState(IndirectHeap *dsh,
         dstSamplerState[i] = state;
     }
 
+    if (bindlessHeapHelper && bindlessHeapHelper->isGlobalDshSupported()) {
+        auto samplerStateInDsh = bindlessHeapHelper->allocateCachedStateInHeap(bindlessSamplerStates.begin(), sizeSamplerState, BindlessHeapsHelper::BindlesHeapType::globalDsh);
+        samplerStateOffsetInDsh = static_cast<uint32_t>(samplerStateInDsh.surfaceStateOffset);
+    }
+
     return samplerStateOffsetInDsh;
 } // namespace NEO
 
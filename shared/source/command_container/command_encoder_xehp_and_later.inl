@@ -127,6 +127,7 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
 
     auto bindingTableStateCount = kernelDescriptor.payloadMappings.bindingTable.numEntries;
     bool sshProgrammingRequired = true;
+    const bool heapDataReuseEnabled = debugManager.flags.EnableDispatchHeapDataReuse.get() == 1;
 
     auto &productHelper = args.device->getProductHelper();
     if (productHelper.isSkippingStatefulInformationRequired(kernelDescriptor)) {
@@ -176,17 +177,30 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
             if constexpr (heaplessModeEnabled == false) {
                 container.prepareBindfulSsh();
                 if (bindingTableStateCount > 0u) {
-                    auto ssh = args.surfaceStateHeap;
-                    if (ssh == nullptr) {
-                        ssh = container.getHeapWithRequiredSizeAndAlignment(HeapType::surfaceState, args.dispatchInterface->getSurfaceStateHeapDataSize(), BINDING_TABLE_STATE::SURFACESTATEPOINTER_ALIGN_SIZE);
-                    }
-                    auto bindingTablePointer = static_cast<uint32_t>(EncodeSurfaceState<Family>::pushBindingTableAndSurfaceStates(
-                        *ssh,
-                        args.dispatchInterface->getSurfaceStateHeapData(),
-                        args.dispatchInterface->getSurfaceStateHeapDataSize(), bindingTableStateCount,
-                        kernelDescriptor.payloadMappings.bindingTable.tableOffset));
+                    auto sshData = args.dispatchInterface->getSurfaceStateHeapData();
+                    auto sshDataSize = args.dispatchInterface->getSurfaceStateHeapDataSize();
+                    // surface states in shared heaps may be rewound by the owning csr, only container owned heap is reused
+                    bool sshReuseAllowed = heapDataReuseEnabled && args.surfaceStateHeap == nullptr && !container.immediateCmdListSharedHeap(HeapType::surfaceState);
+                    auto &reusableSshData = container.getReusableHeapData(HeapType::surfaceState);
+
+                    if (sshReuseAllowed && reusableSshData.isMatching(container.getIndirectHeapAllocation(HeapType::surfaceState), sshData, sshDataSize, nullptr, 0u)) {
+                        idd.setBindingTablePointer(static_cast<uint32_t>(reusableSshData.heapOffset));
+                    } else {
+                        auto ssh = args.surfaceStateHeap;
+                        if (ssh == nullptr) {
+                            ssh = container.getHeapWithRequiredSizeAndAlignment(HeapType::surfaceState, sshDataSize, BINDING_TABLE_STATE::SURFACESTATEPOINTER_ALIGN_SIZE);
+                        }
+                        auto bindingTablePointer = static_cast<uint32_t>(EncodeSurfaceState<Family>::pushBindingTableAndSurfaceStates(
+                            *ssh,
+                            sshData,
+                            sshDataSize, bindingTableStateCount,
+                            kernelDescriptor.payloadMappings.bindingTable.tableOffset));
 
-                    idd.setBindingTablePointer(bindingTablePointer);
+                        idd.setBindingTablePointer(bindingTablePointer);
+                        if (sshReuseAllowed) {
+                            reusableSshData.store(container.getIndirectHeapAllocation(HeapType::surfaceState), bindingTablePointer, sshData, sshDataSize, nullptr, 0u);
+                        }
+                    }
                 }
             }
         }
@@ -242,7 +256,15 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
     uint32_t sizeThreadData = sizePerThreadDataForWholeGroup + sizeCrossThreadData;
     uint32_t sizeForImplicitArgsPatching = NEO::ImplicitArgsHelper::getSizeForImplicitArgsPatching(pImplicitArgs, kernelDescriptor, !localIdsGenerationByRuntime, rootDeviceEnvironment);
     uint32_t iohRequiredSize = sizeThreadData + sizeForImplicitArgsPatching;
-    {
+
+    // indirect data patched by gpu or containing implicit args with heap addresses cannot be shared between dispatches
+    bool iohReuseAllowed = heapDataReuseEnabled && !args.isIndirect && pImplicitArgs == nullptr && sizeThreadData > 0u;
+    auto perThreadDataForReuse = args.dispatchInterface->getPerThreadData();
+    auto perThreadDataSizeForReuse = perThreadDataForReuse != nullptr ? static_cast<size_t>(sizePerThreadDataForWholeGroup) : 0u;
+    auto &reusableIndirectData = container.getReusableHeapData(HeapType::indirectObject);
+    if (iohReuseAllowed && reusableIndirectData.isMatching(container.getIndirectHeapAllocation(HeapType::indirectObject), crossThreadData, sizeCrossThreadData, perThreadDataForReuse, perThreadDataSizeForReuse)) {
+        offsetThreadData = reusableIndirectData.heapOffset;
+    } else {
         auto heap = container.getIndirectHeap(HeapType::indirectObject);
         UNRECOVERABLE_IF(!heap);
         heap->align(DefaultWalkerType::INDIRECTDATASTARTADDRESS_ALIGN_SIZE);
@@ -281,6 +303,10 @@ void EncodeDispatchKernel<Family>::encode(CommandContainer &container, EncodeDis
             memcpy_s(ptr, sizePerThreadDataForWholeGroup,
                      perThreadDataPtr, sizePerThreadDataForWholeGroup);
         }
+
+        if (iohReuseAllowed) {
+            reusableIndirectData.store(container.getIndirectHeapAllocation(HeapType::indirectObject), offsetThreadData, crossThreadData, sizeCrossThreadData, perThreadDataForReuse, perThreadDataSizeForReuse);
+        }
     }
 
     if (container.isAnyHeapDirty() ||
@@ -0,0 +1,244 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_container/relocatable_command_buffer.h"
+
+#include "shared/source/helpers/aligned_memory.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/string.h"
+
+#include <algorithm>
+
+namespace NEO {
+namespace RelocatableCommandBuffer {
+
+namespace {
+constexpr size_t sectionDataAlignment = sizeof(uint64_t);
+
+size_t getTablesSize(size_t sectionsCount, size_t allocationsCount, size_t relocationsCount) {
+    return sizeof(BlobHeader) + sectionsCount * sizeof(SectionEntry) + allocationsCount * sizeof(AllocationEntry) + relocationsCount * sizeof(RelocationEntry);
+}
+
+uint64_t canonizeWithMask(uint64_t address, uint64_t addressMask) {
+    auto topBit = (addressMask >> 1) + 1;
+    return (address & topBit) ? (address | ~addressMask) : (address & addressMask);
+}
+} // namespace
+
+void patchAddress(void *location, RelocationType type, uint64_t newAddress, uint64_t addressMask) {
+    if (type == RelocationType::address32) {
+        auto value = static_cast<uint32_t>(newAddress);
+        memcpy_s(location, sizeof(value), &value, sizeof(value));
+        return;
+    }
+
+    uint64_t value = 0u;
+    memcpy_s(&value, sizeof(value), location, sizeof(value));
+    value = ((value & ~addressMask) != 0u) ? canonizeWithMask(newAddress, addressMask) : (newAddress & addressMask);
+    memcpy_s(location, sizeof(value), &value, sizeof(value));
+}
+
+uint32_t Writer::addAllocation(uint64_t gpuAddress, uint64_t size) {
+    allocations.push_back({gpuAddress, size});
+    addressRanges.clear();
+    return static_cast<uint32_t>(allocations.size() - 1);
+}
+
+uint32_t Writer::addSection(SectionType type, uint32_t allocationIndex, const void *data, size_t size) {
+    UNRECOVERABLE_IF(allocationIndex != invalidIndex && allocationIndex >= allocations.size());
+
+    SectionEntry section{};
+    section.type = type;
+    section.allocationIndex = allocationIndex;
+    section.size = size;
+    sections.push_back(section);
+
+    auto bytes = static_cast<const uint8_t *>(data);
+    sectionsData.emplace_back(bytes, bytes + size);
+    return static_cast<uint32_t>(sections.size() - 1);
+}
+
+void Writer::addRelocation(RelocationType type, uint32_t sectionIndex, size_t offset, uint32_t allocationIndex, uint64_t offsetInAllocation) {
+    UNRECOVERABLE_IF(sectionIndex >= sections.size());
+    UNRECOVERABLE_IF(allocationIndex >= allocations.size());
+    auto patchSize = (type == RelocationType::address64) ? sizeof(uint64_t) : sizeof(uint32_t);
+    UNRECOVERABLE_IF(offset + patchSize > sections[sectionIndex].size);
+
+    RelocationEntry relocation{};
+    relocation.type = type;
+    relocation.sectionIndex = sectionIndex;
+    relocation.offset = offset;
+    relocation.allocationIndex = allocationIndex;
+    relocation.offsetInAllocation = offsetInAllocation;
+    relocations.push_back(relocation);
+}
+
+bool Writer::addAddressRelocation(uint32_t sectionIndex, size_t offset, uint64_t addressMask) {
+    UNRECOVERABLE_IF(sectionIndex >= sections.size());
+    UNRECOVERABLE_IF(offset + sizeof(uint64_t) > sections[sectionIndex].size);
+
+    uint64_t value = 0u;
+    memcpy_s(&value, sizeof(value), &sectionsData[sectionIndex][offset], sizeof(value));
+    value &= addressMask;
+
+    auto allocationIndex = findAllocation(value, addressMask);
+    if (allocationIndex == invalidIndex) {
+        return false;
+    }
+    addRelocation(RelocationType::address64, sectionIndex, offset, allocationIndex, value - (allocations[allocationIndex].gpuAddress & addressMask));
+    return true;
+}
+
+uint32_t Writer::findAllocation(uint64_t address, uint64_t addressMask) {
+    if (addressRanges.empty() || addressRangesMask != addressMask) {
+        addressRanges.clear();
+        for (uint32_t i = 0; i < allocations.size(); i++) {
+            auto start = allocations[i].gpuAddress & addressMask;
+            if (allocations[i].size == 0u) {
+                continue;
+            }
+            addressRanges.push_back({start, start + allocations[i].size, 0u, i});
+        }
+        std::sort(addressRanges.begin(), addressRanges.end(), [](const AddressRange &a, const AddressRange &b) { return a.start < b.start; });
+        uint64_t maxEnd = 0u;
+        for (auto &range : addressRanges) {
+            maxEnd = std::max(maxEnd, range.end);
+            range.maxEndSoFar = maxEnd;
+        }
+        addressRangesMask = addressMask;
+    }
+
+    // ranges starting at or below address, the one starting last is the innermost of nested ones
+    auto range = std::upper_bound(addressRanges.begin(), addressRanges.end(), address, [](uint64_t value, const AddressRange &r) { return value < r.start; });
+    while (range != addressRanges.begin()) {
+        --range;
+        if (range->maxEndSoFar <= address) {
+            break;
+        }
+        if (address < range->end) {
+            return range->allocationIndex;
+        }
+    }
+    return invalidIndex;
+}
+
+size_t Writer::getBlobSize() const {
+    auto size = alignUp(getTablesSize(sections.size(), allocations.size(), relocations.size()), sectionDataAlignment);
+    for (const auto &section : sections) {
+        size += alignUp(static_cast<size_t>(section.size), sectionDataAlignment);
+    }
+    return size;
+}
+
+void Writer::serialize(void *dst) const {
+    auto blobSize = getBlobSize();
+    memset(dst, 0, blobSize);
+
+    BlobHeader header{};
+    header.sectionsCount = static_cast<uint32_t>(sections.size());
+    header.allocationsCount = static_cast<uint32_t>(allocations.size());
+    header.relocationsCount = static_cast<uint32_t>(relocations.size());
+    header.blobSize = blobSize;
+
+    auto tables = static_cast<uint8_t *>(dst);
+    memcpy_s(tables, sizeof(BlobHeader), &header, sizeof(BlobHeader));
+    tables += sizeof(BlobHeader);
+
+    auto sectionEntries = reinterpret_cast<SectionEntry *>(tables);
+    tables += sections.size() * sizeof(SectionEntry);
+    if (!allocations.empty()) {
+        memcpy_s(tables, allocations.size() * sizeof(AllocationEntry), allocations.data(), allocations.size() * sizeof(AllocationEntry));
+    }
+    tables += allocations.size() * sizeof(AllocationEntry);
+    if (!relocations.empty()) {
+        memcpy_s(tables, relocations.size() * sizeof(RelocationEntry), relocations.data(), relocations.size() * sizeof(RelocationEntry));
+    }
+
+    auto dataOffset = alignUp(getTablesSize(sections.size(), allocations.size(), relocations.size()), sectionDataAlignment);
+    for (size_t i = 0; i < sections.size(); i++) {
+        auto section = sections[i];
+        section.dataOffset = dataOffset;
+        memcpy_s(&sectionEntries[i], sizeof(SectionEntry), &section, sizeof(SectionEntry));
+        if (section.size > 0u) {
+            memcpy_s(ptrOffset(dst, dataOffset), static_cast<size_t>(section.size), sectionsData[i].data(), static_cast<size_t>(section.size));
+        }
+        dataOffset += alignUp(static_cast<size_t>(section.size), sectionDataAlignment);
+    }
+}
+
+bool Reader::initialize(const void *blob, size_t blobSize) {
+    if (blob == nullptr || blobSize < sizeof(BlobHeader) || !isAligned<sizeof(uint32_t)>(blob)) {
+        return false;
+    }
+    auto blobHeader = static_cast<const BlobHeader *>(blob);
+    if (blobHeader->magic != blobMagic || blobHeader->version != blobVersion || blobHeader->blobSize != blobSize) {
+        return false;
+    }
+
+    // Each count is bounded by the blob size, so computing tables size cannot overflow
+    if (blobHeader->sectionsCount > blobSize || blobHeader->allocationsCount > blobSize || blobHeader->relocationsCount > blobSize ||
+        getTablesSize(blobHeader->sectionsCount, blobHeader->allocationsCount, blobHeader->relocationsCount) > blobSize) {
+        return false;
+    }
+
+    auto tables = static_cast<const uint8_t *>(blob) + sizeof(BlobHeader);
+    auto sectionEntries = reinterpret_cast<const SectionEntry *>(tables);
+    tables += blobHeader->sectionsCount * sizeof(SectionEntry);
+    auto allocationEntries = reinterpret_cast<const AllocationEntry *>(tables);
+    tables += blobHeader->allocationsCount * sizeof(AllocationEntry);
+    auto relocationEntries = reinterpret_cast<const RelocationEntry *>(tables);
+
+    for (uint32_t i = 0; i < blobHeader->sectionsCount; i++) {
+        const auto &section = sectionEntries[i];
+        if (section.dataOffset > blobSize || section.size > blobSize - section.dataOffset) {
+            return false;
+        }
+        if (section.allocationIndex != invalidIndex && section.allocationIndex >= blobHeader->allocationsCount) {
+            return false;
+        }
+    }
+    for (uint32_t i = 0; i < blobHeader->relocationsCount; i++) {
+        const auto &relocation = relocationEntries[i];
+        if (relocation.sectionIndex >= blobHeader->sectionsCount || relocation.allocationIndex >= blobHeader->allocationsCount) {
+            return false;
+        }
+        auto patchSize = (relocation.type == RelocationType::address64) ? sizeof(uint64_t) : sizeof(uint32_t);
+        if (relocation.type != RelocationType::address64 && relocation.type != RelocationType::address32) {
+            return false;
+        }
+        const auto &section = sectionEntries[relocation.sectionIndex];
+        if (relocation.offset > section.size || patchSize > section.size - relocation.offset) {
+            return false;
+        }
+    }
+
+    this->blob = static_cast<const uint8_t *>(blob);
+    this->header = blobHeader;
+    this->sections = sectionEntries;
+    this->allocations = allocationEntries;
+    this->relocations = relocationEntries;
+    return true;
+}
+
+const void *Reader::getSectionData(uint32_t sectionIndex) const {
+    return blob + sections[sectionIndex].dataOffset;
+}
+
+void Reader::applyRelocations(uint32_t sectionIndex, void *sectionData, const uint64_t *newAllocationAddresses, uint64_t addressMask) const {
+    for (uint32_t i = 0; i < header->relocationsCount; i++) {
+        const auto &relocation = relocations[i];
+        if (relocation.sectionIndex != sectionIndex) {
+            continue;
+        }
+        auto newAddress = newAllocationAddresses[relocation.allocationIndex] + relocation.offsetInAllocation;
+        patchAddress(ptrOffset(sectionData, static_cast<size_t>(relocation.offset)), relocation.type, newAddress, addressMask);
+    }
+}
+
+} // namespace RelocatableCommandBuffer
+} // namespace NEO
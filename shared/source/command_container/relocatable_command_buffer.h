@@ -0,0 +1,132 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace NEO {
+namespace RelocatableCommandBuffer {
+
+inline constexpr uint32_t blobMagic = 0x4c434e52; // "RNCL"
+inline constexpr uint32_t blobVersion = 1u;
+
+enum class SectionType : uint32_t {
+    commandBuffer = 0,
+    surfaceStateHeap,
+    dynamicStateHeap,
+    indirectObjectHeap,
+    userData
+};
+
+enum class RelocationType : uint32_t {
+    address64 = 0, // canonical or decanonized 64-bit GPU address
+    address32      // lower 32 bits of an address, e.g. kernel start pointer relative to instruction heap base
+};
+
+inline constexpr uint32_t invalidIndex = UINT32_MAX;
+
+#pragma pack(push, 4)
+struct BlobHeader {
+    uint32_t magic = blobMagic;
+    uint32_t version = blobVersion;
+    uint32_t sectionsCount = 0u;
+    uint32_t allocationsCount = 0u;
+    uint32_t relocationsCount = 0u;
+    uint32_t reserved = 0u;
+    uint64_t blobSize = 0u;
+};
+
+struct SectionEntry {
+    SectionType type = SectionType::commandBuffer;
+    uint32_t allocationIndex = invalidIndex;
+    uint64_t size = 0u;
+    uint64_t dataOffset = 0u;
+};
+
+struct AllocationEntry {
+    uint64_t gpuAddress = 0u;
+    uint64_t size = 0u;
+};
+
+struct RelocationEntry {
+    RelocationType type = RelocationType::address64;
+    uint32_t sectionIndex = 0u;
+    uint64_t offset = 0u;
+    uint32_t allocationIndex = 0u;
+    uint32_t reserved = 0u;
+    uint64_t offsetInAllocation = 0u;
+};
+#pragma pack(pop)
+
+// Writes newAddress at location preserving canonical form of the previous 64-bit value
+void patchAddress(void *location, RelocationType type, uint64_t newAddress, uint64_t addressMask);
+
+// Builds a blob from section contents and GPU address ranges referenced by them.
+// Offsets of all patchable addresses are recorded so the blob may be loaded at different addresses.
+class Writer {
+  public:
+    uint32_t addAllocation(uint64_t gpuAddress, uint64_t size);
+    uint32_t addSection(SectionType type, uint32_t allocationIndex, const void *data, size_t size);
+    void addRelocation(RelocationType type, uint32_t sectionIndex, size_t offset, uint32_t allocationIndex, uint64_t offsetInAllocation);
+
+    // Records 64-bit address stored at given location of a section, resolved to the innermost allocation containing it.
+    // Returns false when no allocation contains the address.
+    bool addAddressRelocation(uint32_t sectionIndex, size_t offset, uint64_t addressMask);
+
+    size_t getBlobSize() const;
+    void serialize(void *dst) const;
+
+    const std::vector<RelocationEntry> &getRelocations() const { return relocations; }
+
+  protected:
+    struct AddressRange {
+        uint64_t start;
+        uint64_t end;
+        uint64_t maxEndSoFar; // highest end of this and all preceding ranges, bounds search among overlapping ranges
+        uint32_t allocationIndex;
+    };
+
+    uint32_t findAllocation(uint64_t address, uint64_t addressMask);
+
+    std::vector<SectionEntry> sections;
+    std::vector<std::vector<uint8_t>> sectionsData;
+    std::vector<AllocationEntry> allocations;
+    std::vector<RelocationEntry> relocations;
+    std::vector<AddressRange> addressRanges; // sorted by start, rebuilt when allocations are added
+    uint64_t addressRangesMask = 0u;
+};
+
+// Validates blob layout and re-patches section contents for new allocation addresses
+class Reader {
+  public:
+    bool initialize(const void *blob, size_t blobSize);
+
+    uint32_t getSectionsCount() const { return header->sectionsCount; }
+    const SectionEntry &getSection(uint32_t sectionIndex) const { return sections[sectionIndex]; }
+    const void *getSectionData(uint32_t sectionIndex) const;
+
+    uint32_t getAllocationsCount() const { return header->allocationsCount; }
+    const AllocationEntry &getAllocation(uint32_t allocationIndex) const { return allocations[allocationIndex]; }
+
+    uint32_t getRelocationsCount() const { return header->relocationsCount; }
+    const RelocationEntry &getRelocation(uint32_t relocationIndex) const { return relocations[relocationIndex]; }
+
+    // Patches section copy placed at sectionData; newAllocationAddresses is indexed by allocation index
+    void applyRelocations(uint32_t sectionIndex, void *sectionData, const uint64_t *newAllocationAddresses, uint64_t addressMask) const;
+
+  protected:
+    const uint8_t *blob = nullptr;
+    const BlobHeader *header = nullptr;
+    const SectionEntry *sections = nullptr;
+    const AllocationEntry *allocations = nullptr;
+    const RelocationEntry *relocations = nullptr;
+};
+
+} // namespace RelocatableCommandBuffer
+} // namespace NEO
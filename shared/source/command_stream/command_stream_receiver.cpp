@@ -457,6 +457,8 @@ WaitStatus CommandStreamReceiver::waitForCompletionWithTimeout(const WaitParams
             return isGpuHang ? WaitStatus::gpuHang : WaitStatus::notReady;
         }
     }
+    // submitter goes idle, submissions deferred for coalescing must not wait for controller
+    this->releaseCoalescedDirectSubmissions(false);
 
     auto retCode = baseWaitFunction(getTagAddress(), params, taskCountToWait);
     if (printWaitForCompletion) {
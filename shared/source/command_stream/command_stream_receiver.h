@@ -58,6 +58,7 @@ class KmdNotifyHelper;
 class GfxCoreHelper;
 class ProductHelper;
 class ReleaseHelper;
+struct SubmissionGapHistogram;
 enum class WaitStatus;
 struct AubSubCaptureStatus;
 
@@ -323,8 +324,10 @@ class CommandStreamReceiver {
     }
 
     virtual void stopDirectSubmission(bool blocking) {}
+    virtual void releaseCoalescedDirectSubmissions(bool expiredOnly) {}
 
     virtual QueueThrottle getLastDirectSubmissionThrottle() = 0;
+    virtual SubmissionGapHistogram *getDirectSubmissionGapHistogram() = 0;
 
     bool isStaticWorkPartitioningEnabled() const {
         return staticWorkPartitioningEnabled;
@@ -155,8 +155,10 @@ class CommandStreamReceiverHw : public CommandStreamReceiver {
     bool directSubmissionRelaxedOrderingEnabled() const override;
 
     void stopDirectSubmission(bool blocking) override;
+    void releaseCoalescedDirectSubmissions(bool expiredOnly) override;
 
     QueueThrottle getLastDirectSubmissionThrottle() override;
+    SubmissionGapHistogram *getDirectSubmissionGapHistogram() override;
 
     virtual bool isKmdWaitModeActive() { return true; }
 
@@ -1362,6 +1362,17 @@ inline void CommandStreamReceiverHw<GfxFamily>::stopDirectSubmission(bool blocki
     }
 }
 
+template <typename GfxFamily>
+inline void CommandStreamReceiverHw<GfxFamily>::releaseCoalescedDirectSubmissions(bool expiredOnly) {
+    if (this->isAnyDirectSubmissionEnabled()) {
+        if (EngineHelpers::isBcs(this->osContext->getEngineType())) {
+            this->blitterDirectSubmission->releaseCoalescedSubmissions(expiredOnly);
+        } else {
+            this->directSubmission->releaseCoalescedSubmissions(expiredOnly);
+        }
+    }
+}
+
 template <typename GfxFamily>
 inline QueueThrottle CommandStreamReceiverHw<GfxFamily>::getLastDirectSubmissionThrottle() {
     if (this->isAnyDirectSubmissionEnabled()) {
@@ -1374,6 +1385,18 @@ inline QueueThrottle CommandStreamReceiverHw<GfxFamily>::getLastDirectSubmission
     return QueueThrottle::MEDIUM;
 }
 
+template <typename GfxFamily>
+inline SubmissionGapHistogram *CommandStreamReceiverHw<GfxFamily>::getDirectSubmissionGapHistogram() {
+    if (this->isAnyDirectSubmissionEnabled()) {
+        if (EngineHelpers::isBcs(this->osContext->getEngineType())) {
+            return this->blitterDirectSubmission->getSubmissionGapHistogram();
+        } else {
+            return this->directSubmission->getSubmissionGapHistogram();
+        }
+    }
+    return nullptr;
+}
+
 template <typename GfxFamily>
 inline bool CommandStreamReceiverHw<GfxFamily>::initDirectSubmission() {
     bool ret = true;
@@ -7,12 +7,17 @@
 
 #include "shared/source/command_stream/scratch_space_controller.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/gfx_core_helper.h"
+#include "shared/source/memory_manager/allocation_properties.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/os_interface/os_context.h"
+
+#include <algorithm>
 
 namespace NEO {
 ScratchSpaceController::ScratchSpaceController(uint32_t rootDeviceIndex, ExecutionEnvironment &environment, InternalAllocationStorage &allocationStorage)
@@ -21,6 +26,14 @@ ScratchSpaceController::ScratchSpaceController(uint32_t rootDeviceIndex, Executi
     auto &rootDeviceEnvironment = *executionEnvironment.rootDeviceEnvironments[rootDeviceIndex];
     auto &gfxCoreHelper = rootDeviceEnvironment.getHelper<GfxCoreHelper>();
     computeUnitsUsedForScratch = gfxCoreHelper.getComputeUnitsUsedForScratch(rootDeviceEnvironment);
+    maxPerThreadScratchSize = gfxCoreHelper.getMaxScratchSize();
+
+    if (debugManager.flags.EnableAdaptiveScratchSpace.get() != -1) {
+        adaptiveScratchSpace = !!debugManager.flags.EnableAdaptiveScratchSpace.get();
+    }
+    if (debugManager.flags.AdaptiveScratchSpaceShrinkSubmissions.get() != -1) {
+        underutilizedSubmissionsToShrink = static_cast<uint32_t>(debugManager.flags.AdaptiveScratchSpaceShrinkSubmissions.get());
+    }
 }
 
 ScratchSpaceController::~ScratchSpaceController() {
@@ -36,4 +49,58 @@ MemoryManager *ScratchSpaceController::getMemoryManager() const {
     UNRECOVERABLE_IF(executionEnvironment.memoryManager.get() == nullptr);
     return executionEnvironment.memoryManager.get();
 }
+
+size_t ScratchSpaceController::getScratchSizeToAllocate(size_t requiredSizeInBytes, size_t currentSizeInBytes, uint32_t &underutilizedSubmissions) {
+    if (requiredSizeInBytes > currentSizeInBytes) {
+        underutilizedSubmissions = 0u;
+        if (adaptiveScratchSpace) {
+            auto maxScratchSizeInBytes = static_cast<size_t>(maxPerThreadScratchSize) * computeUnitsUsedForScratch;
+            return std::max(requiredSizeInBytes, std::min(currentSizeInBytes * ScratchSpaceConstants::growthFactor, maxScratchSizeInBytes));
+        }
+        return requiredSizeInBytes;
+    }
+    if (!adaptiveScratchSpace || requiredSizeInBytes == 0u) {
+        return 0u;
+    }
+    if (requiredSizeInBytes * ScratchSpaceConstants::shrinkRatio > currentSizeInBytes) {
+        underutilizedSubmissions = 0u;
+        return 0u;
+    }
+    if (++underutilizedSubmissions < underutilizedSubmissionsToShrink) {
+        return 0u;
+    }
+    underutilizedSubmissions = 0u;
+    return requiredSizeInBytes;
+}
+
+GraphicsAllocation *ScratchSpaceController::obtainScratchAllocation(const AllocationProperties &properties) {
+    if (adaptiveScratchSpace) {
+        auto reusableAllocation = csrAllocationStorage.obtainReusableAllocation(properties.size, AllocationType::scratchSurface);
+        if (reusableAllocation) {
+            if (reusableAllocationsCount > 0u) {
+                reusableAllocationsCount--;
+            }
+            statistics.reusedAllocations++;
+            return reusableAllocation.release();
+        }
+    }
+    statistics.allocations++;
+    return getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
+}
+
+void ScratchSpaceController::releaseScratchAllocation(GraphicsAllocation *scratchAllocation, bool shrink, TaskCountType currentTaskCount, OsContext &osContext) {
+    statistics.reallocations++;
+    if (shrink) {
+        statistics.shrinks++;
+    }
+    scratchAllocation->updateTaskCount(currentTaskCount, osContext.getContextId());
+    // backing outgrown by demand is kept for reuse when demand drops again, up to maxReusableAllocations of them;
+    // shrunk one is released
+    auto allocationUsage = TEMPORARY_ALLOCATION;
+    if (adaptiveScratchSpace && !shrink && reusableAllocationsCount < ScratchSpaceConstants::maxReusableAllocations) {
+        allocationUsage = REUSABLE_ALLOCATION;
+        reusableAllocationsCount++;
+    }
+    csrAllocationStorage.storeAllocation(std::unique_ptr<GraphicsAllocation>(scratchAllocation), allocationUsage);
+}
 } // namespace NEO
@@ -22,10 +22,22 @@ class MemoryManager;
 struct HardwareInfo;
 class OsContext;
 class CommandStreamReceiver;
+struct AllocationProperties;
 
 namespace ScratchSpaceConstants {
 inline constexpr size_t scratchSpaceOffsetFor64Bit = 4096u;
-}
+inline constexpr size_t growthFactor = 2u;
+inline constexpr size_t shrinkRatio = 4u;
+inline constexpr uint32_t underutilizedSubmissionsToShrink = 64u;
+inline constexpr uint32_t maxReusableAllocations = 2u;
+} // namespace ScratchSpaceConstants
+
+struct ScratchSpaceStatistics {
+    uint32_t allocations = 0u;       // backings allocated from memory manager
+    uint32_t reusedAllocations = 0u; // backings taken from csr reusable allocations
+    uint32_t reallocations = 0u;     // existing backing replaced by bigger or smaller one
+    uint32_t shrinks = 0u;
+};
 
 using ResidencyContainer = std::vector<GraphicsAllocation *>;
 
@@ -76,9 +88,20 @@ class ScratchSpaceController : NonCopyableOrMovableClass {
                                                        bool &vfeStateDirty,
                                                        CommandStreamReceiver *csr) = 0;
 
+    const ScratchSpaceStatistics &getStatistics() const {
+        return statistics;
+    }
+
   protected:
     MemoryManager *getMemoryManager() const;
 
+    // Returns size of new backing or 0 when current one is kept. With adaptive scratch space backing grows at least growthFactor times,
+    // up to maximal scratch size supported by hardware, and shrinks only after it stayed shrinkRatio times bigger than required
+    // for a number of consecutive submissions.
+    size_t getScratchSizeToAllocate(size_t requiredSizeInBytes, size_t currentSizeInBytes, uint32_t &underutilizedSubmissions);
+    GraphicsAllocation *obtainScratchAllocation(const AllocationProperties &properties);
+    void releaseScratchAllocation(GraphicsAllocation *scratchAllocation, bool shrink, TaskCountType currentTaskCount, OsContext &osContext);
+
     const uint32_t rootDeviceIndex;
     ExecutionEnvironment &executionEnvironment;
     GraphicsAllocation *scratchSlot0Allocation = nullptr;
@@ -88,5 +111,13 @@ class ScratchSpaceController : NonCopyableOrMovableClass {
     size_t scratchSlot1SizeInBytes = 0;
     bool force32BitAllocation = false;
     uint32_t computeUnitsUsedForScratch = 0;
+    uint32_t maxPerThreadScratchSize = 0;
+
+    bool adaptiveScratchSpace = false;
+    uint32_t underutilizedSubmissionsToShrink = ScratchSpaceConstants::underutilizedSubmissionsToShrink;
+    uint32_t underutilizedSubmissionsSlot0 = 0u;
+    uint32_t underutilizedSubmissionsSlot1 = 0u;
+    uint32_t reusableAllocationsCount = 0u; // outgrown backings stored in csr reusable allocations
+    ScratchSpaceStatistics statistics;
 };
 } // namespace NEO
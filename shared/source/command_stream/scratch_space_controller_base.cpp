@@ -33,12 +33,12 @@ void ScratchSpaceControllerBase::setRequiredScratchSpace(void *sshBaseAddress,
                                                          bool &stateBaseAddressDirty,
                                                          bool &vfeStateDirty) {
     size_t requiredScratchSizeInBytes = requiredPerThreadScratchSizeSlot0 * computeUnitsUsedForScratch;
-    if (requiredScratchSizeInBytes && (scratchSlot0SizeInBytes < requiredScratchSizeInBytes)) {
+    auto scratchSizeToAllocate = getScratchSizeToAllocate(requiredScratchSizeInBytes, scratchSlot0SizeInBytes, underutilizedSubmissionsSlot0);
+    if (scratchSizeToAllocate) {
         if (scratchSlot0Allocation) {
-            scratchSlot0Allocation->updateTaskCount(currentTaskCount, osContext.getContextId());
-            csrAllocationStorage.storeAllocation(std::unique_ptr<GraphicsAllocation>(scratchSlot0Allocation), TEMPORARY_ALLOCATION);
+            releaseScratchAllocation(scratchSlot0Allocation, scratchSizeToAllocate < scratchSlot0SizeInBytes, currentTaskCount, osContext);
         }
-        scratchSlot0SizeInBytes = requiredScratchSizeInBytes;
+        scratchSlot0SizeInBytes = scratchSizeToAllocate;
         createScratchSpaceAllocation();
         vfeStateDirty = true;
         force32BitAllocation = getMemoryManager()->peekForce32BitAllocations();
@@ -49,7 +49,7 @@ void ScratchSpaceControllerBase::setRequiredScratchSpace(void *sshBaseAddress,
 }
 
 void ScratchSpaceControllerBase::createScratchSpaceAllocation() {
-    scratchSlot0Allocation = getMemoryManager()->allocateGraphicsMemoryWithProperties({rootDeviceIndex, scratchSlot0SizeInBytes, AllocationType::scratchSurface, this->csrAllocationStorage.getDeviceBitfield()});
+    scratchSlot0Allocation = obtainScratchAllocation({rootDeviceIndex, scratchSlot0SizeInBytes, AllocationType::scratchSurface, this->csrAllocationStorage.getDeviceBitfield()});
     UNRECOVERABLE_IF(scratchSlot0Allocation == nullptr);
 }
 
@@ -164,16 +164,16 @@ void ScratchSpaceControllerXeHPAndLater::prepareScratchAllocation(uint32_t requi
     size_t requiredScratchSizeInBytes = static_cast<size_t>(requiredPerThreadScratchSizeSlot0AlignedUp) * computeUnitsUsedForScratch;
     scratchSurfaceDirty = false;
     auto multiTileCapable = osContext.getNumSupportedDevices() > 1;
-    if (scratchSlot0SizeInBytes < requiredScratchSizeInBytes) {
+    auto scratchSizeToAllocate = getScratchSizeToAllocate(requiredScratchSizeInBytes, scratchSlot0SizeInBytes, underutilizedSubmissionsSlot0);
+    if (scratchSizeToAllocate) {
         if (scratchSlot0Allocation) {
-            scratchSlot0Allocation->updateTaskCount(currentTaskCount, osContext.getContextId());
-            csrAllocationStorage.storeAllocation(std::unique_ptr<GraphicsAllocation>(scratchSlot0Allocation), TEMPORARY_ALLOCATION);
+            releaseScratchAllocation(scratchSlot0Allocation, scratchSizeToAllocate < scratchSlot0SizeInBytes, currentTaskCount, osContext);
         }
         scratchSurfaceDirty = true;
-        scratchSlot0SizeInBytes = requiredScratchSizeInBytes;
-        perThreadScratchSize = requiredPerThreadScratchSizeSlot0AlignedUp;
+        scratchSlot0SizeInBytes = scratchSizeToAllocate;
+        perThreadScratchSize = static_cast<uint32_t>(scratchSizeToAllocate / computeUnitsUsedForScratch);
         AllocationProperties properties{this->rootDeviceIndex, true, scratchSlot0SizeInBytes, AllocationType::scratchSurface, multiTileCapable, false, osContext.getDeviceBitfield()};
-        scratchSlot0Allocation = getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
+        scratchSlot0Allocation = obtainScratchAllocation(properties);
     }
     if (twoSlotScratchSpaceSupported) {
         uint32_t requiredPerThreadScratchSizeSlot1AlignedUp = requiredPerThreadScratchSizeSlot1;
@@ -181,16 +181,16 @@ void ScratchSpaceControllerXeHPAndLater::prepareScratchAllocation(uint32_t requi
             requiredPerThreadScratchSizeSlot1AlignedUp = Math::nextPowerOfTwo(requiredPerThreadScratchSizeSlot1);
         }
         size_t requiredScratchSlot1SizeInBytes = static_cast<size_t>(requiredPerThreadScratchSizeSlot1AlignedUp) * computeUnitsUsedForScratch;
-        if (scratchSlot1SizeInBytes < requiredScratchSlot1SizeInBytes) {
+        auto scratchSlot1SizeToAllocate = getScratchSizeToAllocate(requiredScratchSlot1SizeInBytes, scratchSlot1SizeInBytes, underutilizedSubmissionsSlot1);
+        if (scratchSlot1SizeToAllocate) {
             if (scratchSlot1Allocation) {
-                scratchSlot1Allocation->updateTaskCount(currentTaskCount, osContext.getContextId());
-                csrAllocationStorage.storeAllocation(std::unique_ptr<GraphicsAllocation>(scratchSlot1Allocation), TEMPORARY_ALLOCATION);
+                releaseScratchAllocation(scratchSlot1Allocation, scratchSlot1SizeToAllocate < scratchSlot1SizeInBytes, currentTaskCount, osContext);
             }
-            scratchSlot1SizeInBytes = requiredScratchSlot1SizeInBytes;
-            perThreadScratchSpaceSlot1Size = requiredPerThreadScratchSizeSlot1AlignedUp;
+            scratchSlot1SizeInBytes = scratchSlot1SizeToAllocate;
+            perThreadScratchSpaceSlot1Size = static_cast<uint32_t>(scratchSlot1SizeToAllocate / computeUnitsUsedForScratch);
             scratchSurfaceDirty = true;
             AllocationProperties properties{this->rootDeviceIndex, true, scratchSlot1SizeInBytes, AllocationType::scratchSurface, multiTileCapable, false, osContext.getDeviceBitfield()};
-            scratchSlot1Allocation = getMemoryManager()->allocateGraphicsMemoryWithProperties(properties);
+            scratchSlot1Allocation = obtainScratchAllocation(properties);
         }
     }
 }
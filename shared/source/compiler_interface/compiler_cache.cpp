@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -28,6 +28,13 @@
 namespace NEO {
 std::mutex CompilerCache::cacheAccessMtx;
 
+CompilerCache::~CompilerCache() {
+    PRINT_DEBUG_STRING(debugManager.flags.PrintCompilerCacheStatistics.get() == 1, stdout,
+                       "Compiler cache statistics: binary hits %llu misses %llu, intermediate representation hits %llu misses %llu\n",
+                       static_cast<unsigned long long>(statistics.binaryHits.load()), static_cast<unsigned long long>(statistics.binaryMisses.load()),
+                       static_cast<unsigned long long>(statistics.intermediateRepresentationHits.load()), static_cast<unsigned long long>(statistics.intermediateRepresentationMisses.load()));
+}
+
 const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, const ArrayRef<const char> input,
                                                    const ArrayRef<const char> options, const ArrayRef<const char> internalOptions,
                                                    const ArrayRef<const char> specIds, const ArrayRef<const char> specValues,
@@ -135,4 +142,13 @@ const std::string CompilerCache::getCachedFileName(const HardwareInfo &hwInfo, c
 CompilerCache::CompilerCache(const CompilerCacheConfig &cacheConfig)
     : config(cacheConfig){};
 
+const std::string CompilerCache::getCachedIntermediateRepresentationFileName(const HardwareInfo &hwInfo, ArrayRef<const char> input,
+                                                                             ArrayRef<const char> options, ArrayRef<const char> internalOptions, uint64_t intermediateCodeType,
+                                                                             ArrayRef<const char> igcRevision, size_t igcLibSize, time_t igcLibMTime) {
+    // tag takes place of specialization constants ids, which are never set for sources translated by front end
+    const ArrayRef<const char> tag(intermediateRepresentationTag.data(), intermediateRepresentationTag.size());
+    const ArrayRef<const char> codeType(reinterpret_cast<const char *>(&intermediateCodeType), sizeof(intermediateCodeType));
+    return getCachedFileName(hwInfo, input, options, internalOptions, tag, codeType, igcRevision, igcLibSize, igcLibMTime);
+}
+
 } // namespace NEO
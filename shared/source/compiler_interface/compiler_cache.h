@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,7 +9,9 @@
 
 #include "shared/source/os_interface/os_handle.h"
 #include "shared/source/utilities/arrayref.h"
+#include "shared/source/utilities/const_stringref.h"
 
+#include <atomic>
 #include <cstdint>
 #include <memory>
 #include <mutex>
@@ -26,10 +28,19 @@ struct CompilerCacheConfig {
     size_t cacheSize = 0;
 };
 
+struct CompilerCacheStatistics {
+    std::atomic<uint64_t> binaryHits{0u};
+    std::atomic<uint64_t> binaryMisses{0u};
+    std::atomic<uint64_t> intermediateRepresentationHits{0u};
+    std::atomic<uint64_t> intermediateRepresentationMisses{0u};
+};
+
 class CompilerCache {
   public:
+    static constexpr ConstStringRef intermediateRepresentationTag = "intermediate-representation";
+
     CompilerCache(const CompilerCacheConfig &config);
-    virtual ~CompilerCache() = default;
+    virtual ~CompilerCache();
 
     CompilerCache(const CompilerCache &) = delete;
     CompilerCache(CompilerCache &&) = delete;
@@ -38,6 +49,9 @@ class CompilerCache {
     const CompilerCacheConfig &getConfig() {
         return config;
     }
+    CompilerCacheStatistics &getStatistics() {
+        return statistics;
+    }
 
     const std::string getCachedFileName(const HardwareInfo &hwInfo, ArrayRef<const char> input,
                                         ArrayRef<const char> options, ArrayRef<const char> internalOptions,
@@ -47,6 +61,11 @@ class CompilerCache {
     MOCKABLE_VIRTUAL bool cacheBinary(const std::string &kernelFileHash, const char *pBinary, size_t binarySize);
     MOCKABLE_VIRTUAL std::unique_ptr<char[]> loadCachedBinary(const std::string &kernelFileHash, size_t &cachedBinarySize);
 
+    // Key of front end output, independent of specialization constants and distinct from keys of device binaries
+    const std::string getCachedIntermediateRepresentationFileName(const HardwareInfo &hwInfo, ArrayRef<const char> input,
+                                                                  ArrayRef<const char> options, ArrayRef<const char> internalOptions, uint64_t intermediateCodeType,
+                                                                  ArrayRef<const char> igcRevision, size_t igcLibSize, time_t igcLibMTime);
+
   protected:
     MOCKABLE_VIRTUAL bool evictCache(uint64_t &bytesEvicted);
     MOCKABLE_VIRTUAL bool renameTempFileBinaryToProperName(const std::string &oldName, const std::string &kernelFileHash);
@@ -55,5 +74,6 @@ class CompilerCache {
 
     static std::mutex cacheAccessMtx;
     CompilerCacheConfig config;
+    CompilerCacheStatistics statistics;
 };
 } // namespace NEO
@@ -80,12 +80,22 @@ TranslationOutput::ErrorCode CompilerInterface::build(
         }
     }
 
+    auto idsBuffer = CIF::Builtins::CreateConstBuffer(igcMain.get(), nullptr, 0);
+    auto valuesBuffer = CIF::Builtins::CreateConstBuffer(igcMain.get(), nullptr, 0);
+    for (const auto &specConst : input.specializedValues) {
+        idsBuffer->PushBackRawCopy(specConst.first);
+        valuesBuffer->PushBackRawCopy(specConst.second);
+    }
+    const ArrayRef<const char> specIdsRef(idsBuffer->GetMemory<char>(), idsBuffer->GetSize<char>());
+    const ArrayRef<const char> specValuesRef(valuesBuffer->GetMemory<char>(), valuesBuffer->GetSize<char>());
+
     std::string kernelFileHash;
     if (cachingMode == CachingMode::Direct) {
+        // specialization constants are consumed by backend only, so they are part of device binary key and not of intermediate representation key
         kernelFileHash = cache->getCachedFileName(device.getHardwareInfo(),
                                                   input.src,
                                                   input.apiOptions,
-                                                  input.internalOptions, ArrayRef<const char>(), ArrayRef<const char>(), igcRevision, igcLibSize, igcLibMTime);
+                                                  input.internalOptions, specIdsRef, specValuesRef, igcRevision, igcLibSize, igcLibMTime);
 
         bool success = CompilerCacheHelper::loadCacheAndSetOutput(*cache, kernelFileHash, output, device);
         if (success) {
@@ -97,13 +107,6 @@ TranslationOutput::ErrorCode CompilerInterface::build(
     auto fclOptions = CIF::Builtins::CreateConstBuffer(igcMain.get(), input.apiOptions.begin(), input.apiOptions.size());
     auto fclInternalOptions = CIF::Builtins::CreateConstBuffer(igcMain.get(), input.internalOptions.begin(), input.internalOptions.size());
 
-    auto idsBuffer = CIF::Builtins::CreateConstBuffer(igcMain.get(), nullptr, 0);
-    auto valuesBuffer = CIF::Builtins::CreateConstBuffer(igcMain.get(), nullptr, 0);
-    for (const auto &specConst : input.specializedValues) {
-        idsBuffer->PushBackRawCopy(specConst.first);
-        valuesBuffer->PushBackRawCopy(specConst.second);
-    }
-
     CIF::RAII::UPtr_t<CIF::Builtins::BufferSimple> intermediateRepresentation;
 
     if (srcCodeType == IGC::CodeType::oclC) {
@@ -111,25 +114,38 @@ TranslationOutput::ErrorCode CompilerInterface::build(
             intermediateCodeType = getPreferredIntermediateRepresentation(device);
         }
 
-        auto fclTranslationCtx = createFclTranslationCtx(device, srcCodeType, intermediateCodeType);
-        auto fclOutput = translate(fclTranslationCtx.get(), inSrc.get(),
-                                   fclOptions.get(), fclInternalOptions.get());
-
-        if (fclOutput == nullptr) {
-            return TranslationOutput::ErrorCode::unknownError;
+        // front end output is shared with compile() of the same source, so build missing device binary skips front end
+        std::string irFileHash;
+        if (cachingMode == CachingMode::Direct && isIntermediateRepresentationCacheEnabled()) {
+            irFileHash = getIntermediateRepresentationCacheFileName(device, input, intermediateCodeType);
         }
 
-        TranslationOutput::makeCopy(output.frontendCompilerLog, fclOutput->GetBuildLog());
+        if (false == irFileHash.empty() && loadCachedIntermediateRepresentation(irFileHash, intermediateCodeType, output)) {
+            intermediateRepresentation = CIF::Builtins::CreateConstBuffer(igcMain.get(), output.intermediateRepresentation.mem.get(), output.intermediateRepresentation.size);
+        } else {
+            auto fclTranslationCtx = createFclTranslationCtx(device, srcCodeType, intermediateCodeType);
+            auto fclOutput = translate(fclTranslationCtx.get(), inSrc.get(),
+                                       fclOptions.get(), fclInternalOptions.get());
 
-        if (fclOutput->Successful() == false) {
-            return TranslationOutput::ErrorCode::buildFailure;
-        }
+            if (fclOutput == nullptr) {
+                return TranslationOutput::ErrorCode::unknownError;
+            }
+
+            TranslationOutput::makeCopy(output.frontendCompilerLog, fclOutput->GetBuildLog());
 
-        output.intermediateCodeType = intermediateCodeType;
-        TranslationOutput::makeCopy(output.intermediateRepresentation, fclOutput->GetOutput());
+            if (fclOutput->Successful() == false) {
+                return TranslationOutput::ErrorCode::buildFailure;
+            }
+
+            output.intermediateCodeType = intermediateCodeType;
+            TranslationOutput::makeCopy(output.intermediateRepresentation, fclOutput->GetOutput());
+            if (false == irFileHash.empty()) {
+                cacheIntermediateRepresentation(irFileHash, output);
+            }
 
-        fclOutput->GetOutput()->Retain(); // will be used as input to compiler
-        intermediateRepresentation.reset(fclOutput->GetOutput());
+            fclOutput->GetOutput()->Retain(); // will be used as input to compiler
+            intermediateRepresentation.reset(fclOutput->GetOutput());
+        }
     } else {
         inSrc->Retain(); // will be used as input to compiler directly
         intermediateRepresentation.reset(inSrc.get());
@@ -138,8 +154,6 @@ TranslationOutput::ErrorCode CompilerInterface::build(
 
     if (cachingMode == CachingMode::PreProcess) {
         const ArrayRef<const char> irRef(intermediateRepresentation->GetMemory<char>(), intermediateRepresentation->GetSize<char>());
-        const ArrayRef<const char> specIdsRef(idsBuffer->GetMemory<char>(), idsBuffer->GetSize<char>());
-        const ArrayRef<const char> specValuesRef(valuesBuffer->GetMemory<char>(), valuesBuffer->GetSize<char>());
         kernelFileHash = cache->getCachedFileName(device.getHardwareInfo(), irRef,
                                                   input.apiOptions,
                                                   input.internalOptions, specIdsRef, specValuesRef, igcRevision, igcLibSize, igcLibMTime);
@@ -194,6 +208,15 @@ TranslationOutput::ErrorCode CompilerInterface::compile(
         outType = getPreferredIntermediateRepresentation(device);
     }
 
+    // sources with includes are not cached, as included files may change
+    std::string irFileHash;
+    if ((IGC::CodeType::oclC == input.srcType) && isIntermediateRepresentationCacheEnabled() && (std::strstr(input.src.begin(), "#include") == nullptr)) {
+        irFileHash = getIntermediateRepresentationCacheFileName(device, input, outType);
+        if (loadCachedIntermediateRepresentation(irFileHash, outType, output)) {
+            return TranslationOutput::ErrorCode::success;
+        }
+    }
+
     auto fclSrc = CIF::Builtins::CreateConstBuffer(fclMain.get(), input.src.begin(), input.src.size());
     auto fclOptions = CIF::Builtins::CreateConstBuffer(fclMain.get(), input.apiOptions.begin(), input.apiOptions.size());
     auto fclInternalOptions = CIF::Builtins::CreateConstBuffer(fclMain.get(), input.internalOptions.begin(), input.internalOptions.size());
@@ -215,6 +238,9 @@ TranslationOutput::ErrorCode CompilerInterface::compile(
 
     output.intermediateCodeType = outType;
     TranslationOutput::makeCopy(output.intermediateRepresentation, fclOutput->GetOutput());
+    if (false == irFileHash.empty()) {
+        cacheIntermediateRepresentation(irFileHash, output);
+    }
 
     return TranslationOutput::ErrorCode::success;
 }
@@ -597,6 +623,35 @@ void CompilerCacheHelper::packAndCacheBinary(CompilerCache &compilerCache, const
     }
 }
 
+bool CompilerInterface::isIntermediateRepresentationCacheEnabled() const {
+    return cache != nullptr && cache->getConfig().enabled && debugManager.flags.EnableIntermediateRepresentationCache.get() == 1;
+}
+
+std::string CompilerInterface::getIntermediateRepresentationCacheFileName(const Device &device, const TranslationInput &input, IGC::CodeType::CodeType_t intermediateCodeType) {
+    return cache->getCachedIntermediateRepresentationFileName(device.getHardwareInfo(), input.src, input.apiOptions, input.internalOptions,
+                                                              static_cast<uint64_t>(intermediateCodeType), igcRevision, igcLibSize, igcLibMTime);
+}
+
+bool CompilerInterface::loadCachedIntermediateRepresentation(const std::string &irFileHash, IGC::CodeType::CodeType_t intermediateCodeType, TranslationOutput &output) {
+    size_t cachedIrSize = 0u;
+    auto cachedIr = cache->loadCachedBinary(irFileHash, cachedIrSize);
+    if (cachedIr == nullptr || cachedIrSize == 0u) {
+        cache->getStatistics().intermediateRepresentationMisses++;
+        return false;
+    }
+    cache->getStatistics().intermediateRepresentationHits++;
+    output.intermediateCodeType = intermediateCodeType;
+    output.intermediateRepresentation.mem = std::move(cachedIr);
+    output.intermediateRepresentation.size = cachedIrSize;
+    return true;
+}
+
+void CompilerInterface::cacheIntermediateRepresentation(const std::string &irFileHash, const TranslationOutput &output) {
+    if (output.intermediateRepresentation.mem && output.intermediateRepresentation.size > 0u) {
+        cache->cacheBinary(irFileHash, output.intermediateRepresentation.mem.get(), output.intermediateRepresentation.size);
+    }
+}
+
 bool CompilerCacheHelper::loadCacheAndSetOutput(CompilerCache &compilerCache, const std::string &kernelFileHash, NEO::TranslationOutput &output, const NEO::Device &device) {
     size_t cacheBinarySize = 0u;
     auto cacheBinary = compilerCache.loadCachedBinary(kernelFileHash, cacheBinarySize);
@@ -607,15 +662,18 @@ bool CompilerCacheHelper::loadCacheAndSetOutput(CompilerCache &compilerCache, co
         if (isDeviceBinaryFormat<DeviceBinaryFormat::oclElf>(archive)) {
             bool success = processPackedCacheBinary(archive, output, device);
             if (success) {
+                compilerCache.getStatistics().binaryHits++;
                 return true;
             }
         } else {
             output.deviceBinary.mem = std::move(cacheBinary);
             output.deviceBinary.size = cacheBinarySize;
+            compilerCache.getStatistics().binaryHits++;
             return true;
         }
     }
 
+    compilerCache.getStatistics().binaryMisses++;
     return false;
 }
 
@@ -176,6 +176,13 @@ class CompilerInterface {
     MOCKABLE_VIRTUAL CIF::RAII::UPtr_t<IGC::IgcOclTranslationCtxTagOCL> createIgcTranslationCtx(const Device &device,
                                                                                                 IGC::CodeType::CodeType_t inType,
                                                                                                 IGC::CodeType::CodeType_t outType);
+
+    // Second cache tier keeping front end output of sources without includes, shared by compile() and build()
+    bool isIntermediateRepresentationCacheEnabled() const;
+    std::string getIntermediateRepresentationCacheFileName(const Device &device, const TranslationInput &input, IGC::CodeType::CodeType_t intermediateCodeType);
+    bool loadCachedIntermediateRepresentation(const std::string &irFileHash, IGC::CodeType::CodeType_t intermediateCodeType, TranslationOutput &output);
+    void cacheIntermediateRepresentation(const std::string &irFileHash, const TranslationOutput &output);
+
     bool isFclAvailable() const {
         return (fclMain != nullptr);
     }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -9,6 +9,7 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/compiler_interface/external_functions.h"
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/device_binary_format/zebin/zebin_elf.h"
 #include "shared/source/helpers/blit_commands_helper.h"
@@ -22,10 +23,14 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/program/program_info.h"
 #include "shared/source/release_helper/release_helper.h"
+#include "shared/source/utilities/thread_pool.h"
 
 #include "RelocationInfo.h"
 
+#include <algorithm>
+#include <memory>
 #include <sstream>
+#include <thread>
 #include <unordered_map>
 
 namespace NEO {
@@ -534,6 +539,87 @@ void Linker::patchDataSegments(const SegmentInfo &globalVariablesSegInfo, const
     }
 }
 
+DynamicLinkSymbolTable::SymbolId DynamicLinkSymbolTable::internSymbolName(const std::string &symbolName) {
+    auto [it, inserted] = symbolIds.try_emplace(symbolName, static_cast<SymbolId>(definitions.size()));
+    if (inserted) {
+        definitions.emplace_back();
+    }
+    return it->second;
+}
+
+DynamicLinkSymbolTable::SymbolId DynamicLinkSymbolTable::findSymbolId(const std::string &symbolName) const {
+    auto it = symbolIds.find(symbolName);
+    return it != symbolIds.end() ? it->second : invalidSymbolId;
+}
+
+void DynamicLinkSymbolTable::addModuleSymbols(const void *module, const Linker::RelocatedSymbolsMap &symbols) {
+    for (auto &[symbolName, relocatedSymbol] : symbols) {
+        auto &definition = definitions[internSymbolName(symbolName)];
+        if (definition.exportingModule == nullptr) {
+            definition.gpuAddress = relocatedSymbol.gpuAddress;
+            definition.exportingModule = module;
+        }
+    }
+}
+
+const DynamicLinkSymbolTable::SymbolDefinition *DynamicLinkSymbolTable::findDefinition(SymbolId symbolId) const {
+    if (symbolId >= definitions.size() || definitions[symbolId].exportingModule == nullptr) {
+        return nullptr;
+    }
+    return &definitions[symbolId];
+}
+
+namespace {
+struct PatchingChunk {
+    const ResolvedExternal *begin = nullptr;
+    const ResolvedExternal *end = nullptr;
+};
+
+void patchChunk(const PatchingChunk &chunk) {
+    for (auto resolvedExternal = chunk.begin; resolvedExternal != chunk.end; resolvedExternal++) {
+        Linker::patchAddress(resolvedExternal->relocAddress, resolvedExternal->value, *resolvedExternal->relocation);
+    }
+}
+
+} // namespace
+
+uint32_t getThreadsCountForPatching(size_t relocationsCount) {
+    if (debugManager.flags.DynamicLinkPatchingThreads.get() > 0) {
+        return static_cast<uint32_t>(debugManager.flags.DynamicLinkPatchingThreads.get());
+    }
+    if (relocationsCount < minRelocationsForParallelPatching) {
+        return 1u;
+    }
+    auto hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    auto threadsForRelocations = static_cast<uint32_t>(std::min(relocationsCount / minRelocationsForParallelPatching + 1, static_cast<size_t>(maxDynamicLinkPatchingThreads)));
+    return std::min(threadsForRelocations, hardwareThreads);
+}
+
+void patchResolvedExternals(const ResolvedExternals &resolvedExternals, uint32_t threadsCount, ThreadPool *threadPool) {
+    if (resolvedExternals.empty()) {
+        return;
+    }
+    threadsCount = static_cast<uint32_t>(std::min(static_cast<size_t>(std::max(threadsCount, 1u)), resolvedExternals.size()));
+    auto relocationsPerThread = (resolvedExternals.size() + threadsCount - 1) / threadsCount;
+
+    std::vector<PatchingChunk> chunks;
+    chunks.reserve(threadsCount);
+    for (size_t first = 0u; first < resolvedExternals.size(); first += relocationsPerThread) {
+        auto last = std::min(resolvedExternals.size(), first + relocationsPerThread);
+        chunks.push_back({resolvedExternals.data() + first, resolvedExternals.data() + last});
+    }
+
+    if (threadPool == nullptr || chunks.size() == 1u) {
+        for (auto &chunk : chunks) {
+            patchChunk(chunk);
+        }
+        return;
+    }
+    threadPool->parallelFor(chunks.size(), [&chunks](size_t chunkIndex) {
+        patchChunk(chunks[chunkIndex]);
+    });
+}
+
 std::string constructLinkerErrorMessage(const Linker::UnresolvedExternals &unresolvedExternals, const std::vector<std::string> &instructionsSegmentsNames) {
     std::stringstream errorStream;
     if (unresolvedExternals.size() == 0) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -23,6 +23,7 @@ struct ExternalFunctionUsageKernel;
 
 class Device;
 class GraphicsAllocation;
+class ThreadPool;
 struct KernelDescriptor;
 struct ProgramInfo;
 
@@ -265,6 +266,53 @@ struct Linker {
     std::unordered_map<uint32_t /*ISA segment id*/, StackVec<uint32_t *, 2> /*implicit args relocation address to patch*/> pImplicitArgsRelocationAddresses;
 };
 
+// Global table of symbols exported by a set of dynamically linked modules.
+// Symbol names are interned into dense ids, so every unresolved external is resolved
+// with a single lookup instead of scanning symbols of each module in the link.
+class DynamicLinkSymbolTable {
+  public:
+    using SymbolId = uint32_t;
+    static constexpr SymbolId invalidSymbolId = std::numeric_limits<SymbolId>::max();
+
+    struct SymbolDefinition {
+        uint64_t gpuAddress = std::numeric_limits<uint64_t>::max();
+        const void *exportingModule = nullptr;
+    };
+
+    SymbolId internSymbolName(const std::string &symbolName);
+    SymbolId findSymbolId(const std::string &symbolName) const;
+
+    // Symbol defined by more than one module resolves to the module added first
+    void addModuleSymbols(const void *module, const Linker::RelocatedSymbolsMap &symbols);
+    const SymbolDefinition *findDefinition(SymbolId symbolId) const;
+    const SymbolDefinition *findDefinition(const std::string &symbolName) const {
+        return findDefinition(findSymbolId(symbolName));
+    }
+
+    size_t getSymbolsCount() const {
+        return definitions.size();
+    }
+
+  protected:
+    std::unordered_map<std::string, SymbolId> symbolIds;
+    std::vector<SymbolDefinition> definitions;
+};
+
+struct ResolvedExternal {
+    void *relocAddress = nullptr;
+    uint64_t value = 0u;
+    const Linker::RelocationInfo *relocation = nullptr;
+};
+using ResolvedExternals = std::vector<ResolvedExternal>;
+
+inline constexpr size_t minRelocationsForParallelPatching = 4096u;
+inline constexpr uint32_t maxDynamicLinkPatchingThreads = 8u;
+
+uint32_t getThreadsCountForPatching(size_t relocationsCount);
+// Relocations are split evenly between threadsCount chunks patched on thread pool, each relocation has to target distinct bytes;
+// chunks are patched on calling thread when no thread pool is given
+void patchResolvedExternals(const ResolvedExternals &resolvedExternals, uint32_t threadsCount, ThreadPool *threadPool);
+
 std::string constructLinkerErrorMessage(const Linker::UnresolvedExternals &unresolvedExternals, const std::vector<std::string> &instructionsSegmentsNames);
 std::string constructRelocationsDebugMessage(const Linker::RelocatedSymbolsMap &relocatedSymbols);
 
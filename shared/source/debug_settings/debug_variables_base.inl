@@ -140,6 +140,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, GpuScratchRegWriteRegisterData, 0, "register dat
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideSlmAllocationSize, -1, "-1: default, >=0: program value for shared local memory size")
 DECLARE_DEBUG_VARIABLE(int32_t, DebuggerLogBitmask, 0, "0: logs disabled, 1 - INFO, 2 - ERROR, 1<<10 - Dump elf, see DebugVariables::DEBUGGER_LOG_BITMASK")
 DECLARE_DEBUG_VARIABLE(int32_t, DebuggerForceSbaTrackingMode, -1, "-1: default, 0: per context address spaces, 1: single address space")
+DECLARE_DEBUG_VARIABLE(int32_t, DebuggerEnableStateSaveAreaCache, -1, "-1: default (disabled), 0: disabled, 1: cache state save area per VM and read only thread slots of stopped or requested threads, invalidated on resume")
+DECLARE_DEBUG_VARIABLE(int32_t, DebuggerStateSaveAreaReadThreads, -1, "-1: default (4), >0: max number of threads reading disjoint state save area ranges in parallel")
 DECLARE_DEBUG_VARIABLE(int32_t, DebugApiUsed, 0, "0: default L0 Debug API not used, 1: L0 Debug API used")
 DECLARE_DEBUG_VARIABLE(int32_t, OverrideCsrAllocationSize, -1, "-1: default, >0: use value for size of CSR allocation")
 DECLARE_DEBUG_VARIABLE(int32_t, CFEComputeOverdispatchDisable, -1, "Set Compute Overdispatch Disable field in CFE_STATE, -1: do not set.")
@@ -202,6 +204,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, Force2dImageAsArray, -1, "-1: default, 0: WA Dis
 DECLARE_DEBUG_VARIABLE(int32_t, ForceExtendedBufferSize, -1, "-1: default, 0: disabled, >=1: Forces extended buffer size by specified pageSize number in clCreateBuffer, clCreateBufferWithProperties and clCreateBufferWithPropertiesINTEL calls")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceExtendedUSMBufferSize, -1, "-1: default, 0: disabled, >=1: Forces extended buffer size by specified pageSize number in USM calls")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceExtendedKernelIsaSize, -1, "-1: default, 0: disabled, >=1: Forces extended kernel isa size by specified pageSize number")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableKernelIsaDeduplication, -1, "-1: default, 0: disabled, 1: kernels with identical ISA in modules created on the same root device share single ISA allocation")
 DECLARE_DEBUG_VARIABLE(int32_t, ForceSimdMessageSizeInWalker, -1, "-1: default, >=0 Program given value in Walker command for SIMD size")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableRecoverablePageFaults, -1, "-1: default - ignore, 0: disable, 1: enable recoverable page faults on all VMs (on faultable hardware)")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableImplicitMigrationOnFaultableHardware, -1, "-1: default - ignore, 0: disable, 1: enable implicit migration on faultable hardware (for all allocations)")
@@ -379,7 +382,29 @@ DECLARE_DEBUG_VARIABLE(int32_t, UseImmediateFlushTask, -1, "-1: default, 0: use
 DECLARE_DEBUG_VARIABLE(int32_t, SkipDcFlushOnBarrierWithoutEvents, -1, "-1: default (enabled), 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDeviceUsmAllocationPool, -1, "-1: default (enabled, 1MB), 0: disabled, >=1: enabled, size in MB")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableHostUsmAllocationPool, -1, "-1: default (enabled, 1MB), 0: disabled, >=1: enabled, size in MB")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableUsmAllocationPoolsManager, -1, "-1: default (disabled), 0: disabled, 1: enabled. Serve host and device USM allocations from growing pools in 64KB, 2MB and 16MB size tiers instead of single fixed size pools")
+DECLARE_DEBUG_VARIABLE(int32_t, UsmAllocationPoolsManagerMaxIdleTime, -1, "Release empty pools of USM allocation pools manager after X ms without allocations, one empty pool per size tier is kept, -1: default (1000 ms), 0: release immediately")
 DECLARE_DEBUG_VARIABLE(int32_t, UseLocalPreferredForCacheableBuffers, -1, "Use localPreferred for cacheable buffers")
+DECLARE_DEBUG_VARIABLE(int32_t, DriverThreadPoolSize, -1, "-1: default (number of cpu threads, up to 4), 0: disabled, tasks are executed synchronously, >0: number of threads in driver thread pool used for background initialization")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableBindlessStateCache, -1, "-1: default (disabled), 0: disabled, 1: enabled. Share bindless heap slots between sampler states with identical content")
+DECLARE_DEBUG_VARIABLE(int32_t, TagAllocatorMagazineSize, -1, "-1: default (disabled), >0: number of free tag nodes cached per magazine in TagAllocator (magazines are selected by thread id hash), refilled and flushed in batches of half this size")
+DECLARE_DEBUG_VARIABLE(int32_t, TagAllocatorSlabSize, -1, "-1: default, >0: number of tags allocated in a single graphics allocation when TagAllocator grows")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableImmediateCmdListCapture, -1, "-1: default (disabled), 0: disabled, 1: record recurring sequences of kernel launches on immediate command list into regular command lists and replay them with patched arguments")
+DECLARE_DEBUG_VARIABLE(bool, PrintImmediateCmdListCaptureStatistics, false, "Prints number of replayed and recorded sequences of immediate command list capture when command list is destroyed")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDispatchHeapDataReuse, -1, "-1: default (disabled), 0: disabled, 1: point dispatch to indirect data and surface states of previous dispatch instead of copying them again when they are identical")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableGpuVaArenas, -1, "Sub-allocate small GPU VA ranges of standard heaps from per thread arenas, -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAdaptiveScratchSpace, -1, "Grow scratch space geometrically, shrink it when underutilized and reuse outgrown scratch allocations, -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, AdaptiveScratchSpaceShrinkSubmissions, -1, "Number of consecutive submissions requiring at most quarter of scratch space after which it is shrunk, -1: default (64)")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableCpuTiledImageCopy, -1, "Service blocking image writes and reads without dependencies with CPU tiling/detiling copy when image storage is host accessible, -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, CpuTiledImageCopyThreads, -1, "Number of threads used by CPU tiling/detiling copy of a single image, -1: default (based on copy size), >0: threads count")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableIpcImportCache, -1, "Cache buffer objects imported from IPC handles for reopening, -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, IpcImportCacheMaxIdleEntries, -1, "Number of closed IPC imports kept in cache before least recently closed ones are released, -1: default (64), >=0: count")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableAsyncPrintf, -1, "Copy kernel printf output into a ring of records formatted by a background drainer thread, -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, AsyncPrintfBinarySink, -1, "Write raw printf records with string tables to async printf sink for offline formatting, -1: default (text), 0: text, 1: binary")
+DECLARE_DEBUG_VARIABLE(std::string, AsyncPrintfSinkFile, std::string("unk"), "Output file of async printf drainer; stdout when unk")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableDynamicLinkSymbolTable, -1, "Resolve dynamic link of modules through a global interned symbol table, patch relocations in parallel and skip re-linking of the same modules set, -1: default (disabled), 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, DynamicLinkPatchingThreads, -1, "Number of threads used to patch relocations resolved by dynamic link, -1: default (based on relocations count), >0: threads count")
+DECLARE_DEBUG_VARIABLE(int32_t, EnableIntermediateRepresentationCache, -1, "Cache front end output of sources without includes as a second compiler cache tier reused when device binary is not cached, -1: default (disabled), 0: disabled, 1: enabled")
 
 /*DIRECT SUBMISSION FLAGS*/
 DECLARE_DEBUG_VARIABLE(int32_t, EnableDirectSubmission, -1, "-1: default (disabled), 0: disable, 1:enable. Enables direct submission of command buffers bypassing KMD")
@@ -404,6 +429,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerTimeout, -1, "Set dire
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerMaxTimeout, -1, "Set direct submission controller max timeout - timeout will increase up to given value, -1: default 5000 us, >=0: max timeout in us")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerDivisor, -1, "Set direct submission controller timeout divider, -1: default 1, >0: divider value")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerAdjustOnThrottleAndAcLineStatus, -1, "Adjust controller timeout settings based on queue throttle and ac line status, -1: default, 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerPredictive, -1, "Terminate each ring on its own deadline predicted from engine submission gaps instead of periodic polling, -1: default - disabled, 0: disabled, 1: enabled")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionControllerPrintDecisions, -1, "Print predictive controller termination and restart decisions to stdout, -1: default - disabled, 0: disabled, 1: enabled")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionForceLocalMemoryStorageMode, -1, "Force local memory storage for command/ring/semaphore buffer, -1: default - for all engines, 0: disabled, 1: for multiOsContextCapable engine, 2: for all engines")
 DECLARE_DEBUG_VARIABLE(int32_t, EnableRingSwitchTagUpdateWa, -1, "-1: default, 0 - disable, 1 - enable. If enabled, completionFences wont be updated if ring is not running.")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionPCIBarrier, -1, "Use PCI barrier for data synchronization before semaphore unblock -1: default, 0 - disable, 1 - enable.")
@@ -417,6 +444,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionRelaxedOrderingQueueSizeLimit, -
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionRelaxedOrderingMinNumberOfClients, -1, "-1: default, >0: Enables RelaxedOrdering mode only if specified number of clients is assigned to given CSR.")
 DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionMonitorFenceInputPolicy, -1, "-1: default, 0: stalling command flag, 1: explicit monitor fence flag. Selects policy to dispatch monitor fence upon input flag, either for every stalling command or explicit motor fence dispatch")
 DECLARE_DEBUG_VARIABLE(bool, DirectSubmissionPrintBuffers, false, "Print address of submitted command buffers")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionCoalescingWindow, -1, "Defer semaphore release of submissions arriving within given time of previous one and release them together, last deferred one is released on wait for completion or by direct submission controller, -1: default (disabled), >0: window in us")
+DECLARE_DEBUG_VARIABLE(int32_t, DirectSubmissionMaxCoalescedSubmissions, -1, "Max number of submissions released with single semaphore update when coalescing is enabled, -1: default (8), >0: submissions count")
 
 /*FEATURE FLAGS*/
 DECLARE_DEBUG_VARIABLE(bool, USMEvictAfterMigration, false, "Evict USM allocation after implicit migration to GPU")
@@ -532,6 +561,8 @@ DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalSetWalkerPartitionType, -1, "Experim
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableCustomLocalMemoryAlignment, 0, "Align local memory allocations to a given value. Works only with allocations at least as big as the value.  0: no effect, 2097152: 2 megabytes, 1073741824: 1 gigabyte")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableDeviceAllocationCache, -1, "Experimentally enable device usm allocation cache. Use X% of device memory.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalEnableHostAllocationCache, -1, "Experimentally enable host usm allocation cache. Use X% of shared system memory.")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalUsmAllocationCacheMaxIdleTime, -1, "Release usm allocations kept in cache for longer than X ms, -1: default (10000 ms), 0: disabled")
+DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalUsmAllocationCacheMemoryPressureThreshold, -1, "Trim device usm allocation cache when local memory usage exceeds X% of device memory, -1: default (90%), 0: disabled")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalH2DCpuCopyThreshold, -1, "Override default threshold (in bytes) for H2D CPU copy.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalD2HCpuCopyThreshold, -1, "Override default threshold (in bytes) for D2H CPU copy.")
 DECLARE_DEBUG_VARIABLE(int32_t, ExperimentalCopyThroughLock, -1, "Experimentally copy memory through locked ptr. -1: default 0: disable 1: enable ")
@@ -613,6 +644,7 @@ DECLARE_DEBUG_VARIABLE(int32_t, ForcePreferredAllocationMethod, -1, "Sets prefer
 DECLARE_DEBUG_VARIABLE(int32_t, EventTimestampRefreshIntervalInMilliSec, -1, "-1: use driver default, This value sets the refresh interval for getting synchronized GPU and CPU timestamp")
 /* Binary Cache */
 DECLARE_DEBUG_VARIABLE(bool, BinaryCacheTrace, false, "enable cl_cache to produce .trace files with information about hash computation")
+DECLARE_DEBUG_VARIABLE(int32_t, PrintCompilerCacheStatistics, -1, "Print compiler cache binary and intermediate representation tiers hits and misses when cache is destroyed, -1: default (disabled), 0: disabled, 1: enabled")
 
 /* WORKAROUND FLAGS */
 DECLARE_DEBUG_VARIABLE(int32_t, ForceDummyBlitWa, -1, "-1: default, 0: disabled, 1: enabled, Forces a workaround with dummy blits, driver adds an extra blit before command MI_ARB_CHECK on bcs")
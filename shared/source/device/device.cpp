@@ -27,6 +27,7 @@
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/os_time.h"
+#include "shared/source/program/isa_allocation_cache.h"
 #include "shared/source/program/sync_buffer_handler.h"
 #include "shared/source/utilities/software_tags_manager.h"
 
@@ -69,6 +70,7 @@ Device::~Device() {
     subdevices.clear();
 
     syncBufferHandler.reset();
+    isaAllocationCache.reset();
     commandStreamReceivers.clear();
     executionEnvironment->memoryManager->waitForDeletions();
 
@@ -225,6 +227,11 @@ bool Device::createDeviceImpl() {
 
     getRootDeviceEnvironmentRef().initOsTime();
 
+    if (!isSubDevice()) {
+        // shared by all subdevices, created upfront so concurrent module creation needs no extra locking
+        isaAllocationCache = std::make_unique<IsaAllocationCache>(*getMemoryManager());
+    }
+
     initializeCaps();
 
     if (!createEngines()) {
@@ -708,6 +715,10 @@ void Device::allocateSyncBufferHandler() {
     }
 }
 
+IsaAllocationCache *Device::getIsaAllocationCache() const {
+    return getRootDevice()->isaAllocationCache.get();
+}
+
 uint64_t Device::getGlobalMemorySize(uint32_t deviceBitfield) const {
     auto globalMemorySize = getMemoryManager()->isLocalMemorySupported(this->getRootDeviceIndex())
                                 ? getMemoryManager()->getLocalMemorySize(this->getRootDeviceIndex(), deviceBitfield)
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -26,6 +26,7 @@ class ExecutionEnvironment;
 class Debugger;
 class GmmClientContext;
 class GmmHelper;
+class IsaAllocationCache;
 class SyncBufferHandler;
 enum class EngineGroupType : uint32_t;
 class DebuggerL0;
@@ -144,6 +145,7 @@ class Device : public ReferenceTrackedObject<Device> {
     MOCKABLE_VIRTUAL CompilerInterface *getCompilerInterface() const;
     BuiltIns *getBuiltIns() const;
     void allocateSyncBufferHandler();
+    IsaAllocationCache *getIsaAllocationCache() const;
 
     uint32_t getRootDeviceIndex() const {
         return this->rootDeviceIndex;
@@ -162,6 +164,7 @@ class Device : public ReferenceTrackedObject<Device> {
 
     static decltype(&PerformanceCounters::create) createPerformanceCountersFunc;
     std::unique_ptr<SyncBufferHandler> syncBufferHandler;
+    std::unique_ptr<IsaAllocationCache> isaAllocationCache;
     GraphicsAllocation *getRTMemoryBackedBuffer() { return rtMemoryBackedBuffer; }
     RTDispatchGlobalsInfo *getRTDispatchGlobals(uint32_t maxBvhLevels);
     bool rayTracingIsInitialized() const { return rtMemoryBackedBuffer != nullptr; }
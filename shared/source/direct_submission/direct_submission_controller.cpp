@@ -9,15 +9,65 @@
 
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/engine_node_helper.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/source/os_interface/os_thread.h"
 #include "shared/source/os_interface/product_helper.h"
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
 namespace NEO {
 
+void SubmissionGapHistogram::recordSubmission(SteadyClock::time_point timestamp) {
+    auto previousTimestamp = lastSubmissionTimestamp.load(std::memory_order_relaxed);
+    lastSubmissionTimestamp.store(timestamp.time_since_epoch().count(), std::memory_order_relaxed);
+    if (previousTimestamp == 0) {
+        return;
+    }
+
+    auto gap = std::chrono::duration_cast<std::chrono::microseconds>(timestamp - SteadyClock::time_point(SteadyClock::duration(previousTimestamp)));
+    size_t bucket = 0u;
+    while (bucket < bucketsCount - 1 && gap >= minGap * (1ll << bucket)) {
+        bucket++;
+    }
+
+    auto samples = samplesCount.load(std::memory_order_relaxed) + 1;
+    buckets[bucket].store(buckets[bucket].load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    if (samples >= maxSamples) {
+        samples = 0u;
+        for (auto &count : buckets) {
+            auto halved = count.load(std::memory_order_relaxed) / 2;
+            count.store(halved, std::memory_order_relaxed);
+            samples += halved;
+        }
+    }
+    samplesCount.store(samples, std::memory_order_relaxed);
+}
+
+std::chrono::microseconds SubmissionGapHistogram::getGapPercentile(uint32_t percent) const {
+    uint64_t samples = 0u;
+    std::array<uint32_t, bucketsCount> counts;
+    for (size_t bucket = 0u; bucket < bucketsCount; bucket++) {
+        counts[bucket] = buckets[bucket].load(std::memory_order_relaxed);
+        samples += counts[bucket];
+    }
+    if (samples == 0u) {
+        return std::chrono::microseconds::max();
+    }
+
+    auto requiredSamples = (samples * percent + 99) / 100;
+    uint64_t coveredSamples = 0u;
+    for (size_t bucket = 0u; bucket < bucketsCount - 1; bucket++) {
+        coveredSamples += counts[bucket];
+        if (coveredSamples >= requiredSamples) {
+            return minGap * (1ll << bucket);
+        }
+    }
+    return std::chrono::microseconds::max();
+}
+
 DirectSubmissionController::DirectSubmissionController() {
     if (debugManager.flags.DirectSubmissionControllerTimeout.get() != -1) {
         timeout = std::chrono::microseconds{debugManager.flags.DirectSubmissionControllerTimeout.get()};
@@ -33,11 +83,15 @@ DirectSubmissionController::DirectSubmissionController() {
         adjustTimeoutOnThrottleAndAcLineStatus = debugManager.flags.DirectSubmissionControllerAdjustOnThrottleAndAcLineStatus.get();
     }
 
+    predictiveTermination = debugManager.flags.DirectSubmissionControllerPredictive.get() == 1;
+    printDecisions = debugManager.flags.DirectSubmissionControllerPrintDecisions.get() == 1;
+
     directSubmissionControllingThread = Thread::create(controlDirectSubmissionsState, reinterpret_cast<void *>(this));
 };
 
 DirectSubmissionController::~DirectSubmissionController() {
     keepControlling.store(false);
+    notifyDirectSubmissionStarted();
     if (directSubmissionControllingThread) {
         directSubmissionControllingThread->join();
         directSubmissionControllingThread.reset();
@@ -48,6 +102,7 @@ void DirectSubmissionController::registerDirectSubmission(CommandStreamReceiver
     std::lock_guard<std::mutex> lock(directSubmissionsMutex);
     directSubmissions.insert(std::make_pair(csr, DirectSubmissionState{}));
     this->adjustTimeout(csr);
+    this->notifyDirectSubmissionStarted();
 }
 
 void DirectSubmissionController::setTimeoutParamsForPlatform(const ProductHelper &helper) {
@@ -84,6 +139,23 @@ void DirectSubmissionController::unregisterDirectSubmission(CommandStreamReceive
 
 void DirectSubmissionController::startControlling() {
     this->runControlling.store(true);
+    this->notifyDirectSubmissionStarted();
+}
+
+void DirectSubmissionController::notifyDirectSubmissionStarted() {
+    if (!this->predictiveTermination) {
+        return;
+    }
+    {
+        std::lock_guard<std::mutex> lock(this->wakeupMutex);
+        this->wakeupRequested = true;
+    }
+    this->wakeupCondition.notify_one();
+}
+
+DirectSubmissionTerminationStatistics DirectSubmissionController::getTerminationStatistics() {
+    std::lock_guard<std::mutex> lock(this->directSubmissionsMutex);
+    return this->terminationStatistics;
 }
 
 void *DirectSubmissionController::controlDirectSubmissionsState(void *self) {
@@ -108,12 +180,18 @@ void *DirectSubmissionController::controlDirectSubmissionsState(void *self) {
 }
 
 void DirectSubmissionController::checkNewSubmissions() {
+    if (this->predictiveTermination) {
+        this->checkNewSubmissionsPredictive();
+        return;
+    }
+
     std::lock_guard<std::mutex> lock(this->directSubmissionsMutex);
     bool shouldRecalculateTimeout = false;
     CommandStreamReceiver *csr = nullptr;
     for (auto &directSubmission : this->directSubmissions) {
         csr = directSubmission.first;
         auto &state = directSubmission.second;
+        csr->releaseCoalescedDirectSubmissions(true);
 
         auto taskCount = csr->peekTaskCount();
         if (taskCount == state.taskCount) {
@@ -140,7 +218,84 @@ void DirectSubmissionController::checkNewSubmissions() {
     }
 }
 
+void DirectSubmissionController::checkNewSubmissionsPredictive() {
+    std::lock_guard<std::mutex> lock(this->directSubmissionsMutex);
+    const auto now = this->getCpuTimestamp();
+    std::optional<SteadyClock::time_point> nextWakeup;
+
+    for (auto &[csr, state] : this->directSubmissions) {
+        csr->releaseCoalescedDirectSubmissions(true);
+        auto submissionGaps = csr->getDirectSubmissionGapHistogram();
+        auto taskCount = csr->peekTaskCount();
+        if (taskCount != state.taskCount) {
+            auto lastActivity = (submissionGaps && submissionGaps->hasSubmissions()) ? submissionGaps->getLastSubmissionTimestamp() : now;
+            if (state.isStopped && state.terminatedByController) {
+                auto idleTime = std::chrono::duration_cast<std::chrono::microseconds>(lastActivity - state.lastActivityTimestamp);
+                bool premature = idleTime <= this->maxTimeout;
+                this->terminationStatistics.restarts++;
+                this->terminationStatistics.prematureTerminations += premature ? 1u : 0u;
+                PRINT_DEBUG_STRING(this->printDecisions, stdout, "DirectSubmissionController: restart %s after %lld us idle%s\n",
+                                   EngineHelpers::engineTypeToString(csr->getOsContext().getEngineType()).c_str(), static_cast<long long>(idleTime.count()), premature ? ", premature termination" : "");
+            }
+            state.isStopped = false;
+            state.terminatedByController = false;
+            state.taskCount = taskCount;
+            state.lastActivityTimestamp = lastActivity;
+            state.predictedTimeout = this->predictTimeout(submissionGaps);
+        }
+        if (state.isStopped) {
+            continue;
+        }
+
+        auto deadline = state.lastActivityTimestamp + state.predictedTimeout;
+        if (now < deadline) {
+            nextWakeup = nextWakeup ? std::min(*nextWakeup, deadline) : deadline;
+            continue;
+        }
+
+        auto csrLock = csr->obtainUniqueOwnership();
+        csr->stopDirectSubmission(false);
+        state.isStopped = true;
+        state.terminatedByController = true;
+        this->terminationStatistics.terminations++;
+        PRINT_DEBUG_STRING(this->printDecisions, stdout, "DirectSubmissionController: terminate %s after %lld us idle, predicted timeout %lld us, gap samples %u\n",
+                           EngineHelpers::engineTypeToString(csr->getOsContext().getEngineType()).c_str(),
+                           static_cast<long long>(std::chrono::duration_cast<std::chrono::microseconds>(now - state.lastActivityTimestamp).count()),
+                           static_cast<long long>(state.predictedTimeout.count()), submissionGaps ? submissionGaps->getSamplesCount() : 0u);
+    }
+    this->nextWakeupTimestamp = nextWakeup;
+}
+
+std::chrono::microseconds DirectSubmissionController::predictTimeout(const SubmissionGapHistogram *submissionGaps) const {
+    if (submissionGaps == nullptr || submissionGaps->getSamplesCount() < minSamplesForPrediction) {
+        return this->timeout;
+    }
+
+    auto likelyGap = submissionGaps->getGapPercentile(predictionPercentile);
+    if (likelyGap <= this->maxTimeout) {
+        return std::max(likelyGap, minPredictedTimeout);
+    }
+    // when most gaps are longer than ring may spin, keeping it alive would not avoid restarts
+    if (submissionGaps->getGapPercentile(50u) > this->maxTimeout) {
+        return minPredictedTimeout;
+    }
+    return this->maxTimeout;
+}
+
 void DirectSubmissionController::sleep() {
+    if (this->predictiveTermination) {
+        std::unique_lock<std::mutex> lock(this->wakeupMutex);
+        auto wakeupPredicate = [this] { return this->wakeupRequested || !this->keepControlling.load(); };
+        if (this->nextWakeupTimestamp) {
+            this->wakeupCondition.wait_until(lock, *this->nextWakeupTimestamp, wakeupPredicate);
+        } else {
+            // ring may be started without waking controller up (task count is published after notification,
+            // rings started on initialization do not notify), so stopped rings are still checked every timeout
+            this->wakeupCondition.wait_for(lock, this->timeout, wakeupPredicate);
+        }
+        this->wakeupRequested = false;
+        return;
+    }
     std::this_thread::sleep_for(std::chrono::microseconds(this->timeout));
 }
 
@@ -14,8 +14,10 @@
 #include <array>
 #include <atomic>
 #include <chrono>
+#include <condition_variable>
 #include <memory>
 #include <mutex>
+#include <optional>
 #include <unordered_map>
 
 namespace NEO {
@@ -33,9 +35,38 @@ struct TimeoutParams {
     bool directSubmissionEnabled;
 };
 
+// Gaps between consecutive submissions on one engine. Written only by the submitting thread (under CSR ownership),
+// read concurrently by the controller. Bucket i counts gaps shorter than minGap << i, the last one all longer gaps.
+struct SubmissionGapHistogram {
+    static constexpr size_t bucketsCount = 16u;
+    static constexpr std::chrono::microseconds minGap{16};
+    static constexpr uint32_t maxSamples = 256u; // counts are halved when reached, so recent load dominates
+
+    void recordSubmission(SteadyClock::time_point timestamp);
+    // Upper bound of gaps covering given percent of samples, microseconds::max() when it falls into the last bucket
+    std::chrono::microseconds getGapPercentile(uint32_t percent) const;
+    uint32_t getSamplesCount() const { return samplesCount.load(std::memory_order_relaxed); }
+    bool hasSubmissions() const { return lastSubmissionTimestamp.load(std::memory_order_relaxed) != 0; }
+    SteadyClock::time_point getLastSubmissionTimestamp() const { return SteadyClock::time_point(SteadyClock::duration(lastSubmissionTimestamp.load(std::memory_order_relaxed))); }
+
+    std::array<std::atomic<uint32_t>, bucketsCount> buckets = {};
+    std::atomic<uint32_t> samplesCount{0u};
+    std::atomic<SteadyClock::rep> lastSubmissionTimestamp{0};
+};
+
+struct DirectSubmissionTerminationStatistics {
+    uint64_t terminations = 0u;
+    uint64_t restarts = 0u;
+    uint64_t prematureTerminations = 0u; // restarted within max timeout, fixed timeout would have kept ring alive
+};
+
 class DirectSubmissionController {
   public:
     static constexpr size_t defaultTimeout = 5'000;
+    static constexpr std::chrono::microseconds minPredictedTimeout{100};
+    static constexpr uint32_t minSamplesForPrediction = 16u;
+    static constexpr uint32_t predictionPercentile = 90u;
+
     DirectSubmissionController();
     virtual ~DirectSubmissionController();
 
@@ -44,17 +75,26 @@ class DirectSubmissionController {
     void unregisterDirectSubmission(CommandStreamReceiver *csr);
 
     void startControlling();
+    // Wakes up controller sleeping until next deadline, e.g. when stopped ring was started again
+    void notifyDirectSubmissionStarted();
+
+    DirectSubmissionTerminationStatistics getTerminationStatistics();
 
     static bool isSupported();
 
   protected:
     struct DirectSubmissionState {
         bool isStopped = true;
+        bool terminatedByController = false;
         TaskCountType taskCount = 0u;
+        SteadyClock::time_point lastActivityTimestamp{};
+        std::chrono::microseconds predictedTimeout{0};
     };
 
     static void *controlDirectSubmissionsState(void *self);
     void checkNewSubmissions();
+    void checkNewSubmissionsPredictive();
+    std::chrono::microseconds predictTimeout(const SubmissionGapHistogram *submissionGaps) const;
     MOCKABLE_VIRTUAL void sleep();
     MOCKABLE_VIRTUAL SteadyClock::time_point getCpuTimestamp();
 
@@ -80,5 +120,13 @@ class DirectSubmissionController {
     std::unordered_map<size_t, TimeoutParams> timeoutParamsMap;
     QueueThrottle lowestThrottleSubmitted = QueueThrottle::HIGH;
     bool adjustTimeoutOnThrottleAndAcLineStatus = true;
+
+    bool predictiveTermination = false;
+    bool printDecisions = false;
+    bool wakeupRequested = false;
+    std::optional<SteadyClock::time_point> nextWakeupTimestamp; // none - no running ring known, check again after timeout
+    std::mutex wakeupMutex;
+    std::condition_variable wakeupCondition;
+    DirectSubmissionTerminationStatistics terminationStatistics;
 };
 } // namespace NEO
\ No newline at end of file
@@ -8,11 +8,14 @@
 #pragma once
 #include "shared/source/command_stream/linear_stream.h"
 #include "shared/source/command_stream/queue_throttle.h"
+#include "shared/source/direct_submission/direct_submission_controller.h"
 #include "shared/source/helpers/completion_stamp.h"
 #include "shared/source/helpers/constants.h"
 #include "shared/source/utilities/stackvec.h"
 
+#include <chrono>
 #include <memory>
+#include <mutex>
 
 namespace NEO {
 class MemoryManager;
@@ -50,8 +53,16 @@ enum class DirectSubmissionSfenceMode : int32_t {
 namespace UllsDefaults {
 inline constexpr bool defaultDisableCacheFlush = true;
 inline constexpr bool defaultDisableMonitorFence = true;
+inline constexpr uint32_t defaultMaxCoalescedSubmissions = 8u;
 } // namespace UllsDefaults
 
+struct SubmissionCoalescingStatistics {
+    uint64_t semaphoreReleases = 0u;
+    uint64_t releasedSubmissions = 0u;
+    uint64_t coalescedReleases = 0u; // releases covering more than one submission
+    uint32_t maxReleasedSubmissions = 0u;
+};
+
 struct BatchBuffer;
 class DirectSubmissionDiagnosticsCollector;
 class FlushStampTracker;
@@ -99,6 +110,20 @@ class DirectSubmissionHw {
         return this->lastSubmittedThrottle;
     }
 
+    SubmissionGapHistogram *getSubmissionGapHistogram() {
+        return this->recordSubmissionGaps ? &this->submissionGaps : nullptr;
+    }
+
+    // Releases deferred submissions, with expiredOnly set only those pending for at least coalescing window.
+    // Called by direct submission controller and before waiting for completion, so last submission of a burst
+    // waits for the sooner of the two: controller pass after window expires or submitter starting to wait.
+    void releaseCoalescedSubmissions(bool expiredOnly);
+
+    SubmissionCoalescingStatistics getCoalescingStatistics() {
+        std::lock_guard<std::mutex> lock(coalescingMutex);
+        return coalescingStatistics;
+    }
+
   protected:
     static constexpr size_t prefetchSize = 8 * MemoryConstants::cacheLineSize;
     static constexpr size_t prefetchNoops = prefetchSize / sizeof(uint32_t);
@@ -123,7 +148,12 @@ class DirectSubmissionHw {
     virtual bool dispatchMonitorFenceRequired(bool requireMonitorFence);
     virtual void getTagAddressValue(TagData &tagData) = 0;
     void unblockGpu();
-    bool submitCommandBufferToGpu(bool needStart, uint64_t gpuAddress, size_t size);
+    void releaseSemaphore(uint32_t queueWorkCount);
+    bool submitCommandBufferToGpu(bool needStart, uint64_t gpuAddress, size_t size, bool allowDeferredRelease);
+
+    bool deferSemaphoreRelease();
+    void releasePendingSubmissions();
+    void recordSemaphoreRelease(uint32_t releasedSubmissions);
     bool copyCommandBufferIntoRing(BatchBuffer &batchBuffer);
 
     void cpuCachelineFlush(void *ptr, size_t size);
@@ -203,6 +233,21 @@ class DirectSubmissionHw {
     LinearStream ringCommandStream;
     std::unique_ptr<DirectSubmissionDiagnosticsCollector> diagnostic;
 
+    // Submissions arriving in bursts share single semaphore release, semaphore wait is satisfied by any greater value
+    std::mutex coalescingMutex;
+    std::chrono::steady_clock::time_point lastSubmissionTime{};
+    std::chrono::steady_clock::time_point firstPendingSubmissionTime{};
+    std::chrono::microseconds coalescingWindow{0};
+    SubmissionCoalescingStatistics coalescingStatistics;
+    uint32_t pendingSubmissions = 0u;
+    uint32_t pendingQueueWorkCount = 0u;
+    uint32_t maxCoalescedSubmissions = UllsDefaults::defaultMaxCoalescedSubmissions;
+    bool coalescingEnabled = false;
+
+    // Read by direct submission controller to predict when idle ring should be terminated
+    SubmissionGapHistogram submissionGaps;
+    bool recordSubmissionGaps = false;
+
     uint64_t semaphoreGpuVa = 0u;
     uint64_t gpuVaForMiFlush = 0u;
     uint64_t gpuVaForAdditionalSynchronizationWA = 0u;
@@ -112,6 +112,17 @@ DirectSubmissionHw<GfxFamily, Dispatcher>::DirectSubmissionHw(const DirectSubmis
     if (EngineHelpers::isBcs(this->osContext.getEngineType()) && relaxedOrderingEnabled) {
         relaxedOrderingEnabled = (debugManager.flags.DirectSubmissionRelaxedOrderingForBcs.get() != 0);
     }
+
+    // relaxed ordering scheduler consumes semaphore values on its own, each submission has to release it
+    if (debugManager.flags.DirectSubmissionCoalescingWindow.get() > 0 && !relaxedOrderingEnabled) {
+        coalescingEnabled = true;
+        coalescingWindow = std::chrono::microseconds(debugManager.flags.DirectSubmissionCoalescingWindow.get());
+        if (debugManager.flags.DirectSubmissionMaxCoalescedSubmissions.get() > 0) {
+            maxCoalescedSubmissions = static_cast<uint32_t>(debugManager.flags.DirectSubmissionMaxCoalescedSubmissions.get());
+        }
+    }
+
+    recordSubmissionGaps = debugManager.flags.DirectSubmissionControllerPredictive.get() == 1;
 }
 
 template <typename GfxFamily, typename Dispatcher>
@@ -419,6 +430,19 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::makeResourcesResident(DirectSubm
 
 template <typename GfxFamily, typename Dispatcher>
 inline void DirectSubmissionHw<GfxFamily, Dispatcher>::unblockGpu() {
+    if (coalescingEnabled) {
+        // current value covers all deferred submissions as well
+        std::lock_guard<std::mutex> lock(coalescingMutex);
+        recordSemaphoreRelease(pendingSubmissions);
+        pendingSubmissions = 0u;
+        releaseSemaphore(currentQueueWorkCount);
+        return;
+    }
+    releaseSemaphore(currentQueueWorkCount);
+}
+
+template <typename GfxFamily, typename Dispatcher>
+inline void DirectSubmissionHw<GfxFamily, Dispatcher>::releaseSemaphore(uint32_t queueWorkCount) {
     if (sfenceMode >= DirectSubmissionSfenceMode::beforeSemaphoreOnly) {
         CpuIntrinsics::sfence();
     }
@@ -427,13 +451,74 @@ inline void DirectSubmissionHw<GfxFamily, Dispatcher>::unblockGpu() {
         *this->pciBarrierPtr = 0u;
     }
 
-    semaphoreData->queueWorkCount = currentQueueWorkCount;
+    semaphoreData->queueWorkCount = queueWorkCount;
 
     if (sfenceMode == DirectSubmissionSfenceMode::beforeAndAfterSemaphore) {
         CpuIntrinsics::sfence();
     }
 }
 
+template <typename GfxFamily, typename Dispatcher>
+bool DirectSubmissionHw<GfxFamily, Dispatcher>::deferSemaphoreRelease() {
+    if (!coalescingEnabled) {
+        return false;
+    }
+
+    auto now = std::chrono::steady_clock::now();
+    std::lock_guard<std::mutex> lock(coalescingMutex);
+    bool burst = (now - lastSubmissionTime) < coalescingWindow;
+    lastSubmissionTime = now;
+
+    if (pendingSubmissions == 0u) {
+        firstPendingSubmissionTime = now;
+    }
+    pendingSubmissions++;
+    pendingQueueWorkCount = currentQueueWorkCount;
+
+    bool windowExpired = (now - firstPendingSubmissionTime) >= coalescingWindow;
+    return burst && !windowExpired && pendingSubmissions < maxCoalescedSubmissions && lastSubmittedThrottle != QueueThrottle::HIGH;
+}
+
+template <typename GfxFamily, typename Dispatcher>
+void DirectSubmissionHw<GfxFamily, Dispatcher>::releasePendingSubmissions() {
+    // called with coalescingMutex held
+    if (pendingSubmissions == 0u) {
+        return;
+    }
+    recordSemaphoreRelease(pendingSubmissions);
+    pendingSubmissions = 0u;
+    releaseSemaphore(pendingQueueWorkCount);
+    cpuCachelineFlush(semaphorePtr, MemoryConstants::cacheLineSize);
+}
+
+template <typename GfxFamily, typename Dispatcher>
+void DirectSubmissionHw<GfxFamily, Dispatcher>::recordSemaphoreRelease(uint32_t releasedSubmissions) {
+    if (releasedSubmissions == 0u) {
+        return;
+    }
+    coalescingStatistics.semaphoreReleases++;
+    coalescingStatistics.releasedSubmissions += releasedSubmissions;
+    if (releasedSubmissions > 1u) {
+        coalescingStatistics.coalescedReleases++;
+    }
+    coalescingStatistics.maxReleasedSubmissions = std::max(coalescingStatistics.maxReleasedSubmissions, releasedSubmissions);
+}
+
+template <typename GfxFamily, typename Dispatcher>
+void DirectSubmissionHw<GfxFamily, Dispatcher>::releaseCoalescedSubmissions(bool expiredOnly) {
+    if (!coalescingEnabled) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(coalescingMutex);
+    if (pendingSubmissions == 0u) {
+        return;
+    }
+    if (expiredOnly && (std::chrono::steady_clock::now() - firstPendingSubmissionTime) < coalescingWindow) {
+        return;
+    }
+    releasePendingSubmissions();
+}
+
 template <typename GfxFamily, typename Dispatcher>
 inline void DirectSubmissionHw<GfxFamily, Dispatcher>::cpuCachelineFlush(void *ptr, size_t size) {
     if (disableCpuCacheFlush) {
@@ -980,10 +1065,20 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffe
 
     cpuCachelineFlush(currentPosition, dispatchSize);
 
-    if (!this->submitCommandBufferToGpu(needStart, startVA, requiredMinimalSize)) {
+    if (!this->submitCommandBufferToGpu(needStart, startVA, requiredMinimalSize, true)) {
         return false;
     }
 
+    if (this->recordSubmissionGaps) {
+        this->submissionGaps.recordSubmission(SteadyClock::now());
+        if (needStart) {
+            auto directSubmissionController = this->rootDeviceEnvironment.executionEnvironment.directSubmissionController.get();
+            if (directSubmissionController) {
+                directSubmissionController->notifyDirectSubmissionStarted();
+            }
+        }
+    }
+
     cpuCachelineFlush(semaphorePtr, MemoryConstants::cacheLineSize);
     currentQueueWorkCount++;
     DirectSubmissionDiagnostics::diagnosticModeOneSubmit(diagnostic.get());
@@ -998,13 +1093,15 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchCommandBuffer(BatchBuffe
 }
 
 template <typename GfxFamily, typename Dispatcher>
-bool DirectSubmissionHw<GfxFamily, Dispatcher>::submitCommandBufferToGpu(bool needStart, uint64_t gpuAddress, size_t size) {
+bool DirectSubmissionHw<GfxFamily, Dispatcher>::submitCommandBufferToGpu(bool needStart, uint64_t gpuAddress, size_t size, bool allowDeferredRelease) {
     if (needStart) {
         this->ringStart = this->submit(gpuAddress, size);
         return this->ringStart;
     } else {
         handleResidency();
-        this->unblockGpu();
+        if (!allowDeferredRelease || !this->deferSemaphoreRelease()) {
+            this->unblockGpu();
+        }
         return true;
     }
 }
@@ -1116,6 +1213,7 @@ bool DirectSubmissionHw<GfxFamily, Dispatcher>::dispatchMonitorFenceRequired(boo
 
 template <typename GfxFamily, typename Dispatcher>
 void DirectSubmissionHw<GfxFamily, Dispatcher>::deallocateResources() {
+    releaseCoalescedSubmissions(false);
     for (uint32_t ringBufferIndex = 0; ringBufferIndex < this->ringBuffers.size(); ringBufferIndex++) {
         memoryManager->freeGraphicsMemory(this->ringBuffers[ringBufferIndex].ringBuffer);
     }
@@ -24,6 +24,8 @@
 #include "shared/source/os_interface/os_environment.h"
 #include "shared/source/os_interface/os_interface.h"
 #include "shared/source/os_interface/product_helper.h"
+#include "shared/source/program/printf_drainer.h"
+#include "shared/source/utilities/thread_pool.h"
 #include "shared/source/utilities/wait_util.h"
 
 namespace NEO {
@@ -43,6 +45,10 @@ void ExecutionEnvironment::releaseRootDeviceEnvironmentResources(RootDeviceEnvir
 }
 
 ExecutionEnvironment::~ExecutionEnvironment() {
+    printfDrainer.reset();
+    if (threadPool) {
+        threadPool->shutdown();
+    }
     if (memoryManager) {
         memoryManager->commonCleanup();
         for (const auto &rootDeviceEnvironment : this->rootDeviceEnvironments) {
@@ -125,6 +131,23 @@ DirectSubmissionController *ExecutionEnvironment::initializeDirectSubmissionCont
     return directSubmissionController.get();
 }
 
+ThreadPool *ExecutionEnvironment::getThreadPool() {
+    std::lock_guard<std::mutex> lock(threadPoolMutex);
+    if (this->threadPool == nullptr) {
+        this->threadPool = std::make_unique<ThreadPool>(ThreadPool::getDefaultThreadsCount());
+    }
+    return this->threadPool.get();
+}
+
+PrintfDrainer *ExecutionEnvironment::getPrintfDrainer() {
+    std::lock_guard<std::mutex> lock(printfDrainerMutex);
+    if (!this->printfDrainerInitialized) {
+        this->printfDrainer = PrintfDrainer::create();
+        this->printfDrainerInitialized = true;
+    }
+    return this->printfDrainer.get();
+}
+
 void ExecutionEnvironment::prepareRootDeviceEnvironments(uint32_t numRootDevices) {
     if (rootDeviceEnvironments.size() < numRootDevices) {
         rootDeviceEnvironments.resize(numRootDevices);
@@ -19,7 +19,9 @@ class DirectSubmissionController;
 class GfxCoreHelper;
 class MemoryManager;
 struct OsEnvironment;
+class PrintfDrainer;
 struct RootDeviceEnvironment;
+class ThreadPool;
 
 class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment> {
 
@@ -63,9 +65,13 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
     bool isFP64EmulationEnabled() const { return fp64EmulationEnabled; }
 
     DirectSubmissionController *initializeDirectSubmissionController();
+    ThreadPool *getThreadPool();
+    PrintfDrainer *getPrintfDrainer();
 
     std::unique_ptr<MemoryManager> memoryManager;
     std::unique_ptr<DirectSubmissionController> directSubmissionController;
+    std::unique_ptr<ThreadPool> threadPool;
+    std::unique_ptr<PrintfDrainer> printfDrainer;
     std::unique_ptr<OsEnvironment> osEnvironment;
     std::vector<std::unique_ptr<RootDeviceEnvironment>> rootDeviceEnvironments;
     void releaseRootDeviceEnvironmentResources(RootDeviceEnvironment *rootDeviceEnvironment);
@@ -88,6 +94,9 @@ class ExecutionEnvironment : public ReferenceTrackedObject<ExecutionEnvironment>
     DebuggingMode debuggingEnabledMode = DebuggingMode::disabled;
     std::unordered_map<uint32_t, uint32_t> rootDeviceNumCcsMap;
     std::mutex initializeDirectSubmissionControllerMutex;
+    std::mutex threadPoolMutex;
+    std::mutex printfDrainerMutex;
+    bool printfDrainerInitialized = false;
     std::vector<std::tuple<std::string, uint32_t>> deviceCcsModeVec;
 };
 } // namespace NEO
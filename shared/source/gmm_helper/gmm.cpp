@@ -18,6 +18,7 @@
 #include "shared/source/helpers/hw_info.h"
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/helpers/surface_format_info.h"
+#include "shared/source/helpers/tiled_image_copy.h"
 #include "shared/source/memory_manager/allocation_type.h"
 #include "shared/source/memory_manager/definitions/storage_info.h"
 
@@ -346,6 +347,23 @@ bool Gmm::unifiedAuxTranslationCapable() const {
     return gmmFlags->Gpu.CCS && gmmFlags->Gpu.UnifiedAuxSurface && (gmmFlags->Info.RenderCompressed | gmmFlags->Info.MediaCompressed);
 }
 
+ImageTilingMode Gmm::getImageTilingMode() const {
+    auto &flags = this->gmmResourceInfo->getResourceFlags()->Info;
+    if (flags.Linear) {
+        return ImageTilingMode::linear;
+    }
+    if (flags.TiledX) {
+        return ImageTilingMode::tileX;
+    }
+    if (flags.Tile4) {
+        return ImageTilingMode::tile4;
+    }
+    if (flags.TiledY && !flags.TiledYf && !flags.TiledYs) {
+        return ImageTilingMode::tileY;
+    }
+    return ImageTilingMode::unsupported;
+}
+
 bool Gmm::hasMultisampleControlSurface() const {
     return this->gmmResourceInfo->getResourceFlags()->Gpu.MCS;
 }
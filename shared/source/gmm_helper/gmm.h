@@ -13,6 +13,7 @@
 
 namespace NEO {
 enum class ImagePlane;
+enum class ImageTilingMode : uint32_t;
 struct HardwareInfo;
 struct ImageInfo;
 struct StorageInfo;
@@ -55,6 +56,7 @@ class Gmm {
 
     bool unifiedAuxTranslationCapable() const;
     bool hasMultisampleControlSurface() const;
+    ImageTilingMode getImageTilingMode() const;
 
     GmmHelper *getGmmHelper() const;
 
@@ -0,0 +1,49 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/tiled_image_copy.h"
+#include "shared/source/utilities/cpu_info.h"
+
+#if defined(__ARM_NEON)
+#include <arm_neon.h>
+#endif
+
+namespace NEO {
+namespace TiledImageCopy {
+
+#if defined(__ARM_NEON)
+namespace {
+void neonColumnToTiled(void *tiled, const void *linear, size_t linearRowPitch, size_t rows) {
+    for (size_t row = 0; row < rows; row++) {
+        auto value = vld1q_u8(reinterpret_cast<const uint8_t *>(ptrOffset(linear, row * linearRowPitch)));
+        vst1q_u8(reinterpret_cast<uint8_t *>(ptrOffset(tiled, row * columnWidth)), value);
+    }
+}
+
+void neonColumnFromTiled(void *linear, size_t linearRowPitch, const void *tiled, size_t rows) {
+    for (size_t row = 0; row < rows; row++) {
+        auto value = vld1q_u8(reinterpret_cast<const uint8_t *>(ptrOffset(tiled, row * columnWidth)));
+        vst1q_u8(reinterpret_cast<uint8_t *>(ptrOffset(linear, row * linearRowPitch)), value);
+    }
+}
+
+const ColumnCopyKernels neonKernels = {neonColumnToTiled, neonColumnFromTiled};
+} // namespace
+#endif
+
+const ColumnCopyKernels *getSimdColumnCopyKernels() {
+#if defined(__ARM_NEON)
+    if (CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureNeon)) {
+        return &neonKernels;
+    }
+#endif
+    return nullptr;
+}
+
+} // namespace TiledImageCopy
+} // namespace NEO
@@ -7,10 +7,12 @@
 
 #include "shared/source/helpers/bindless_heaps_helper.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/device/device.h"
 #include "shared/source/execution_environment/execution_environment.h"
 #include "shared/source/execution_environment/root_device_environment.h"
 #include "shared/source/helpers/gfx_core_helper.h"
+#include "shared/source/helpers/hash.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/indirect_heap/indirect_heap.h"
 #include "shared/source/memory_manager/allocation_properties.h"
@@ -46,6 +48,10 @@ BindlessHeapsHelper::BindlessHeapsHelper(Device *rootDevice, bool isMultiOsConte
     memcpy_s(borderColorStates->getUnderlyingBuffer(), sizeof(borderColorDefault), borderColorDefault, sizeof(borderColorDefault));
     float borderColorAlpha[4] = {0, 0, 0, 1.0};
     memcpy_s(ptrOffset(borderColorStates->getUnderlyingBuffer(), borderColorAlphaOffset), sizeof(borderColorAlpha), borderColorAlpha, sizeof(borderColorDefault));
+
+    if (debugManager.flags.EnableBindlessStateCache.get() != -1) {
+        stateCacheEnabled = !!debugManager.flags.EnableBindlessStateCache.get();
+    }
 }
 
 BindlessHeapsHelper::~BindlessHeapsHelper() {
@@ -172,6 +178,8 @@ bool BindlessHeapsHelper::growHeap(BindlesHeapType heapType) {
         return false;
     }
     ssHeapsAllocations.push_back(newAlloc);
+    retiredHeapUsedSize[heapType] += heap->getUsed();
+    retiredHeapAllocatedSize[heapType] += heap->getMaxAvailableSpace();
     heap->replaceGraphicsAllocation(newAlloc);
     heap->replaceBuffer(newAlloc->getUnderlyingBuffer(),
                         newAlloc->getUnderlyingBufferSize());
@@ -188,4 +196,56 @@ void BindlessHeapsHelper::releaseSSToReusePool(const SurfaceStateInHeapInfo &sur
     return;
 }
 
+SurfaceStateInHeapInfo BindlessHeapsHelper::allocateCachedStateInHeap(const void *stateContent, size_t stateSize, BindlesHeapType heapType) {
+    // empty state only marks current heap offset, it is not worth sharing
+    if (!stateCacheEnabled || stateSize == 0) {
+        auto stateInfo = allocateSSInHeap(stateSize, nullptr, heapType);
+        if (stateInfo.ssPtr && stateSize > 0) {
+            memcpy_s(stateInfo.ssPtr, stateSize, stateContent, stateSize);
+        }
+        return stateInfo;
+    }
+
+    auto contentHash = Hash::hash(reinterpret_cast<const char *>(stateContent), stateSize);
+
+    std::lock_guard<std::mutex> autolock(this->stateCacheMtx);
+    auto &heapCachedStates = cachedStates[heapType];
+    auto range = heapCachedStates.equal_range(contentHash);
+    for (auto it = range.first; it != range.second; ++it) {
+        auto &cachedStateInfo = it->second;
+        if (cachedStateInfo.ssSize == stateSize && memcmp(cachedStateInfo.ssPtr, stateContent, stateSize) == 0) {
+            stateCacheHits++;
+            return cachedStateInfo;
+        }
+    }
+
+    stateCacheMisses++;
+    auto stateInfo = allocateSSInHeap(stateSize, nullptr, heapType);
+    if (stateInfo.ssPtr == nullptr) {
+        return stateInfo;
+    }
+    memcpy_s(stateInfo.ssPtr, stateSize, stateContent, stateSize);
+    stateInfo.ssSize = stateSize;
+    heapCachedStates.insert({contentHash, stateInfo});
+    return stateInfo;
+}
+
+BindlessHeapsHelper::StateCacheStatistics BindlessHeapsHelper::getStateCacheStatistics() {
+    StateCacheStatistics statistics{};
+
+    std::lock_guard<std::mutex> cacheLock(this->stateCacheMtx);
+    statistics.hits = stateCacheHits;
+    statistics.misses = stateCacheMisses;
+    for (auto heapType = 0; heapType < BindlesHeapType::numHeapTypes; heapType++) {
+        statistics.cachedStatesCount += cachedStates[heapType].size();
+    }
+
+    std::lock_guard<std::mutex> heapLock(this->mtx);
+    for (auto heapType = 0; heapType < BindlesHeapType::numHeapTypes; heapType++) {
+        statistics.heapUsedSize[heapType] = retiredHeapUsedSize[heapType] + surfaceStateHeaps[heapType]->getUsed();
+        statistics.heapAllocatedSize[heapType] = retiredHeapAllocatedSize[heapType] + surfaceStateHeaps[heapType]->getMaxAvailableSpace();
+    }
+    return statistics;
+}
+
 } // namespace NEO
\ No newline at end of file
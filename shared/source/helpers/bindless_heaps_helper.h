@@ -27,6 +27,15 @@ class BindlessHeapsHelper {
         globalDsh,
         numHeapTypes
     };
+
+    struct StateCacheStatistics {
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        size_t cachedStatesCount = 0;
+        size_t heapUsedSize[BindlesHeapType::numHeapTypes] = {};
+        size_t heapAllocatedSize[BindlesHeapType::numHeapTypes] = {};
+    };
+
     BindlessHeapsHelper(Device *rootDevice, bool isMultiOsContextCapable);
     MOCKABLE_VIRTUAL ~BindlessHeapsHelper();
 
@@ -42,6 +51,12 @@ class BindlessHeapsHelper {
     uint32_t getAlphaBorderColorOffset();
     IndirectHeap *getHeap(BindlesHeapType heapType);
     void releaseSSToReusePool(const SurfaceStateInHeapInfo &surfStateInfo);
+
+    // States with identical content share a single slot in heap, slot content must not be modified by caller.
+    // Used for samplers only - slots in global DSH are never released, so cached states live as long as the heap.
+    SurfaceStateInHeapInfo allocateCachedStateInHeap(const void *stateContent, size_t stateSize, BindlesHeapType heapType);
+    bool isStateCacheEnabled() const { return stateCacheEnabled; }
+    StateCacheStatistics getStateCacheStatistics();
     bool isGlobalDshSupported() {
         return globalBindlessDsh;
     }
@@ -76,7 +91,15 @@ class BindlessHeapsHelper {
     std::array<std::vector<SurfaceStateInHeapInfo>, 2> surfaceStateInHeapVectorReuse[2];
     std::bitset<64> stateCacheDirtyForContext;
 
+    std::unordered_multimap<uint64_t, SurfaceStateInHeapInfo> cachedStates[BindlesHeapType::numHeapTypes];
+    size_t retiredHeapUsedSize[BindlesHeapType::numHeapTypes] = {};
+    size_t retiredHeapAllocatedSize[BindlesHeapType::numHeapTypes] = {};
+    uint64_t stateCacheHits = 0;
+    uint64_t stateCacheMisses = 0;
+    bool stateCacheEnabled = false;
+
     std::mutex mtx;
+    std::mutex stateCacheMtx;
     DeviceBitfield deviceBitfield;
     bool globalBindlessDsh = false;
 };
@@ -0,0 +1,268 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/tiled_image_copy.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/gmm_helper/gmm.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_manager.h"
+#include "shared/source/memory_manager/memory_pool.h"
+#include "shared/source/utilities/thread_pool.h"
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+#include <thread>
+#include <vector>
+
+namespace NEO {
+namespace TiledImageCopy {
+
+namespace {
+void scalarColumnToTiled(void *tiled, const void *linear, size_t linearRowPitch, size_t rows) {
+    for (size_t row = 0; row < rows; row++) {
+        memcpy(ptrOffset(tiled, row * columnWidth), ptrOffset(linear, row * linearRowPitch), columnWidth);
+    }
+}
+
+void scalarColumnFromTiled(void *linear, size_t linearRowPitch, const void *tiled, size_t rows) {
+    for (size_t row = 0; row < rows; row++) {
+        memcpy(ptrOffset(linear, row * linearRowPitch), ptrOffset(tiled, row * columnWidth), columnWidth);
+    }
+}
+
+const ColumnCopyKernels scalarKernels = {scalarColumnToTiled, scalarColumnFromTiled};
+
+// Number of consecutive rows of a 16 byte column stored contiguously within a tile
+size_t getColumnRunHeight(ImageTilingMode tilingMode) {
+    return tilingMode == ImageTilingMode::tile4 ? 4u : 32u;
+}
+
+size_t getSwizzledOffsetInTile(ImageTilingMode tilingMode, size_t x, size_t y) {
+    switch (tilingMode) {
+    case ImageTilingMode::tileX:
+        return (x & 0x1ff) | ((y & 0x7) << 9);
+    case ImageTilingMode::tileY:
+        return (x & 0xf) | ((y & 0x1f) << 4) | ((x & 0x70) << 5);
+    default:
+        return (x & 0xf) | ((y & 0x3) << 4) | ((x & 0x30) << 2) | ((y & 0x4) << 6) | ((x & 0x40) << 3) | ((y & 0x18) << 7);
+    }
+}
+
+struct CopyChunk {
+    const TiledImageCopyParams *params = nullptr;
+    size_t firstRow = 0u; // flattened over slices
+    size_t lastRow = 0u;
+    bool toTiled = false;
+};
+
+void copyRowsInSlice(const TiledImageCopyParams &params, bool toTiled, size_t slice, size_t firstRow, size_t lastRow) {
+    auto tilingMode = params.tilingMode;
+    auto tiledFirstRow = (params.tiledOrigin[2] + slice) * params.tiledQPitch + params.tiledOrigin[1];
+    auto xBegin = params.tiledOrigin[0];
+    auto xEnd = xBegin + params.region[0];
+    auto linearSlice = ptrOffset(params.linearPtr, slice * params.linearSlicePitch);
+
+    auto copySpan = [&](size_t x, size_t row, size_t size) {
+        auto tiled = ptrOffset(params.tiledPtr, getOffsetInTiledSurface(tilingMode, params.tiledRowPitch, x, tiledFirstRow + row));
+        auto linear = ptrOffset(linearSlice, row * params.linearRowPitch + (x - xBegin));
+        if (toTiled) {
+            memcpy(tiled, linear, size);
+        } else {
+            memcpy(linear, tiled, size);
+        }
+    };
+
+    if (tilingMode == ImageTilingMode::linear || tilingMode == ImageTilingMode::tileX) {
+        // rows are contiguous within linear surface and within each 512 byte wide X tile
+        auto tileWidth = getTileWidthInBytes(tilingMode);
+        for (auto row = firstRow; row < lastRow; row++) {
+            for (auto x = xBegin; x < xEnd;) {
+                auto size = tilingMode == ImageTilingMode::linear ? xEnd - x : std::min(xEnd - x, tileWidth - (x % tileWidth));
+                copySpan(x, row, size);
+                x += size;
+            }
+        }
+        return;
+    }
+
+    auto &kernels = getColumnCopyKernels();
+    auto runHeight = getColumnRunHeight(tilingMode);
+    for (auto row = firstRow; row < lastRow;) {
+        auto tiledRow = tiledFirstRow + row;
+        auto rowsInRun = std::min(lastRow - row, runHeight - (tiledRow % runHeight));
+        for (auto x = xBegin; x < xEnd;) {
+            auto size = std::min(xEnd - x, columnWidth - (x % columnWidth));
+            if (size == columnWidth) {
+                auto tiled = ptrOffset(params.tiledPtr, getOffsetInTiledSurface(tilingMode, params.tiledRowPitch, x, tiledRow));
+                auto linear = ptrOffset(linearSlice, row * params.linearRowPitch + (x - xBegin));
+                if (toTiled) {
+                    kernels.toTiled(tiled, linear, params.linearRowPitch, rowsInRun);
+                } else {
+                    kernels.fromTiled(linear, params.linearRowPitch, tiled, rowsInRun);
+                }
+            } else {
+                for (size_t i = 0; i < rowsInRun; i++) {
+                    copySpan(x, row + i, size);
+                }
+            }
+            x += size;
+        }
+        row += rowsInRun;
+    }
+}
+
+void copyChunk(const CopyChunk &chunk) {
+    auto rowsInSlice = chunk.params->region[1];
+    for (auto row = chunk.firstRow; row < chunk.lastRow;) {
+        auto slice = row / rowsInSlice;
+        auto firstRowInSlice = row % rowsInSlice;
+        auto lastRowInSlice = std::min(rowsInSlice, firstRowInSlice + (chunk.lastRow - row));
+        copyRowsInSlice(*chunk.params, chunk.toTiled, slice, firstRowInSlice, lastRowInSlice);
+        row += lastRowInSlice - firstRowInSlice;
+    }
+}
+
+void copy(const TiledImageCopyParams &params, uint32_t threadsCount, ThreadPool *threadPool, bool toTiled) {
+    UNRECOVERABLE_IF(!isCopySupported(params));
+
+    auto totalRows = params.region[1] * params.region[2];
+    threadsCount = static_cast<uint32_t>(std::min(static_cast<size_t>(std::max(threadsCount, 1u)), totalRows));
+    auto rowsPerThread = (totalRows + threadsCount - 1) / threadsCount;
+
+    std::vector<CopyChunk> chunks;
+    chunks.reserve(threadsCount);
+    for (size_t firstRow = 0u; firstRow < totalRows; firstRow += rowsPerThread) {
+        chunks.push_back({&params, firstRow, std::min(totalRows, firstRow + rowsPerThread), toTiled});
+    }
+
+    if (threadPool == nullptr || chunks.size() == 1u) {
+        for (auto &chunk : chunks) {
+            copyChunk(chunk);
+        }
+        return;
+    }
+    threadPool->parallelFor(chunks.size(), [&chunks](size_t chunkIndex) {
+        copyChunk(chunks[chunkIndex]);
+    });
+}
+} // namespace
+
+bool isTilingModeSupported(ImageTilingMode tilingMode) {
+    switch (tilingMode) {
+    case ImageTilingMode::linear:
+    case ImageTilingMode::tileX:
+    case ImageTilingMode::tileY:
+    case ImageTilingMode::tile4:
+        return true;
+    default:
+        return false;
+    }
+}
+
+size_t getTileWidthInBytes(ImageTilingMode tilingMode) {
+    switch (tilingMode) {
+    case ImageTilingMode::tileX:
+        return 512u;
+    case ImageTilingMode::tileY:
+    case ImageTilingMode::tile4:
+        return 128u;
+    default:
+        return 1u;
+    }
+}
+
+size_t getTileHeightInRows(ImageTilingMode tilingMode) {
+    switch (tilingMode) {
+    case ImageTilingMode::tileX:
+        return 8u;
+    case ImageTilingMode::tileY:
+    case ImageTilingMode::tile4:
+        return 32u;
+    default:
+        return 1u;
+    }
+}
+
+size_t getOffsetInTiledSurface(ImageTilingMode tilingMode, size_t rowPitch, size_t x, size_t y) {
+    if (tilingMode == ImageTilingMode::linear) {
+        return y * rowPitch + x;
+    }
+    auto tileWidth = getTileWidthInBytes(tilingMode);
+    auto tileHeight = getTileHeightInRows(tilingMode);
+    auto tileOffset = (y / tileHeight) * rowPitch * tileHeight + (x / tileWidth) * tileSize;
+    return tileOffset + getSwizzledOffsetInTile(tilingMode, x, y);
+}
+
+bool isCopySupported(const TiledImageCopyParams &params) {
+    if (!isTilingModeSupported(params.tilingMode) || params.tiledPtr == nullptr || params.linearPtr == nullptr) {
+        return false;
+    }
+    if (params.region[0] == 0u || params.region[1] == 0u || params.region[2] == 0u) {
+        return false;
+    }
+    if (params.tiledRowPitch % getTileWidthInBytes(params.tilingMode) != 0u || params.tiledOrigin[0] + params.region[0] > params.tiledRowPitch) {
+        return false;
+    }
+    if (params.tiledQPitch < params.tiledOrigin[1] + params.region[1] && (params.tiledOrigin[2] + params.region[2]) > 1u) {
+        return false;
+    }
+    if (params.linearRowPitch < params.region[0]) {
+        return false;
+    }
+    return params.region[2] == 1u || params.linearSlicePitch >= params.linearRowPitch * params.region[1];
+}
+
+uint32_t getThreadsCountForCopy(const TiledImageCopyParams &params) {
+    if (debugManager.flags.CpuTiledImageCopyThreads.get() > 0) {
+        return static_cast<uint32_t>(debugManager.flags.CpuTiledImageCopyThreads.get());
+    }
+    auto copySize = params.region[0] * params.region[1] * params.region[2];
+    if (copySize < minSizeForMultithreadedCopy) {
+        return 1u;
+    }
+    auto hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    auto threadsForSize = static_cast<uint32_t>(std::min(copySize / (minSizeForMultithreadedCopy / 4), static_cast<size_t>(maxThreadsCount)));
+    return std::min({threadsForSize, hardwareThreads, maxThreadsCount});
+}
+
+void copyLinearToTiled(const TiledImageCopyParams &params, uint32_t threadsCount, ThreadPool *threadPool) {
+    copy(params, threadsCount, threadPool, true);
+}
+
+void copyTiledToLinear(const TiledImageCopyParams &params, uint32_t threadsCount, ThreadPool *threadPool) {
+    copy(params, threadsCount, threadPool, false);
+}
+
+ImageTilingMode getTilingModeForCpuAccess(const GraphicsAllocation &imageAllocation) {
+    auto gmm = imageAllocation.getDefaultGmm();
+    if (gmm == nullptr || gmm->isCompressionEnabled || gmm->getPreferNoCpuAccess()) {
+        return ImageTilingMode::unsupported;
+    }
+    if (imageAllocation.peekSharedHandle() != 0 || !MemoryPoolHelper::isSystemMemoryPool(imageAllocation.getMemoryPool())) {
+        return ImageTilingMode::unsupported;
+    }
+    return gmm->getImageTilingMode();
+}
+
+void *getCpuPtrForImageAccess(GraphicsAllocation &imageAllocation, MemoryManager &memoryManager) {
+    if (imageAllocation.getUnderlyingBuffer()) {
+        return imageAllocation.getUnderlyingBuffer();
+    }
+    return memoryManager.lockResource(&imageAllocation);
+}
+
+const ColumnCopyKernels &getColumnCopyKernels() {
+    static const ColumnCopyKernels *kernels = getSimdColumnCopyKernels();
+    return kernels ? *kernels : scalarKernels;
+}
+
+} // namespace TiledImageCopy
+} // namespace NEO
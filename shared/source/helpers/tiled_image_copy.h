@@ -0,0 +1,71 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace NEO {
+class GraphicsAllocation;
+class MemoryManager;
+class ThreadPool;
+
+enum class ImageTilingMode : uint32_t {
+    linear = 0,
+    tileX,
+    tileY,
+    tile4,
+    unsupported
+};
+
+// Describes a copy between host linear memory and CPU-visible tiled image storage.
+// Horizontal offsets and sizes are in bytes, vertical ones in rows of the tiled surface.
+struct TiledImageCopyParams {
+    void *tiledPtr = nullptr;
+    void *linearPtr = nullptr;
+    size_t tiledRowPitch = 0u;
+    size_t tiledQPitch = 0u; // rows between consecutive slices or array layers
+    size_t linearRowPitch = 0u;
+    size_t linearSlicePitch = 0u;
+    size_t tiledOrigin[3] = {0u, 0u, 0u};
+    size_t region[3] = {0u, 0u, 0u};
+    ImageTilingMode tilingMode = ImageTilingMode::linear;
+};
+
+namespace TiledImageCopy {
+inline constexpr size_t tileSize = 4096u;
+inline constexpr size_t columnWidth = 16u;
+inline constexpr size_t minSizeForMultithreadedCopy = 4 * 1024 * 1024;
+inline constexpr uint32_t maxThreadsCount = 8u;
+
+// Copies 16 byte wide column of consecutive rows in a Y-major tile (TileY / Tile4 OWord columns)
+struct ColumnCopyKernels {
+    void (*toTiled)(void *tiled, const void *linear, size_t linearRowPitch, size_t rows) = nullptr;
+    void (*fromTiled)(void *linear, size_t linearRowPitch, const void *tiled, size_t rows) = nullptr;
+};
+
+bool isTilingModeSupported(ImageTilingMode tilingMode);
+size_t getTileWidthInBytes(ImageTilingMode tilingMode);
+size_t getTileHeightInRows(ImageTilingMode tilingMode);
+size_t getOffsetInTiledSurface(ImageTilingMode tilingMode, size_t rowPitch, size_t x, size_t y);
+bool isCopySupported(const TiledImageCopyParams &params);
+uint32_t getThreadsCountForCopy(const TiledImageCopyParams &params);
+
+// Rows are split between threadsCount chunks copied on thread pool; chunks are copied on calling thread when no thread pool is given
+void copyLinearToTiled(const TiledImageCopyParams &params, uint32_t threadsCount, ThreadPool *threadPool);
+void copyTiledToLinear(const TiledImageCopyParams &params, uint32_t threadsCount, ThreadPool *threadPool);
+
+// Tiling of image storage if CPU may copy it directly - uncompressed, not shared, in system memory; unsupported otherwise
+ImageTilingMode getTilingModeForCpuAccess(const GraphicsAllocation &imageAllocation);
+void *getCpuPtrForImageAccess(GraphicsAllocation &imageAllocation, MemoryManager &memoryManager);
+
+// Returns vector kernels available on current CPU or nullptr when only scalar copy may be used
+const ColumnCopyKernels *getSimdColumnCopyKernels();
+const ColumnCopyKernels &getColumnCopyKernels();
+} // namespace TiledImageCopy
+
+} // namespace NEO
@@ -0,0 +1,27 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/timestamp_conversion.h"
+
+namespace NEO {
+namespace TimestampConversion {
+
+void convertIntervalsToNs(const uint64_t *startTicks, const uint64_t *endTicks, uint64_t *startNs, uint64_t *endNs,
+                          size_t count, double resolution, uint64_t validBitsMask) {
+    for (size_t i = 0; i < count; i++) {
+        endNs[i] = static_cast<uint64_t>(static_cast<double>(getDurationInTicks(startTicks[i], endTicks[i], validBitsMask)) * resolution);
+    }
+    for (size_t i = 0; i < count; i++) {
+        startNs[i] = static_cast<uint64_t>(static_cast<double>(startTicks[i] & validBitsMask) * resolution);
+    }
+    for (size_t i = 0; i < count; i++) {
+        endNs[i] += startNs[i];
+    }
+}
+
+} // namespace TimestampConversion
+} // namespace NEO
@@ -0,0 +1,33 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace NEO {
+namespace TimestampConversion {
+
+// Number of intervals processed in one batch by callers staging AoS results into SoA buffers
+inline constexpr size_t batchSize = 64u;
+
+// Duration in ticks of a [start, end] interval, counter wraparound at validBitsMask is resolved
+inline uint64_t getDurationInTicks(uint64_t start, uint64_t end, uint64_t validBitsMask) {
+    start &= validBitsMask;
+    end &= validBitsMask;
+    const uint64_t wrapped = static_cast<uint64_t>(start > end);
+    return end - start + wrapped * validBitsMask;
+}
+
+// Converts count intervals from device ticks to nanoseconds.
+// Start is scaled directly, end is derived from start and the wraparound-aware duration.
+// Loops are branch free over contiguous arrays so they can be vectorized by the compiler.
+void convertIntervalsToNs(const uint64_t *startTicks, const uint64_t *endTicks, uint64_t *startNs, uint64_t *endNs,
+                          size_t count, double resolution, uint64_t validBitsMask);
+
+} // namespace TimestampConversion
+} // namespace NEO
@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/ptr_math.h"
+#include "shared/source/helpers/tiled_image_copy.h"
+#include "shared/source/utilities/cpu_info.h"
+
+#if __AVX2__
+#include <immintrin.h>
+#endif
+
+namespace NEO {
+namespace TiledImageCopy {
+
+#if __AVX2__
+namespace {
+// Two consecutive rows of a column are adjacent in the tile, so they are moved with a single 32 byte access
+void avx2ColumnToTiled(void *tiled, const void *linear, size_t linearRowPitch, size_t rows) {
+    size_t row = 0;
+    for (; row + 1 < rows; row += 2) {
+        auto first = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptrOffset(linear, row * linearRowPitch)));
+        auto second = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptrOffset(linear, (row + 1) * linearRowPitch)));
+        auto pair = _mm256_inserti128_si256(_mm256_castsi128_si256(first), second, 1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(ptrOffset(tiled, row * columnWidth)), pair);
+    }
+    if (row < rows) {
+        auto last = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptrOffset(linear, row * linearRowPitch)));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(ptrOffset(tiled, row * columnWidth)), last);
+    }
+}
+
+void avx2ColumnFromTiled(void *linear, size_t linearRowPitch, const void *tiled, size_t rows) {
+    size_t row = 0;
+    for (; row + 1 < rows; row += 2) {
+        auto pair = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(ptrOffset(tiled, row * columnWidth)));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(ptrOffset(linear, row * linearRowPitch)), _mm256_castsi256_si128(pair));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(ptrOffset(linear, (row + 1) * linearRowPitch)), _mm256_extracti128_si256(pair, 1));
+    }
+    if (row < rows) {
+        auto last = _mm_loadu_si128(reinterpret_cast<const __m128i *>(ptrOffset(tiled, row * columnWidth)));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(ptrOffset(linear, row * linearRowPitch)), last);
+    }
+}
+
+const ColumnCopyKernels avx2Kernels = {avx2ColumnToTiled, avx2ColumnFromTiled};
+} // namespace
+#endif
+
+const ColumnCopyKernels *getSimdColumnCopyKernels() {
+#if __AVX2__
+    if (CpuInfo::getInstance().isFeatureSupported(CpuInfo::featureAvX2)) {
+        return &avx2Kernels;
+    }
+#endif
+    return nullptr;
+}
+
+} // namespace TiledImageCopy
+} // namespace NEO
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Intel Corporation
+ * Copyright (C) 2021-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,8 +10,11 @@
 #include "shared/source/command_stream/command_stream_receiver.h"
 #include "shared/source/command_stream/task_count_helper.h"
 #include "shared/source/device/device.h"
+#include "shared/source/helpers/basic_math.h"
 #include "shared/source/os_interface/os_context.h"
 
+#include <limits>
+
 namespace {
 struct ReusableAllocationRequirements {
     const void *requiredPtr;
@@ -36,6 +39,19 @@ bool checkTagAddressReady(ReusableAllocationRequirements *requirements, NEO::Gra
 
     return true;
 }
+
+bool isAllocationReusable(ReusableAllocationRequirements *requirements, NEO::GraphicsAllocation *gfxAllocation, NEO::AllocationUsage allocationUsage) {
+    if (gfxAllocation->getAllocationType() != requirements->allocationType ||
+        gfxAllocation->getUnderlyingBufferSize() < requirements->requiredMinimalSize ||
+        gfxAllocation->storageInfo.systemMemoryForced != requirements->forceSystemMemoryFlag) {
+        return false;
+    }
+    if (requirements->csrTagAddress == nullptr) {
+        return true;
+    }
+    return (allocationUsage == NEO::TEMPORARY_ALLOCATION || checkTagAddressReady(requirements, gfxAllocation)) &&
+           (requirements->requiredPtr == nullptr || requirements->requiredPtr == gfxAllocation->getUnderlyingBuffer());
+}
 } // namespace
 
 namespace NEO {
@@ -63,26 +79,34 @@ std::unique_ptr<GraphicsAllocation> AllocationsList::detachAllocation(size_t req
 
 GraphicsAllocation *AllocationsList::detachAllocationImpl(GraphicsAllocation *, void *data) {
     ReusableAllocationRequirements *req = static_cast<ReusableAllocationRequirements *>(data);
-    auto *curr = head;
-    while (curr != nullptr) {
-        if ((req->allocationType == curr->getAllocationType()) &&
-            (curr->getUnderlyingBufferSize() >= req->requiredMinimalSize) &&
-            (curr->storageInfo.systemMemoryForced == req->forceSystemMemoryFlag)) {
-            if (req->csrTagAddress == nullptr) {
-                return removeOneImpl(curr, nullptr);
+
+    // Only buckets of requested type with size class not smaller than requested one are visited.
+    // First reusable allocation in list order is taken, as when walking the whole list.
+    GraphicsAllocation *reusableAllocation = nullptr;
+    int64_t reusablePosition = std::numeric_limits<int64_t>::max();
+    const auto lastBucketKey = getReuseBucketKey(req->allocationType, std::numeric_limits<size_t>::max());
+    for (auto bucket = reuseIndex.lower_bound(getReuseBucketKey(req->allocationType, req->requiredMinimalSize));
+         bucket != reuseIndex.end() && bucket->first <= lastBucketKey; ++bucket) {
+        for (const auto &entry : bucket->second) {
+            if (entry.position >= reusablePosition) {
+                break;
             }
-            if ((this->allocationUsage == TEMPORARY_ALLOCATION || checkTagAddressReady(req, curr)) &&
-                (req->requiredPtr == nullptr || req->requiredPtr == curr->getUnderlyingBuffer())) {
-                if (this->allocationUsage == TEMPORARY_ALLOCATION) {
-                    // We may not have proper task count yet, so set notReady to avoid releasing in a different thread
-                    curr->updateTaskCount(CompletionStamp::notReady, req->contextId);
-                }
-                return removeOneImpl(curr, nullptr);
+            if (isAllocationReusable(req, entry.allocation, this->allocationUsage)) {
+                reusableAllocation = entry.allocation;
+                reusablePosition = entry.position;
+                break;
             }
         }
-        curr = curr->next;
     }
-    return nullptr;
+
+    if (reusableAllocation == nullptr) {
+        return nullptr;
+    }
+    if (req->csrTagAddress != nullptr && this->allocationUsage == TEMPORARY_ALLOCATION) {
+        // We may not have proper task count yet, so set notReady to avoid releasing in a different thread
+        reusableAllocation->updateTaskCount(CompletionStamp::notReady, req->contextId);
+    }
+    return removeOneIndexedImpl(reusableAllocation, nullptr);
 }
 
 void AllocationsList::freeAllGraphicsAllocations(Device *neoDevice) {
@@ -94,5 +118,115 @@ void AllocationsList::freeAllGraphicsAllocations(Device *neoDevice) {
     }
     head = nullptr;
     tail = nullptr;
+    clearReuseIndex();
+}
+
+void AllocationsList::pushFrontOne(GraphicsAllocation &node) {
+    processLocked<AllocationsList, &AllocationsList::pushFrontOneIndexedImpl>(&node);
+}
+
+void AllocationsList::pushTailOne(GraphicsAllocation &node) {
+    processLocked<AllocationsList, &AllocationsList::pushTailOneIndexedImpl>(&node);
+}
+
+std::unique_ptr<GraphicsAllocation> AllocationsList::removeOne(GraphicsAllocation &node) {
+    return std::unique_ptr<GraphicsAllocation>(processLocked<AllocationsList, &AllocationsList::removeOneIndexedImpl>(&node));
+}
+
+std::unique_ptr<GraphicsAllocation> AllocationsList::removeFrontOne() {
+    return std::unique_ptr<GraphicsAllocation>(processLocked<AllocationsList, &AllocationsList::removeFrontOneIndexedImpl>(nullptr));
+}
+
+GraphicsAllocation *AllocationsList::detachSequence(GraphicsAllocation &first, GraphicsAllocation &last) {
+    return processLocked<AllocationsList, &AllocationsList::detachSequenceIndexedImpl>(&first, &last);
+}
+
+GraphicsAllocation *AllocationsList::detachNodes() {
+    return processLocked<AllocationsList, &AllocationsList::detachNodesIndexedImpl>();
+}
+
+void AllocationsList::splice(GraphicsAllocation &nodes) {
+    processLocked<AllocationsList, &AllocationsList::spliceIndexedImpl>(&nodes);
+}
+
+size_t AllocationsList::getReuseIndexSize() const {
+    return reuseIndexLocations.size();
+}
+
+uint64_t AllocationsList::getReuseBucketKey(AllocationType allocationType, size_t size) {
+    uint64_t sizeClass = (size == 0u) ? 0u : Math::log2(static_cast<uint64_t>(size));
+    return (static_cast<uint64_t>(allocationType) << 32) | sizeClass;
+}
+
+void AllocationsList::addToReuseIndex(GraphicsAllocation &node, bool atFront) {
+    auto bucket = reuseIndex.try_emplace(getReuseBucketKey(node.getAllocationType(), node.getUnderlyingBufferSize())).first;
+    auto entry = atFront ? bucket->second.insert(bucket->second.begin(), ReuseIndexEntry{--headPosition, &node})
+                         : bucket->second.insert(bucket->second.end(), ReuseIndexEntry{tailPosition++, &node});
+    auto inserted = reuseIndexLocations.emplace(&node, ReuseIndexLocation{bucket, entry}).second;
+    UNRECOVERABLE_IF(!inserted);
+}
+
+void AllocationsList::removeFromReuseIndex(GraphicsAllocation &node) {
+    auto location = reuseIndexLocations.find(&node);
+    UNRECOVERABLE_IF(location == reuseIndexLocations.end());
+
+    auto bucket = location->second.bucket;
+    bucket->second.erase(location->second.entry);
+    if (bucket->second.empty()) {
+        reuseIndex.erase(bucket);
+    }
+    reuseIndexLocations.erase(location);
+}
+
+void AllocationsList::clearReuseIndex() {
+    reuseIndex.clear();
+    reuseIndexLocations.clear();
+    headPosition = 0;
+    tailPosition = 0;
+}
+
+GraphicsAllocation *AllocationsList::pushFrontOneIndexedImpl(GraphicsAllocation *node, void *) {
+    addToReuseIndex(*node, true);
+    return pushFrontOneImpl(node, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::pushTailOneIndexedImpl(GraphicsAllocation *node, void *) {
+    addToReuseIndex(*node, false);
+    return pushTailOneImpl(node, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::removeOneIndexedImpl(GraphicsAllocation *node, void *) {
+    removeFromReuseIndex(*node);
+    return removeOneImpl(node, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::removeFrontOneIndexedImpl(GraphicsAllocation *, void *) {
+    if (head == nullptr) {
+        return nullptr;
+    }
+    return removeOneIndexedImpl(head, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::detachSequenceIndexedImpl(GraphicsAllocation *node, void *data) {
+    auto last = static_cast<GraphicsAllocation *>(data);
+    for (auto curr = node; curr != nullptr; curr = curr->next) {
+        removeFromReuseIndex(*curr);
+        if (curr == last) {
+            break;
+        }
+    }
+    return detachSequenceImpl(node, data);
+}
+
+GraphicsAllocation *AllocationsList::detachNodesIndexedImpl(GraphicsAllocation *, void *) {
+    clearReuseIndex();
+    return detachNodesImpl(nullptr, nullptr);
+}
+
+GraphicsAllocation *AllocationsList::spliceIndexedImpl(GraphicsAllocation *node, void *) {
+    for (auto curr = node; curr != nullptr; curr = curr->next) {
+        addToReuseIndex(*curr, false);
+    }
+    return spliceImpl(node, nullptr);
 }
 } // namespace NEO
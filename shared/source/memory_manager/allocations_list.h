@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,12 +10,19 @@
 #include "shared/source/memory_manager/memory_manager.h"
 #include "shared/source/utilities/idlist.h"
 
+#include <list>
+#include <map>
 #include <memory>
+#include <unordered_map>
 
 namespace NEO {
 class CommandStreamReceiver;
 
-class AllocationsList : public IDList<GraphicsAllocation, true, true> {
+// List modifiers are only reachable through AllocationsList, so that the reuse index is always kept in sync
+class AllocationsList : protected IDList<GraphicsAllocation, true, true> {
+    using BaseList = IDList<GraphicsAllocation, true, true>;
+    friend BaseList;
+
   public:
     AllocationsList() = default;
     AllocationsList(AllocationUsage allocationUsage);
@@ -24,9 +31,54 @@ class AllocationsList : public IDList<GraphicsAllocation, true, true> {
     std::unique_ptr<GraphicsAllocation> detachAllocation(size_t requiredMinimalSize, const void *requiredPtr, bool forceSystemMemoryFlag, CommandStreamReceiver *commandStreamReceiver, AllocationType allocationType);
     void freeAllGraphicsAllocations(Device *neoDevice);
 
+    void pushFrontOne(GraphicsAllocation &node);
+    void pushTailOne(GraphicsAllocation &node);
+    std::unique_ptr<GraphicsAllocation> removeOne(GraphicsAllocation &node);
+    std::unique_ptr<GraphicsAllocation> removeFrontOne();
+    GraphicsAllocation *detachSequence(GraphicsAllocation &first, GraphicsAllocation &last);
+    GraphicsAllocation *detachNodes();
+    void splice(GraphicsAllocation &nodes);
+
+    using BaseList::peekContains;
+    using BaseList::peekHead;
+    using BaseList::peekIsEmpty;
+    using BaseList::peekTail;
+
+    size_t getReuseIndexSize() const;
+
+  protected:
+    // Allocations of one type and size class, ordered by their position in the list
+    struct ReuseIndexEntry {
+        int64_t position;
+        GraphicsAllocation *allocation;
+    };
+    using ReuseBucket = std::list<ReuseIndexEntry>;
+    using ReuseIndex = std::map<uint64_t, ReuseBucket>;
+    // Where allocation was indexed on insertion, later changes of its size or type do not affect removal
+    struct ReuseIndexLocation {
+        ReuseIndex::iterator bucket;
+        ReuseBucket::iterator entry;
+    };
+
+    static uint64_t getReuseBucketKey(AllocationType allocationType, size_t size);
+    void addToReuseIndex(GraphicsAllocation &node, bool atFront);
+    void removeFromReuseIndex(GraphicsAllocation &node);
+    void clearReuseIndex();
+
   private:
     GraphicsAllocation *detachAllocationImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *pushFrontOneIndexedImpl(GraphicsAllocation *node, void *);
+    GraphicsAllocation *pushTailOneIndexedImpl(GraphicsAllocation *node, void *);
+    GraphicsAllocation *removeOneIndexedImpl(GraphicsAllocation *node, void *);
+    GraphicsAllocation *removeFrontOneIndexedImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *detachSequenceIndexedImpl(GraphicsAllocation *node, void *data);
+    GraphicsAllocation *detachNodesIndexedImpl(GraphicsAllocation *, void *);
+    GraphicsAllocation *spliceIndexedImpl(GraphicsAllocation *node, void *);
 
+    ReuseIndex reuseIndex;
+    std::unordered_map<GraphicsAllocation *, ReuseIndexLocation> reuseIndexLocations;
+    int64_t headPosition = 0;
+    int64_t tailPosition = 0;
     const AllocationUsage allocationUsage{REUSABLE_ALLOCATION};
 };
 } // namespace NEO
@@ -7,6 +7,7 @@
 
 #include "shared/source/memory_manager/gfx_partition.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/heap_assigner.h"
 #include "shared/source/helpers/ptr_math.h"
@@ -14,8 +15,48 @@
 #include "shared/source/utilities/cpu_info.h"
 #include "shared/source/utilities/heap_allocator.h"
 
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <shared_mutex>
+#include <thread>
+#include <unordered_map>
+
 namespace NEO {
 
+struct GfxPartition::Heap::VaArenas {
+    struct Range {
+        uint64_t base = 0u;
+        uint64_t used = 0u;
+        uint64_t liveSize = 0u;
+        uint32_t arenaIndex = 0u;
+    };
+
+    struct Arena {
+        std::mutex mtx;
+        Range *currentRange = nullptr;
+    };
+
+    std::unique_lock<std::mutex> lockArena(uint32_t arenaIndex) {
+        std::unique_lock<std::mutex> lock(arenas[arenaIndex].mtx, std::try_to_lock);
+        if (!lock.owns_lock()) {
+            contendedLocks++;
+            lock.lock();
+        }
+        return lock;
+    }
+
+    std::array<Arena, GfxPartition::vaArenasCount> arenas;
+    std::shared_mutex rangesMtx;
+    std::unordered_map<uint64_t, std::unique_ptr<Range>> ranges;
+
+    std::atomic<uint64_t> reservedRanges = 0u;
+    std::atomic<uint64_t> releasedRanges = 0u;
+    std::atomic<uint64_t> arenaAllocations = 0u;
+    std::atomic<uint64_t> contendedLocks = 0u;
+    std::atomic<uint64_t> liveSize = 0u;
+};
+
 const std::array<HeapIndex, 4> GfxPartition::heap32Names{{HeapIndex::heapInternalDeviceMemory,
                                                           HeapIndex::heapInternal,
                                                           HeapIndex::heapExternalDeviceMemory,
@@ -102,9 +143,14 @@ GfxPartition::~GfxPartition() {
     osMemory->releaseCpuAddressRange(reservedCpuAddressRangeForHeapExtended);
 }
 
+GfxPartition::Heap::Heap() = default;
+GfxPartition::Heap::~Heap() = default;
+
 void GfxPartition::Heap::init(uint64_t base, uint64_t size, size_t allocationAlignment) {
     this->base = base;
     this->size = size;
+    this->allocationAlignment = allocationAlignment;
+    this->vaArenas.reset();
 
     auto heapGranularity = GfxPartition::heapGranularity;
     if (allocationAlignment > heapGranularity) {
@@ -147,6 +193,12 @@ void GfxPartition::Heap::initFrontWindow(uint64_t base, uint64_t size) {
 }
 
 uint64_t GfxPartition::Heap::allocate(size_t &size) {
+    if (vaArenas && size > 0u && size <= GfxPartition::vaArenaMaxAllocationSize) {
+        auto address = allocateFromVaArena(size);
+        if (address != 0u) {
+            return address;
+        }
+    }
     return alloc->allocate(size);
 }
 
@@ -155,9 +207,108 @@ uint64_t GfxPartition::Heap::allocateWithCustomAlignment(size_t &sizeToAllocate,
 }
 
 void GfxPartition::Heap::free(uint64_t ptr, size_t size) {
+    if (vaArenas && freeToVaArena(ptr, size)) {
+        return;
+    }
     alloc->free(ptr, size);
 }
 
+void GfxPartition::Heap::enableVaArenas() {
+    if (alloc && this->size > GfxPartition::vaArenaRangeSize && allocationAlignment <= GfxPartition::vaArenaMaxAllocationSize) {
+        vaArenas = std::make_unique<VaArenas>();
+    }
+}
+
+VaArenaStatistics GfxPartition::Heap::getVaArenaStatistics() const {
+    VaArenaStatistics statistics{};
+    if (vaArenas) {
+        statistics.reservedRanges = vaArenas->reservedRanges;
+        statistics.releasedRanges = vaArenas->releasedRanges;
+        statistics.arenaAllocations = vaArenas->arenaAllocations;
+        statistics.contendedLocks = vaArenas->contendedLocks;
+        statistics.reservedSize = (statistics.reservedRanges - statistics.releasedRanges) * GfxPartition::vaArenaRangeSize;
+        statistics.liveSize = vaArenas->liveSize;
+    }
+    return statistics;
+}
+
+uint64_t GfxPartition::Heap::allocateFromVaArena(size_t &size) {
+    const auto sizeToAllocate = alignUp(size, allocationAlignment);
+    const auto arenaIndex = static_cast<uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()) % GfxPartition::vaArenasCount);
+    auto &arena = vaArenas->arenas[arenaIndex];
+    auto arenaLock = vaArenas->lockArena(arenaIndex);
+
+    auto range = arena.currentRange;
+    if (range && range->used + sizeToAllocate > GfxPartition::vaArenaRangeSize) {
+        if (range->liveSize == 0u) {
+            range->used = 0u;
+        } else {
+            // range is released back to heap when its last sub-allocation is freed
+            range = nullptr;
+        }
+    }
+
+    if (range == nullptr) {
+        size_t rangeSize = GfxPartition::vaArenaRangeSize;
+        auto rangeBase = alloc->allocateWithCustomAlignment(rangeSize, GfxPartition::vaArenaRangeSize);
+        if (rangeBase == 0u) {
+            return 0u;
+        }
+        auto newRange = std::make_unique<VaArenas::Range>();
+        newRange->base = rangeBase;
+        newRange->arenaIndex = arenaIndex;
+        range = newRange.get();
+        {
+            std::unique_lock<std::shared_mutex> rangesLock(vaArenas->rangesMtx);
+            vaArenas->ranges.emplace(rangeBase, std::move(newRange));
+        }
+        arena.currentRange = range;
+        vaArenas->reservedRanges++;
+    }
+
+    auto address = range->base + range->used;
+    range->used += sizeToAllocate;
+    range->liveSize += sizeToAllocate;
+    vaArenas->liveSize += sizeToAllocate;
+    vaArenas->arenaAllocations++;
+    size = sizeToAllocate;
+    return address;
+}
+
+bool GfxPartition::Heap::freeToVaArena(uint64_t ptr, size_t size) {
+    VaArenas::Range *range = nullptr;
+    {
+        std::shared_lock<std::shared_mutex> rangesLock(vaArenas->rangesMtx);
+        auto rangeIt = vaArenas->ranges.find(alignDown(ptr, GfxPartition::vaArenaRangeSize));
+        if (rangeIt == vaArenas->ranges.end()) {
+            return false;
+        }
+        range = rangeIt->second.get();
+    }
+
+    // range cannot be released concurrently as long as the freed sub-allocation is alive
+    auto &arena = vaArenas->arenas[range->arenaIndex];
+    auto arenaLock = vaArenas->lockArena(range->arenaIndex);
+
+    const auto sizeToFree = std::min(static_cast<uint64_t>(alignUp(size, allocationAlignment)), range->liveSize);
+    range->liveSize -= sizeToFree;
+    vaArenas->liveSize -= sizeToFree;
+    if (range->liveSize == 0u) {
+        if (arena.currentRange == range) {
+            range->used = 0u;
+        } else {
+            auto rangeBase = range->base;
+            {
+                std::unique_lock<std::shared_mutex> rangesLock(vaArenas->rangesMtx);
+                vaArenas->ranges.erase(rangeBase);
+            }
+            alloc->free(rangeBase, GfxPartition::vaArenaRangeSize);
+            vaArenas->releasedRanges++;
+        }
+    }
+    return true;
+}
+
 void GfxPartition::freeGpuAddressRange(uint64_t ptr, size_t size) {
     for (auto heapName : GfxPartition::heapNonSvmNames) {
         auto &heap = getHeap(heapName);
@@ -168,6 +319,15 @@ void GfxPartition::freeGpuAddressRange(uint64_t ptr, size_t size) {
     }
 }
 
+void GfxPartition::initVaArenas(HeapIndex heapIndex) {
+    if (debugManager.flags.EnableGpuVaArenas.get() != 1) {
+        return;
+    }
+    if (heapIndex == HeapIndex::heapStandard || heapIndex == HeapIndex::heapStandard64KB) {
+        getHeap(heapIndex).enableVaArenas();
+    }
+}
+
 uint64_t GfxPartition::getHeapMinimalAddress(HeapIndex heapIndex) {
     if (heapIndex == HeapIndex::heapSvm ||
         heapIndex == HeapIndex::heapExternalDeviceFrontWindow ||
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -34,6 +34,15 @@ enum class HeapIndex : uint32_t {
     totalHeaps
 };
 
+struct VaArenaStatistics {
+    uint64_t reservedRanges = 0u;
+    uint64_t releasedRanges = 0u;
+    uint64_t arenaAllocations = 0u;
+    uint64_t contendedLocks = 0u;
+    uint64_t reservedSize = 0u; // size of ranges currently owned by arenas
+    uint64_t liveSize = 0u;     // size of live sub-allocations, reservedSize - liveSize is lost to fragmentation
+};
+
 class GfxPartition {
   public:
     GfxPartition(OSMemory::ReservedCpuAddressRange &reservedCpuAddressRangeForHeapSvm);
@@ -43,10 +52,12 @@ class GfxPartition {
 
     void heapInit(HeapIndex heapIndex, uint64_t base, uint64_t size) {
         getHeap(heapIndex).init(base, size, MemoryConstants::pageSize);
+        initVaArenas(heapIndex);
     }
 
     void heapInitWithAllocationAlignment(HeapIndex heapIndex, uint64_t base, uint64_t size, size_t allocationAlignment) {
         getHeap(heapIndex).init(base, size, allocationAlignment);
+        initVaArenas(heapIndex);
     }
 
     void heapInitExternalWithFrontWindow(HeapIndex heapIndex, uint64_t base, uint64_t size) {
@@ -85,6 +96,10 @@ class GfxPartition {
 
     uint64_t getHeapMinimalAddress(HeapIndex heapIndex);
 
+    VaArenaStatistics getVaArenaStatistics(HeapIndex heapIndex) {
+        return getHeap(heapIndex).getVaArenaStatistics();
+    }
+
     bool isLimitedRange() { return getHeap(HeapIndex::heapSvm).getSize() == 0ull; }
 
     static bool isAnyHeap32(HeapIndex heapIndex) {
@@ -99,16 +114,21 @@ class GfxPartition {
     static constexpr uint64_t heapGranularity2MB = 2 * MemoryConstants::megaByte;
     static constexpr size_t externalFrontWindowPoolSize = 2 * MemoryConstants::pageSize64k;
     static constexpr size_t internalFrontWindowPoolSize = 1 * MemoryConstants::megaByte;
+    static constexpr size_t vaArenaRangeSize = 4 * MemoryConstants::megaByte;
+    static constexpr size_t vaArenaMaxAllocationSize = 256 * MemoryConstants::kiloByte;
+    static constexpr uint32_t vaArenasCount = 8u;
 
     static const std::array<HeapIndex, 4> heap32Names;
     static const std::array<HeapIndex, 8> heapNonSvmNames;
 
   protected:
     bool initAdditionalRange(uint32_t cpuAddressWidth, uint64_t gpuAddressSpace, uint64_t &gfxBase, uint64_t &gfxTop, uint32_t rootDeviceIndex, size_t numRootDevices, uint64_t systemMemorySize);
+    void initVaArenas(HeapIndex heapIndex);
 
     class Heap {
       public:
-        Heap() = default;
+        Heap();
+        ~Heap();
         void init(uint64_t base, uint64_t size, size_t allocationAlignment);
         void initExternalWithFrontWindow(uint64_t base, uint64_t size);
         void initWithFrontWindow(uint64_t base, uint64_t size, uint64_t frontWindowSize);
@@ -120,9 +140,20 @@ class GfxPartition {
         uint64_t allocateWithCustomAlignment(size_t &sizeToAllocate, size_t alignment);
         void free(uint64_t ptr, size_t size);
 
+        // Small allocations are sub-allocated from ranges reserved per thread arena, so threads do not serialize on the heap allocator
+        void enableVaArenas();
+        VaArenaStatistics getVaArenaStatistics() const;
+
       protected:
+        struct VaArenas;
+
+        uint64_t allocateFromVaArena(size_t &size);
+        bool freeToVaArena(uint64_t ptr, size_t size);
+
         uint64_t base = 0, size = 0;
+        size_t allocationAlignment = MemoryConstants::pageSize;
         std::unique_ptr<HeapAllocator> alloc;
+        std::unique_ptr<VaArenas> vaArenas;
     };
 
     Heap &getHeap(HeapIndex heapIndex) {
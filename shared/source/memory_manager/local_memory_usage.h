@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -32,6 +32,16 @@ class LocalMemoryUsageBankSelector : public NonCopyableOrMovableClass {
         return memorySizes[bankIndex].load();
     }
 
+    uint64_t getOccupiedMemorySizeForBanks(DeviceBitfield deviceBitfield) {
+        uint64_t occupiedMemorySize = 0u;
+        for (uint32_t i = 0u; i < banksCount; i++) {
+            if (deviceBitfield.test(i)) {
+                occupiedMemorySize += memorySizes[i].load();
+            }
+        }
+        return occupiedMemorySize;
+    }
+
   protected:
     uint32_t banksCount = 0;
     std::unique_ptr<std::atomic<uint64_t>[]> memorySizes = nullptr;
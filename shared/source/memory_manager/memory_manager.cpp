@@ -758,6 +758,11 @@ LocalMemoryUsageBankSelector *MemoryManager::getLocalMemoryUsageBankSelector(All
     return internalLocalMemoryUsageBankSelector[rootDeviceIndex].get();
 }
 
+uint64_t MemoryManager::getLocalMemoryUsage(uint32_t rootDeviceIndex, DeviceBitfield deviceBitfield) {
+    return internalLocalMemoryUsageBankSelector[rootDeviceIndex]->getOccupiedMemorySizeForBanks(deviceBitfield) +
+           externalLocalMemoryUsageBankSelector[rootDeviceIndex]->getOccupiedMemorySizeForBanks(deviceBitfield);
+}
+
 const EngineControl *MemoryManager::getRegisteredEngineForCsr(CommandStreamReceiver *commandStreamReceiver) {
     const EngineControl *engineCtrl = nullptr;
     for (auto &engine : getRegisteredEngines(commandStreamReceiver->getRootDeviceIndex())) {
@@ -256,6 +256,7 @@ class MemoryManager {
 
     bool isExternalAllocation(AllocationType allocationType);
     LocalMemoryUsageBankSelector *getLocalMemoryUsageBankSelector(AllocationType allocationType, uint32_t rootDeviceIndex);
+    MOCKABLE_VIRTUAL uint64_t getLocalMemoryUsage(uint32_t rootDeviceIndex, DeviceBitfield deviceBitfield);
 
     bool isLocalMemoryUsedForIsa(uint32_t rootDeviceIndex);
     MOCKABLE_VIRTUAL bool isNonSvmBuffer(const void *hostPtr, AllocationType allocationType, uint32_t rootDeviceIndex) {
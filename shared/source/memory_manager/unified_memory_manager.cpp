@@ -52,10 +52,15 @@ bool SVMAllocsManager::SvmAllocationCache::insert(size_t size, void *ptr) {
     return true;
 }
 
+bool SVMAllocsManager::SvmAllocationCache::isWasteAcceptable(size_t allocationSize, size_t requestedSize) {
+    return allocationSize <= requestedSize * maxWasteRatio ||
+           allocationSize - requestedSize <= MemoryConstants::pageSize64k;
+}
+
 void *SVMAllocsManager::SvmAllocationCache::get(size_t size, const UnifiedMemoryProperties &unifiedMemoryProperties, SVMAllocsManager *svmAllocsManager) {
     std::lock_guard<std::mutex> lock(this->mtx);
     for (auto allocationIter = std::lower_bound(allocations.begin(), allocations.end(), size);
-         allocationIter != allocations.end();
+         allocationIter != allocations.end() && isWasteAcceptable(allocationIter->allocationSize, size);
          ++allocationIter) {
         void *allocationPtr = allocationIter->allocation;
         SvmAllocationData *svmAllocData = svmAllocsManager->getSVMAlloc(allocationPtr);
@@ -64,10 +69,13 @@ void *SVMAllocsManager::SvmAllocationCache::get(size_t size, const UnifiedMemory
             svmAllocData->allocationFlagsProperty.allFlags == unifiedMemoryProperties.allocationFlags.allFlags &&
             svmAllocData->allocationFlagsProperty.allAllocFlags == unifiedMemoryProperties.allocationFlags.allAllocFlags) {
             totalSize -= allocationIter->allocationSize;
+            wastedSize += allocationIter->allocationSize - size;
+            hits++;
             allocations.erase(allocationIter);
             return allocationPtr;
         }
     }
+    misses++;
     return nullptr;
 }
 
@@ -82,6 +90,40 @@ void SVMAllocsManager::SvmAllocationCache::trim(SVMAllocsManager *svmAllocsManag
     this->totalSize = 0u;
 }
 
+void SVMAllocsManager::SvmAllocationCache::trimOldAllocations(std::chrono::steady_clock::time_point trimTime, SVMAllocsManager *svmAllocsManager) {
+    std::lock_guard<std::mutex> lock(this->mtx);
+    if (this->maxIdleTime.count() == 0 || trimTime - this->lastAgingTime < this->maxIdleTime / 2) {
+        return;
+    }
+    this->lastAgingTime = trimTime;
+    for (auto allocationIter = allocations.begin(); allocationIter != allocations.end();) {
+        if (trimTime - allocationIter->saveTime <= this->maxIdleTime) {
+            ++allocationIter;
+            continue;
+        }
+        SvmAllocationData *svmData = svmAllocsManager->getSVMAlloc(allocationIter->allocation);
+        DEBUG_BREAK_IF(nullptr == svmData);
+        svmAllocsManager->freeSVMAllocImpl(allocationIter->allocation, FreePolicyType::none, svmData);
+        this->totalSize -= allocationIter->allocationSize;
+        allocationIter = allocations.erase(allocationIter);
+    }
+}
+
+void SVMAllocsManager::SvmAllocationCache::trimOldestAllocations(size_t sizeToRelease, SVMAllocsManager *svmAllocsManager) {
+    std::lock_guard<std::mutex> lock(this->mtx);
+    const auto size = this->totalSize > sizeToRelease ? this->totalSize - sizeToRelease : 0u;
+    while (this->totalSize > size) {
+        auto oldestIter = std::min_element(allocations.begin(), allocations.end(), [](const auto &lhs, const auto &rhs) {
+            return lhs.saveTime < rhs.saveTime;
+        });
+        SvmAllocationData *svmData = svmAllocsManager->getSVMAlloc(oldestIter->allocation);
+        DEBUG_BREAK_IF(nullptr == svmData);
+        svmAllocsManager->freeSVMAllocImpl(oldestIter->allocation, FreePolicyType::none, svmData);
+        this->totalSize -= oldestIter->allocationSize;
+        allocations.erase(oldestIter);
+    }
+}
+
 SvmAllocationData *SVMAllocsManager::MapBasedAllocationTracker::get(const void *ptr) {
     if (allocations.size() == 0) {
         return nullptr;
@@ -445,10 +487,12 @@ bool SVMAllocsManager::freeSVMAlloc(void *ptr, bool blocking) {
     if (svmDeferFreeAllocs.allocations.size() > 0) {
         this->freeSVMAllocDeferImpl();
     }
+    this->trimUsmAllocationsCachesOnIdle();
     SvmAllocationData *svmData = getSVMAlloc(ptr);
     if (svmData) {
         if (InternalMemoryType::deviceUnifiedMemory == svmData->memoryType &&
-            this->usmDeviceAllocationsCacheEnabled) {
+            this->usmDeviceAllocationsCacheEnabled &&
+            !this->trimUSMDeviceAllocCacheOnMemoryPressure()) {
             if (this->usmDeviceAllocationsCache.insert(svmData->size, ptr)) {
                 return true;
             }
@@ -474,11 +518,13 @@ bool SVMAllocsManager::freeSVMAllocDefer(void *ptr) {
     if (svmDeferFreeAllocs.allocations.size() > 0) {
         this->freeSVMAllocDeferImpl();
     }
+    this->trimUsmAllocationsCachesOnIdle();
 
     SvmAllocationData *svmData = getSVMAlloc(ptr);
     if (svmData) {
         if (InternalMemoryType::deviceUnifiedMemory == svmData->memoryType &&
-            this->usmDeviceAllocationsCacheEnabled) {
+            this->usmDeviceAllocationsCacheEnabled &&
+            !this->trimUSMDeviceAllocCacheOnMemoryPressure()) {
             if (this->usmDeviceAllocationsCache.insert(svmData->size, ptr)) {
                 return true;
             }
@@ -562,6 +608,31 @@ void SVMAllocsManager::trimUSMHostAllocCache() {
     this->usmHostAllocationsCache.trim(this);
 }
 
+void SVMAllocsManager::trimUsmAllocationsCachesOnIdle() {
+    if (!this->usmDeviceAllocationsCacheEnabled && !this->usmHostAllocationsCacheEnabled) {
+        return;
+    }
+    const auto trimTime = std::chrono::steady_clock::now();
+    if (this->usmDeviceAllocationsCacheEnabled) {
+        this->usmDeviceAllocationsCache.trimOldAllocations(trimTime, this);
+    }
+    if (this->usmHostAllocationsCacheEnabled) {
+        this->usmHostAllocationsCache.trimOldAllocations(trimTime, this);
+    }
+}
+
+bool SVMAllocsManager::trimUSMDeviceAllocCacheOnMemoryPressure() {
+    if (this->usmDeviceAllocationsCacheMemoryPressureLimit == 0u) {
+        return false;
+    }
+    const auto localMemoryUsage = this->memoryManager->getLocalMemoryUsage(this->usmDeviceAllocationsCacheRootDeviceIndex, this->usmDeviceAllocationsCacheDeviceBitfield);
+    if (localMemoryUsage <= this->usmDeviceAllocationsCacheMemoryPressureLimit) {
+        return false;
+    }
+    this->usmDeviceAllocationsCache.trimOldestAllocations(static_cast<size_t>(localMemoryUsage - this->usmDeviceAllocationsCacheMemoryPressureLimit), this);
+    return true;
+}
+
 void *SVMAllocsManager::createZeroCopySvmAllocation(size_t size, const SvmAllocationProperties &svmProperties,
                                                     const RootDeviceIndicesContainer &rootDeviceIndices,
                                                     const std::map<uint32_t, DeviceBitfield> &subdeviceBitfields) {
@@ -682,6 +753,14 @@ void SVMAllocsManager::freeZeroCopySvmAllocation(SvmAllocationData *svmData) {
     }
 }
 
+static std::chrono::milliseconds getUsmAllocationsCacheMaxIdleTime() {
+    auto maxIdleTimeMs = 10000;
+    if (debugManager.flags.ExperimentalUsmAllocationCacheMaxIdleTime.get() != -1) {
+        maxIdleTimeMs = debugManager.flags.ExperimentalUsmAllocationCacheMaxIdleTime.get();
+    }
+    return std::chrono::milliseconds(maxIdleTimeMs);
+}
+
 void SVMAllocsManager::initUsmDeviceAllocationsCache(Device &device) {
     this->usmDeviceAllocationsCache.allocations.reserve(128u);
     const auto totalDeviceMemory = device.getGlobalMemorySize(static_cast<uint32_t>(device.getDeviceBitfield().to_ulong()));
@@ -690,6 +769,15 @@ void SVMAllocsManager::initUsmDeviceAllocationsCache(Device &device) {
         fractionOfTotalMemoryForRecycling = 0.01 * std::min(100, debugManager.flags.ExperimentalEnableDeviceAllocationCache.get());
     }
     this->usmDeviceAllocationsCache.maxSize = static_cast<size_t>(fractionOfTotalMemoryForRecycling * totalDeviceMemory);
+    this->usmDeviceAllocationsCache.maxIdleTime = getUsmAllocationsCacheMaxIdleTime();
+
+    auto memoryPressureThreshold = 90;
+    if (debugManager.flags.ExperimentalUsmAllocationCacheMemoryPressureThreshold.get() != -1) {
+        memoryPressureThreshold = std::min(100, debugManager.flags.ExperimentalUsmAllocationCacheMemoryPressureThreshold.get());
+    }
+    this->usmDeviceAllocationsCacheMemoryPressureLimit = static_cast<uint64_t>(0.01 * memoryPressureThreshold * totalDeviceMemory);
+    this->usmDeviceAllocationsCacheRootDeviceIndex = device.getRootDeviceIndex();
+    this->usmDeviceAllocationsCacheDeviceBitfield = device.getDeviceBitfield();
 }
 
 void SVMAllocsManager::initUsmHostAllocationsCache() {
@@ -700,6 +788,7 @@ void SVMAllocsManager::initUsmHostAllocationsCache() {
         fractionOfTotalMemoryForRecycling = 0.01 * std::min(100, debugManager.flags.ExperimentalEnableHostAllocationCache.get());
     }
     this->usmHostAllocationsCache.maxSize = static_cast<size_t>(fractionOfTotalMemoryForRecycling * totalSystemMemory);
+    this->usmHostAllocationsCache.maxIdleTime = getUsmAllocationsCacheMaxIdleTime();
 }
 
 void SVMAllocsManager::initUsmAllocationsCaches(Device &device) {
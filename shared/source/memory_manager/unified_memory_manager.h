@@ -16,6 +16,7 @@
 #include "memory_properties_flags.h"
 
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <map>
 #include <memory>
@@ -143,7 +144,8 @@ class SVMAllocsManager {
     struct SvmCacheAllocationInfo {
         size_t allocationSize;
         void *allocation;
-        SvmCacheAllocationInfo(size_t allocationSize, void *allocation) : allocationSize(allocationSize), allocation(allocation) {}
+        std::chrono::steady_clock::time_point saveTime;
+        SvmCacheAllocationInfo(size_t allocationSize, void *allocation) : allocationSize(allocationSize), allocation(allocation), saveTime(std::chrono::steady_clock::now()) {}
         bool operator<(SvmCacheAllocationInfo const &other) const {
             return allocationSize < other.allocationSize;
         }
@@ -153,13 +155,24 @@ class SVMAllocsManager {
     };
 
     struct SvmAllocationCache {
+        // cached allocation is reused only if it is at most maxWasteRatio times larger than requested, or within 64KB of requested size
+        static constexpr size_t maxWasteRatio = 2u;
+        static bool isWasteAcceptable(size_t allocationSize, size_t requestedSize);
+
         bool insert(size_t size, void *);
         void *get(size_t size, const UnifiedMemoryProperties &unifiedMemoryProperties, SVMAllocsManager *svmAllocsManager);
         void trim(SVMAllocsManager *svmAllocsManager);
+        void trimOldAllocations(std::chrono::steady_clock::time_point trimTime, SVMAllocsManager *svmAllocsManager);
+        void trimOldestAllocations(size_t sizeToRelease, SVMAllocsManager *svmAllocsManager);
         std::vector<SvmCacheAllocationInfo> allocations;
         std::mutex mtx;
         size_t maxSize = 0;
         size_t totalSize = 0;
+        std::chrono::milliseconds maxIdleTime{0};
+        std::chrono::steady_clock::time_point lastAgingTime{};
+        uint64_t hits = 0;
+        uint64_t misses = 0;
+        uint64_t wastedSize = 0;
     };
 
     enum class FreePolicyType : uint32_t {
@@ -208,6 +221,8 @@ class SVMAllocsManager {
     bool freeSVMAlloc(void *ptr) { return freeSVMAlloc(ptr, false); }
     void trimUSMDeviceAllocCache();
     void trimUSMHostAllocCache();
+    void trimUsmAllocationsCachesOnIdle();
+    bool trimUSMDeviceAllocCacheOnMemoryPressure();
     void insertSVMAlloc(const SvmAllocationData &svmData);
     void removeSVMAlloc(const SvmAllocationData &svmData);
     size_t getNumAllocs() const { return svmAllocs.getNumAllocs(); }
@@ -259,6 +274,9 @@ class SVMAllocsManager {
     bool multiOsContextSupport;
     SvmAllocationCache usmDeviceAllocationsCache;
     SvmAllocationCache usmHostAllocationsCache;
+    uint64_t usmDeviceAllocationsCacheMemoryPressureLimit = 0;
+    uint32_t usmDeviceAllocationsCacheRootDeviceIndex = 0;
+    DeviceBitfield usmDeviceAllocationsCacheDeviceBitfield;
     bool usmDeviceAllocationsCacheEnabled = false;
     bool usmHostAllocationsCacheEnabled = false;
 };
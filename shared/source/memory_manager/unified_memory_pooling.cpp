@@ -12,9 +12,15 @@
 #include "shared/source/memory_manager/unified_memory_manager.h"
 #include "shared/source/utilities/heap_allocator.h"
 
+#include <algorithm>
+
 namespace NEO {
 
 bool UsmMemAllocPool::initialize(SVMAllocsManager *svmMemoryManager, const UnifiedMemoryProperties &memoryProperties, size_t poolSize) {
+    return initialize(svmMemoryManager, memoryProperties, poolSize, allocationThreshold);
+}
+
+bool UsmMemAllocPool::initialize(SVMAllocsManager *svmMemoryManager, const UnifiedMemoryProperties &memoryProperties, size_t poolSize, size_t maxServicedSize) {
     this->pool = svmMemoryManager->createUnifiedMemoryAllocation(poolSize, memoryProperties);
     if (nullptr == this->pool) {
         return false;
@@ -25,6 +31,8 @@ bool UsmMemAllocPool::initialize(SVMAllocsManager *svmMemoryManager, const Unifi
                                                  poolSize,
                                                  chunkAlignment));
     this->poolSize = poolSize;
+    this->maxServicedSize = maxServicedSize;
+    this->usedSize = 0u;
     this->poolMemoryType = memoryProperties.memoryType;
     return true;
 }
@@ -34,8 +42,12 @@ bool UsmMemAllocPool::isInitialized() {
 }
 
 void UsmMemAllocPool::cleanup() {
+    cleanup(true);
+}
+
+void UsmMemAllocPool::cleanup(bool blocking) {
     if (isInitialized()) {
-        this->svmMemoryManager->freeSVMAlloc(this->pool, true);
+        this->svmMemoryManager->freeSVMAlloc(this->pool, blocking);
         this->svmMemoryManager = nullptr;
         this->pool = nullptr;
         this->poolEnd = nullptr;
@@ -49,7 +61,7 @@ bool UsmMemAllocPool::alignmentIsAllowed(size_t alignment) {
 }
 
 bool UsmMemAllocPool::canBePooled(size_t size, const UnifiedMemoryProperties &memoryProperties) {
-    return size <= allocationThreshold &&
+    return size <= this->maxServicedSize &&
            alignmentIsAllowed(memoryProperties.alignment) &&
            memoryProperties.memoryType == this->poolMemoryType &&
            memoryProperties.allocationFlags.allFlags == 0u &&
@@ -71,6 +83,7 @@ void *UsmMemAllocPool::createUnifiedMemoryAllocation(size_t requestedSize, const
 
         pooledPtr = addrToPtr(pooledAddress);
         this->allocations.insert(pooledPtr, AllocationInfo{pooledAddress, actualSize, requestedSize});
+        this->usedSize += actualSize;
 
         ++this->svmMemoryManager->allocationsCounter;
     }
@@ -88,6 +101,7 @@ bool UsmMemAllocPool::freeSVMAlloc(void *ptr, bool blocking) {
         if (allocationInfo) {
             DEBUG_BREAK_IF(allocationInfo->size == 0 || allocationInfo->address == 0);
             this->chunkAllocator->free(allocationInfo->address, allocationInfo->size);
+            this->usedSize -= allocationInfo->size;
             return true;
         }
     }
@@ -116,4 +130,178 @@ void *UsmMemAllocPool::getPooledAllocationBasePtr(const void *ptr) {
     return nullptr;
 }
 
+size_t UsmMemAllocPool::getUsedSize() {
+    std::unique_lock<std::mutex> lock(mtx);
+    return this->usedSize;
+}
+
+size_t UsmMemAllocPool::getAllocationsCount() {
+    std::unique_lock<std::mutex> lock(mtx);
+    return this->allocations.getNumAllocs();
+}
+
+bool UsmMemAllocPool::isEmpty() {
+    return 0u == getAllocationsCount();
+}
+
+UsmMemAllocPoolsManager::UsmMemAllocPoolsManager(SVMAllocsManager *svmMemoryManager, InternalMemoryType memoryType) : svmMemoryManager(svmMemoryManager), memoryType(memoryType) {
+    if (debugManager.flags.UsmAllocationPoolsManagerMaxIdleTime.get() != -1) {
+        this->maxIdleTime = std::chrono::milliseconds(debugManager.flags.UsmAllocationPoolsManagerMaxIdleTime.get());
+    }
+}
+
+void UsmMemAllocPoolsManager::cleanup() {
+    std::unique_lock<std::shared_mutex> lock(mtx);
+    for (auto &[device, devicePools] : this->pools) {
+        for (auto &tierPools : devicePools) {
+            for (auto &managedPool : tierPools) {
+                managedPool->pool->cleanup();
+            }
+        }
+    }
+    this->pools.clear();
+    this->poolsByAddress.clear();
+}
+
+bool UsmMemAllocPoolsManager::canBePooled(size_t size, const UnifiedMemoryProperties &memoryProperties) {
+    return size <= poolTiers.back().maxServicedSize &&
+           memoryProperties.alignment % UsmMemAllocPool::chunkAlignment == 0 &&
+           memoryProperties.memoryType == this->memoryType &&
+           memoryProperties.allocationFlags.allFlags == 0u &&
+           memoryProperties.allocationFlags.allAllocFlags == 0u;
+}
+
+void *UsmMemAllocPoolsManager::allocateFromPools(TierPools &tierPools, size_t size, const UnifiedMemoryProperties &memoryProperties) {
+    for (auto &managedPool : tierPools) {
+        if (auto pooledPtr = managedPool->pool->createUnifiedMemoryAllocation(size, memoryProperties)) {
+            managedPool->emptySince.store({});
+            return pooledPtr;
+        }
+    }
+    return nullptr;
+}
+
+void *UsmMemAllocPoolsManager::createUnifiedMemoryAllocation(size_t size, const UnifiedMemoryProperties &memoryProperties) {
+    if (false == canBePooled(size, memoryProperties)) {
+        return nullptr;
+    }
+    size_t tierIndex = 0u;
+    while (size > poolTiers[tierIndex].maxServicedSize) {
+        tierIndex++;
+    }
+
+    {
+        std::shared_lock<std::shared_mutex> lock(mtx);
+        auto devicePools = this->pools.find(memoryProperties.device);
+        if (devicePools != this->pools.end()) {
+            if (auto pooledPtr = allocateFromPools(devicePools->second[tierIndex], size, memoryProperties)) {
+                return pooledPtr;
+            }
+        }
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mtx);
+    auto &tierPools = this->pools[memoryProperties.device][tierIndex];
+    // space may have been freed or pool added by other thread since shared lock was released
+    if (auto pooledPtr = allocateFromPools(tierPools, size, memoryProperties)) {
+        return pooledPtr;
+    }
+
+    UnifiedMemoryProperties poolMemoryProperties(this->memoryType, MemoryConstants::pageSize2M, memoryProperties.rootDeviceIndices, memoryProperties.subdeviceBitfields);
+    poolMemoryProperties.device = memoryProperties.device;
+    auto managedPool = std::make_unique<ManagedPool>();
+    managedPool->pool = std::make_unique<UsmMemAllocPool>();
+    if (false == managedPool->pool->initialize(this->svmMemoryManager, poolMemoryProperties, poolTiers[tierIndex].poolSize, poolTiers[tierIndex].maxServicedSize)) {
+        return nullptr;
+    }
+    auto pooledPtr = managedPool->pool->createUnifiedMemoryAllocation(size, memoryProperties);
+    this->poolsByAddress[managedPool->pool->getPoolAddress()] = managedPool.get();
+    tierPools.push_back(std::move(managedPool));
+    return pooledPtr;
+}
+
+bool UsmMemAllocPoolsManager::freeSVMAlloc(void *ptr, bool blocking) {
+    {
+        std::shared_lock<std::shared_mutex> lock(mtx);
+        auto managedPool = getPoolContaining(ptr);
+        if (managedPool == nullptr || false == managedPool->pool->freeSVMAlloc(ptr, blocking)) {
+            return false;
+        }
+        if (managedPool->pool->isEmpty()) {
+            managedPool->emptySince.store(std::chrono::steady_clock::now());
+        }
+    }
+    trimIdlePools(std::chrono::steady_clock::now(), blocking);
+    return true;
+}
+
+void UsmMemAllocPoolsManager::trimIdlePools(std::chrono::steady_clock::time_point trimTime, bool blocking) {
+    auto lastTrim = this->lastTrimTime.load();
+    if (trimTime - lastTrim < this->maxIdleTime / 2 || false == this->lastTrimTime.compare_exchange_strong(lastTrim, trimTime)) {
+        return;
+    }
+
+    std::unique_lock<std::shared_mutex> lock(mtx);
+    for (auto &[device, devicePools] : this->pools) {
+        for (auto &tierPools : devicePools) {
+            auto emptyPools = std::count_if(tierPools.begin(), tierPools.end(), [](auto &managedPool) { return managedPool->pool->isEmpty(); });
+            for (auto it = tierPools.begin(); it != tierPools.end() && emptyPools > 1;) {
+                auto &managedPool = *it;
+                auto emptySince = managedPool->emptySince.load();
+                if (false == managedPool->pool->isEmpty() || trimTime - emptySince < this->maxIdleTime) {
+                    ++it;
+                    continue;
+                }
+                if (emptySince == std::chrono::steady_clock::time_point{}) {
+                    // emptied while allocation into it was recorded, idle time starts now
+                    managedPool->emptySince.store(trimTime);
+                    ++it;
+                    continue;
+                }
+                this->poolsByAddress.erase(managedPool->pool->getPoolAddress());
+                managedPool->pool->cleanup(blocking);
+                it = tierPools.erase(it);
+                emptyPools--;
+            }
+        }
+    }
+}
+
+UsmMemAllocPoolsManager::ManagedPool *UsmMemAllocPoolsManager::getPoolContaining(const void *ptr) {
+    auto poolIt = this->poolsByAddress.upper_bound(ptr);
+    if (poolIt == this->poolsByAddress.begin()) {
+        return nullptr;
+    }
+    --poolIt;
+    return poolIt->second->pool->isInPool(ptr) ? poolIt->second : nullptr;
+}
+
+size_t UsmMemAllocPoolsManager::getPooledAllocationSize(const void *ptr) {
+    std::shared_lock<std::shared_mutex> lock(mtx);
+    auto managedPool = getPoolContaining(ptr);
+    return managedPool ? managedPool->pool->getPooledAllocationSize(ptr) : 0u;
+}
+
+void *UsmMemAllocPoolsManager::getPooledAllocationBasePtr(const void *ptr) {
+    std::shared_lock<std::shared_mutex> lock(mtx);
+    auto managedPool = getPoolContaining(ptr);
+    return managedPool ? managedPool->pool->getPooledAllocationBasePtr(ptr) : nullptr;
+}
+
+UsmMemAllocPoolsManager::Statistics UsmMemAllocPoolsManager::getStatistics() {
+    Statistics statistics{};
+    std::shared_lock<std::shared_mutex> lock(mtx);
+    for (auto &[device, devicePools] : this->pools) {
+        for (size_t tierIndex = 0; tierIndex < poolTiers.size(); tierIndex++) {
+            for (auto &managedPool : devicePools[tierIndex]) {
+                statistics[tierIndex].poolsCount++;
+                statistics[tierIndex].poolsSize += managedPool->pool->getPoolSize();
+                statistics[tierIndex].usedSize += managedPool->pool->getUsedSize();
+                statistics[tierIndex].allocationsCount += managedPool->pool->getAllocationsCount();
+            }
+        }
+    }
+    return statistics;
+}
+
 } // namespace NEO
\ No newline at end of file
@@ -11,6 +11,12 @@
 #include "shared/source/utilities/heap_allocator.h"
 #include "shared/source/utilities/sorted_vector.h"
 
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <map>
+#include <shared_mutex>
+
 namespace NEO {
 class UsmMemAllocPool {
   public:
@@ -24,8 +30,10 @@ class UsmMemAllocPool {
 
     UsmMemAllocPool() = default;
     bool initialize(SVMAllocsManager *svmMemoryManager, const UnifiedMemoryProperties &memoryProperties, size_t poolSize);
+    bool initialize(SVMAllocsManager *svmMemoryManager, const UnifiedMemoryProperties &memoryProperties, size_t poolSize, size_t maxServicedSize);
     bool isInitialized();
     void cleanup();
+    void cleanup(bool blocking);
     bool alignmentIsAllowed(size_t alignment);
     bool canBePooled(size_t size, const UnifiedMemoryProperties &memoryProperties);
     void *createUnifiedMemoryAllocation(size_t size, const UnifiedMemoryProperties &memoryProperties);
@@ -33,6 +41,11 @@ class UsmMemAllocPool {
     bool freeSVMAlloc(void *ptr, bool blocking);
     size_t getPooledAllocationSize(const void *ptr);
     void *getPooledAllocationBasePtr(const void *ptr);
+    void *getPoolAddress() const { return pool; }
+    size_t getPoolSize() const { return poolSize; }
+    size_t getUsedSize();
+    size_t getAllocationsCount();
+    bool isEmpty();
 
     static constexpr auto allocationThreshold = 1 * MemoryConstants::megaByte;
     static constexpr auto chunkAlignment = 512u;
@@ -40,6 +53,8 @@ class UsmMemAllocPool {
 
   protected:
     size_t poolSize{};
+    size_t maxServicedSize = allocationThreshold;
+    size_t usedSize{};
     std::unique_ptr<HeapAllocator> chunkAllocator;
     void *pool{};
     void *poolEnd{};
@@ -49,4 +64,58 @@ class UsmMemAllocPool {
     InternalMemoryType poolMemoryType;
 };
 
+// Serves pooled allocations of one memory type from pools split into size tiers.
+// Pools are created on demand per device. Pools staying empty for longer than max idle time are released,
+// keeping one spare empty pool per tier.
+class UsmMemAllocPoolsManager {
+  public:
+    using UnifiedMemoryProperties = SVMAllocsManager::UnifiedMemoryProperties;
+    struct PoolTier {
+        size_t maxServicedSize;
+        size_t poolSize;
+    };
+    static constexpr std::array<PoolTier, 3> poolTiers = {{{64 * MemoryConstants::kiloByte, 2 * MemoryConstants::megaByte},
+                                                           {2 * MemoryConstants::megaByte, 16 * MemoryConstants::megaByte},
+                                                           {16 * MemoryConstants::megaByte, 64 * MemoryConstants::megaByte}}};
+    struct TierStatistics {
+        size_t poolsCount;
+        size_t poolsSize;
+        size_t usedSize;
+        size_t allocationsCount;
+    };
+    using Statistics = std::array<TierStatistics, poolTiers.size()>;
+    static constexpr std::chrono::milliseconds defaultMaxIdleTime{1000};
+
+    UsmMemAllocPoolsManager(SVMAllocsManager *svmMemoryManager, InternalMemoryType memoryType);
+    ~UsmMemAllocPoolsManager() { cleanup(); }
+
+    void cleanup();
+    bool canBePooled(size_t size, const UnifiedMemoryProperties &memoryProperties);
+    void *createUnifiedMemoryAllocation(size_t size, const UnifiedMemoryProperties &memoryProperties);
+    bool freeSVMAlloc(void *ptr, bool blocking);
+    size_t getPooledAllocationSize(const void *ptr);
+    void *getPooledAllocationBasePtr(const void *ptr);
+    Statistics getStatistics();
+
+  protected:
+    struct ManagedPool {
+        std::unique_ptr<UsmMemAllocPool> pool;
+        std::atomic<std::chrono::steady_clock::time_point> emptySince{}; // default while pool holds allocations
+    };
+    using TierPools = std::vector<std::unique_ptr<ManagedPool>>;
+    using DevicePools = std::array<TierPools, poolTiers.size()>;
+
+    ManagedPool *getPoolContaining(const void *ptr);
+    void *allocateFromPools(TierPools &tierPools, size_t size, const UnifiedMemoryProperties &memoryProperties);
+    void trimIdlePools(std::chrono::steady_clock::time_point trimTime, bool blocking);
+
+    std::map<Device *, DevicePools> pools;
+    std::map<const void *, ManagedPool *> poolsByAddress; // keyed by pool start address
+    SVMAllocsManager *svmMemoryManager = nullptr;
+    InternalMemoryType memoryType = InternalMemoryType::notSpecified;
+    std::chrono::milliseconds maxIdleTime{defaultMaxIdleTime};
+    std::atomic<std::chrono::steady_clock::time_point> lastTrimTime{};
+    std::shared_mutex mtx; // exclusive only when pools are added or released
+};
+
 } // namespace NEO
\ No newline at end of file
@@ -152,6 +152,8 @@ class BufferObject {
     uint64_t peekUnmapSize() const { return unmapSize; }
     bool peekIsReusableAllocation() const { return this->isReused; }
     void markAsReusableAllocation() { this->isReused = true; }
+    bool peekIsIpcImportCached() const { return this->isIpcImportCached; }
+    void markAsIpcImportCached() { this->isIpcImportCached = true; }
     void addBindExtHandle(uint32_t handle);
     const StackVec<uint32_t, 2> &getBindExtHandles() const { return bindExtHandles; }
     void markForCapture() {
@@ -240,6 +242,7 @@ class BufferObject {
     BufferObjectHandleWrapper handle; // i915 gem object handle
 
     bool isReused = false;
+    bool isIpcImportCached = false;
     bool boHandleShared = false;
 
     bool allowCapture = false;
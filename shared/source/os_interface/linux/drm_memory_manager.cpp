@@ -182,6 +182,12 @@ void DrmMemoryManager::releaseBufferObject(uint32_t rootDeviceIndex) {
 }
 
 void DrmMemoryManager::commonCleanup() {
+    if (isIpcImportCacheEnabled()) {
+        PRINT_DEBUG_STRING(debugManager.flags.PrintDebugMessages.get(), stdout, "IPC import cache: hits %llu, misses %llu, evictions %llu\n",
+                           ipcImportCacheStatistics.hits, ipcImportCacheStatistics.misses, ipcImportCacheStatistics.evictions);
+    }
+    releaseIpcImportCache();
+
     if (gemCloseWorker) {
         gemCloseWorker->close(true);
     }
@@ -204,6 +210,51 @@ void DrmMemoryManager::pushSharedBufferObject(NEO::BufferObject *bo) {
     sharingBufferObjects.push_back(bo);
 }
 
+bool DrmMemoryManager::isIpcImportCacheEnabled() const {
+    return debugManager.flags.EnableIpcImportCache.get() == 1;
+}
+
+size_t DrmMemoryManager::getIpcImportCacheMaxIdleEntries() const {
+    if (debugManager.flags.IpcImportCacheMaxIdleEntries.get() != -1) {
+        return static_cast<size_t>(debugManager.flags.IpcImportCacheMaxIdleEntries.get());
+    }
+    return defaultIpcImportCacheMaxIdleEntries;
+}
+
+BufferObject *DrmMemoryManager::findAndReferenceIpcImportCacheEntry(int boHandle, uint32_t rootDeviceIndex) {
+    // only closed imports are reused, each open import owns its BO, GPU VA and SVM registration
+    for (auto it = ipcImportCacheIdleEntries.begin(); it != ipcImportCacheIdleEntries.end(); ++it) {
+        auto bo = *it;
+        if (bo->getHandle() == boHandle && bo->getRootDeviceIndex() == rootDeviceIndex) {
+            bo->reference();
+            ipcImportCacheIdleEntries.erase(it);
+            ipcImportCacheStatistics.hits++;
+            return bo;
+        }
+    }
+    return nullptr;
+}
+
+void DrmMemoryManager::releaseIpcImportCacheEntry(BufferObject *bo) {
+    DrmMemoryManager::unreference(bo, false);
+}
+
+void DrmMemoryManager::releaseIpcImportCache() {
+    std::list<BufferObject *> idleEntries;
+    {
+        std::lock_guard lock{mtx};
+        idleEntries.swap(ipcImportCacheIdleEntries);
+    }
+    for (auto bo : idleEntries) {
+        releaseIpcImportCacheEntry(bo);
+    }
+}
+
+DrmMemoryManager::IpcImportCacheStatistics DrmMemoryManager::getIpcImportCacheStatistics() {
+    std::lock_guard lock{mtx};
+    return ipcImportCacheStatistics;
+}
+
 uint32_t DrmMemoryManager::unreference(NEO::BufferObject *bo, bool synchronousDestroy) {
     if (!bo)
         return -1;
@@ -220,6 +271,26 @@ uint32_t DrmMemoryManager::unreference(NEO::BufferObject *bo, bool synchronousDe
 
     uint32_t r = bo->unreference();
 
+    if (r == 2 && bo->peekIsIpcImportCached()) {
+        // only the cache reference is left, keep import for reopening and release least recently closed ones over the limit
+        if (!lock.owns_lock()) {
+            lock.lock();
+        }
+        ipcImportCacheIdleEntries.push_front(bo);
+        std::vector<BufferObject *> evictedEntries;
+        while (ipcImportCacheIdleEntries.size() > getIpcImportCacheMaxIdleEntries()) {
+            evictedEntries.push_back(ipcImportCacheIdleEntries.back());
+            ipcImportCacheIdleEntries.pop_back();
+            ipcImportCacheStatistics.evictions++;
+        }
+        lock.unlock();
+
+        for (auto evictedBo : evictedEntries) {
+            releaseIpcImportCacheEntry(evictedBo);
+        }
+        return r;
+    }
+
     if (r == 1) {
         if (bo->peekIsReusableAllocation()) {
             eraseSharedBufferObject(bo);
@@ -1001,6 +1072,9 @@ GraphicsAllocation *DrmMemoryManager::createGraphicsAllocationFromSharedHandle(o
         return createUSMHostAllocationFromSharedHandle(handle, properties, nullptr, reuseSharedAllocation);
     }
 
+    // imports of plain buffers are cached by GEM handle, which identifies the exported object within this DRM file
+    const bool useIpcImportCache = isIpcImportCacheEnabled() && !reuseSharedAllocation && !requireSpecificBitness && mapPointer == nullptr && properties.imgInfo == nullptr;
+
     std::unique_lock<std::mutex> lock(mtx);
 
     PrimeHandle openFd{};
@@ -1023,6 +1097,8 @@ GraphicsAllocation *DrmMemoryManager::createGraphicsAllocationFromSharedHandle(o
     BufferObject *bo = nullptr;
     if (reuseSharedAllocation) {
         bo = findAndReferenceSharedBufferObject(boHandle, properties.rootDeviceIndex);
+    } else if (useIpcImportCache) {
+        bo = findAndReferenceIpcImportCacheEntry(boHandle, properties.rootDeviceIndex);
     }
 
     const auto memoryPool = MemoryPool::systemCpuInaccessible;
@@ -1079,6 +1155,14 @@ GraphicsAllocation *DrmMemoryManager::createGraphicsAllocationFromSharedHandle(o
                          bo->peekSize());
 
         pushSharedBufferObject(bo);
+
+        if (useIpcImportCache) {
+            // reference owned by cache keeps BO and its GPU VA alive after close. There is no CPU mapping to keep:
+            // imports use BO address as CPU pointer, so lockResource returns it without mmap
+            bo->markAsIpcImportCached();
+            bo->reference();
+            ipcImportCacheStatistics.misses++;
+        }
     }
 
     if (reuseSharedAllocation) {
@@ -10,6 +10,7 @@
 #include "shared/source/os_interface/linux/drm_buffer_object.h"
 
 #include <limits>
+#include <list>
 #include <map>
 #include <sys/mman.h>
 #include <unistd.h>
@@ -26,6 +27,13 @@ enum class GemCloseWorkerMode;
 
 class DrmMemoryManager : public MemoryManager {
   public:
+    struct IpcImportCacheStatistics {
+        uint64_t hits = 0u;
+        uint64_t misses = 0u;
+        uint64_t evictions = 0u;
+    };
+    static constexpr size_t defaultIpcImportCacheMaxIdleEntries = 64u;
+
     DrmMemoryManager(GemCloseWorkerMode mode,
                      bool forcePinAllowed,
                      bool validateHostPtrMemory,
@@ -54,6 +62,9 @@ class DrmMemoryManager : public MemoryManager {
     void cleanOsHandles(OsHandleStorage &handleStorage, uint32_t rootDeviceIndex) override;
     void commonCleanup() override;
 
+    IpcImportCacheStatistics getIpcImportCacheStatistics();
+    void releaseIpcImportCache();
+
     // drm/i915 ioctl wrappers
     MOCKABLE_VIRTUAL uint32_t unreference(BufferObject *bo, bool synchronousDestroy);
 
@@ -108,6 +119,10 @@ class DrmMemoryManager : public MemoryManager {
     MOCKABLE_VIRTUAL BufferObject *findAndReferenceSharedBufferObject(int boHandle, uint32_t rootDeviceIndex);
     void eraseSharedBufferObject(BufferObject *bo);
     void pushSharedBufferObject(BufferObject *bo);
+    bool isIpcImportCacheEnabled() const;
+    size_t getIpcImportCacheMaxIdleEntries() const;
+    BufferObject *findAndReferenceIpcImportCacheEntry(int boHandle, uint32_t rootDeviceIndex);
+    void releaseIpcImportCacheEntry(BufferObject *bo);
     BufferObject *allocUserptr(uintptr_t address, size_t size, uint32_t rootDeviceIndex);
     bool setDomainCpu(GraphicsAllocation &graphicsAllocation, bool writeEnable);
     MOCKABLE_VIRTUAL uint64_t acquireGpuRange(size_t &size, uint32_t rootDeviceIndex, HeapIndex heapIndex);
@@ -170,6 +185,8 @@ class DrmMemoryManager : public MemoryManager {
     decltype(&munmap) munmapFunction = munmap;
     decltype(&close) closeFunction = close;
     std::vector<BufferObject *> sharingBufferObjects;
+    std::list<BufferObject *> ipcImportCacheIdleEntries; // closed imports, most recently closed first
+    IpcImportCacheStatistics ipcImportCacheStatistics;
     std::mutex mtx;
 
     std::map<int, BufferObjectHandleWrapper> sharedBoHandles;
@@ -0,0 +1,108 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/program/isa_allocation_cache.h"
+
+#include "shared/source/device/device.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/helpers/hash.h"
+#include "shared/source/memory_manager/allocation_properties.h"
+#include "shared/source/memory_manager/graphics_allocation.h"
+#include "shared/source/memory_manager/memory_manager.h"
+
+#include <cstring>
+#include <limits>
+
+namespace NEO {
+
+IsaAllocationCache::~IsaAllocationCache() {
+    DEBUG_BREAK_IF(!hashesByAllocation.empty());
+    for (auto &[hash, entry] : entries) {
+        memoryManager.freeGraphicsMemory(entry->allocation);
+    }
+}
+
+GraphicsAllocation *IsaAllocationCache::acquire(Device &device, AllocationType allocationType, const void *isa, size_t isaSize) {
+    auto hash = Hash::hash(reinterpret_cast<const char *>(isa), isaSize);
+    auto deviceBitfield = device.getDeviceBitfield();
+
+    std::lock_guard<std::mutex> lock(mtx);
+    auto [first, last] = entries.equal_range(hash);
+    for (auto it = first; it != last; ++it) {
+        auto &entry = *it->second;
+        if (entry.allocationType == allocationType && entry.deviceBitfield == deviceBitfield &&
+            entry.isa.size() == isaSize && memcmp(entry.isa.data(), isa, isaSize) == 0) {
+            entry.refCount++;
+            statistics.hits++;
+            statistics.savedBytes += entry.allocation->getUnderlyingBufferSize();
+            return entry.allocation;
+        }
+    }
+
+    // uploaded under the lock so other modules never observe allocation before ISA is in place
+    auto allocation = allocateAndUpload(device, allocationType, isa, isaSize);
+    if (allocation == nullptr) {
+        return nullptr;
+    }
+
+    auto entry = std::make_unique<Entry>();
+    entry->isa.assign(reinterpret_cast<const uint8_t *>(isa), reinterpret_cast<const uint8_t *>(isa) + isaSize);
+    entry->allocationType = allocationType;
+    entry->deviceBitfield = deviceBitfield;
+    entry->allocation = allocation;
+    entry->refCount = 1u;
+    entries.emplace(hash, std::move(entry));
+    hashesByAllocation[allocation] = hash;
+    statistics.uploads++;
+    return allocation;
+}
+
+void IsaAllocationCache::release(GraphicsAllocation *allocation) {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto hashIt = hashesByAllocation.find(allocation);
+    UNRECOVERABLE_IF(hashIt == hashesByAllocation.end());
+
+    auto [first, last] = entries.equal_range(hashIt->second);
+    for (auto it = first; it != last; ++it) {
+        if (it->second->allocation != allocation) {
+            continue;
+        }
+        if (--it->second->refCount == 0u) {
+            memoryManager.freeGraphicsMemory(allocation);
+            entries.erase(it);
+            hashesByAllocation.erase(hashIt);
+        }
+        return;
+    }
+    UNRECOVERABLE_IF(true);
+}
+
+IsaAllocationCacheStatistics IsaAllocationCache::getStatistics() {
+    std::lock_guard<std::mutex> lock(mtx);
+    auto currentStatistics = statistics;
+    currentStatistics.liveAllocations = entries.size();
+    return currentStatistics;
+}
+
+GraphicsAllocation *IsaAllocationCache::allocateAndUpload(Device &device, AllocationType allocationType, const void *isa, size_t isaSize) {
+    auto allocation = memoryManager.allocateGraphicsMemoryWithProperties({device.getRootDeviceIndex(),
+                                                                          isaSize,
+                                                                          allocationType,
+                                                                          device.getDeviceBitfield()});
+    if (allocation == nullptr) {
+        return nullptr;
+    }
+
+    allocation->setAubWritable(true, std::numeric_limits<uint32_t>::max());
+    allocation->setTbxWritable(true, std::numeric_limits<uint32_t>::max());
+    auto &productHelper = device.getProductHelper();
+    MemoryTransferHelper::transferMemoryToAllocation(productHelper.isBlitCopyRequiredForLocalMemory(device.getRootDeviceEnvironment(), *allocation),
+                                                     device, allocation, 0u, isa, isaSize);
+    return allocation;
+}
+
+} // namespace NEO
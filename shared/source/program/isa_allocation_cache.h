@@ -0,0 +1,63 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/device_bitfield.h"
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+#include "shared/source/memory_manager/allocation_type.h"
+
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+namespace NEO {
+class Device;
+class GraphicsAllocation;
+class MemoryManager;
+
+struct IsaAllocationCacheStatistics {
+    uint64_t uploads = 0u;
+    uint64_t hits = 0u;
+    uint64_t savedBytes = 0u; // device memory not allocated thanks to sharing
+    size_t liveAllocations = 0u;
+};
+
+// Shares read-only kernel ISA allocations between modules created on the same root device.
+// Allocations are looked up by content hash and verified against a host copy of the ISA,
+// so colliding hashes never alias different code. Allocation is freed with its last user.
+class IsaAllocationCache : NonCopyableOrMovableClass {
+  public:
+    IsaAllocationCache(MemoryManager &memoryManager) : memoryManager(memoryManager) {}
+    MOCKABLE_VIRTUAL ~IsaAllocationCache();
+
+    // Returns allocation holding given ISA, allocates and uploads it on first use; nullptr when out of memory
+    GraphicsAllocation *acquire(Device &device, AllocationType allocationType, const void *isa, size_t isaSize);
+    void release(GraphicsAllocation *allocation);
+
+    IsaAllocationCacheStatistics getStatistics();
+
+  protected:
+    struct Entry {
+        std::vector<uint8_t> isa;
+        AllocationType allocationType = AllocationType::unknown;
+        DeviceBitfield deviceBitfield;
+        GraphicsAllocation *allocation = nullptr;
+        uint32_t refCount = 0u;
+    };
+
+    MOCKABLE_VIRTUAL GraphicsAllocation *allocateAndUpload(Device &device, AllocationType allocationType, const void *isa, size_t isaSize);
+
+    MemoryManager &memoryManager;
+    std::unordered_multimap<uint64_t, std::unique_ptr<Entry>> entries;
+    std::unordered_map<GraphicsAllocation *, uint64_t> hashesByAllocation;
+    IsaAllocationCacheStatistics statistics;
+    std::mutex mtx;
+};
+
+} // namespace NEO
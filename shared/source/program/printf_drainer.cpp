@@ -0,0 +1,160 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/program/printf_drainer.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/helpers/debug_helpers.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <cstring>
+
+namespace NEO {
+
+std::unique_ptr<PrintfDrainer> PrintfDrainer::create() {
+    if (debugManager.flags.EnableAsyncPrintf.get() != 1) {
+        return nullptr;
+    }
+
+    FILE *sink = stdout;
+    bool ownsSink = false;
+    auto sinkFormat = debugManager.flags.AsyncPrintfBinarySink.get() == 1 ? PrintfSinkFormat::binary : PrintfSinkFormat::text;
+
+    auto sinkFileName = debugManager.flags.AsyncPrintfSinkFile.get();
+    if (sinkFileName != "unk") {
+        sink = fopen(sinkFileName.c_str(), sinkFormat == PrintfSinkFormat::binary ? "wb" : "w");
+        if (sink == nullptr) {
+            PRINT_DEBUG_STRING(debugManager.flags.PrintDebugMessages.get(), stderr, "Failed to open printf sink file %s, async printf disabled.\n", sinkFileName.c_str());
+            return nullptr;
+        }
+        ownsSink = true;
+    }
+
+    return std::make_unique<PrintfDrainer>(sink, ownsSink, sinkFormat);
+}
+
+PrintfDrainer::PrintfDrainer(FILE *sink, bool ownsSink, PrintfSinkFormat sinkFormat)
+    : ring(ringSize), sink(sink), ownsSink(ownsSink), sinkFormat(sinkFormat) {
+    UNRECOVERABLE_IF(sink == nullptr);
+    drainerThread = Thread::create(drainerThreadFunc, this);
+}
+
+PrintfDrainer::~PrintfDrainer() {
+    {
+        std::unique_lock<std::mutex> lock(mtx);
+        stopRequested = true;
+    }
+    recordSubmitted.notify_one();
+    drainerThread->join();
+
+    fflush(sink);
+    if (ownsSink) {
+        fclose(sink);
+    }
+}
+
+void PrintfDrainer::submit(const uint8_t *printfBuffer, uint32_t printfBufferSize, bool using32BitPointers, const StringMap *stringLiteralMap) {
+    // first 4 bytes of the buffer store the actual size of data that was written by printf from within EUs
+    uint32_t usedSize = 0u;
+    if (printfBufferSize >= sizeof(usedSize)) {
+        memcpy(&usedSize, printfBuffer, sizeof(usedSize));
+    }
+    usedSize = std::min(usedSize, printfBufferSize);
+    if (usedSize <= sizeof(usedSize)) {
+        return;
+    }
+
+    std::unique_lock<std::mutex> lock(mtx);
+    recordWritten.wait(lock, [this] { return pendingRecords < ring.size(); });
+
+    auto &record = ring[(ringHead + pendingRecords) % ring.size()];
+    record.data.assign(printfBuffer, printfBuffer + usedSize);
+    record.using32BitPointers = using32BitPointers;
+    record.stringLiteralMap = stringLiteralMap;
+    pendingRecords++;
+    submittedRecords++;
+    lock.unlock();
+
+    recordSubmitted.notify_one();
+}
+
+void PrintfDrainer::flush() {
+    std::unique_lock<std::mutex> lock(mtx);
+    auto recordsToWait = submittedRecords;
+    recordWritten.wait(lock, [&] { return writtenRecords >= recordsToWait; });
+}
+
+uint64_t PrintfDrainer::getSubmittedRecordsCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return submittedRecords;
+}
+
+uint64_t PrintfDrainer::getWrittenRecordsCount() {
+    std::lock_guard<std::mutex> lock(mtx);
+    return writtenRecords;
+}
+
+void *PrintfDrainer::drainerThreadFunc(void *self) {
+    static_cast<PrintfDrainer *>(self)->drain();
+    return nullptr;
+}
+
+void PrintfDrainer::drain() {
+    std::unique_lock<std::mutex> lock(mtx);
+    while (true) {
+        recordSubmitted.wait(lock, [this] { return pendingRecords > 0u || stopRequested; });
+        if (pendingRecords == 0u) {
+            break;
+        }
+
+        // record stays reserved until written, producers only fill free slots
+        auto &record = ring[ringHead];
+        lock.unlock();
+        writeRecord(record);
+        lock.lock();
+
+        ringHead = (ringHead + 1) % ring.size();
+        pendingRecords--;
+        writtenRecords++;
+        recordWritten.notify_all();
+    }
+}
+
+void PrintfDrainer::writeRecord(const Record &record) {
+    if (sinkFormat == PrintfSinkFormat::binary) {
+        writeBinaryRecord(record);
+    } else {
+        writeTextRecord(record);
+    }
+    fflush(sink);
+}
+
+void PrintfDrainer::writeTextRecord(const Record &record) {
+    PrintFormatter printFormatter{record.data.data(), static_cast<uint32_t>(record.data.size()), record.using32BitPointers, record.stringLiteralMap};
+    printFormatter.printKernelOutput([this](char *str) { fputs(str, sink); });
+}
+
+void PrintfDrainer::writeBinaryRecord(const Record &record) {
+    PrintfBinaryRecordHeader header;
+    header.using32BitPointers = record.using32BitPointers ? 1u : 0u;
+    header.stringsCount = record.stringLiteralMap ? static_cast<uint32_t>(record.stringLiteralMap->size()) : 0u;
+    header.dataSize = static_cast<uint32_t>(record.data.size());
+    fwrite(&header, sizeof(header), 1, sink);
+
+    if (record.stringLiteralMap) {
+        for (auto &[index, string] : *record.stringLiteralMap) {
+            auto length = static_cast<uint32_t>(string.size());
+            fwrite(&index, sizeof(index), 1, sink);
+            fwrite(&length, sizeof(length), 1, sink);
+            fwrite(string.data(), 1, length, sink);
+        }
+    }
+    fwrite(record.data.data(), 1, record.data.size(), sink);
+}
+
+} // namespace NEO
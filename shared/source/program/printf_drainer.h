@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/program/print_formatter.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <cstdio>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+enum class PrintfSinkFormat : uint32_t {
+    text,
+    binary
+};
+
+#pragma pack(push, 1)
+struct PrintfBinaryRecordHeader {
+    static constexpr uint32_t magic = 0x46525450; // "PTRF"
+    uint32_t recordMagic = magic;
+    uint32_t using32BitPointers = 0u;
+    uint32_t stringsCount = 0u; // followed by stringsCount x {uint32_t index, uint32_t length, chars}
+    uint32_t dataSize = 0u;     // followed by raw printf buffer data
+};
+#pragma pack(pop)
+
+// Formats kernel printf output off the critical path. Producers copy used part of printf buffer
+// into a ring of reusable records, drainer thread formats them and writes them to the sink.
+class PrintfDrainer {
+  public:
+    static constexpr size_t ringSize = 32u;
+
+    static std::unique_ptr<PrintfDrainer> create();
+
+    PrintfDrainer(FILE *sink, bool ownsSink, PrintfSinkFormat sinkFormat);
+    MOCKABLE_VIRTUAL ~PrintfDrainer();
+
+    PrintfDrainer(const PrintfDrainer &) = delete;
+    PrintfDrainer &operator=(const PrintfDrainer &) = delete;
+
+    // Copies printf data written by kernel, blocks only when all ring records are pending
+    void submit(const uint8_t *printfBuffer, uint32_t printfBufferSize, bool using32BitPointers, const StringMap *stringLiteralMap);
+    // Waits until all submitted records are written to the sink
+    void flush();
+
+    uint64_t getSubmittedRecordsCount();
+    uint64_t getWrittenRecordsCount();
+
+  protected:
+    struct Record {
+        std::vector<uint8_t> data;
+        bool using32BitPointers = false;
+        const StringMap *stringLiteralMap = nullptr;
+    };
+
+    static void *drainerThreadFunc(void *self);
+    void drain();
+    MOCKABLE_VIRTUAL void writeRecord(const Record &record);
+    void writeTextRecord(const Record &record);
+    void writeBinaryRecord(const Record &record);
+
+    std::vector<Record> ring;
+    size_t ringHead = 0u; // oldest pending record
+    size_t pendingRecords = 0u;
+    uint64_t submittedRecords = 0u;
+    uint64_t writtenRecords = 0u;
+    bool stopRequested = false;
+
+    std::mutex mtx;
+    std::condition_variable recordSubmitted;
+    std::condition_variable recordWritten;
+
+    FILE *sink = nullptr;
+    bool ownsSink = false;
+    PrintfSinkFormat sinkFormat = PrintfSinkFormat::text;
+    std::unique_ptr<Thread> drainerThread;
+};
+
+} // namespace NEO
@@ -219,6 +219,10 @@ class IDList {
         return processLocked<ThisType, &ThisType::detachNodesImpl>();
     }
 
+    NodeObjectType *detachFrontNodes(size_t maxNodesCount) {
+        return processLocked<ThisType, &ThisType::detachFrontNodesImpl>(nullptr, &maxNodesCount);
+    }
+
     void splice(NodeObjectType &nodes) {
         processLocked<ThisType, &ThisType::spliceImpl>(&nodes);
     }
@@ -417,6 +421,19 @@ class IDList {
         return rest;
     }
 
+    NodeObjectType *detachFrontNodesImpl(NodeObjectType *, void *data) {
+        auto maxNodesCount = *static_cast<size_t *>(data);
+        if (head == nullptr || maxNodesCount == 0) {
+            return nullptr;
+        }
+
+        NodeObjectType *last = head;
+        for (size_t i = 1; i < maxNodesCount && last->next != nullptr; i++) {
+            last = last->next;
+        }
+        return detachSequenceImpl(head, last);
+    }
+
     NodeObjectType *spliceImpl(NodeObjectType *node, void *) {
         if (tail == nullptr) {
             DEBUG_BREAK_IF(head != nullptr);
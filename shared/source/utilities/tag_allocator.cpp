@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Intel Corporation
+ * Copyright (C) 2021-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -7,6 +7,7 @@
 
 #include "shared/source/utilities/tag_allocator.h"
 
+#include "shared/source/debug_settings/debug_settings_manager.h"
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/memory_manager/multi_graphics_allocation.h"
 
@@ -16,6 +17,9 @@ TagAllocatorBase::TagAllocatorBase(const RootDeviceIndicesContainer &rootDeviceI
     : deviceBitfield(deviceBitfield), rootDeviceIndices(rootDeviceIndices), memoryManager(memMngr), tagCount(tagCount), tagSize(tagSize), doNotReleaseNodes(doNotReleaseNodes) {
 
     this->tagSize = alignUp(tagSize, tagAlignment);
+    if (debugManager.flags.TagAllocatorSlabSize.get() > 0) {
+        this->tagCount = static_cast<size_t>(debugManager.flags.TagAllocatorSlabSize.get());
+    }
     maxRootDeviceIndex = *std::max_element(std::begin(rootDeviceIndices), std::end(rootDeviceIndices));
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,9 +13,11 @@
 
 #include "metrics_library_api_1_0.h"
 
+#include <array>
 #include <atomic>
 #include <cstdint>
 #include <mutex>
+#include <thread>
 #include <type_traits>
 #include <vector>
 
@@ -195,6 +197,27 @@ class TagAllocator : public TagAllocatorBase {
 
     void populateFreeTags();
 
+    NodeType *getFreeTag();
+
+    // Cache of free nodes, refilled from and flushed to freeTags in batches.
+    // Magazines are lock striped by thread id hash, so threads hashed to the same magazine share it.
+    // Before new tag pool is allocated, magazines not locked by other threads are drained back to freeTags.
+    struct TagMagazine {
+        std::mutex mutex;
+        std::vector<NodeType *> nodes;
+    };
+    static constexpr size_t magazinesCount = 8u;
+
+    TagMagazine &getMagazineForCurrentThread();
+    NodeType *getTagFromMagazine();
+    void returnTagToMagazine(NodeType *node);
+    void refillMagazine(TagMagazine &magazine);
+    void drainMagazines(TagMagazine &lockedMagazine);
+    void flushMagazine(TagMagazine &magazine, size_t nodesToFlush);
+
+    std::array<TagMagazine, magazinesCount> magazines;
+    size_t magazineSize = 0;
+
     IDList<NodeType> freeTags;
     IDList<NodeType> usedTags;
     IDList<NodeType> deferredTags;
@@ -15,22 +15,38 @@ template <typename TagType>
 TagAllocator<TagType>::TagAllocator(const RootDeviceIndicesContainer &rootDeviceIndices, MemoryManager *memMngr, size_t tagCount, size_t tagAlignment,
                                     size_t tagSize, bool doNotReleaseNodes, DeviceBitfield deviceBitfield)
     : TagAllocatorBase(rootDeviceIndices, memMngr, tagCount, tagAlignment, tagSize, doNotReleaseNodes, deviceBitfield) {
+    if (debugManager.flags.TagAllocatorMagazineSize.get() > 0) {
+        magazineSize = static_cast<size_t>(debugManager.flags.TagAllocatorMagazineSize.get());
+        for (auto &magazine : magazines) {
+            magazine.nodes.reserve(magazineSize);
+        }
+    }
+
     std::unique_lock<std::mutex> lock(allocatorMutex);
 
     populateFreeTags();
 }
 
 template <typename TagType>
-TagNodeBase *TagAllocator<TagType>::getTag() {
+typename TagAllocator<TagType>::NodeType *TagAllocator<TagType>::getFreeTag() {
     if (freeTags.peekIsEmpty()) {
         releaseDeferredTags();
     }
     auto node = freeTags.removeFrontOne().release();
-    if (!node) {
+    while (!node) {
         std::unique_lock<std::mutex> lock(allocatorMutex);
-        populateFreeTags();
+        if (freeTags.peekIsEmpty()) {
+            populateFreeTags();
+        }
         node = freeTags.removeFrontOne().release();
     }
+    return node;
+}
+
+template <typename TagType>
+TagNodeBase *TagAllocator<TagType>::getTag() {
+    auto node = (magazineSize > 0) ? getTagFromMagazine() : getFreeTag();
+
     usedTags.pushFrontOne(*node);
     node->incRefCount();
     node->initialize();
@@ -52,9 +68,101 @@ void TagAllocator<TagType>::returnTagToFreePool(TagNodeBase *node) {
         printf("\nPID: %u, TSP returned to pool: 0x%" PRIX64, SysCalls::getProcessId(), nodeT->getGpuAddress());
     }
 
+    if (magazineSize > 0) {
+        returnTagToMagazine(nodeT);
+        return;
+    }
     freeTags.pushFrontOne(*nodeT);
 }
 
+template <typename TagType>
+typename TagAllocator<TagType>::TagMagazine &TagAllocator<TagType>::getMagazineForCurrentThread() {
+    auto magazineIndex = std::hash<std::thread::id>{}(std::this_thread::get_id()) % magazinesCount;
+    return magazines[magazineIndex];
+}
+
+template <typename TagType>
+typename TagAllocator<TagType>::NodeType *TagAllocator<TagType>::getTagFromMagazine() {
+    auto &magazine = getMagazineForCurrentThread();
+    std::lock_guard<std::mutex> lock(magazine.mutex);
+
+    if (magazine.nodes.empty()) {
+        refillMagazine(magazine);
+    }
+    auto node = magazine.nodes.back();
+    magazine.nodes.pop_back();
+    return node;
+}
+
+template <typename TagType>
+void TagAllocator<TagType>::refillMagazine(TagMagazine &magazine) {
+    auto nodesToRefill = std::max(magazineSize / 2, static_cast<size_t>(1u));
+
+    auto nodes = freeTags.detachFrontNodes(nodesToRefill);
+    if (nodes == nullptr) {
+        releaseDeferredTags();
+        nodes = freeTags.detachFrontNodes(nodesToRefill);
+    }
+    while (nodes == nullptr) {
+        std::unique_lock<std::mutex> lock(allocatorMutex);
+        if (freeTags.peekIsEmpty()) {
+            drainMagazines(magazine);
+        }
+        if (freeTags.peekIsEmpty()) {
+            populateFreeTags();
+        }
+        nodes = freeTags.detachFrontNodes(nodesToRefill);
+    }
+
+    while (nodes != nullptr) {
+        auto nextNode = nodes->next;
+        nodes->prev = nullptr;
+        nodes->next = nullptr;
+        magazine.nodes.push_back(nodes);
+        nodes = nextNode;
+    }
+}
+
+template <typename TagType>
+void TagAllocator<TagType>::drainMagazines(TagMagazine &lockedMagazine) {
+    for (auto &magazine : magazines) {
+        if (&magazine == &lockedMagazine) {
+            continue;
+        }
+        // magazine used by other thread is skipped, waiting for it could deadlock with thread refilling it
+        std::unique_lock<std::mutex> lock(magazine.mutex, std::try_to_lock);
+        if (lock.owns_lock()) {
+            flushMagazine(magazine, magazine.nodes.size());
+        }
+    }
+}
+
+template <typename TagType>
+void TagAllocator<TagType>::returnTagToMagazine(NodeType *node) {
+    auto &magazine = getMagazineForCurrentThread();
+    std::lock_guard<std::mutex> lock(magazine.mutex);
+
+    if (magazine.nodes.size() >= magazineSize) {
+        flushMagazine(magazine, std::max(magazineSize / 2, static_cast<size_t>(1u)));
+    }
+    magazine.nodes.push_back(node);
+}
+
+template <typename TagType>
+void TagAllocator<TagType>::flushMagazine(TagMagazine &magazine, size_t nodesToFlush) {
+    IDList<NodeType, false> pendingFreeTags;
+    nodesToFlush = std::min(nodesToFlush, magazine.nodes.size());
+
+    for (size_t i = 0; i < nodesToFlush; i++) {
+        pendingFreeTags.pushTailOne(*magazine.nodes.back());
+        magazine.nodes.pop_back();
+    }
+
+    if (!pendingFreeTags.peekIsEmpty()) {
+        freeTags.splice(*pendingFreeTags.detachNodes());
+    }
+}
+
 template <typename TagType>
 void TagAllocator<TagType>::returnTagToDeferredPool(TagNodeBase *node) {
     auto nodeT = static_cast<NodeType *>(node);
@@ -0,0 +1,122 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/thread_pool.h"
+
+#include "shared/source/debug_settings/debug_settings_manager.h"
+#include "shared/source/os_interface/os_thread.h"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace NEO {
+
+uint32_t ThreadPool::getDefaultThreadsCount() {
+    if (debugManager.flags.DriverThreadPoolSize.get() != -1) {
+        return static_cast<uint32_t>(debugManager.flags.DriverThreadPoolSize.get());
+    }
+    auto hardwareThreads = std::max(std::thread::hardware_concurrency(), 1u);
+    return std::min(hardwareThreads, defaultMaxThreadsCount);
+}
+
+ThreadPool::ThreadPool(uint32_t threadsCount) : threadsCount(threadsCount) {
+    workers.reserve(threadsCount);
+    for (auto i = 0u; i < threadsCount; i++) {
+        workers.push_back(Thread::create(run, reinterpret_cast<void *>(this)));
+    }
+}
+
+ThreadPool::~ThreadPool() {
+    shutdown();
+}
+
+ThreadPool::TaskHandle ThreadPool::enqueue(TaskFunction &&task) {
+    std::packaged_task<void()> packagedTask(std::move(task));
+    TaskHandle handle = packagedTask.get_future().share();
+
+    std::unique_lock<std::mutex> lock(tasksMutex);
+    if (this->stopped || this->workers.empty()) {
+        lock.unlock();
+        packagedTask();
+        return handle;
+    }
+    tasks.push_back(std::move(packagedTask));
+    lock.unlock();
+    condition.notify_one();
+    return handle;
+}
+
+void ThreadPool::parallelFor(size_t tasksCount, const std::function<void(size_t)> &task) {
+    struct State {
+        std::atomic<size_t> nextIndex{0u};
+        std::atomic<size_t> completedCount{0u};
+    };
+    auto state = std::make_shared<State>();
+    // pool tasks started after all indices are taken return without touching task
+    auto processIndices = [state, tasksCount, &task]() {
+        for (auto index = state->nextIndex++; index < tasksCount; index = state->nextIndex++) {
+            task(index);
+            state->completedCount++;
+        }
+    };
+
+    auto helpersCount = std::min(static_cast<size_t>(this->threadsCount), tasksCount > 0u ? tasksCount - 1 : 0u);
+    for (size_t i = 0; i < helpersCount; i++) {
+        enqueue(processIndices);
+    }
+    processIndices();
+
+    // remaining indices are already processed by started pool tasks, waiting for not started ones could deadlock
+    while (state->completedCount.load() < tasksCount) {
+        std::this_thread::yield();
+    }
+}
+
+void ThreadPool::shutdown() {
+    {
+        std::lock_guard<std::mutex> lock(tasksMutex);
+        if (this->stopped) {
+            return;
+        }
+        this->stopped = true;
+    }
+    condition.notify_all();
+    for (auto &worker : workers) {
+        worker->join();
+    }
+    workers.clear();
+}
+
+uint32_t ThreadPool::getPendingTasksCount() {
+    std::lock_guard<std::mutex> lock(tasksMutex);
+    return static_cast<uint32_t>(tasks.size());
+}
+
+bool ThreadPool::processTask() {
+    std::unique_lock<std::mutex> lock(tasksMutex);
+    condition.wait(lock, [this] { return this->stopped || !this->tasks.empty(); });
+    if (tasks.empty()) {
+        return false;
+    }
+    auto task = std::move(tasks.front());
+    tasks.pop_front();
+    lock.unlock();
+
+    task();
+    return true;
+}
+
+void *ThreadPool::run(void *arg) {
+    auto self = reinterpret_cast<ThreadPool *>(arg);
+    // Pending tasks are drained before exit, so every handle returned by enqueue becomes ready
+    while (self->processTask()) {
+    }
+    return nullptr;
+}
+
+} // namespace NEO
@@ -0,0 +1,56 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#pragma once
+#include "shared/source/helpers/non_copyable_or_moveable.h"
+
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace NEO {
+class Thread;
+
+class ThreadPool : NonCopyableOrMovableClass {
+  public:
+    using TaskFunction = std::function<void()>;
+    using TaskHandle = std::shared_future<void>;
+
+    static constexpr uint32_t defaultMaxThreadsCount = 4u;
+
+    static uint32_t getDefaultThreadsCount();
+
+    ThreadPool(uint32_t threadsCount);
+    MOCKABLE_VIRTUAL ~ThreadPool();
+
+    // Schedules task for background execution; returned handle allows waiting for this single task only
+    MOCKABLE_VIRTUAL TaskHandle enqueue(TaskFunction &&task);
+    // Runs task for every index in [0, tasksCount) on pool threads and calling thread, returns when all indices are done.
+    // Calling thread processes indices not yet taken by pool, so it may be used from within pool tasks as well.
+    void parallelFor(size_t tasksCount, const std::function<void(size_t)> &task);
+    void shutdown();
+
+    uint32_t getThreadsCount() const { return threadsCount; }
+    uint32_t getPendingTasksCount();
+
+  protected:
+    static void *run(void *arg);
+    bool processTask();
+
+    std::vector<std::unique_ptr<Thread>> workers;
+    std::deque<std::packaged_task<void()>> tasks;
+    std::mutex tasksMutex;
+    std::condition_variable condition;
+    uint32_t threadsCount = 0u;
+    bool stopped = false;
+};
+} // namespace NEO
@@ -32,6 +32,7 @@ class MockBindlesHeapsHelper : public BindlessHeapsHelper {
     using BaseClass::allocateFromReusePool;
     using BaseClass::allocatePoolIndex;
     using BaseClass::borderColorStates;
+    using BaseClass::cachedStates;
     using BaseClass::globalBindlessDsh;
     using BaseClass::growHeap;
     using BaseClass::isMultiOsContextCapable;
@@ -41,6 +42,7 @@ class MockBindlesHeapsHelper : public BindlessHeapsHelper {
     using BaseClass::rootDeviceIndex;
     using BaseClass::ssHeapsAllocations;
     using BaseClass::stateCacheDirtyForContext;
+    using BaseClass::stateCacheEnabled;
     using BaseClass::surfaceStateHeaps;
     using BaseClass::surfaceStateInHeapVectorReuse;
     using BaseClass::surfaceStateSize;
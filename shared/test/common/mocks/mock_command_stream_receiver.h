@@ -223,6 +223,15 @@ class MockCommandStreamReceiver : public CommandStreamReceiver {
         return getLastDirectSubmissionThrottleReturnValue;
     }
 
+    SubmissionGapHistogram *getDirectSubmissionGapHistogram() override {
+        return getDirectSubmissionGapHistogramReturnValue;
+    }
+
+    void releaseCoalescedDirectSubmissions(bool expiredOnly) override {
+        releaseCoalescedDirectSubmissionsCalled++;
+        releaseCoalescedDirectSubmissionsExpiredOnly = expiredOnly;
+    }
+
     bool getAcLineConnected(bool updateStatus) const override {
         return getAcLineConnectedReturnValue;
     }
@@ -232,6 +241,7 @@ class MockCommandStreamReceiver : public CommandStreamReceiver {
     std::vector<char> instructionHeapReserveredData;
     int *flushBatchedSubmissionsCallCounter = nullptr;
     uint32_t waitForCompletionWithTimeoutCalled = 0;
+    uint32_t releaseCoalescedDirectSubmissionsCalled = 0;
     uint32_t fillReusableAllocationsListCalled = 0;
     uint32_t writeMemoryAubCalled = 0;
     uint32_t makeResidentCalledTimes = 0;
@@ -245,12 +255,14 @@ class MockCommandStreamReceiver : public CommandStreamReceiver {
     bool makeResidentParentCall = false;
     bool programComputeBarrierCommandCalled = false;
     bool programStallingCommandsForBarrierCalled = false;
+    bool releaseCoalescedDirectSubmissionsExpiredOnly = false;
     std::optional<bool> isGpuHangDetectedReturnValue{};
     std::optional<bool> testTaskCountReadyReturnValue{};
     WaitStatus waitForCompletionWithTimeoutReturnValue{WaitStatus::ready};
     CommandStreamReceiverType commandStreamReceiverType = CommandStreamReceiverType::CSR_HW;
     BatchBuffer latestFlushedBatchBuffer = {};
     QueueThrottle getLastDirectSubmissionThrottleReturnValue = QueueThrottle::MEDIUM;
+    SubmissionGapHistogram *getDirectSubmissionGapHistogramReturnValue = nullptr;
     bool getAcLineConnectedReturnValue = true;
 };
 
@@ -17,6 +17,9 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     using BaseClass = DirectSubmissionHw<GfxFamily, Dispatcher>;
     using BaseClass::activeTiles;
     using BaseClass::allocateResources;
+    using BaseClass::coalescingEnabled;
+    using BaseClass::coalescingMutex;
+    using BaseClass::coalescingWindow;
     using BaseClass::completionFenceAllocation;
     using BaseClass::copyCommandBufferIntoRing;
     using BaseClass::cpuCachelineFlush;
@@ -42,6 +45,7 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     using BaseClass::dispatchSwitchRingBufferSection;
     using BaseClass::dispatchUllsState;
     using BaseClass::dispatchWorkloadSection;
+    using BaseClass::firstPendingSubmissionTime;
     using BaseClass::getDiagnosticModeSection;
     using BaseClass::getSizeDisablePrefetcher;
     using BaseClass::getSizeDispatch;
@@ -59,10 +63,12 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     using BaseClass::inputMonitorFenceDispatchRequirement;
     using BaseClass::isDisablePrefetcherRequired;
     using BaseClass::lastSubmittedThrottle;
+    using BaseClass::maxCoalescedSubmissions;
     using BaseClass::miMemFenceRequired;
     using BaseClass::osContext;
     using BaseClass::partitionConfigSet;
     using BaseClass::partitionedMode;
+    using BaseClass::pendingSubmissions;
     using BaseClass::pciBarrierPtr;
     using BaseClass::performDiagnosticMode;
     using BaseClass::preinitializedRelaxedOrderingScheduler;
@@ -71,6 +77,7 @@ struct MockDirectSubmissionHw : public DirectSubmissionHw<GfxFamily, Dispatcher>
     using BaseClass::relaxedOrderingInitialized;
     using BaseClass::relaxedOrderingSchedulerAllocation;
     using BaseClass::relaxedOrderingSchedulerRequired;
+    using BaseClass::releasePendingSubmissions;
     using BaseClass::reserved;
     using BaseClass::ringBuffers;
     using BaseClass::ringCommandStream;
@@ -24,6 +24,7 @@ struct MockSVMAllocsManager : public SVMAllocsManager {
     using SVMAllocsManager::svmMapOperations;
     using SVMAllocsManager::usmDeviceAllocationsCache;
     using SVMAllocsManager::usmDeviceAllocationsCacheEnabled;
+    using SVMAllocsManager::usmDeviceAllocationsCacheMemoryPressureLimit;
     using SVMAllocsManager::usmHostAllocationsCache;
     using SVMAllocsManager::usmHostAllocationsCacheEnabled;
 
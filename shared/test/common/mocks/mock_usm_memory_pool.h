@@ -15,4 +15,11 @@ class MockUsmMemAllocPool : public UsmMemAllocPool {
     using UsmMemAllocPool::poolEnd;
     using UsmMemAllocPool::poolMemoryType;
     using UsmMemAllocPool::poolSize;
+};
+
+class MockUsmMemAllocPoolsManager : public UsmMemAllocPoolsManager {
+  public:
+    using UsmMemAllocPoolsManager::maxIdleTime;
+    using UsmMemAllocPoolsManager::trimIdlePools;
+    using UsmMemAllocPoolsManager::UsmMemAllocPoolsManager;
 };
\ No newline at end of file
@@ -404,6 +404,31 @@ TEST_F(CommandContainerTest, givenCommandContainerWhenResetThenStateIsReset) {
     EXPECT_EQ(cmdContainer.getNumIddPerBlock(), defaultNumIddsPerBlock);
 }
 
+TEST_F(CommandContainerTest, givenStoredReusableHeapDataWhenMatchingAndResettingContainerThenDataIsReusableOnlyUntilReset) {
+    CommandContainer cmdContainer;
+    cmdContainer.initialize(pDevice, nullptr, HeapSize::defaultHeapSize, true, false);
+    auto heapAllocation = cmdContainer.getIndirectHeapAllocation(HeapType::indirectObject);
+    auto &reusableHeapData = cmdContainer.getReusableHeapData(HeapType::indirectObject);
+
+    uint8_t crossThreadData[16] = {1, 2, 3};
+    uint8_t perThreadData[8] = {4, 5};
+    EXPECT_FALSE(reusableHeapData.isMatching(heapAllocation, crossThreadData, sizeof(crossThreadData), perThreadData, sizeof(perThreadData)));
+
+    reusableHeapData.store(heapAllocation, 0x40u, crossThreadData, sizeof(crossThreadData), perThreadData, sizeof(perThreadData));
+    EXPECT_EQ(0x40u, reusableHeapData.heapOffset);
+    EXPECT_TRUE(reusableHeapData.isMatching(heapAllocation, crossThreadData, sizeof(crossThreadData), perThreadData, sizeof(perThreadData)));
+    EXPECT_FALSE(reusableHeapData.isMatching(heapAllocation, crossThreadData, sizeof(crossThreadData), nullptr, 0u));
+    EXPECT_FALSE(reusableHeapData.isMatching(heapAllocation, crossThreadData, sizeof(crossThreadData) - 1, perThreadData, sizeof(perThreadData) + 1));
+    EXPECT_FALSE(reusableHeapData.isMatching(cmdContainer.getIndirectHeapAllocation(HeapType::surfaceState), crossThreadData, sizeof(crossThreadData), perThreadData, sizeof(perThreadData)));
+
+    perThreadData[7] = 1;
+    EXPECT_FALSE(reusableHeapData.isMatching(heapAllocation, crossThreadData, sizeof(crossThreadData), perThreadData, sizeof(perThreadData)));
+    perThreadData[7] = 0;
+
+    cmdContainer.reset();
+    EXPECT_FALSE(reusableHeapData.isMatching(heapAllocation, crossThreadData, sizeof(crossThreadData), perThreadData, sizeof(perThreadData)));
+}
+
 TEST_F(CommandContainerTest, givenCommandContainerWhenWantToAddNullPtrToResidencyContainerThenNothingIsAdded) {
     CommandContainer cmdContainer;
     cmdContainer.initialize(pDevice, nullptr, HeapSize::defaultHeapSize, true, false);
@@ -0,0 +1,212 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/command_container/relocatable_command_buffer.h"
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/ptr_math.h"
+
+#include "gtest/gtest.h"
+
+#include <cstring>
+
+using namespace NEO;
+using namespace NEO::RelocatableCommandBuffer;
+
+namespace {
+constexpr uint64_t addressMask = maxNBitValue(48);
+
+uint64_t readQword(const void *data, size_t offset) {
+    uint64_t value = 0u;
+    memcpy(&value, ptrOffset(data, offset), sizeof(value));
+    return value;
+}
+
+void writeQword(void *data, size_t offset, uint64_t value) {
+    memcpy(ptrOffset(data, offset), &value, sizeof(value));
+}
+} // namespace
+
+TEST(RelocatableCommandBufferTest, givenAddressLocationsWhenAddingAddressRelocationsThenOnlyAddressesWithinAllocationsAreRecorded) {
+    Writer writer;
+    auto bufferAllocation = writer.addAllocation(0x10000, 0x1000);
+    auto dataAllocation = writer.addAllocation(0xffff800000020000, 0x100);
+
+    uint8_t commands[64] = {};
+    writeQword(commands, 4, 0x10040);
+    writeQword(commands, 16, 0x800000020010);
+    writeQword(commands, 32, 0x20100);
+    writeQword(commands, 48, 0x10080);
+
+    auto sectionIndex = writer.addSection(SectionType::commandBuffer, bufferAllocation, commands, sizeof(commands));
+    EXPECT_TRUE(writer.addAddressRelocation(sectionIndex, 4, addressMask));
+    EXPECT_TRUE(writer.addAddressRelocation(sectionIndex, 16, addressMask));
+    EXPECT_FALSE(writer.addAddressRelocation(sectionIndex, 32, addressMask));
+
+    auto &relocations = writer.getRelocations();
+    ASSERT_EQ(2u, relocations.size());
+
+    EXPECT_EQ(RelocationType::address64, relocations[0].type);
+    EXPECT_EQ(sectionIndex, relocations[0].sectionIndex);
+    EXPECT_EQ(4u, relocations[0].offset);
+    EXPECT_EQ(bufferAllocation, relocations[0].allocationIndex);
+    EXPECT_EQ(0x40u, relocations[0].offsetInAllocation);
+
+    EXPECT_EQ(16u, relocations[1].offset);
+    EXPECT_EQ(dataAllocation, relocations[1].allocationIndex);
+    EXPECT_EQ(0x10u, relocations[1].offsetInAllocation);
+}
+
+TEST(RelocatableCommandBufferTest, givenOverlappingAllocationsWhenAddingAddressRelocationThenInnermostContainingAllocationIsUsed) {
+    Writer writer;
+    auto outerAllocation = writer.addAllocation(0x10000, 0x10000);
+    auto innerAllocation = writer.addAllocation(0x12000, 0x100);
+    auto otherAllocation = writer.addAllocation(0x14000, 0x100);
+    writer.addAllocation(0x18000, 0u);
+
+    uint8_t commands[32] = {};
+    writeQword(commands, 0, 0x12010);
+    writeQword(commands, 8, 0x15000);
+    writeQword(commands, 16, 0x18000);
+    writeQword(commands, 24, 0x30000);
+
+    auto sectionIndex = writer.addSection(SectionType::commandBuffer, invalidIndex, commands, sizeof(commands));
+    EXPECT_TRUE(writer.addAddressRelocation(sectionIndex, 0, addressMask));
+    EXPECT_TRUE(writer.addAddressRelocation(sectionIndex, 8, addressMask));
+    EXPECT_TRUE(writer.addAddressRelocation(sectionIndex, 16, addressMask));
+    EXPECT_FALSE(writer.addAddressRelocation(sectionIndex, 24, addressMask));
+
+    auto &relocations = writer.getRelocations();
+    ASSERT_EQ(3u, relocations.size());
+    EXPECT_EQ(innerAllocation, relocations[0].allocationIndex);
+    EXPECT_EQ(0x10u, relocations[0].offsetInAllocation);
+    EXPECT_EQ(outerAllocation, relocations[1].allocationIndex);
+    EXPECT_EQ(0x5000u, relocations[1].offsetInAllocation);
+    EXPECT_EQ(outerAllocation, relocations[2].allocationIndex);
+    EXPECT_EQ(0x8000u, relocations[2].offsetInAllocation);
+    EXPECT_NE(otherAllocation, relocations[1].allocationIndex);
+}
+
+TEST(RelocatableCommandBufferTest, givenSerializedBlobWhenReadingThenSectionsAllocationsAndRelocationsAreRestored) {
+    Writer writer;
+    auto allocation = writer.addAllocation(0x10000, 0x1000);
+
+    uint8_t commands[20] = {};
+    writeQword(commands, 8, 0x10080);
+    uint32_t userData = 0x1234;
+
+    auto sectionIndex = writer.addSection(SectionType::commandBuffer, allocation, commands, sizeof(commands));
+    writer.addSection(SectionType::userData, invalidIndex, &userData, sizeof(userData));
+    EXPECT_TRUE(writer.addAddressRelocation(sectionIndex, 8, addressMask));
+
+    std::vector<uint64_t> blob(writer.getBlobSize() / sizeof(uint64_t));
+    ASSERT_EQ(0u, writer.getBlobSize() % sizeof(uint64_t));
+    writer.serialize(blob.data());
+
+    Reader reader;
+    ASSERT_TRUE(reader.initialize(blob.data(), writer.getBlobSize()));
+
+    ASSERT_EQ(2u, reader.getSectionsCount());
+    EXPECT_EQ(SectionType::commandBuffer, reader.getSection(0).type);
+    EXPECT_EQ(allocation, reader.getSection(0).allocationIndex);
+    EXPECT_EQ(sizeof(commands), reader.getSection(0).size);
+    EXPECT_EQ(0, memcmp(commands, reader.getSectionData(0), sizeof(commands)));
+    EXPECT_EQ(SectionType::userData, reader.getSection(1).type);
+    EXPECT_EQ(userData, *static_cast<const uint32_t *>(reader.getSectionData(1)));
+
+    ASSERT_EQ(1u, reader.getAllocationsCount());
+    EXPECT_EQ(0x10000u, reader.getAllocation(0).gpuAddress);
+    EXPECT_EQ(0x1000u, reader.getAllocation(0).size);
+
+    ASSERT_EQ(1u, reader.getRelocationsCount());
+    EXPECT_EQ(8u, reader.getRelocation(0).offset);
+    EXPECT_EQ(0x80u, reader.getRelocation(0).offsetInAllocation);
+}
+
+TEST(RelocatableCommandBufferTest, givenRelocationsWhenApplyingThenAddressesArePatchedPreservingTheirForm) {
+    Writer writer;
+    auto bufferAllocation = writer.addAllocation(0x10000, 0x1000);
+    auto dataAllocation = writer.addAllocation(0xffff800000020000, 0x100);
+
+    uint8_t commands[32] = {};
+    writeQword(commands, 0, 0x10040);
+    writeQword(commands, 8, 0xffff800000020010);
+    writeQword(commands, 16, 0x800000020020);
+    uint32_t kernelStartPointer = 0x100;
+    memcpy(&commands[24], &kernelStartPointer, sizeof(kernelStartPointer));
+
+    auto sectionIndex = writer.addSection(SectionType::commandBuffer, bufferAllocation, commands, sizeof(commands));
+    writer.addRelocation(RelocationType::address32, sectionIndex, 24, dataAllocation, 0x100);
+    for (size_t offset = 0; offset < 24; offset += sizeof(uint64_t)) {
+        EXPECT_TRUE(writer.addAddressRelocation(sectionIndex, offset, addressMask));
+    }
+
+    std::vector<uint64_t> blob(writer.getBlobSize() / sizeof(uint64_t));
+    writer.serialize(blob.data());
+
+    Reader reader;
+    ASSERT_TRUE(reader.initialize(blob.data(), writer.getBlobSize()));
+
+    uint8_t patched[32] = {};
+    memcpy(patched, reader.getSectionData(sectionIndex), sizeof(patched));
+
+    const uint64_t newAddresses[] = {0x50000, 0xffff800000090000};
+    reader.applyRelocations(sectionIndex, patched, newAddresses, addressMask);
+
+    EXPECT_EQ(0x50040u, readQword(patched, 0));
+    EXPECT_EQ(0xffff800000090010u, readQword(patched, 8));
+    EXPECT_EQ(0x800000090020u, readQword(patched, 16));
+    uint32_t patchedKernelStartPointer = 0;
+    memcpy(&patchedKernelStartPointer, &patched[24], sizeof(patchedKernelStartPointer));
+    EXPECT_EQ(0x90100u, patchedKernelStartPointer);
+}
+
+TEST(RelocatableCommandBufferTest, givenInvalidBlobWhenInitializingReaderThenFalseIsReturned) {
+    Writer writer;
+    auto allocation = writer.addAllocation(0x10000, 0x1000);
+    uint8_t commands[16] = {};
+    writeQword(commands, 0, 0x10040);
+    auto sectionIndex = writer.addSection(SectionType::commandBuffer, allocation, commands, sizeof(commands));
+    EXPECT_TRUE(writer.addAddressRelocation(sectionIndex, 0, addressMask));
+
+    auto blobSize = writer.getBlobSize();
+    std::vector<uint64_t> validBlob(blobSize / sizeof(uint64_t));
+    writer.serialize(validBlob.data());
+
+    Reader reader;
+    EXPECT_FALSE(reader.initialize(nullptr, blobSize));
+    EXPECT_FALSE(reader.initialize(validBlob.data(), sizeof(BlobHeader) - 1));
+    EXPECT_FALSE(reader.initialize(validBlob.data(), blobSize - sizeof(uint64_t)));
+
+    auto blob = validBlob;
+    reinterpret_cast<BlobHeader *>(blob.data())->magic = 0;
+    EXPECT_FALSE(reader.initialize(blob.data(), blobSize));
+
+    blob = validBlob;
+    reinterpret_cast<BlobHeader *>(blob.data())->version = blobVersion + 1;
+    EXPECT_FALSE(reader.initialize(blob.data(), blobSize));
+
+    blob = validBlob;
+    reinterpret_cast<BlobHeader *>(blob.data())->relocationsCount = static_cast<uint32_t>(blobSize);
+    EXPECT_FALSE(reader.initialize(blob.data(), blobSize));
+
+    blob = validBlob;
+    auto section = reinterpret_cast<SectionEntry *>(ptrOffset(blob.data(), sizeof(BlobHeader)));
+    section->size = blobSize;
+    EXPECT_FALSE(reader.initialize(blob.data(), blobSize));
+
+    blob = validBlob;
+    auto relocation = reinterpret_cast<RelocationEntry *>(ptrOffset(blob.data(), sizeof(BlobHeader) + sizeof(SectionEntry) + sizeof(AllocationEntry)));
+    relocation->offset = sizeof(commands) - sizeof(uint32_t);
+    EXPECT_FALSE(reader.initialize(blob.data(), blobSize));
+
+    blob = validBlob;
+    relocation = reinterpret_cast<RelocationEntry *>(ptrOffset(blob.data(), sizeof(BlobHeader) + sizeof(SectionEntry) + sizeof(AllocationEntry)));
+    relocation->allocationIndex = 1;
+    EXPECT_FALSE(reader.initialize(blob.data(), blobSize));
+
+    EXPECT_TRUE(reader.initialize(validBlob.data(), blobSize));
+}
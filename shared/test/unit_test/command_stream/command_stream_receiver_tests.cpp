@@ -4454,6 +4454,101 @@ HWCMDTEST_F(IGFX_XE_HP_CORE, CommandStreamReceiverHwTest, givenScratchSpaceSurfa
     EXPECT_EQ(scratchController->scratchSlot1SizeInBytes, scratchController->getScratchSpaceSlot1Allocation()->getUnderlyingBufferSize());
 }
 
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandStreamReceiverHwTest, givenAdaptiveScratchSpaceDisabledWhenRequiredScratchSpaceChangesThenScratchIsOnlyGrownToRequiredSize) {
+    MockCsrHw<FamilyType> commandStreamReceiver(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    auto scratchController = static_cast<MockScratchSpaceControllerXeHPAndLater *>(commandStreamReceiver.getScratchSpaceController());
+    auto &osContext = *pDevice->getDefaultEngine().osContext;
+
+    bool stateBaseAddressDirty = false;
+    bool cfeStateDirty = false;
+    uint8_t surfaceHeap[1000];
+    scratchController->setRequiredScratchSpace(surfaceHeap, 0u, 1024u, 0u, 0u, osContext, stateBaseAddressDirty, cfeStateDirty);
+    scratchController->setRequiredScratchSpace(surfaceHeap, 0u, 2048u, 0u, 0u, osContext, stateBaseAddressDirty, cfeStateDirty);
+    EXPECT_EQ(2048u, scratchController->perThreadScratchSize);
+    EXPECT_FALSE(commandStreamReceiver.getTemporaryAllocations().peekIsEmpty());
+    EXPECT_TRUE(commandStreamReceiver.getAllocationsForReuse().peekIsEmpty());
+
+    for (uint32_t i = 0; i < 2 * ScratchSpaceConstants::underutilizedSubmissionsToShrink; i++) {
+        scratchController->setRequiredScratchSpace(surfaceHeap, 0u, 64u, 0u, 0u, osContext, stateBaseAddressDirty, cfeStateDirty);
+    }
+    EXPECT_EQ(2048u, scratchController->perThreadScratchSize);
+
+    auto &statistics = scratchController->getStatistics();
+    EXPECT_EQ(2u, statistics.allocations);
+    EXPECT_EQ(1u, statistics.reallocations);
+    EXPECT_EQ(0u, statistics.reusedAllocations);
+    EXPECT_EQ(0u, statistics.shrinks);
+}
+
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandStreamReceiverHwTest, givenAdaptiveScratchSpaceEnabledWhenScratchIsOutgrownRepeatedlyThenOnlyLimitedNumberOfBackingsIsKeptForReuse) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableAdaptiveScratchSpace.set(1);
+
+    MockCsrHw<FamilyType> commandStreamReceiver(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    auto scratchController = static_cast<MockScratchSpaceControllerXeHPAndLater *>(commandStreamReceiver.getScratchSpaceController());
+    auto &osContext = *pDevice->getDefaultEngine().osContext;
+
+    bool stateBaseAddressDirty = false;
+    bool cfeStateDirty = false;
+    uint8_t surfaceHeap[1000];
+    uint32_t perThreadScratchSize = 1024u;
+    for (uint32_t i = 0; i <= ScratchSpaceConstants::maxReusableAllocations + 1; i++) {
+        scratchController->setRequiredScratchSpace(surfaceHeap, 0u, perThreadScratchSize, 0u, 0u, osContext, stateBaseAddressDirty, cfeStateDirty);
+        perThreadScratchSize *= 4;
+    }
+
+    size_t reusableAllocationsCount = 0u;
+    for (auto allocation = commandStreamReceiver.getAllocationsForReuse().peekHead(); allocation != nullptr; allocation = allocation->next) {
+        reusableAllocationsCount++;
+    }
+    EXPECT_EQ(ScratchSpaceConstants::maxReusableAllocations, reusableAllocationsCount);
+    EXPECT_FALSE(commandStreamReceiver.getTemporaryAllocations().peekIsEmpty());
+}
+
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandStreamReceiverHwTest, givenAdaptiveScratchSpaceEnabledWhenScratchSpaceIsUnderutilizedForConsecutiveSubmissionsThenItIsShrunkToReusedAllocation) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableAdaptiveScratchSpace.set(1);
+    debugManager.flags.AdaptiveScratchSpaceShrinkSubmissions.set(2);
+
+    MockCsrHw<FamilyType> commandStreamReceiver(*pDevice->executionEnvironment, pDevice->getRootDeviceIndex(), pDevice->getDeviceBitfield());
+    auto scratchController = static_cast<MockScratchSpaceControllerXeHPAndLater *>(commandStreamReceiver.getScratchSpaceController());
+    auto &osContext = *pDevice->getDefaultEngine().osContext;
+    auto &statistics = scratchController->getStatistics();
+
+    bool stateBaseAddressDirty = false;
+    bool cfeStateDirty = false;
+    uint8_t surfaceHeap[1000];
+    scratchController->setRequiredScratchSpace(surfaceHeap, 0u, 1024u, 0u, 0u, osContext, stateBaseAddressDirty, cfeStateDirty);
+    auto smallScratchAllocation = scratchController->getScratchSpaceSlot0Allocation();
+    ASSERT_NE(nullptr, smallScratchAllocation);
+
+    scratchController->setRequiredScratchSpace(surfaceHeap, 0u, 4096u, 0u, 0u, osContext, stateBaseAddressDirty, cfeStateDirty);
+    EXPECT_EQ(4096u, scratchController->perThreadScratchSize);
+    EXPECT_FALSE(commandStreamReceiver.getAllocationsForReuse().peekIsEmpty());
+    EXPECT_TRUE(commandStreamReceiver.getTemporaryAllocations().peekIsEmpty());
+
+    cfeStateDirty = false;
+    scratchController->setRequiredScratchSpace(surfaceHeap, 0u, 1024u, 0u, 0u, osContext, stateBaseAddressDirty, cfeStateDirty);
+    EXPECT_EQ(4096u, scratchController->perThreadScratchSize);
+    EXPECT_FALSE(cfeStateDirty);
+
+    scratchController->setRequiredScratchSpace(surfaceHeap, 0u, 1024u, 0u, 0u, osContext, stateBaseAddressDirty, cfeStateDirty);
+    EXPECT_EQ(1024u, scratchController->perThreadScratchSize);
+    EXPECT_EQ(smallScratchAllocation, scratchController->getScratchSpaceSlot0Allocation());
+    EXPECT_TRUE(cfeStateDirty);
+    EXPECT_TRUE(commandStreamReceiver.getAllocationsForReuse().peekIsEmpty());
+    EXPECT_FALSE(commandStreamReceiver.getTemporaryAllocations().peekIsEmpty());
+
+    EXPECT_EQ(2u, statistics.allocations);
+    EXPECT_EQ(1u, statistics.reusedAllocations);
+    EXPECT_EQ(2u, statistics.reallocations);
+    EXPECT_EQ(1u, statistics.shrinks);
+
+    scratchController->setRequiredScratchSpace(surfaceHeap, 0u, 2048u, 0u, 0u, osContext, stateBaseAddressDirty, cfeStateDirty);
+    EXPECT_EQ(2048u, scratchController->perThreadScratchSize);
+    EXPECT_EQ(3u, statistics.allocations);
+}
+
 HWTEST_F(CommandStreamReceiverHwTest, givenDcFlushRequiredWhenProgramStallingPostSyncCommandsForBarrierCalledThenDcFlushSet) {
     using PIPE_CONTROL = typename FamilyType::PIPE_CONTROL;
     auto &ultCsr = pDevice->getUltCommandStreamReceiver<FamilyType>();
@@ -450,6 +450,150 @@ TEST(CompilerInterfaceCachedTests, givenKernelWithIncludesAndBinaryInCacheWhenCo
     gEnvironment->fclPopDebugVars();
 }
 
+TEST(CompilerInterfaceCachedTests, givenIntermediateRepresentationCacheEnabledWhenBuildingKernelWithoutIncludesAgainAfterBackendFailureThenCachedFrontendOutputIsReused) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableIntermediateRepresentationCache.set(1);
+
+    MockDevice device{};
+    TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
+    auto src = "__kernel k() {}";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+    inputArgs.allowCaching = true;
+
+    std::unique_ptr<CompilerCacheMock> cache(new CompilerCacheMock());
+    auto mockCache = cache.get();
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::move(cache), true));
+
+    MockCompilerDebugVars fclDebugVars;
+    fclDebugVars.fileName = gEnvironment->fclGetMockFile();
+    gEnvironment->fclPushDebugVars(fclDebugVars);
+    MockCompilerDebugVars igcDebugVars;
+    igcDebugVars.fileName = gEnvironment->igcGetMockFile();
+    igcDebugVars.forceBuildFailure = true;
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+
+    TranslationOutput firstOutput;
+    EXPECT_EQ(TranslationOutput::ErrorCode::buildFailure, compilerInterface->build(device, inputArgs, firstOutput));
+    EXPECT_EQ(1u, mockCache->cacheInvoked);
+    EXPECT_EQ(0u, mockCache->getStatistics().intermediateRepresentationHits);
+    EXPECT_EQ(1u, mockCache->getStatistics().intermediateRepresentationMisses);
+
+    gEnvironment->fclPopDebugVars();
+    gEnvironment->igcPopDebugVars();
+
+    fclDebugVars.forceBuildFailure = true;
+    gEnvironment->fclPushDebugVars(fclDebugVars);
+    igcDebugVars.forceBuildFailure = false;
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+
+    TranslationOutput secondOutput;
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, compilerInterface->build(device, inputArgs, secondOutput));
+    EXPECT_EQ(1u, mockCache->getStatistics().intermediateRepresentationHits);
+    EXPECT_EQ(2u, mockCache->getStatistics().binaryMisses);
+    ASSERT_EQ(firstOutput.intermediateRepresentation.size, secondOutput.intermediateRepresentation.size);
+    EXPECT_EQ(0, memcmp(firstOutput.intermediateRepresentation.mem.get(), secondOutput.intermediateRepresentation.mem.get(), secondOutput.intermediateRepresentation.size));
+    EXPECT_EQ(firstOutput.intermediateCodeType, secondOutput.intermediateCodeType);
+
+    gEnvironment->fclPopDebugVars();
+    gEnvironment->igcPopDebugVars();
+}
+
+TEST(CompilerInterfaceCachedTests, givenSpecializationConstantsWhenBuildingKernelWithoutIncludesThenTheyArePartOfBinaryKeyButNotOfIntermediateRepresentationKey) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableIntermediateRepresentationCache.set(1);
+
+    MockDevice device{};
+    TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::oclGenBin};
+    auto src = "__kernel k() {}";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+    inputArgs.allowCaching = true;
+
+    std::unique_ptr<CompilerCacheMock> cache(new CompilerCacheMock());
+    auto mockCache = cache.get();
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::move(cache), true));
+
+    MockCompilerDebugVars fclDebugVars;
+    fclDebugVars.fileName = gEnvironment->fclGetMockFile();
+    gEnvironment->fclPushDebugVars(fclDebugVars);
+    MockCompilerDebugVars igcDebugVars;
+    igcDebugVars.fileName = gEnvironment->igcGetMockFile();
+    gEnvironment->igcPushDebugVars(igcDebugVars);
+
+    TranslationOutput firstOutput;
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, compilerInterface->build(device, inputArgs, firstOutput));
+    EXPECT_EQ(1u, mockCache->getStatistics().binaryMisses);
+    EXPECT_EQ(1u, mockCache->getStatistics().intermediateRepresentationMisses);
+
+    inputArgs.specializedValues = specConstValuesMap{{10, 100}};
+    TranslationOutput secondOutput;
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, compilerInterface->build(device, inputArgs, secondOutput));
+    EXPECT_EQ(2u, mockCache->getStatistics().binaryMisses);
+    EXPECT_EQ(0u, mockCache->getStatistics().binaryHits);
+    EXPECT_EQ(1u, mockCache->getStatistics().intermediateRepresentationHits);
+
+    gEnvironment->fclPopDebugVars();
+    gEnvironment->igcPopDebugVars();
+}
+
+TEST(CompilerInterfaceCachedTests, givenIntermediateRepresentationCacheEnabledWhenCompilingSourcesThenOnlySourcesWithoutIncludesAreServedFromCache) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableIntermediateRepresentationCache.set(1);
+
+    MockDevice device{};
+    std::unique_ptr<CompilerCacheMock> cache(new CompilerCacheMock());
+    auto mockCache = cache.get();
+    auto compilerInterface = std::unique_ptr<CompilerInterface>(CompilerInterface::createInstance(std::move(cache), true));
+
+    MockCompilerDebugVars fclDebugVars;
+    fclDebugVars.fileName = gEnvironment->fclGetMockFile();
+    gEnvironment->fclPushDebugVars(fclDebugVars);
+
+    for (auto src : {"__kernel k() {}", "#include \"file.h\"\n__kernel k() {}"}) {
+        TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::spirV};
+        inputArgs.src = ArrayRef<const char>(src, strlen(src));
+        TranslationOutput output;
+        EXPECT_EQ(TranslationOutput::ErrorCode::success, compilerInterface->compile(device, inputArgs, output));
+    }
+    EXPECT_EQ(1u, mockCache->cacheInvoked);
+    gEnvironment->fclPopDebugVars();
+
+    fclDebugVars.forceBuildFailure = true;
+    gEnvironment->fclPushDebugVars(fclDebugVars);
+
+    TranslationInput inputArgs{IGC::CodeType::oclC, IGC::CodeType::spirV};
+    auto src = "__kernel k() {}";
+    inputArgs.src = ArrayRef<const char>(src, strlen(src));
+    TranslationOutput output;
+    EXPECT_EQ(TranslationOutput::ErrorCode::success, compilerInterface->compile(device, inputArgs, output));
+    EXPECT_EQ(IGC::CodeType::spirV, output.intermediateCodeType);
+    EXPECT_NE(0u, output.intermediateRepresentation.size);
+    EXPECT_EQ(1u, mockCache->getStatistics().intermediateRepresentationHits);
+    EXPECT_EQ(1u, mockCache->getStatistics().intermediateRepresentationMisses);
+
+    auto includeSrc = "#include \"file.h\"\n__kernel k() {}";
+    inputArgs.src = ArrayRef<const char>(includeSrc, strlen(includeSrc));
+    EXPECT_EQ(TranslationOutput::ErrorCode::compilationFailure, compilerInterface->compile(device, inputArgs, output));
+
+    gEnvironment->fclPopDebugVars();
+}
+
+TEST(CompilerCacheTests, givenSameInputWhenGettingIntermediateRepresentationFileNameThenItDiffersFromBinaryFileNameAndDependsOnCodeType) {
+    CompilerCacheMock cache;
+    auto &hwInfo = *defaultHwInfo;
+    const char src[] = "__kernel k() {}";
+    ArrayRef<const char> input(src, sizeof(src));
+    ArrayRef<const char> empty;
+    ArrayRef<const char> revision("rev", 3);
+
+    auto binaryName = cache.getCachedFileName(hwInfo, input, empty, empty, empty, empty, revision, 0u, 0);
+    auto spirVName = cache.getCachedIntermediateRepresentationFileName(hwInfo, input, empty, empty, IGC::CodeType::spirV, revision, 0u, 0);
+    auto llvmBcName = cache.getCachedIntermediateRepresentationFileName(hwInfo, input, empty, empty, IGC::CodeType::llvmBc, revision, 0u, 0);
+
+    EXPECT_NE(binaryName, spirVName);
+    EXPECT_NE(spirVName, llvmBcName);
+    EXPECT_EQ(spirVName, cache.getCachedIntermediateRepresentationFileName(hwInfo, input, empty, empty, IGC::CodeType::spirV, revision, 0u, 0));
+}
+
 class CompilerInterfaceOclElfCacheTest : public ::testing::Test, public CompilerCacheHelper {
   public:
     using CompilerCacheHelper::processPackedCacheBinary;
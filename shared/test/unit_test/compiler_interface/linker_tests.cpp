@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -13,6 +13,7 @@
 #include "shared/source/kernel/kernel_descriptor.h"
 #include "shared/source/memory_manager/graphics_allocation.h"
 #include "shared/source/program/program_initialization.h"
+#include "shared/source/utilities/thread_pool.h"
 #include "shared/test/common/compiler_interface/linker_mock.h"
 #include "shared/test/common/fixtures/device_fixture.h"
 #include "shared/test/common/helpers/debug_manager_state_restore.h"
@@ -2393,3 +2394,73 @@ TEST_F(LinkerTests, givenPerThreadPayloadOffsetRelocationWhenPatchingInstruction
     auto perThreadPayloadOffsetPatchedValue = reinterpret_cast<uint32_t *>(ptrOffset(segmentToPatch.hostPointer, static_cast<size_t>(rel.offset)));
     EXPECT_EQ(kd.kernelAttributes.crossThreadDataSize, static_cast<uint32_t>(*perThreadPayloadOffsetPatchedValue));
 }
+
+TEST(DynamicLinkSymbolTableTests, givenSymbolsExportedByMultipleModulesWhenAddingModulesThenNamesAreInternedOnceAndFirstDefinitionWins) {
+    NEO::Linker::RelocatedSymbolsMap module0Symbols;
+    NEO::Linker::RelocatedSymbolsMap module1Symbols;
+    module0Symbols["fun"].gpuAddress = 0x1000;
+    module1Symbols["fun"].gpuAddress = 0x2000;
+    module1Symbols["var"].gpuAddress = 0x3000;
+    int module0 = 0;
+    int module1 = 0;
+
+    NEO::DynamicLinkSymbolTable symbolTable;
+    auto undefinedId = symbolTable.internSymbolName("undefined");
+    symbolTable.addModuleSymbols(&module0, module0Symbols);
+    symbolTable.addModuleSymbols(&module1, module1Symbols);
+
+    EXPECT_EQ(3u, symbolTable.getSymbolsCount());
+    EXPECT_EQ(undefinedId, symbolTable.internSymbolName("undefined"));
+    EXPECT_EQ(nullptr, symbolTable.findDefinition(undefinedId));
+    EXPECT_EQ(NEO::DynamicLinkSymbolTable::invalidSymbolId, symbolTable.findSymbolId("unknown"));
+    EXPECT_EQ(nullptr, symbolTable.findDefinition("unknown"));
+
+    auto funDefinition = symbolTable.findDefinition("fun");
+    ASSERT_NE(nullptr, funDefinition);
+    EXPECT_EQ(0x1000u, funDefinition->gpuAddress);
+    EXPECT_EQ(&module0, funDefinition->exportingModule);
+
+    auto varDefinition = symbolTable.findDefinition(symbolTable.findSymbolId("var"));
+    ASSERT_NE(nullptr, varDefinition);
+    EXPECT_EQ(0x3000u, varDefinition->gpuAddress);
+    EXPECT_EQ(&module1, varDefinition->exportingModule);
+}
+
+TEST(DynamicLinkSymbolTableTests, givenResolvedExternalsWhenPatchingWithMultipleThreadsThenAllRelocationsArePatched) {
+    NEO::Linker::RelocationInfo address;
+    address.type = NEO::Linker::RelocationInfo::Type::address;
+    NEO::Linker::RelocationInfo addressLow;
+    addressLow.type = NEO::Linker::RelocationInfo::Type::addressLow;
+    NEO::Linker::RelocationInfo addressHigh;
+    addressHigh.type = NEO::Linker::RelocationInfo::Type::addressHigh;
+
+    constexpr size_t relocationsCount = 100u;
+    std::vector<uint64_t> segment(relocationsCount * 2, 0u);
+    NEO::ResolvedExternals resolvedExternals;
+    for (size_t i = 0; i < relocationsCount; i++) {
+        uint64_t value = 0x100000000ull * (i + 1) + i;
+        resolvedExternals.push_back({&segment[2 * i], value, &address});
+        resolvedExternals.push_back({&segment[2 * i + 1], value, &addressLow});
+        resolvedExternals.push_back({ptrOffset(&segment[2 * i + 1], sizeof(uint32_t)), value, &addressHigh});
+    }
+
+    NEO::ThreadPool threadPool(2u);
+    for (auto threadsCount : {1u, 3u, 1000u}) {
+        std::fill(segment.begin(), segment.end(), 0u);
+        NEO::patchResolvedExternals(resolvedExternals, threadsCount, &threadPool);
+        for (size_t i = 0; i < relocationsCount; i++) {
+            uint64_t value = 0x100000000ull * (i + 1) + i;
+            EXPECT_EQ(value, segment[2 * i]);
+            EXPECT_EQ(value, segment[2 * i + 1]);
+        }
+    }
+}
+
+TEST(DynamicLinkSymbolTableTests, givenRelocationsCountWhenGettingThreadsCountForPatchingThenSingleThreadIsUsedForSmallLinksUnlessOverridden) {
+    DebugManagerStateRestore restorer;
+    EXPECT_EQ(1u, NEO::getThreadsCountForPatching(NEO::minRelocationsForParallelPatching - 1));
+    EXPECT_GE(NEO::maxDynamicLinkPatchingThreads, NEO::getThreadsCountForPatching(NEO::minRelocationsForParallelPatching * 100));
+
+    debugManager.flags.DynamicLinkPatchingThreads.set(4);
+    EXPECT_EQ(4u, NEO::getThreadsCountForPatching(1u));
+}
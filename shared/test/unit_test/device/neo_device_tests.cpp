@@ -35,6 +35,17 @@
 
 using namespace NEO;
 
+TEST(DeviceTest, givenRootDeviceWithSubDevicesWhenCreatedThenIsaAllocationCacheIsCreatedOnceAndSharedWithSubDevices) {
+    UltDeviceFactory factory{1, 2};
+    auto rootDevice = factory.rootDevices[0];
+    ASSERT_NE(nullptr, rootDevice->isaAllocationCache.get());
+    EXPECT_EQ(rootDevice->isaAllocationCache.get(), rootDevice->getIsaAllocationCache());
+    for (auto subDevice : factory.subDevices) {
+        EXPECT_EQ(nullptr, subDevice->isaAllocationCache.get());
+        EXPECT_EQ(rootDevice->isaAllocationCache.get(), subDevice->getIsaAllocationCache());
+    }
+}
+
 TEST(DeviceBlitterTest, whenBlitterOperationsSupportIsDisabledThenNoInternalCopyEngineIsReturned) {
     VariableBackup<HardwareInfo> backupHwInfo(defaultHwInfo.get());
     defaultHwInfo->capabilityTable.blitterOperationsSupported = false;
@@ -21,6 +21,9 @@ struct DirectSubmissionControllerMock : public DirectSubmissionController {
     using DirectSubmissionController::lastTerminateCpuTimestamp;
     using DirectSubmissionController::lowestThrottleSubmitted;
     using DirectSubmissionController::maxTimeout;
+    using DirectSubmissionController::nextWakeupTimestamp;
+    using DirectSubmissionController::predictiveTermination;
+    using DirectSubmissionController::predictTimeout;
     using DirectSubmissionController::timeout;
     using DirectSubmissionController::timeoutDivisor;
     using DirectSubmissionController::timeoutParamsMap;
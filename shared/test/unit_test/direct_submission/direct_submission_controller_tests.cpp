@@ -78,6 +78,36 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenRegiste
     controller.unregisterDirectSubmission(&csr);
 }
 
+TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenCheckingSubmissionsThenExpiredCoalescedSubmissionsAreReleased) {
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    std::unique_ptr<OsContext> osContext(OsContext::create(nullptr, 0, 0,
+                                                           EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::regular},
+                                                                                                        PreemptionMode::ThreadGroup, deviceBitfield)));
+    csr.setupContext(*osContext.get());
+
+    DirectSubmissionControllerMock controller;
+    controller.keepControlling.store(false);
+    controller.directSubmissionControllingThread->join();
+    controller.directSubmissionControllingThread.reset();
+    controller.registerDirectSubmission(&csr);
+
+    controller.checkNewSubmissions();
+    EXPECT_EQ(1u, csr.releaseCoalescedDirectSubmissionsCalled);
+    EXPECT_TRUE(csr.releaseCoalescedDirectSubmissionsExpiredOnly);
+
+    controller.predictiveTermination = true;
+    controller.checkNewSubmissions();
+    EXPECT_EQ(2u, csr.releaseCoalescedDirectSubmissionsCalled);
+    EXPECT_TRUE(csr.releaseCoalescedDirectSubmissionsExpiredOnly);
+
+    controller.unregisterDirectSubmission(&csr);
+}
+
 TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerWhenTimeoutThenDirectSubmissionsAreChecked) {
     MockExecutionEnvironment executionEnvironment;
     executionEnvironment.prepareRootDeviceEnvironments(1);
@@ -603,4 +633,121 @@ TEST(DirectSubmissionControllerTests, givenDirectSubmissionControllerDirectSubmi
     controller.unregisterDirectSubmission(&csr4);
 }
 
+TEST(SubmissionGapHistogramTests, givenRecordedSubmissionsWhenGettingGapPercentileThenUpperBoundOfCoveringBucketIsReturned) {
+    SubmissionGapHistogram submissionGaps;
+    EXPECT_FALSE(submissionGaps.hasSubmissions());
+    EXPECT_EQ(std::chrono::microseconds::max(), submissionGaps.getGapPercentile(90u));
+
+    auto timestamp = SteadyClock::time_point(std::chrono::seconds(1));
+    submissionGaps.recordSubmission(timestamp);
+    EXPECT_TRUE(submissionGaps.hasSubmissions());
+    EXPECT_EQ(0u, submissionGaps.getSamplesCount());
+
+    for (uint32_t i = 0; i < 9u; i++) {
+        timestamp += std::chrono::microseconds(50);
+        submissionGaps.recordSubmission(timestamp);
+    }
+    timestamp += std::chrono::seconds(1);
+    submissionGaps.recordSubmission(timestamp);
+
+    EXPECT_EQ(10u, submissionGaps.getSamplesCount());
+    EXPECT_EQ(timestamp, submissionGaps.getLastSubmissionTimestamp());
+    EXPECT_EQ(std::chrono::microseconds(64), submissionGaps.getGapPercentile(90u));
+    EXPECT_EQ(std::chrono::microseconds::max(), submissionGaps.getGapPercentile(100u));
+
+    for (uint32_t i = 0; i < SubmissionGapHistogram::maxSamples; i++) {
+        timestamp += std::chrono::microseconds(50);
+        submissionGaps.recordSubmission(timestamp);
+    }
+    EXPECT_LT(submissionGaps.getSamplesCount(), SubmissionGapHistogram::maxSamples);
+}
+
+TEST(DirectSubmissionControllerTests, givenPredictiveControllerWhenPredictingTimeoutThenSubmissionGapsOfEngineAreUsed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionControllerPredictive.set(1);
+    debugManager.flags.DirectSubmissionControllerMaxTimeout.set(5'000);
+
+    DirectSubmissionControllerMock controller;
+    EXPECT_TRUE(controller.predictiveTermination);
+    controller.keepControlling.store(false);
+    controller.notifyDirectSubmissionStarted();
+    controller.directSubmissionControllingThread->join();
+    controller.directSubmissionControllingThread.reset();
+
+    EXPECT_EQ(controller.timeout, controller.predictTimeout(nullptr));
+
+    SubmissionGapHistogram denseGaps;
+    auto timestamp = SteadyClock::time_point(std::chrono::seconds(1));
+    for (uint32_t i = 0; i <= DirectSubmissionController::minSamplesForPrediction; i++) {
+        timestamp += std::chrono::microseconds(300);
+        denseGaps.recordSubmission(timestamp);
+    }
+    EXPECT_EQ(std::chrono::microseconds(512), controller.predictTimeout(&denseGaps));
+
+    SubmissionGapHistogram sparseGaps;
+    for (uint32_t i = 0; i <= DirectSubmissionController::minSamplesForPrediction; i++) {
+        timestamp += std::chrono::milliseconds(100);
+        sparseGaps.recordSubmission(timestamp);
+    }
+    EXPECT_EQ(DirectSubmissionController::minPredictedTimeout, controller.predictTimeout(&sparseGaps));
+}
+
+TEST(DirectSubmissionControllerTests, givenPredictiveControllerWhenEngineIsIdlePastPredictedDeadlineThenItIsTerminatedAndRestartIsCounted) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionControllerPredictive.set(1);
+    debugManager.flags.DirectSubmissionControllerMaxTimeout.set(5'000);
+
+    MockExecutionEnvironment executionEnvironment;
+    executionEnvironment.prepareRootDeviceEnvironments(1);
+    executionEnvironment.initializeMemoryManager();
+
+    DeviceBitfield deviceBitfield(1);
+    MockCommandStreamReceiver csr(executionEnvironment, 0, deviceBitfield);
+    std::unique_ptr<OsContext> osContext(OsContext::create(nullptr, 0, 0,
+                                                           EngineDescriptorHelper::getDefaultDescriptor({aub_stream::ENGINE_CCS, EngineUsage::regular},
+                                                                                                        PreemptionMode::ThreadGroup, deviceBitfield)));
+    csr.setupContext(*osContext.get());
+
+    SubmissionGapHistogram submissionGaps;
+    auto timestamp = SteadyClock::time_point(std::chrono::seconds(1));
+    for (uint32_t i = 0; i <= DirectSubmissionController::minSamplesForPrediction; i++) {
+        timestamp += std::chrono::microseconds(50);
+        submissionGaps.recordSubmission(timestamp);
+    }
+    csr.getDirectSubmissionGapHistogramReturnValue = &submissionGaps;
+
+    DirectSubmissionControllerMock controller;
+    controller.keepControlling.store(false);
+    controller.notifyDirectSubmissionStarted();
+    controller.directSubmissionControllingThread->join();
+    controller.directSubmissionControllingThread.reset();
+    controller.registerDirectSubmission(&csr);
+
+    csr.taskCount.store(1u);
+    controller.cpuTimestamp = timestamp;
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+    ASSERT_TRUE(controller.nextWakeupTimestamp.has_value());
+    EXPECT_EQ(timestamp + DirectSubmissionController::minPredictedTimeout, *controller.nextWakeupTimestamp);
+
+    controller.cpuTimestamp = *controller.nextWakeupTimestamp;
+    controller.checkNewSubmissions();
+    EXPECT_TRUE(controller.directSubmissions[&csr].isStopped);
+    EXPECT_FALSE(controller.nextWakeupTimestamp.has_value());
+
+    timestamp += std::chrono::milliseconds(1);
+    submissionGaps.recordSubmission(timestamp);
+    csr.taskCount.store(2u);
+    controller.cpuTimestamp = timestamp;
+    controller.checkNewSubmissions();
+    EXPECT_FALSE(controller.directSubmissions[&csr].isStopped);
+
+    auto statistics = controller.getTerminationStatistics();
+    EXPECT_EQ(1u, statistics.terminations);
+    EXPECT_EQ(1u, statistics.restarts);
+    EXPECT_EQ(1u, statistics.prematureTerminations);
+
+    controller.unregisterDirectSubmission(&csr);
+}
+
 } // namespace NEO
\ No newline at end of file
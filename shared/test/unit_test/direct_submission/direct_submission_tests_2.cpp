@@ -2761,3 +2761,100 @@ HWTEST_F(DirectSubmissionDispatchBufferTest, givenNotStartedDirectSubmissionWhen
 
     EXPECT_FALSE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
 }
+
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenCoalescingEnabledWhenSubmissionsArriveInBurstThenSemaphoreIsReleasedOnceForDeferredSubmissions) {
+    using Dispatcher = RenderDispatcher<FamilyType>;
+
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionRelaxedOrdering.set(0);
+    debugManager.flags.DirectSubmissionCoalescingWindow.set(10 * 1000 * 1000);
+
+    FlushStampTracker flushStamp(true);
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_TRUE(directSubmission.coalescingEnabled);
+    EXPECT_TRUE(directSubmission.initialize(true, false));
+
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    auto releasedQueueWorkCount = directSubmission.semaphoreData->queueWorkCount;
+    EXPECT_EQ(directSubmission.currentQueueWorkCount - 1, releasedQueueWorkCount);
+
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_EQ(2u, directSubmission.pendingSubmissions);
+    EXPECT_EQ(releasedQueueWorkCount, directSubmission.semaphoreData->queueWorkCount);
+
+    {
+        std::lock_guard<std::mutex> lock(directSubmission.coalescingMutex);
+        directSubmission.releasePendingSubmissions();
+    }
+    EXPECT_EQ(0u, directSubmission.pendingSubmissions);
+    EXPECT_EQ(directSubmission.currentQueueWorkCount - 1, directSubmission.semaphoreData->queueWorkCount);
+
+    auto statistics = directSubmission.getCoalescingStatistics();
+    EXPECT_EQ(2u, statistics.semaphoreReleases);
+    EXPECT_EQ(3u, statistics.releasedSubmissions);
+    EXPECT_EQ(1u, statistics.coalescedReleases);
+    EXPECT_EQ(2u, statistics.maxReleasedSubmissions);
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenCoalescingEnabledWhenMaxCoalescedSubmissionsIsReachedOrHighThrottleIsSubmittedThenSemaphoreIsReleasedImmediately) {
+    using Dispatcher = RenderDispatcher<FamilyType>;
+
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionRelaxedOrdering.set(0);
+    debugManager.flags.DirectSubmissionCoalescingWindow.set(10 * 1000 * 1000);
+    debugManager.flags.DirectSubmissionMaxCoalescedSubmissions.set(2);
+
+    FlushStampTracker flushStamp(true);
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_EQ(2u, directSubmission.maxCoalescedSubmissions);
+    EXPECT_TRUE(directSubmission.initialize(true, false));
+
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_EQ(1u, directSubmission.pendingSubmissions);
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_EQ(0u, directSubmission.pendingSubmissions);
+    EXPECT_EQ(directSubmission.currentQueueWorkCount - 1, directSubmission.semaphoreData->queueWorkCount);
+
+    batchBuffer.throttle = QueueThrottle::HIGH;
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_EQ(0u, directSubmission.pendingSubmissions);
+    EXPECT_EQ(directSubmission.currentQueueWorkCount - 1, directSubmission.semaphoreData->queueWorkCount);
+
+    auto statistics = directSubmission.getCoalescingStatistics();
+    EXPECT_EQ(3u, statistics.semaphoreReleases);
+    EXPECT_EQ(4u, statistics.releasedSubmissions);
+    EXPECT_EQ(2u, statistics.maxReleasedSubmissions);
+}
+
+HWTEST_F(DirectSubmissionDispatchBufferTest, givenDeferredSubmissionWhenReleasingExpiredCoalescedSubmissionsThenItIsReleasedOnlyAfterWindowExpires) {
+    using Dispatcher = RenderDispatcher<FamilyType>;
+
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DirectSubmissionRelaxedOrdering.set(0);
+    debugManager.flags.DirectSubmissionCoalescingWindow.set(10 * 1000 * 1000);
+
+    FlushStampTracker flushStamp(true);
+    MockDirectSubmissionHw<FamilyType, Dispatcher> directSubmission(*pDevice->getDefaultEngine().commandStreamReceiver);
+    EXPECT_TRUE(directSubmission.initialize(true, false));
+
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_EQ(1u, directSubmission.pendingSubmissions);
+
+    directSubmission.releaseCoalescedSubmissions(true);
+    EXPECT_EQ(1u, directSubmission.pendingSubmissions);
+
+    directSubmission.firstPendingSubmissionTime -= directSubmission.coalescingWindow;
+    directSubmission.releaseCoalescedSubmissions(true);
+    EXPECT_EQ(0u, directSubmission.pendingSubmissions);
+    EXPECT_EQ(directSubmission.currentQueueWorkCount - 1, directSubmission.semaphoreData->queueWorkCount);
+
+    EXPECT_TRUE(directSubmission.dispatchCommandBuffer(batchBuffer, flushStamp));
+    EXPECT_EQ(1u, directSubmission.pendingSubmissions);
+    directSubmission.releaseCoalescedSubmissions(false);
+    EXPECT_EQ(0u, directSubmission.pendingSubmissions);
+    EXPECT_EQ(directSubmission.currentQueueWorkCount - 1, directSubmission.semaphoreData->queueWorkCount);
+    EXPECT_EQ(3u, directSubmission.getCoalescingStatistics().semaphoreReleases);
+}
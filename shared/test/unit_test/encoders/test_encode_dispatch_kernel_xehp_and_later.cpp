@@ -627,6 +627,56 @@ HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenInlineDataRequiredIsF
     EXPECT_EQ(expectedSizeIOH, heap->getUsed());
 }
 
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenDispatchHeapDataReuseEnabledWhenEncodingIdenticalDispatchesThenIndirectDataOfPreviousDispatchIsReused) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+    DebugManagerStateRestore restore;
+    debugManager.flags.EnableDispatchHeapDataReuse.set(1);
+    uint32_t dims[] = {1, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    dispatchInterface->kernelDescriptor.kernelAttributes.flags.passInlineData = false;
+
+    bool requiresUncachedMocs = false;
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+    auto heap = cmdContainer->getIndirectHeap(HeapType::indirectObject);
+
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    auto heapUsedAfterFirstDispatch = heap->getUsed();
+    EXPECT_NE(0u, heapUsedAfterFirstDispatch);
+
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    EXPECT_EQ(heapUsedAfterFirstDispatch, heap->getUsed());
+
+    dispatchInterface->dataCrossThread[0]++;
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    EXPECT_LT(heapUsedAfterFirstDispatch, heap->getUsed());
+
+    GenCmdList commands;
+    CmdParse<FamilyType>::parseCommandBuffer(commands, cmdContainer->getCommandStream()->getCpuBase(), cmdContainer->getCommandStream()->getUsed());
+    auto walkers = findAll<DefaultWalkerType *>(commands.begin(), commands.end());
+    ASSERT_EQ(3u, walkers.size());
+    auto firstWalker = genCmdCast<DefaultWalkerType *>(*walkers[0]);
+    auto secondWalker = genCmdCast<DefaultWalkerType *>(*walkers[1]);
+    auto thirdWalker = genCmdCast<DefaultWalkerType *>(*walkers[2]);
+    EXPECT_EQ(firstWalker->getIndirectDataStartAddress(), secondWalker->getIndirectDataStartAddress());
+    EXPECT_NE(firstWalker->getIndirectDataStartAddress(), thirdWalker->getIndirectDataStartAddress());
+}
+
+HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenDispatchHeapDataReuseDisabledWhenEncodingIdenticalDispatchesThenIndirectDataIsCopiedForEachDispatch) {
+    using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
+    uint32_t dims[] = {1, 1, 1};
+    std::unique_ptr<MockDispatchKernelEncoder> dispatchInterface(new MockDispatchKernelEncoder());
+    dispatchInterface->kernelDescriptor.kernelAttributes.flags.passInlineData = false;
+
+    bool requiresUncachedMocs = false;
+    EncodeDispatchKernelArgs dispatchArgs = createDefaultDispatchKernelArgs(pDevice, dispatchInterface.get(), dims, requiresUncachedMocs);
+    auto heap = cmdContainer->getIndirectHeap(HeapType::indirectObject);
+
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    auto heapUsedAfterFirstDispatch = heap->getUsed();
+    EncodeDispatchKernel<FamilyType>::template encode<DefaultWalkerType>(*cmdContainer.get(), dispatchArgs);
+    EXPECT_EQ(2 * heapUsedAfterFirstDispatch, heap->getUsed());
+}
+
 HWCMDTEST_F(IGFX_XE_HP_CORE, CommandEncodeStatesTest, givenInlineDataRequiredAndZeroCrossThreadDataSizeWhenEncodingWalkerThenEmitInlineParameterIsNotSet) {
     using DefaultWalkerType = typename FamilyType::DefaultWalkerType;
     uint32_t dims[] = {1, 1, 1};
@@ -128,6 +128,42 @@ HWTEST_F(BindlessCommandEncodeStatesTest, GivenBindlessEnabledWhenBorderColorWit
     alignedFree(memory);
 }
 
+HWTEST_F(BindlessCommandEncodeStatesTest, GivenBindlessEnabledWhenCopyingIdenticalSamplerStatesTwiceThenSameSlotInGlobalDshIsUsed) {
+    using SAMPLER_BORDER_COLOR_STATE = typename FamilyType::SAMPLER_BORDER_COLOR_STATE;
+    using SAMPLER_STATE = typename FamilyType::SAMPLER_STATE;
+    DebugManagerStateRestore restorer;
+    debugManager.flags.UseExternalAllocatorForSshAndDsh.set(1);
+    debugManager.flags.EnableBindlessStateCache.set(1);
+    uint32_t numSamplers = 1;
+    auto mockHelper = std::make_unique<MockBindlesHeapsHelper>(pDevice,
+                                                               pDevice->getNumGenericSubDevices() > 1);
+    mockHelper->globalBindlessDsh = true;
+
+    pDevice->getExecutionEnvironment()->rootDeviceEnvironments[pDevice->getRootDeviceIndex()]->bindlessHeapsHelper.reset(mockHelper.release());
+
+    SAMPLER_BORDER_COLOR_STATE borderColorState;
+    borderColorState.init();
+    uint32_t borderColorSize = sizeof(SAMPLER_BORDER_COLOR_STATE);
+
+    auto memory = alignedMalloc(4096, 4096);
+    memcpy_s(memory, 4096, &borderColorState, sizeof(SAMPLER_BORDER_COLOR_STATE));
+    SAMPLER_STATE samplerState;
+    samplerState.init();
+    memcpy_s(ptrOffset(memory, sizeof(SAMPLER_BORDER_COLOR_STATE)), 4096 - sizeof(SAMPLER_BORDER_COLOR_STATE), &samplerState, sizeof(SAMPLER_STATE));
+
+    auto bindlessHeapsHelper = pDevice->getBindlessHeapsHelper();
+    auto dsh = bindlessHeapsHelper->getHeap(BindlessHeapsHelper::BindlesHeapType::globalDsh);
+    auto offset = EncodeStates<FamilyType>::copySamplerState(dsh, borderColorSize, numSamplers, 0, memory, bindlessHeapsHelper, pDevice->getRootDeviceEnvironment());
+    auto usedAfterFirstCopy = dsh->getUsed();
+    auto offset2 = EncodeStates<FamilyType>::copySamplerState(dsh, borderColorSize, numSamplers, 0, memory, bindlessHeapsHelper, pDevice->getRootDeviceEnvironment());
+
+    EXPECT_EQ(offset, offset2);
+    EXPECT_EQ(usedAfterFirstCopy, dsh->getUsed());
+    EXPECT_EQ(1u, bindlessHeapsHelper->getStateCacheStatistics().hits);
+
+    alignedFree(memory);
+}
+
 HWTEST_F(BindlessCommandEncodeStatesTest, GivenBindlessHeapHelperAndGlobalDshNotUsedWhenCopyingSamplerStateThenDynamicPatternIsUsedAndOffsetFromDshProgrammed) {
     using SAMPLER_BORDER_COLOR_STATE = typename FamilyType::SAMPLER_BORDER_COLOR_STATE;
     using INTERFACE_DESCRIPTOR_DATA = typename FamilyType::INTERFACE_DESCRIPTOR_DATA;
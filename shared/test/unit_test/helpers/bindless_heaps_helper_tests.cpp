@@ -557,3 +557,88 @@ TEST_F(BindlessHeapsHelperTests, givenBindlessHeapHelperWhenItsCreatedThenSshAll
         EXPECT_EQ(memoryOperationsIface->isResident(getDevice(), *allocation), MemoryOperationsStatus::success);
     }
 }
+
+TEST_F(BindlessHeapsHelperTests, givenStatesWithIdenticalContentWhenAllocatingCachedStatesThenSameSlotIsReturned) {
+    DebugManagerStateRestore dbgRestorer;
+    debugManager.flags.EnableBindlessStateCache.set(1);
+    auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(getDevice(), false);
+    auto stateSize = bindlessHeapHelper->surfaceStateSize;
+    std::vector<uint8_t> stateContent(stateSize, 0xab);
+
+    auto usedBefore = bindlessHeapHelper->globalSsh->getUsed();
+    auto stateInfo = bindlessHeapHelper->allocateCachedStateInHeap(stateContent.data(), stateSize, BindlessHeapsHelper::globalSsh);
+    auto stateInfo2 = bindlessHeapHelper->allocateCachedStateInHeap(stateContent.data(), stateSize, BindlessHeapsHelper::globalSsh);
+
+    EXPECT_NE(nullptr, stateInfo.ssPtr);
+    EXPECT_EQ(stateInfo.ssPtr, stateInfo2.ssPtr);
+    EXPECT_EQ(stateInfo.surfaceStateOffset, stateInfo2.surfaceStateOffset);
+    EXPECT_EQ(0, memcmp(stateInfo.ssPtr, stateContent.data(), stateSize));
+    EXPECT_EQ(usedBefore + stateSize, bindlessHeapHelper->globalSsh->getUsed());
+
+    stateContent[0] = 0xcd;
+    auto stateInfo3 = bindlessHeapHelper->allocateCachedStateInHeap(stateContent.data(), stateSize, BindlessHeapsHelper::globalSsh);
+    EXPECT_NE(stateInfo.surfaceStateOffset, stateInfo3.surfaceStateOffset);
+    EXPECT_EQ(usedBefore + 2 * stateSize, bindlessHeapHelper->globalSsh->getUsed());
+
+    EXPECT_EQ(2u, bindlessHeapHelper->cachedStates[BindlessHeapsHelper::globalSsh].size());
+
+    auto statistics = bindlessHeapHelper->getStateCacheStatistics();
+    EXPECT_EQ(1u, statistics.hits);
+    EXPECT_EQ(2u, statistics.misses);
+    EXPECT_EQ(2u, statistics.cachedStatesCount);
+    EXPECT_EQ(bindlessHeapHelper->globalSsh->getUsed(), statistics.heapUsedSize[BindlessHeapsHelper::globalSsh]);
+    EXPECT_EQ(bindlessHeapHelper->globalSsh->getMaxAvailableSpace(), statistics.heapAllocatedSize[BindlessHeapsHelper::globalSsh]);
+}
+
+TEST_F(BindlessHeapsHelperTests, givenDefaultSettingsWhenCreatingBindlessHeapsHelperThenStateCacheIsDisabled) {
+    auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(getDevice(), false);
+    EXPECT_FALSE(bindlessHeapHelper->isStateCacheEnabled());
+}
+
+TEST_F(BindlessHeapsHelperTests, givenStateCacheDisabledWhenAllocatingStatesWithIdenticalContentThenDifferentSlotsAreReturned) {
+    DebugManagerStateRestore dbgRestorer;
+    debugManager.flags.EnableBindlessStateCache.set(0);
+    auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(getDevice(), false);
+    EXPECT_FALSE(bindlessHeapHelper->isStateCacheEnabled());
+
+    auto stateSize = bindlessHeapHelper->surfaceStateSize;
+    std::vector<uint8_t> stateContent(stateSize, 0xab);
+
+    auto stateInfo = bindlessHeapHelper->allocateCachedStateInHeap(stateContent.data(), stateSize, BindlessHeapsHelper::globalSsh);
+    auto stateInfo2 = bindlessHeapHelper->allocateCachedStateInHeap(stateContent.data(), stateSize, BindlessHeapsHelper::globalSsh);
+    EXPECT_NE(stateInfo.surfaceStateOffset, stateInfo2.surfaceStateOffset);
+    EXPECT_EQ(0, memcmp(stateInfo2.ssPtr, stateContent.data(), stateSize));
+    EXPECT_EQ(0u, bindlessHeapHelper->cachedStates[BindlessHeapsHelper::globalSsh].size());
+}
+
+TEST_F(BindlessHeapsHelperTests, givenSamplerStatesWithIdenticalContentWhenAllocatingCachedStatesInGlobalDshThenSameSlotIsReturned) {
+    DebugManagerStateRestore dbgRestorer;
+    debugManager.flags.EnableBindlessStateCache.set(1);
+    auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(getDevice(), false);
+    uint8_t stateContent[64] = {1};
+
+    auto stateInfo = bindlessHeapHelper->allocateCachedStateInHeap(stateContent, sizeof(stateContent), BindlessHeapsHelper::globalDsh);
+    auto usedAfterFirstAllocation = bindlessHeapHelper->globalDsh->getUsed();
+    auto stateInfo2 = bindlessHeapHelper->allocateCachedStateInHeap(stateContent, sizeof(stateContent), BindlessHeapsHelper::globalDsh);
+
+    EXPECT_EQ(stateInfo.surfaceStateOffset, stateInfo2.surfaceStateOffset);
+    EXPECT_EQ(usedAfterFirstAllocation, bindlessHeapHelper->globalDsh->getUsed());
+    EXPECT_EQ(1u, bindlessHeapHelper->cachedStates[BindlessHeapsHelper::globalDsh].size());
+}
+
+TEST_F(BindlessHeapsHelperTests, givenStateCacheEnabledWhenAllocatingEmptyStateThenCurrentHeapOffsetIsReturnedAndStateIsNotCached) {
+    DebugManagerStateRestore dbgRestorer;
+    debugManager.flags.EnableBindlessStateCache.set(1);
+    auto bindlessHeapHelper = std::make_unique<MockBindlesHeapsHelper>(getDevice(), false);
+    uint8_t stateContent[64] = {1};
+    bindlessHeapHelper->allocateCachedStateInHeap(stateContent, sizeof(stateContent), BindlessHeapsHelper::globalDsh);
+
+    auto usedBefore = bindlessHeapHelper->globalDsh->getUsed();
+    auto stateInfo = bindlessHeapHelper->allocateCachedStateInHeap(nullptr, 0u, BindlessHeapsHelper::globalDsh);
+
+    auto heapAllocation = bindlessHeapHelper->globalDsh->getGraphicsAllocation();
+    EXPECT_NE(0u, usedBefore);
+    EXPECT_EQ(heapAllocation->getGpuAddress() - heapAllocation->getGpuBaseAddress() + usedBefore, stateInfo.surfaceStateOffset);
+    EXPECT_EQ(usedBefore, bindlessHeapHelper->globalDsh->getUsed());
+    EXPECT_EQ(1u, bindlessHeapHelper->cachedStates[BindlessHeapsHelper::globalDsh].size());
+}
@@ -0,0 +1,273 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/tiled_image_copy.h"
+#include "shared/source/utilities/thread_pool.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/test_macros/test.h"
+
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+using namespace NEO;
+
+namespace {
+constexpr ImageTilingMode testedTilingModes[] = {ImageTilingMode::linear, ImageTilingMode::tileX, ImageTilingMode::tileY, ImageTilingMode::tile4};
+
+// Reference layouts built from tile structure, independent from bit swizzles used by the copy engine
+size_t referenceOffsetInTile(ImageTilingMode tilingMode, size_t x, size_t y) {
+    switch (tilingMode) {
+    case ImageTilingMode::tileX:
+        // 512B x 8 rows, row major
+        return y * 512 + x;
+    case ImageTilingMode::tileY:
+        // 128B x 32 rows, made of 16B wide columns of 32 rows
+        return (x / 16) * 512 + y * 16 + (x % 16);
+    default: {
+        // 128B x 32 rows, made of 1KB blocks of 128B x 8 rows, each being two 512B blocks of 64B x 8 rows,
+        // each being two 256B blocks of 64B x 4 rows, each being four 64B blocks of 16B x 4 rows
+        size_t offset = (y / 8) * 1024;
+        y %= 8;
+        offset += (x / 64) * 512;
+        x %= 64;
+        offset += (y / 4) * 256;
+        y %= 4;
+        offset += (x / 16) * 64;
+        x %= 16;
+        return offset + y * 16 + x;
+    }
+    }
+}
+
+size_t referenceOffset(ImageTilingMode tilingMode, size_t rowPitch, size_t x, size_t y) {
+    if (tilingMode == ImageTilingMode::linear) {
+        return y * rowPitch + x;
+    }
+    auto tileWidth = TiledImageCopy::getTileWidthInBytes(tilingMode);
+    auto tileHeight = TiledImageCopy::getTileHeightInRows(tilingMode);
+    auto tilesInRow = rowPitch / tileWidth;
+    auto tileIndex = (y / tileHeight) * tilesInRow + (x / tileWidth);
+    return tileIndex * TiledImageCopy::tileSize + referenceOffsetInTile(tilingMode, x % tileWidth, y % tileHeight);
+}
+
+struct TiledSurface {
+    TiledSurface(ImageTilingMode tilingMode, size_t rowPitch, size_t qPitch, size_t slices) : tilingMode(tilingMode), rowPitch(rowPitch), qPitch(qPitch) {
+        storage.resize(rowPitch * qPitch * slices, 0xcd);
+    }
+
+    uint8_t &at(size_t x, size_t y, size_t z) {
+        return storage[referenceOffset(tilingMode, rowPitch, x, z * qPitch + y)];
+    }
+
+    ImageTilingMode tilingMode;
+    size_t rowPitch;
+    size_t qPitch;
+    std::vector<uint8_t> storage;
+};
+
+TiledImageCopyParams createParams(TiledSurface &surface, std::vector<uint8_t> &linear, const size_t (&origin)[3], const size_t (&region)[3], size_t linearRowPitch) {
+    TiledImageCopyParams params;
+    params.tiledPtr = surface.storage.data();
+    params.linearPtr = linear.data();
+    params.tiledRowPitch = surface.rowPitch;
+    params.tiledQPitch = surface.qPitch;
+    params.linearRowPitch = linearRowPitch;
+    params.linearSlicePitch = linearRowPitch * region[1];
+    for (int i = 0; i < 3; i++) {
+        params.tiledOrigin[i] = origin[i];
+        params.region[i] = region[i];
+    }
+    params.tilingMode = surface.tilingMode;
+    return params;
+}
+} // namespace
+
+TEST(TiledImageCopyTest, givenTilingModeWhenGettingOffsetInTiledSurfaceThenReferenceLayoutIsReturned) {
+    constexpr size_t rowPitch = 1024u;
+    for (auto tilingMode : testedTilingModes) {
+        auto width = rowPitch;
+        auto height = 2 * TiledImageCopy::getTileHeightInRows(ImageTilingMode::tileY);
+        for (size_t y = 0; y < height; y++) {
+            for (size_t x = 0; x < width; x++) {
+                EXPECT_EQ(referenceOffset(tilingMode, rowPitch, x, y), TiledImageCopy::getOffsetInTiledSurface(tilingMode, rowPitch, x, y));
+            }
+        }
+    }
+}
+
+TEST(TiledImageCopyTest, givenUnalignedRegionWhenCopyingLinearToTiledThenOnlyRegionIsWrittenAtReferenceOffsets) {
+    constexpr size_t rowPitch = 1024u;
+    constexpr size_t qPitch = 96u;
+    constexpr size_t origin[3] = {37, 5, 1};
+    constexpr size_t region[3] = {733, 70, 2};
+    constexpr size_t linearRowPitch = 800u;
+
+    for (auto tilingMode : testedTilingModes) {
+        TiledSurface surface(tilingMode, rowPitch, qPitch, 3);
+        std::vector<uint8_t> linear(linearRowPitch * region[1] * region[2]);
+        for (size_t i = 0; i < linear.size(); i++) {
+            linear[i] = static_cast<uint8_t>(i % 251);
+        }
+
+        auto params = createParams(surface, linear, origin, region, linearRowPitch);
+        ASSERT_TRUE(TiledImageCopy::isCopySupported(params));
+        TiledImageCopy::copyLinearToTiled(params, 1u, nullptr);
+
+        size_t writtenBytes = 0u;
+        for (size_t z = 0; z < region[2]; z++) {
+            for (size_t y = 0; y < region[1]; y++) {
+                for (size_t x = 0; x < region[0]; x++) {
+                    EXPECT_EQ(linear[z * linearRowPitch * region[1] + y * linearRowPitch + x], surface.at(origin[0] + x, origin[1] + y, origin[2] + z));
+                    surface.at(origin[0] + x, origin[1] + y, origin[2] + z) = 0xcd;
+                    writtenBytes++;
+                }
+            }
+        }
+        EXPECT_EQ(region[0] * region[1] * region[2], writtenBytes);
+        for (auto byte : surface.storage) {
+            EXPECT_EQ(0xcd, byte);
+        }
+    }
+}
+
+TEST(TiledImageCopyTest, givenTiledSurfaceWhenCopyingTiledToLinearThenDataIsReadFromReferenceOffsets) {
+    constexpr size_t rowPitch = 512u;
+    constexpr size_t qPitch = 64u;
+    constexpr size_t origin[3] = {16, 31, 0};
+    constexpr size_t region[3] = {250, 33, 3};
+    constexpr size_t linearRowPitch = 256u;
+
+    for (auto tilingMode : testedTilingModes) {
+        TiledSurface surface(tilingMode, rowPitch, qPitch, 3);
+        for (size_t i = 0; i < surface.storage.size(); i++) {
+            surface.storage[i] = static_cast<uint8_t>((i * 13) % 241);
+        }
+        std::vector<uint8_t> linear(linearRowPitch * region[1] * region[2], 0u);
+
+        auto params = createParams(surface, linear, origin, region, linearRowPitch);
+        TiledImageCopy::copyTiledToLinear(params, 1u, nullptr);
+
+        for (size_t z = 0; z < region[2]; z++) {
+            for (size_t y = 0; y < region[1]; y++) {
+                auto linearRow = &linear[z * linearRowPitch * region[1] + y * linearRowPitch];
+                for (size_t x = 0; x < region[0]; x++) {
+                    EXPECT_EQ(surface.at(origin[0] + x, origin[1] + y, origin[2] + z), linearRow[x]);
+                }
+                for (size_t x = region[0]; x < linearRowPitch; x++) {
+                    EXPECT_EQ(0u, linearRow[x]);
+                }
+            }
+        }
+    }
+}
+
+TEST(TiledImageCopyTest, givenMultipleThreadsWhenCopyingThenResultIsSameAsWithSingleThread) {
+    constexpr size_t rowPitch = 2048u;
+    constexpr size_t qPitch = 128u;
+    constexpr size_t origin[3] = {3, 7, 0};
+    constexpr size_t region[3] = {2000, 100, 2};
+
+    ThreadPool threadPool(3u);
+    for (auto tilingMode : testedTilingModes) {
+        std::vector<uint8_t> linear(region[0] * region[1] * region[2]);
+        for (size_t i = 0; i < linear.size(); i++) {
+            linear[i] = static_cast<uint8_t>(i % 253);
+        }
+
+        TiledSurface singleThreaded(tilingMode, rowPitch, qPitch, 2);
+        TiledSurface multiThreaded(tilingMode, rowPitch, qPitch, 2);
+        TiledImageCopy::copyLinearToTiled(createParams(singleThreaded, linear, origin, region, region[0]), 1u, nullptr);
+        TiledImageCopy::copyLinearToTiled(createParams(multiThreaded, linear, origin, region, region[0]), 7u, &threadPool);
+        EXPECT_EQ(singleThreaded.storage, multiThreaded.storage);
+
+        std::vector<uint8_t> readBack(linear.size(), 0u);
+        TiledImageCopy::copyTiledToLinear(createParams(multiThreaded, readBack, origin, region, region[0]), 5u, &threadPool);
+        EXPECT_EQ(linear, readBack);
+    }
+}
+
+TEST(TiledImageCopyTest, givenSimdKernelsAvailableWhenCopyingColumnThenResultMatchesScalarCopy) {
+    auto simdKernels = TiledImageCopy::getSimdColumnCopyKernels();
+    if (simdKernels == nullptr) {
+        GTEST_SKIP();
+    }
+    EXPECT_EQ(simdKernels->toTiled, TiledImageCopy::getColumnCopyKernels().toTiled);
+
+    constexpr size_t linearRowPitch = 100u;
+    for (size_t rows : {1u, 2u, 4u, 31u, 32u}) {
+        std::vector<uint8_t> linear(linearRowPitch * rows);
+        for (size_t i = 0; i < linear.size(); i++) {
+            linear[i] = static_cast<uint8_t>(i * 3);
+        }
+        std::vector<uint8_t> tiled(TiledImageCopy::columnWidth * rows + 1, 0xcd);
+        simdKernels->toTiled(tiled.data(), linear.data() + 1, linearRowPitch, rows);
+        for (size_t row = 0; row < rows; row++) {
+            EXPECT_EQ(0, memcmp(&tiled[row * TiledImageCopy::columnWidth], &linear[row * linearRowPitch + 1], TiledImageCopy::columnWidth));
+        }
+        EXPECT_EQ(0xcd, tiled.back());
+
+        std::vector<uint8_t> readBack(linear.size(), 0u);
+        simdKernels->fromTiled(readBack.data(), linearRowPitch, tiled.data(), rows);
+        for (size_t row = 0; row < rows; row++) {
+            EXPECT_EQ(0, memcmp(&readBack[row * linearRowPitch], &tiled[row * TiledImageCopy::columnWidth], TiledImageCopy::columnWidth));
+        }
+    }
+}
+
+TEST(TiledImageCopyTest, givenInvalidParamsWhenCheckingIfCopyIsSupportedThenFalseIsReturned) {
+    TiledSurface surface(ImageTilingMode::tileY, 256u, 32u, 2);
+    std::vector<uint8_t> linear(256u * 32u * 2);
+    auto params = createParams(surface, linear, {0, 0, 0}, {256, 32, 2}, 256u);
+    EXPECT_TRUE(TiledImageCopy::isCopySupported(params));
+
+    auto invalidParams = params;
+    invalidParams.tilingMode = ImageTilingMode::unsupported;
+    EXPECT_FALSE(TiledImageCopy::isCopySupported(invalidParams));
+
+    invalidParams = params;
+    invalidParams.tiledRowPitch = 200u;
+    EXPECT_FALSE(TiledImageCopy::isCopySupported(invalidParams));
+
+    invalidParams = params;
+    invalidParams.tiledOrigin[0] = 1u;
+    EXPECT_FALSE(TiledImageCopy::isCopySupported(invalidParams));
+
+    invalidParams = params;
+    invalidParams.region[1] = 0u;
+    EXPECT_FALSE(TiledImageCopy::isCopySupported(invalidParams));
+
+    invalidParams = params;
+    invalidParams.tiledQPitch = 16u;
+    EXPECT_FALSE(TiledImageCopy::isCopySupported(invalidParams));
+
+    invalidParams = params;
+    invalidParams.linearSlicePitch = 256u;
+    EXPECT_FALSE(TiledImageCopy::isCopySupported(invalidParams));
+
+    invalidParams = params;
+    invalidParams.linearPtr = nullptr;
+    EXPECT_FALSE(TiledImageCopy::isCopySupported(invalidParams));
+}
+
+TEST(TiledImageCopyTest, givenCopySizeWhenGettingThreadsCountThenSmallCopiesAreSingleThreadedAndDebugFlagIsRespected) {
+    DebugManagerStateRestore restorer;
+    TiledImageCopyParams params;
+    params.region[0] = 4096u;
+    params.region[1] = 16u;
+    params.region[2] = 1u;
+    EXPECT_EQ(1u, TiledImageCopy::getThreadsCountForCopy(params));
+
+    params.region[1] = 4096u;
+    auto threadsCount = TiledImageCopy::getThreadsCountForCopy(params);
+    EXPECT_LE(threadsCount, TiledImageCopy::maxThreadsCount);
+    EXPECT_LE(threadsCount, std::max(std::thread::hardware_concurrency(), 1u));
+
+    debugManager.flags.CpuTiledImageCopyThreads.set(3);
+    EXPECT_EQ(3u, TiledImageCopy::getThreadsCountForCopy(params));
+}
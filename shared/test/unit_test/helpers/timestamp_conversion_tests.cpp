@@ -0,0 +1,55 @@
+/*
+ * Copyright (C) 2024 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/helpers/constants.h"
+#include "shared/source/helpers/timestamp_conversion.h"
+
+#include "gtest/gtest.h"
+
+using namespace NEO;
+
+TEST(TimestampConversionTest, givenEndGreaterThanStartWhenGettingDurationThenDifferenceIsReturned) {
+    EXPECT_EQ(5u, TimestampConversion::getDurationInTicks(10u, 15u, maxNBitValue(32)));
+    EXPECT_EQ(0u, TimestampConversion::getDurationInTicks(10u, 10u, maxNBitValue(32)));
+}
+
+TEST(TimestampConversionTest, givenCounterWraparoundWhenGettingDurationThenOverflowIsResolved) {
+    constexpr uint64_t validBitsMask = maxNBitValue(32);
+    EXPECT_EQ(4u + (validBitsMask - (validBitsMask - 2u)), TimestampConversion::getDurationInTicks(validBitsMask - 2u, 4u, validBitsMask));
+}
+
+TEST(TimestampConversionTest, givenBitsAboveValidMaskWhenGettingDurationThenTheyAreIgnored) {
+    constexpr uint64_t validBitsMask = maxNBitValue(32);
+    EXPECT_EQ(5u, TimestampConversion::getDurationInTicks((1ull << 40) + 10u, (3ull << 40) + 15u, validBitsMask));
+}
+
+TEST(TimestampConversionTest, givenIntervalsWhenConvertingToNsThenEachIntervalIsScaledByResolution) {
+    constexpr uint64_t validBitsMask = maxNBitValue(32);
+    constexpr size_t count = TimestampConversion::batchSize + 3u;
+    const double resolution = 2.5;
+
+    uint64_t startTicks[count] = {};
+    uint64_t endTicks[count] = {};
+    uint64_t startNs[count] = {};
+    uint64_t endNs[count] = {};
+
+    for (size_t i = 0; i < count; i++) {
+        startTicks[i] = 100u * i;
+        endTicks[i] = 100u * i + 40u;
+    }
+    startTicks[count - 1] = validBitsMask - 10u;
+    endTicks[count - 1] = 20u;
+
+    TimestampConversion::convertIntervalsToNs(startTicks, endTicks, startNs, endNs, count, resolution, validBitsMask);
+
+    for (size_t i = 0; i < count - 1; i++) {
+        EXPECT_EQ(static_cast<uint64_t>(100u * i * resolution), startNs[i]);
+        EXPECT_EQ(startNs[i] + 100u, endNs[i]);
+    }
+    EXPECT_EQ(static_cast<uint64_t>((validBitsMask - 10u) * resolution), startNs[count - 1]);
+    EXPECT_EQ(startNs[count - 1] + static_cast<uint64_t>(30u * resolution), endNs[count - 1]);
+}
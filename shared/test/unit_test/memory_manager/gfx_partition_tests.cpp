@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2019-2023 Intel Corporation
+ * Copyright (C) 2019-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -10,12 +10,14 @@
 #include "shared/source/helpers/ptr_math.h"
 #include "shared/source/os_interface/os_memory.h"
 #include "shared/source/utilities/cpu_info.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/helpers/variable_backup.h"
 #include "shared/test/common/mocks/mock_gfx_partition.h"
 
 #include "gtest/gtest.h"
 
 #include <mutex>
+#include <thread>
 
 namespace NEO {
 namespace SysCalls {
@@ -929,4 +931,159 @@ TEST(GfxPartitionTest, givenHeapIndexWhenCheckingIsAnyHeap32ThenTrueIsReturnedFo
     for (size_t i = 0; i < sizeof(heapsOther) / sizeof(heapsOther[0]); i++) {
         EXPECT_FALSE(GfxPartition::isAnyHeap32(heapsOther[i]));
     }
-}
\ No newline at end of file
+}
+TEST(GfxPartitionTest, givenGpuVaArenasDisabledWhenAllocatingSmallChunkThenArenaIsNotUsed) {
+    MockGfxPartition gfxPartition;
+    gfxPartition.init(maxNBitValue(48), reservedCpuAddressRangeSize, 0, 1, false, 0u);
+
+    size_t sizeToAlloc = MemoryConstants::pageSize;
+    auto address = gfxPartition.heapAllocate(HeapIndex::heapStandard, sizeToAlloc);
+    EXPECT_NE(0ull, address);
+    gfxPartition.heapFree(HeapIndex::heapStandard, address, sizeToAlloc);
+
+    EXPECT_EQ(0u, gfxPartition.getVaArenaStatistics(HeapIndex::heapStandard).arenaAllocations);
+    EXPECT_EQ(0u, gfxPartition.getVaArenaStatistics(HeapIndex::heapStandard).reservedRanges);
+}
+
+TEST(GfxPartitionTest, givenGpuVaArenasEnabledWhenAllocatingSmallChunksThenTheyAreSubAllocatedFromSingleRange) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableGpuVaArenas.set(1);
+
+    MockGfxPartition gfxPartition;
+    gfxPartition.init(maxNBitValue(48), reservedCpuAddressRangeSize, 0, 1, false, 0u);
+
+    for (auto heapIndex : {HeapIndex::heapStandard, HeapIndex::heapStandard64KB}) {
+        size_t sizeToAlloc = 1u;
+        auto address0 = gfxPartition.heapAllocate(heapIndex, sizeToAlloc);
+        const auto sizeAllocated = sizeToAlloc;
+        sizeToAlloc = 1u;
+        auto address1 = gfxPartition.heapAllocate(heapIndex, sizeToAlloc);
+
+        EXPECT_NE(0ull, address0);
+        EXPECT_TRUE(isAligned<GfxPartition::vaArenaRangeSize>(address0));
+        EXPECT_EQ(address0 + sizeAllocated, address1);
+        EXPECT_EQ(heapIndex == HeapIndex::heapStandard ? MemoryConstants::pageSize : MemoryConstants::pageSize64k, sizeAllocated);
+
+        auto statistics = gfxPartition.getVaArenaStatistics(heapIndex);
+        EXPECT_EQ(1u, statistics.reservedRanges);
+        EXPECT_EQ(2u, statistics.arenaAllocations);
+        EXPECT_EQ(GfxPartition::vaArenaRangeSize, statistics.reservedSize);
+        EXPECT_EQ(2 * sizeAllocated, statistics.liveSize);
+
+        gfxPartition.heapFree(heapIndex, address0, sizeAllocated);
+        gfxPartition.heapFree(heapIndex, address1, sizeAllocated);
+
+        statistics = gfxPartition.getVaArenaStatistics(heapIndex);
+        EXPECT_EQ(0u, statistics.liveSize);
+        EXPECT_EQ(0u, statistics.releasedRanges);
+
+        sizeToAlloc = 1u;
+        EXPECT_EQ(address0, gfxPartition.heapAllocate(heapIndex, sizeToAlloc));
+        gfxPartition.heapFree(heapIndex, address0, sizeToAlloc);
+    }
+    EXPECT_EQ(0u, gfxPartition.getVaArenaStatistics(HeapIndex::heapStandard2MB).arenaAllocations);
+}
+
+TEST(GfxPartitionTest, givenGpuVaArenasEnabledWhenAllocatingChunkBiggerThanArenaLimitThenHeapAllocatorIsUsed) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableGpuVaArenas.set(1);
+
+    MockGfxPartition gfxPartition;
+    gfxPartition.init(maxNBitValue(48), reservedCpuAddressRangeSize, 0, 1, false, 0u);
+
+    size_t sizeToAlloc = GfxPartition::vaArenaMaxAllocationSize + MemoryConstants::pageSize;
+    auto address = gfxPartition.heapAllocate(HeapIndex::heapStandard, sizeToAlloc);
+    EXPECT_NE(0ull, address);
+    EXPECT_EQ(0u, gfxPartition.getVaArenaStatistics(HeapIndex::heapStandard).arenaAllocations);
+
+    gfxPartition.callBasefreeGpuAddressRange = true;
+    gfxPartition.freeGpuAddressRange(address, sizeToAlloc);
+    EXPECT_EQ(0u, gfxPartition.getVaArenaStatistics(HeapIndex::heapStandard).releasedRanges);
+}
+
+TEST(GfxPartitionTest, givenGpuVaArenasEnabledWhenAllChunksOfFullRangeAreFreedThenRangeIsReleasedToHeap) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableGpuVaArenas.set(1);
+
+    MockGfxPartition gfxPartition;
+    gfxPartition.init(maxNBitValue(48), reservedCpuAddressRangeSize, 0, 1, false, 0u);
+
+    constexpr size_t chunksPerRange = GfxPartition::vaArenaRangeSize / GfxPartition::vaArenaMaxAllocationSize;
+    std::vector<uint64_t> addresses;
+    for (size_t i = 0; i < chunksPerRange + 1; i++) {
+        size_t sizeToAlloc = GfxPartition::vaArenaMaxAllocationSize;
+        addresses.push_back(gfxPartition.heapAllocate(HeapIndex::heapStandard, sizeToAlloc));
+        EXPECT_NE(0ull, addresses.back());
+    }
+    EXPECT_NE(alignDown(addresses[0], GfxPartition::vaArenaRangeSize), alignDown(addresses.back(), GfxPartition::vaArenaRangeSize));
+
+    auto statistics = gfxPartition.getVaArenaStatistics(HeapIndex::heapStandard);
+    EXPECT_EQ(2u, statistics.reservedRanges);
+    EXPECT_EQ(2 * GfxPartition::vaArenaRangeSize, statistics.reservedSize);
+    EXPECT_EQ(GfxPartition::vaArenaRangeSize - GfxPartition::vaArenaMaxAllocationSize, statistics.reservedSize - statistics.liveSize);
+
+    gfxPartition.callBasefreeGpuAddressRange = true;
+    for (size_t i = 0; i < chunksPerRange; i++) {
+        gfxPartition.freeGpuAddressRange(addresses[i], GfxPartition::vaArenaMaxAllocationSize);
+    }
+
+    statistics = gfxPartition.getVaArenaStatistics(HeapIndex::heapStandard);
+    EXPECT_EQ(1u, statistics.releasedRanges);
+    EXPECT_EQ(GfxPartition::vaArenaRangeSize, statistics.reservedSize);
+    EXPECT_EQ(GfxPartition::vaArenaMaxAllocationSize, statistics.liveSize);
+
+    gfxPartition.freeGpuAddressRange(addresses.back(), GfxPartition::vaArenaMaxAllocationSize);
+    EXPECT_EQ(0u, gfxPartition.getVaArenaStatistics(HeapIndex::heapStandard).liveSize);
+}
+
+TEST(GfxPartitionTest, givenGpuVaArenasEnabledWhenAllocatingFromMultipleThreadsThenRangesDoNotOverlapAndStatisticsAreConsistent) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableGpuVaArenas.set(1);
+
+    MockGfxPartition gfxPartition;
+    gfxPartition.init(maxNBitValue(48), reservedCpuAddressRangeSize, 0, 1, false, 0u);
+
+    constexpr uint32_t threadsCount = 8;
+    constexpr uint32_t allocationsPerThread = 256;
+    std::array<std::vector<uint64_t>, threadsCount> addresses;
+
+    auto allocateAndFree = [&](uint32_t threadIndex) {
+        auto &threadAddresses = addresses[threadIndex];
+        for (uint32_t i = 0; i < allocationsPerThread; i++) {
+            size_t sizeToAlloc = MemoryConstants::pageSize;
+            threadAddresses.push_back(gfxPartition.heapAllocate(HeapIndex::heapStandard, sizeToAlloc));
+            if (i % 2) {
+                gfxPartition.heapFree(HeapIndex::heapStandard, threadAddresses[i - 1], sizeToAlloc);
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < threadsCount; i++) {
+        threads.emplace_back(allocateAndFree, i);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    std::vector<uint64_t> liveAddresses;
+    for (auto &threadAddresses : addresses) {
+        for (uint32_t i = 1; i < allocationsPerThread; i += 2) {
+            EXPECT_NE(0ull, threadAddresses[i]);
+            liveAddresses.push_back(threadAddresses[i]);
+        }
+    }
+    std::sort(liveAddresses.begin(), liveAddresses.end());
+    EXPECT_EQ(liveAddresses.end(), std::adjacent_find(liveAddresses.begin(), liveAddresses.end()));
+
+    auto statistics = gfxPartition.getVaArenaStatistics(HeapIndex::heapStandard);
+    EXPECT_EQ(threadsCount * allocationsPerThread, statistics.arenaAllocations);
+    EXPECT_EQ(liveAddresses.size() * MemoryConstants::pageSize, statistics.liveSize);
+    EXPECT_GE(statistics.reservedSize, statistics.liveSize);
+    EXPECT_LE(statistics.reservedRanges, static_cast<uint64_t>(GfxPartition::vaArenasCount));
+
+    for (auto address : liveAddresses) {
+        gfxPartition.heapFree(HeapIndex::heapStandard, address, MemoryConstants::pageSize);
+    }
+    EXPECT_EQ(0u, gfxPartition.getVaArenaStatistics(HeapIndex::heapStandard).liveSize);
+}
@@ -1,10 +1,11 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
  */
 
+#include "shared/source/memory_manager/allocations_list.h"
 #include "shared/source/memory_manager/internal_allocation_storage.h"
 #include "shared/source/os_interface/os_context.h"
 #include "shared/test/common/fixtures/memory_allocator_fixture.h"
@@ -326,3 +327,86 @@ TEST_F(InternalAllocationStorageTest, givenInternalAllocationWhenTaskCountMetsEx
     EXPECT_FALSE(csr->getTemporaryAllocations().peekIsEmpty());
     allocation->hostPtrTaskCountAssignment = 0;
 }
+
+TEST(AllocationsListTest, givenThousandsOfCachedAllocationsWhenDetachingAllocationThenFirstMatchingAllocationInListOrderIsReturned) {
+    constexpr AllocationType allocationTypes[] = {AllocationType::buffer, AllocationType::commandBuffer, AllocationType::internalHeap, AllocationType::linearStream};
+    constexpr uint32_t allocationsCount = 4096u;
+
+    AllocationsList allocationsList;
+    for (uint32_t i = 0; i < allocationsCount; i++) {
+        auto allocation = new MockGraphicsAllocation(nullptr, MemoryConstants::pageSize * (1 + (i * 7) % 13));
+        allocation->setAllocationType(allocationTypes[i % 4]);
+        allocation->storageInfo.systemMemoryForced = (i % 11 == 0);
+        if (i % 5 == 0) {
+            allocationsList.pushFrontOne(*allocation);
+        } else {
+            allocationsList.pushTailOne(*allocation);
+        }
+    }
+    EXPECT_EQ(allocationsCount, allocationsList.getReuseIndexSize());
+
+    for (uint32_t i = 0; i < allocationsCount / 2; i++) {
+        auto allocationType = allocationTypes[(i * 3) % 4];
+        size_t requiredSize = MemoryConstants::pageSize * ((i * 5) % 14) + (i % 3);
+        bool forceSystemMemory = (i % 7 == 0);
+
+        GraphicsAllocation *expectedAllocation = nullptr;
+        for (auto curr = allocationsList.peekHead(); curr != nullptr; curr = curr->next) {
+            if (curr->getAllocationType() == allocationType && curr->getUnderlyingBufferSize() >= requiredSize && curr->storageInfo.systemMemoryForced == forceSystemMemory) {
+                expectedAllocation = curr;
+                break;
+            }
+        }
+
+        auto allocation = allocationsList.detachAllocation(requiredSize, nullptr, forceSystemMemory, nullptr, allocationType);
+        EXPECT_EQ(expectedAllocation, allocation.get());
+    }
+
+    EXPECT_EQ(allocationsList.peekHead()->countThisAndAllConnected(), allocationsList.getReuseIndexSize());
+}
+
+TEST(AllocationsListTest, givenAllocationsListWhenNodesAreMovedInAndOutOfListThenOnlyAllocationsOnListCanBeDetached) {
+    AllocationsList allocationsList;
+    MockGraphicsAllocation *allocations[4];
+    for (auto &allocation : allocations) {
+        allocation = new MockGraphicsAllocation(nullptr, MemoryConstants::pageSize);
+        allocationsList.pushTailOne(*allocation);
+    }
+
+    auto sequence = allocationsList.detachSequence(*allocations[1], *allocations[2]);
+    EXPECT_EQ(2u, allocationsList.getReuseIndexSize());
+    EXPECT_EQ(allocations[0], allocationsList.detachAllocation(0, nullptr, nullptr, AllocationType::unknown).release());
+
+    allocationsList.splice(*sequence);
+    EXPECT_EQ(3u, allocationsList.getReuseIndexSize());
+    EXPECT_EQ(allocations[3], allocationsList.detachAllocation(0, nullptr, nullptr, AllocationType::unknown).release());
+
+    allocationsList.removeOne(*allocations[1]).reset();
+    allocationsList.removeFrontOne().reset();
+    EXPECT_EQ(0u, allocationsList.getReuseIndexSize());
+    EXPECT_EQ(nullptr, allocationsList.detachAllocation(0, nullptr, nullptr, AllocationType::unknown));
+
+    allocationsList.pushFrontOne(*allocations[0]);
+    allocationsList.pushFrontOne(*allocations[3]);
+    EXPECT_EQ(allocations[3], allocationsList.detachAllocation(0, nullptr, nullptr, AllocationType::unknown).release());
+
+    auto nodes = allocationsList.detachNodes();
+    EXPECT_EQ(0u, allocationsList.getReuseIndexSize());
+    EXPECT_EQ(nullptr, allocationsList.detachAllocation(0, nullptr, nullptr, AllocationType::unknown));
+
+    delete nodes;
+    delete allocations[3];
+}
+
+TEST(AllocationsListTest, givenAllocationWithSizeAndTypeChangedAfterPushWhenRemovingItThenItIsRemovedFromReuseIndex) {
+    AllocationsList allocationsList;
+    auto allocation = new MockGraphicsAllocation(nullptr, MemoryConstants::pageSize);
+    allocationsList.pushTailOne(*allocation);
+    EXPECT_EQ(1u, allocationsList.getReuseIndexSize());
+
+    allocation->setSize(MemoryConstants::pageSize64k);
+    allocation->setAllocationType(AllocationType::buffer);
+    allocationsList.removeOne(*allocation).reset();
+    EXPECT_EQ(0u, allocationsList.getReuseIndexSize());
+    EXPECT_TRUE(allocationsList.peekIsEmpty());
+}
@@ -349,8 +349,11 @@ TEST_F(SvmDeviceAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfter
     EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), --expectedCacheSize);
 
     auto thirdAllocation = svmManager->createUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
-    EXPECT_EQ(thirdAllocation, testDataset[2].allocation);
-    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+    EXPECT_NE(thirdAllocation, testDataset[2].allocation);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), expectedCacheSize);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.hits, 2u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.misses, 2u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.wastedSize, allocationSizeBasis);
 
     svmManager->freeSVMAlloc(firstAllocation);
     svmManager->freeSVMAlloc(secondAllocation);
@@ -492,6 +495,110 @@ TEST_F(SvmDeviceAllocationCacheTest, givenDeviceOutOfMemoryWhenAllocatingThenCac
     ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
 }
 
+TEST_F(SvmDeviceAllocationCacheTest, givenAllocationCacheEnabledWhenInitializedThenAgingAndMemoryPressureLimitsAreSetCorrectly) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    DebugManagerStateRestore restore;
+    debugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    auto device = deviceFactory->rootDevices[0];
+    const auto totalDeviceMemory = device->getGlobalMemorySize(static_cast<uint32_t>(device->getDeviceBitfield().to_ulong()));
+    {
+        auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+        svmManager->initUsmAllocationsCaches(*device);
+        ASSERT_TRUE(svmManager->usmDeviceAllocationsCacheEnabled);
+        EXPECT_EQ(std::chrono::milliseconds(10000), svmManager->usmDeviceAllocationsCache.maxIdleTime);
+        EXPECT_EQ(static_cast<uint64_t>(0.01 * 90 * totalDeviceMemory), svmManager->usmDeviceAllocationsCacheMemoryPressureLimit);
+    }
+    {
+        debugManager.flags.ExperimentalUsmAllocationCacheMaxIdleTime.set(0);
+        debugManager.flags.ExperimentalUsmAllocationCacheMemoryPressureThreshold.set(0);
+        auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+        svmManager->initUsmAllocationsCaches(*device);
+        ASSERT_TRUE(svmManager->usmDeviceAllocationsCacheEnabled);
+        EXPECT_EQ(0, svmManager->usmDeviceAllocationsCache.maxIdleTime.count());
+        EXPECT_EQ(0u, svmManager->usmDeviceAllocationsCacheMemoryPressureLimit);
+    }
+}
+
+TEST_F(SvmDeviceAllocationCacheTest, givenAllocationIdleInCacheForLongerThanMaxIdleTimeWhenFreeingAllocationThenIdleAllocationIsReleased) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    debugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    svmManager->initUsmAllocationsCaches(*device);
+    ASSERT_TRUE(svmManager->usmDeviceAllocationsCacheEnabled);
+    svmManager->usmDeviceAllocationsCache.maxSize = 1 * MemoryConstants::gigaByte;
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::deviceUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = device;
+    auto idleAllocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    auto recentAllocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k * 2, unifiedMemoryProperties);
+    auto allocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k * 4, unifiedMemoryProperties);
+    svmManager->freeSVMAlloc(idleAllocation);
+    svmManager->freeSVMAlloc(recentAllocation);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 2u);
+
+    auto &cache = svmManager->usmDeviceAllocationsCache;
+    cache.allocations[0].saveTime -= 2 * cache.maxIdleTime;
+    cache.lastAgingTime -= cache.maxIdleTime;
+
+    svmManager->freeSVMAlloc(allocation);
+    ASSERT_EQ(cache.allocations.size(), 2u);
+    EXPECT_EQ(cache.allocations[0].allocation, recentAllocation);
+    EXPECT_EQ(cache.allocations[1].allocation, allocation);
+    EXPECT_EQ(cache.totalSize, MemoryConstants::pageSize64k * 6);
+    EXPECT_EQ(svmManager->getSVMAlloc(idleAllocation), nullptr);
+
+    cache.allocations[0].saveTime -= 2 * cache.maxIdleTime;
+    svmManager->trimUsmAllocationsCachesOnIdle();
+    EXPECT_EQ(cache.allocations.size(), 2u);
+
+    svmManager->trimUSMDeviceAllocCache();
+    EXPECT_EQ(cache.allocations.size(), 0u);
+}
+
+TEST_F(SvmDeviceAllocationCacheTest, givenLocalMemoryUsageAboveMemoryPressureLimitWhenFreeingAllocationThenOldestAllocationsAreReleasedAndAllocationIsNotCached) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    RootDeviceIndicesContainer rootDeviceIndices = {mockRootDeviceIndex};
+    std::map<uint32_t, DeviceBitfield> deviceBitfields{{mockRootDeviceIndex, mockDeviceBitfield}};
+    DebugManagerStateRestore restore;
+    debugManager.flags.ExperimentalEnableDeviceAllocationCache.set(1);
+    auto device = deviceFactory->rootDevices[0];
+    auto memoryManager = device->getMemoryManager();
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(memoryManager, false);
+    svmManager->initUsmAllocationsCaches(*device);
+    ASSERT_TRUE(svmManager->usmDeviceAllocationsCacheEnabled);
+    svmManager->usmDeviceAllocationsCache.maxSize = 1 * MemoryConstants::gigaByte;
+
+    SVMAllocsManager::UnifiedMemoryProperties unifiedMemoryProperties(InternalMemoryType::deviceUnifiedMemory, 1, rootDeviceIndices, deviceBitfields);
+    unifiedMemoryProperties.device = device;
+    auto oldestAllocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k * 2, unifiedMemoryProperties);
+    auto newerAllocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    auto allocation = svmManager->createUnifiedMemoryAllocation(MemoryConstants::pageSize64k, unifiedMemoryProperties);
+    svmManager->freeSVMAlloc(oldestAllocation);
+    svmManager->freeSVMAlloc(newerAllocation);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 2u);
+    svmManager->usmDeviceAllocationsCache.allocations[1].saveTime -= std::chrono::milliseconds(1);
+
+    const auto localMemoryUsage = memoryManager->getLocalMemoryUsage(device->getRootDeviceIndex(), device->getDeviceBitfield());
+    auto bankSelector = memoryManager->getLocalMemoryUsageBankSelector(AllocationType::buffer, device->getRootDeviceIndex());
+    bankSelector->reserveOnBanks(1u, MemoryConstants::pageSize64k);
+    svmManager->usmDeviceAllocationsCacheMemoryPressureLimit = localMemoryUsage + 1u;
+
+    svmManager->freeSVMAlloc(allocation);
+    EXPECT_EQ(svmManager->getSVMAlloc(allocation), nullptr);
+    EXPECT_EQ(svmManager->getSVMAlloc(oldestAllocation), nullptr);
+    ASSERT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 1u);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations[0].allocation, newerAllocation);
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.totalSize, MemoryConstants::pageSize64k);
+
+    bankSelector->freeOnBanks(1u, MemoryConstants::pageSize64k);
+    svmManager->trimUSMDeviceAllocCache();
+    EXPECT_EQ(svmManager->usmDeviceAllocationsCache.allocations.size(), 0u);
+}
+
 using SvmHostAllocationCacheTest = Test<SvmAllocationCacheTestFixture>;
 
 TEST_F(SvmHostAllocationCacheTest, givenAllocationCacheDefaultWhenCheckingIfEnabledThenItIsDisabled) {
@@ -757,8 +864,11 @@ TEST_F(SvmHostAllocationCacheTest, givenMultipleAllocationsWhenAllocatingAfterFr
     EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), --expectedCacheSize);
 
     auto thirdAllocation = svmManager->createHostUnifiedMemoryAllocation(allocationSizeBasis, unifiedMemoryProperties);
-    EXPECT_EQ(thirdAllocation, testDataset[2].allocation);
-    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), 0u);
+    EXPECT_NE(thirdAllocation, testDataset[2].allocation);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.allocations.size(), expectedCacheSize);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.hits, 2u);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.misses, 2u);
+    EXPECT_EQ(svmManager->usmHostAllocationsCache.wastedSize, allocationSizeBasis);
 
     svmManager->freeSVMAlloc(firstAllocation);
     svmManager->freeSVMAlloc(secondAllocation);
@@ -223,3 +223,113 @@ TEST_F(InitializationFailedUnifiedMemoryPoolingTest, givenNotInitializedPoolWhen
     EXPECT_EQ(0u, usmMemAllocPool.getPooledAllocationSize(bogusPtr));
     EXPECT_EQ(nullptr, usmMemAllocPool.getPooledAllocationBasePtr(bogusPtr));
 }
+
+using UnifiedMemoryPoolsManagerTest = Test<SVMMemoryAllocatorFixture<true>>;
+TEST_F(UnifiedMemoryPoolsManagerTest, givenPoolsManagerWhenAllocationsExceedPoolThenPoolIsAddedAndEmptyPoolsAboveOneSpareAreReleased) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.UsmAllocationPoolsManagerMaxIdleTime.set(0);
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    UsmMemAllocPoolsManager poolsManager(svmManager.get(), InternalMemoryType::hostUnifiedMemory);
+
+    SVMAllocsManager::UnifiedMemoryProperties memoryProperties(InternalMemoryType::hostUnifiedMemory, MemoryConstants::pageSize64k, rootDeviceIndices, deviceBitfields);
+    memoryProperties.device = device;
+    const auto &smallTier = UsmMemAllocPoolsManager::poolTiers[0];
+    EXPECT_FALSE(poolsManager.canBePooled(UsmMemAllocPoolsManager::poolTiers.back().maxServicedSize + 1, memoryProperties));
+    EXPECT_EQ(nullptr, poolsManager.createUnifiedMemoryAllocation(UsmMemAllocPoolsManager::poolTiers.back().maxServicedSize + 1, memoryProperties));
+
+    std::vector<void *> allocations;
+    const size_t allocationsPerPool = smallTier.poolSize / smallTier.maxServicedSize;
+    for (size_t i = 0; i < allocationsPerPool + 1; i++) {
+        auto allocation = poolsManager.createUnifiedMemoryAllocation(smallTier.maxServicedSize, memoryProperties);
+        ASSERT_NE(nullptr, allocation);
+        EXPECT_EQ(smallTier.maxServicedSize, poolsManager.getPooledAllocationSize(allocation));
+        EXPECT_EQ(allocation, poolsManager.getPooledAllocationBasePtr(ptrOffset(allocation, 1)));
+        allocations.push_back(allocation);
+    }
+    auto largeAllocation = poolsManager.createUnifiedMemoryAllocation(smallTier.maxServicedSize + 1, memoryProperties);
+    EXPECT_NE(nullptr, largeAllocation);
+
+    auto statistics = poolsManager.getStatistics();
+    EXPECT_EQ(2u, statistics[0].poolsCount);
+    EXPECT_EQ(2 * smallTier.poolSize, statistics[0].poolsSize);
+    EXPECT_EQ(allocations.size(), statistics[0].allocationsCount);
+    EXPECT_EQ(allocations.size() * smallTier.maxServicedSize, statistics[0].usedSize);
+    EXPECT_EQ(1u, statistics[1].poolsCount);
+    EXPECT_EQ(1u, statistics[1].allocationsCount);
+    EXPECT_EQ(0u, statistics[2].poolsCount);
+
+    for (auto allocation : allocations) {
+        EXPECT_TRUE(poolsManager.freeSVMAlloc(allocation, true));
+    }
+    EXPECT_FALSE(poolsManager.freeSVMAlloc(allocations[0], true));
+
+    statistics = poolsManager.getStatistics();
+    EXPECT_EQ(1u, statistics[0].poolsCount);
+    EXPECT_EQ(0u, statistics[0].allocationsCount);
+    EXPECT_EQ(0u, statistics[0].usedSize);
+    EXPECT_EQ(1u, statistics[1].allocationsCount);
+
+    poolsManager.cleanup();
+    statistics = poolsManager.getStatistics();
+    EXPECT_EQ(0u, statistics[0].poolsCount);
+    EXPECT_EQ(0u, statistics[1].poolsCount);
+    EXPECT_EQ(0u, poolsManager.getPooledAllocationSize(largeAllocation));
+}
+
+TEST_F(UnifiedMemoryPoolsManagerTest, givenEmptyPoolsWhenTheyAreIdleShorterThanMaxIdleTimeThenTheyAreNotReleased) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.UsmAllocationPoolsManagerMaxIdleTime.set(60 * 1000);
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 1));
+    auto device = deviceFactory->rootDevices[0];
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(device->getMemoryManager(), false);
+    MockUsmMemAllocPoolsManager poolsManager(svmManager.get(), InternalMemoryType::hostUnifiedMemory);
+    EXPECT_EQ(std::chrono::milliseconds(60 * 1000), poolsManager.maxIdleTime);
+
+    SVMAllocsManager::UnifiedMemoryProperties memoryProperties(InternalMemoryType::hostUnifiedMemory, MemoryConstants::pageSize64k, rootDeviceIndices, deviceBitfields);
+    memoryProperties.device = device;
+    const auto &smallTier = UsmMemAllocPoolsManager::poolTiers[0];
+    std::vector<void *> allocations;
+    for (size_t i = 0; i < smallTier.poolSize / smallTier.maxServicedSize + 1; i++) {
+        allocations.push_back(poolsManager.createUnifiedMemoryAllocation(smallTier.maxServicedSize, memoryProperties));
+        ASSERT_NE(nullptr, allocations.back());
+    }
+    for (auto allocation : allocations) {
+        EXPECT_TRUE(poolsManager.freeSVMAlloc(allocation, true));
+    }
+    EXPECT_EQ(2u, poolsManager.getStatistics()[0].poolsCount);
+
+    auto trimTime = std::chrono::steady_clock::now() + poolsManager.maxIdleTime / 2;
+    poolsManager.trimIdlePools(trimTime, true);
+    EXPECT_EQ(2u, poolsManager.getStatistics()[0].poolsCount);
+
+    poolsManager.trimIdlePools(trimTime + poolsManager.maxIdleTime, true);
+    EXPECT_EQ(1u, poolsManager.getStatistics()[0].poolsCount);
+    EXPECT_EQ(0u, poolsManager.getPooledAllocationSize(allocations[0]));
+}
+
+TEST_F(UnifiedMemoryPoolsManagerTest, givenPoolsManagerWhenAllocatingForDifferentDevicesOrMemoryTypeThenSeparatePoolsAreUsed) {
+    std::unique_ptr<UltDeviceFactory> deviceFactory(new UltDeviceFactory(1, 2));
+    auto svmManager = std::make_unique<MockSVMAllocsManager>(deviceFactory->rootDevices[0]->getMemoryManager(), false);
+    UsmMemAllocPoolsManager poolsManager(svmManager.get(), InternalMemoryType::hostUnifiedMemory);
+
+    SVMAllocsManager::UnifiedMemoryProperties memoryProperties(InternalMemoryType::hostUnifiedMemory, MemoryConstants::pageSize64k, rootDeviceIndices, deviceBitfields);
+    memoryProperties.device = deviceFactory->subDevices[0];
+    auto allocation0 = poolsManager.createUnifiedMemoryAllocation(MemoryConstants::kiloByte, memoryProperties);
+    memoryProperties.device = deviceFactory->subDevices[1];
+    auto allocation1 = poolsManager.createUnifiedMemoryAllocation(MemoryConstants::kiloByte, memoryProperties);
+    EXPECT_NE(nullptr, allocation0);
+    EXPECT_NE(nullptr, allocation1);
+    EXPECT_EQ(2u, poolsManager.getStatistics()[0].poolsCount);
+
+    memoryProperties.memoryType = InternalMemoryType::deviceUnifiedMemory;
+    EXPECT_EQ(nullptr, poolsManager.createUnifiedMemoryAllocation(MemoryConstants::kiloByte, memoryProperties));
+    memoryProperties.memoryType = InternalMemoryType::hostUnifiedMemory;
+    memoryProperties.allocationFlags.allFlags = 1u;
+    EXPECT_EQ(nullptr, poolsManager.createUnifiedMemoryAllocation(MemoryConstants::kiloByte, memoryProperties));
+
+    EXPECT_TRUE(poolsManager.freeSVMAlloc(allocation0, true));
+    EXPECT_TRUE(poolsManager.freeSVMAlloc(allocation1, true));
+    EXPECT_EQ(2u, poolsManager.getStatistics()[0].poolsCount);
+}
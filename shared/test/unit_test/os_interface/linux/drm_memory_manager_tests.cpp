@@ -4106,6 +4106,130 @@ INSTANTIATE_TEST_CASE_P(HostIpcAllocationFlag,
                         DrmMemoryManagerWithHostIpcAllocationParamTest,
                         ::testing::Values(false, true));
 
+TEST_F(DrmMemoryManagerTest, givenIpcImportCacheEnabledWhenClosedImportIsReopenedThenCachedBufferObjectAndGpuAddressAreReused) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableIpcImportCache.set(1);
+
+    mock->ioctlExpected.primeFdToHandle = 2;
+    mock->ioctlExpected.gemWait = 2;
+    mock->ioctlExpected.gemClose = 1;
+    mock->outputHandle = 88u;
+    AllocationProperties properties(rootDeviceIndex, false, MemoryConstants::pageSize, AllocationType::buffer, false, {});
+
+    auto allocation = memoryManager->createGraphicsAllocationFromSharedHandle(11u, properties, false, false, false, nullptr);
+    ASSERT_NE(nullptr, allocation);
+    auto bo = static_cast<DrmAllocation *>(allocation)->getBO();
+    auto gpuAddress = allocation->getGpuAddress();
+    EXPECT_TRUE(bo->peekIsIpcImportCached());
+    memoryManager->freeGraphicsMemory(allocation);
+    EXPECT_EQ(1u, memoryManager->peekSharedBosSize());
+
+    allocation = memoryManager->createGraphicsAllocationFromSharedHandle(12u, properties, false, false, false, nullptr);
+    ASSERT_NE(nullptr, allocation);
+    EXPECT_EQ(bo, static_cast<DrmAllocation *>(allocation)->getBO());
+    EXPECT_EQ(gpuAddress, allocation->getGpuAddress());
+    memoryManager->freeGraphicsMemory(allocation);
+
+    auto statistics = memoryManager->getIpcImportCacheStatistics();
+    EXPECT_EQ(1u, statistics.hits);
+    EXPECT_EQ(1u, statistics.misses);
+    EXPECT_EQ(0u, statistics.evictions);
+
+    memoryManager->releaseIpcImportCache();
+    EXPECT_EQ(0u, memoryManager->peekSharedBosSize());
+}
+
+TEST_F(DrmMemoryManagerTest, givenIpcImportCacheEnabledWhenClosedImportsExceedLimitThenLeastRecentlyClosedImportIsReleased) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableIpcImportCache.set(1);
+    debugManager.flags.IpcImportCacheMaxIdleEntries.set(1);
+
+    mock->ioctlExpected.primeFdToHandle = 3;
+    mock->ioctlExpected.gemWait = 3;
+    mock->ioctlExpected.gemClose = 3;
+    AllocationProperties properties(rootDeviceIndex, false, MemoryConstants::pageSize, AllocationType::buffer, false, {});
+
+    mock->outputHandle = 88u;
+    auto allocation1 = memoryManager->createGraphicsAllocationFromSharedHandle(11u, properties, false, false, false, nullptr);
+    ASSERT_NE(nullptr, allocation1);
+    mock->outputHandle = 89u;
+    auto allocation2 = memoryManager->createGraphicsAllocationFromSharedHandle(12u, properties, false, false, false, nullptr);
+    ASSERT_NE(nullptr, allocation2);
+
+    memoryManager->freeGraphicsMemory(allocation1);
+    memoryManager->freeGraphicsMemory(allocation2);
+    EXPECT_EQ(1u, memoryManager->peekSharedBosSize());
+    EXPECT_EQ(1u, memoryManager->getIpcImportCacheStatistics().evictions);
+
+    mock->outputHandle = 88u;
+    allocation1 = memoryManager->createGraphicsAllocationFromSharedHandle(13u, properties, false, false, false, nullptr);
+    ASSERT_NE(nullptr, allocation1);
+    EXPECT_EQ(0u, memoryManager->getIpcImportCacheStatistics().hits);
+    EXPECT_EQ(3u, memoryManager->getIpcImportCacheStatistics().misses);
+    memoryManager->freeGraphicsMemory(allocation1);
+
+    memoryManager->releaseIpcImportCache();
+    EXPECT_EQ(0u, memoryManager->peekSharedBosSize());
+}
+
+TEST_F(DrmMemoryManagerTest, givenIpcImportCacheEnabledWhenReopenedImportIsLockedThenBufferObjectIsNotMapped) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableIpcImportCache.set(1);
+
+    mock->ioctlExpected.primeFdToHandle = 2;
+    mock->ioctlExpected.gemSetDomain = 2;
+    mock->ioctlExpected.gemMmapOffset = 0;
+    mock->ioctlExpected.gemWait = 2;
+    mock->ioctlExpected.gemClose = 1;
+    mock->outputHandle = 88u;
+    AllocationProperties properties(rootDeviceIndex, false, MemoryConstants::pageSize, AllocationType::buffer, false, {});
+
+    for (auto handle : {11u, 12u}) {
+        auto allocation = memoryManager->createGraphicsAllocationFromSharedHandle(handle, properties, false, false, false, nullptr);
+        ASSERT_NE(nullptr, allocation);
+        auto bo = static_cast<DrmAllocation *>(allocation)->getBO();
+        EXPECT_EQ(allocation->getUnderlyingBuffer(), memoryManager->lockResource(allocation));
+        EXPECT_EQ(nullptr, bo->peekLockedAddress());
+        memoryManager->unlockResource(allocation);
+        memoryManager->freeGraphicsMemory(allocation);
+    }
+    EXPECT_EQ(1u, memoryManager->getIpcImportCacheStatistics().hits);
+
+    memoryManager->releaseIpcImportCache();
+}
+
+TEST_F(DrmMemoryManagerTest, givenIpcImportCacheEnabledWhenImportIsOpenedTwiceConcurrentlyThenEachOpenGetsSeparateBufferObject) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.EnableIpcImportCache.set(1);
+
+    mock->ioctlExpected.primeFdToHandle = 3;
+    mock->ioctlExpected.gemWait = 3;
+    mock->ioctlExpected.gemClose = 1;
+    mock->outputHandle = 88u;
+    AllocationProperties properties(rootDeviceIndex, false, MemoryConstants::pageSize, AllocationType::buffer, false, {});
+
+    auto allocation1 = memoryManager->createGraphicsAllocationFromSharedHandle(11u, properties, false, false, false, nullptr);
+    ASSERT_NE(nullptr, allocation1);
+    auto allocation2 = memoryManager->createGraphicsAllocationFromSharedHandle(12u, properties, false, false, false, nullptr);
+    ASSERT_NE(nullptr, allocation2);
+    auto bo1 = static_cast<DrmAllocation *>(allocation1)->getBO();
+    EXPECT_NE(bo1, static_cast<DrmAllocation *>(allocation2)->getBO());
+    EXPECT_NE(allocation1->getGpuAddress(), allocation2->getGpuAddress());
+    EXPECT_EQ(reinterpret_cast<void *>(bo1->peekAddress()), allocation1->getUnderlyingBuffer());
+    EXPECT_EQ(0u, memoryManager->getIpcImportCacheStatistics().hits);
+
+    memoryManager->freeGraphicsMemory(allocation1);
+    auto allocation3 = memoryManager->createGraphicsAllocationFromSharedHandle(13u, properties, false, false, false, nullptr);
+    ASSERT_NE(nullptr, allocation3);
+    EXPECT_EQ(bo1, static_cast<DrmAllocation *>(allocation3)->getBO());
+    EXPECT_EQ(1u, memoryManager->getIpcImportCacheStatistics().hits);
+
+    memoryManager->freeGraphicsMemory(allocation2);
+    memoryManager->freeGraphicsMemory(allocation3);
+    memoryManager->releaseIpcImportCache();
+    EXPECT_EQ(0u, memoryManager->peekSharedBosSize());
+}
+
 TEST(DrmMemoryManagerFreeGraphicsMemoryUnreferenceTest,
      givenCallToCreateSharedAllocationWithReuseSharedAllocationThenAllocationsSuccedAndAddressesAreTheSame) {
     MockExecutionEnvironment executionEnvironment(defaultHwInfo.get());
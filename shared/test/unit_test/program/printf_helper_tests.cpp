@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2018-2023 Intel Corporation
+ * Copyright (C) 2018-2024 Intel Corporation
  *
  * SPDX-License-Identifier: MIT
  *
@@ -8,6 +8,8 @@
 #include "shared/source/helpers/aligned_memory.h"
 #include "shared/source/helpers/string.h"
 #include "shared/source/program/print_formatter.h"
+#include "shared/source/program/printf_drainer.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
 #include "shared/test/common/mocks/mock_graphics_allocation.h"
 #include "shared/test/common/mocks/mock_kernel_info.h"
 
@@ -1018,3 +1020,85 @@ TEST(simpleSprintf, GivenEmptyFormatStringWhenSimpleSprintfIsCalledThenBailOutWi
     EXPECT_EQ(0, out[0]);
     EXPECT_EQ(0, out[1]);
 }
+
+namespace {
+std::string readWholeFile(FILE *file) {
+    std::string content;
+    rewind(file);
+    char chunk[256];
+    size_t read = 0;
+    while ((read = fread(chunk, 1, sizeof(chunk), file)) > 0) {
+        content.append(chunk, read);
+    }
+    return content;
+}
+} // namespace
+
+TEST_F(PrintFormatterTest, givenAsyncPrintfDisabledWhenCreatingPrintfDrainerThenNullptrIsReturned) {
+    DebugManagerStateRestore restore;
+    EXPECT_EQ(nullptr, PrintfDrainer::create());
+
+    debugManager.flags.EnableAsyncPrintf.set(0);
+    EXPECT_EQ(nullptr, PrintfDrainer::create());
+}
+
+TEST_F(PrintFormatterTest, givenMoreSubmissionsThanRingRecordsWhenFlushingPrintfDrainerThenAllOutputIsFormattedInOrder) {
+    auto stringIndex = injectFormatString("drained %d\n");
+    storeData(stringIndex);
+    injectValue(7);
+
+    FILE *sink = tmpfile();
+    ASSERT_NE(nullptr, sink);
+    auto &stringsMap = kernelInfo->kernelDescriptor.kernelMetadata.printfStringsMap;
+    std::string expectedOutput;
+    {
+        PrintfDrainer drainer(sink, false, PrintfSinkFormat::text);
+        for (size_t i = 0; i < PrintfDrainer::ringSize + 5; i++) {
+            drainer.submit(underlyingBuffer, printfBufferSize, is32bit, &stringsMap);
+            expectedOutput += "drained 7\n";
+        }
+        drainer.flush();
+        EXPECT_EQ(PrintfDrainer::ringSize + 5, drainer.getSubmittedRecordsCount());
+        EXPECT_EQ(PrintfDrainer::ringSize + 5, drainer.getWrittenRecordsCount());
+
+        // records are snapshots, buffer may be reused by kernel right after submission
+        *reinterpret_cast<uint32_t *>(underlyingBuffer) = 4u;
+        drainer.submit(underlyingBuffer, printfBufferSize, is32bit, &stringsMap);
+        EXPECT_EQ(PrintfDrainer::ringSize + 5, drainer.getSubmittedRecordsCount());
+    }
+    EXPECT_EQ(expectedOutput, readWholeFile(sink));
+    fclose(sink);
+}
+
+TEST_F(PrintFormatterTest, givenBinarySinkWhenPrintfDrainerWritesRecordThenHeaderStringsAndUsedDataAreWritten) {
+    auto stringIndex = injectFormatString("binary %d\n");
+    storeData(stringIndex);
+    injectValue(3);
+
+    FILE *sink = tmpfile();
+    ASSERT_NE(nullptr, sink);
+    {
+        PrintfDrainer drainer(sink, false, PrintfSinkFormat::binary);
+        drainer.submit(underlyingBuffer, printfBufferSize, is32bit, &kernelInfo->kernelDescriptor.kernelMetadata.printfStringsMap);
+    }
+    auto content = readWholeFile(sink);
+    fclose(sink);
+
+    std::string expectedString = "binary %d\n";
+    ASSERT_EQ(sizeof(PrintfBinaryRecordHeader) + 2 * sizeof(uint32_t) + expectedString.size() + offset, content.size());
+
+    PrintfBinaryRecordHeader header;
+    memcpy(&header, content.data(), sizeof(header));
+    EXPECT_EQ(PrintfBinaryRecordHeader::magic, header.recordMagic);
+    EXPECT_EQ(1u, header.stringsCount);
+    EXPECT_EQ(offset, header.dataSize);
+
+    auto strings = content.data() + sizeof(header);
+    uint32_t index = 0u;
+    uint32_t length = 0u;
+    memcpy(&index, strings, sizeof(index));
+    memcpy(&length, strings + sizeof(index), sizeof(length));
+    EXPECT_EQ(static_cast<uint32_t>(stringIndex), index);
+    EXPECT_EQ(expectedString, std::string(strings + 2 * sizeof(uint32_t), length));
+    EXPECT_EQ(0, memcmp(underlyingBuffer, strings + 2 * sizeof(uint32_t) + length, offset));
+}
@@ -17,6 +17,11 @@ using namespace NEO;
 
 class MockScratchSpaceControllerBase : public ScratchSpaceControllerBase {
   public:
+    using ScratchSpaceControllerBase::adaptiveScratchSpace;
+    using ScratchSpaceControllerBase::computeUnitsUsedForScratch;
+    using ScratchSpaceControllerBase::getScratchSizeToAllocate;
+    using ScratchSpaceControllerBase::maxPerThreadScratchSize;
+
     MockScratchSpaceControllerBase(uint32_t rootDeviceIndex,
                                    ExecutionEnvironment &environment,
                                    InternalAllocationStorage &allocationStorage) : ScratchSpaceControllerBase(rootDeviceIndex, environment, allocationStorage) {}
@@ -86,3 +91,21 @@ HWTEST_F(ScratchComtrolerTests, givenNullptrBindlessHeapHelperWhenProgramBindles
     EXPECT_TRUE(static_cast<MockScratchSpaceControllerBase *>(scratchController.get())->programBindlessSurfaceStateForScratchCalled);
     EXPECT_EQ(0u, csr.makeResidentCalledTimes);
 }
+
+HWTEST_F(ScratchComtrolerTests, givenAdaptiveScratchSpaceWhenScratchIsGrownThenNewSizeIsLimitedByMaxScratchSizeButNotBelowRequiredSize) {
+    MockCommandStreamReceiver csr(*pDevice->getExecutionEnvironment(), 0, pDevice->getDeviceBitfield());
+    auto scratchController = std::make_unique<MockScratchSpaceControllerBase>(pDevice->getRootDeviceIndex(),
+                                                                              *pDevice->getExecutionEnvironment(),
+                                                                              *csr.getInternalAllocationStorage());
+    EXPECT_EQ(pDevice->getGfxCoreHelper().getMaxScratchSize(), scratchController->maxPerThreadScratchSize);
+
+    scratchController->adaptiveScratchSpace = true;
+    scratchController->computeUnitsUsedForScratch = 2u;
+    scratchController->maxPerThreadScratchSize = 1024u;
+
+    uint32_t underutilizedSubmissions = 0u;
+    EXPECT_EQ(1024u, scratchController->getScratchSizeToAllocate(600u, 512u, underutilizedSubmissions));
+    EXPECT_EQ(2048u, scratchController->getScratchSizeToAllocate(1100u, 1024u, underutilizedSubmissions));
+    EXPECT_EQ(2048u, scratchController->getScratchSizeToAllocate(1600u, 1500u, underutilizedSubmissions));
+    EXPECT_EQ(4096u, scratchController->getScratchSizeToAllocate(4096u, 2048u, underutilizedSubmissions));
+}
\ No newline at end of file
@@ -849,6 +849,47 @@ TEST(IDList, GivenNonThreadSafeWhenDetachingSequenceThenResultIsCorrect) {
     iDListTestDetachSequence<false>();
 }
 
+template <bool threadSafe>
+void iDListTestDetachFrontNodes() {
+    DummyDNode *nodes[10];
+    makeList(nodes);
+    IDList<DummyDNode, threadSafe, false, false> list(nodes[0]);
+    DummyDNode *detachedNodes = nullptr;
+
+    detachedNodes = list.detachFrontNodes(0u);
+    ASSERT_EQ(nullptr, detachedNodes);
+    ASSERT_EQ(nodes[0], list.peekHead());
+
+    detachedNodes = list.detachFrontNodes(3u);
+    ASSERT_EQ(nodes[0], detachedNodes);
+    ASSERT_EQ(nullptr, nodes[0]->prev);
+    ASSERT_EQ(nullptr, nodes[2]->next);
+    ASSERT_EQ(nodes[3], list.peekHead());
+    ASSERT_EQ(nullptr, nodes[3]->prev);
+    ASSERT_EQ(nodes[9], list.peekTail());
+
+    detachedNodes = list.detachFrontNodes(20u);
+    ASSERT_EQ(nodes[3], detachedNodes);
+    ASSERT_EQ(nullptr, nodes[9]->next);
+    ASSERT_TRUE(list.peekIsEmpty());
+    ASSERT_EQ(nullptr, list.peekTail());
+
+    detachedNodes = list.detachFrontNodes(1u);
+    ASSERT_EQ(nullptr, detachedNodes);
+
+    for (auto n : nodes) {
+        delete n;
+    }
+}
+
+TEST(IDList, GivenThreadSafeWhenDetachingFrontNodesThenResultIsCorrect) {
+    iDListTestDetachFrontNodes<true>();
+}
+
+TEST(IDList, GivenNonThreadSafeWhenDetachingFrontNodesThenResultIsCorrect) {
+    iDListTestDetachFrontNodes<false>();
+}
+
 template <bool threadSafe>
 void iDListTestPeekContains() {
     IDList<DummyDNode, threadSafe, false, false> list;
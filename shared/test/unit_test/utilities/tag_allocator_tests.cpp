@@ -22,6 +22,7 @@
 #include "gtest/gtest.h"
 
 #include <cstdint>
+#include <thread>
 
 using namespace NEO;
 
@@ -80,12 +81,16 @@ class MockTagAllocator : public TagAllocator<TagType> {
     using BaseClass::deferredTags;
     using BaseClass::doNotReleaseNodes;
     using BaseClass::freeTags;
+    using BaseClass::getMagazineForCurrentThread;
     using BaseClass::gfxAllocations;
+    using BaseClass::magazines;
+    using BaseClass::magazineSize;
     using BaseClass::populateFreeTags;
     using BaseClass::releaseDeferredTags;
     using BaseClass::returnTagToDeferredPool;
     using BaseClass::rootDeviceIndices;
     using BaseClass::TagAllocator;
+    using BaseClass::tagCount;
     using BaseClass::usedTags;
     using BaseClass::TagAllocatorBase::cleanUpResources;
 
@@ -121,6 +126,22 @@ class MockTagAllocator : public TagAllocator<TagType> {
     size_t getTagPoolCount() {
         return this->tagPoolMemory.size();
     }
+
+    size_t getFreeTagsCount() {
+        size_t count = 0;
+        for (auto node = this->freeTags.peekHead(); node != nullptr; node = node->next) {
+            count++;
+        }
+        return count;
+    }
+
+    size_t getMagazinedTagsCount() {
+        size_t count = 0;
+        for (auto &magazine : this->magazines) {
+            count += magazine.nodes.size();
+        }
+        return count;
+    }
 };
 
 TEST_F(TagAllocatorTest, givenTagNodeTypeWhenCopyingOrMovingThenDisallow) {
@@ -614,3 +635,170 @@ TEST_F(TagAllocatorTest, givenNotSupportedTagTypeWhenCallingMethodThenAbortOrRet
         EXPECT_NO_THROW(timestampPacketsNode.getGlobalStartValue(0));
     }
 }
+
+TEST_F(TagAllocatorTest, givenSlabSizeDebugFlagSetWhenTagAllocatorGrowsThenFlagValueIsUsedAsTagCount) {
+    debugManager.flags.TagAllocatorSlabSize.set(3);
+
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 10, 64, deviceBitfield);
+    EXPECT_EQ(3u, tagAllocator.tagCount);
+    EXPECT_EQ(3u, tagAllocator.getFreeTagsCount());
+
+    TagNodeBase *tags[4] = {};
+    for (auto &tag : tags) {
+        tag = tagAllocator.getTag();
+    }
+    EXPECT_EQ(2u, tagAllocator.getGraphicsAllocationsCount());
+    EXPECT_EQ(2u, tagAllocator.getFreeTagsCount());
+
+    for (auto &tag : tags) {
+        tagAllocator.returnTag(tag);
+    }
+}
+
+TEST_F(TagAllocatorTest, givenMagazinesEnabledWhenGettingTagThenBatchOfNodesIsMovedFromFreeListToMagazine) {
+    debugManager.flags.TagAllocatorMagazineSize.set(4);
+
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 10, 64, deviceBitfield);
+    EXPECT_EQ(4u, tagAllocator.magazineSize);
+
+    auto tagNode = static_cast<TagNode<TimeStamps> *>(tagAllocator.getTag());
+    auto &magazine = tagAllocator.getMagazineForCurrentThread();
+
+    EXPECT_EQ(1u, magazine.nodes.size());
+    EXPECT_EQ(8u, tagAllocator.getFreeTagsCount());
+    EXPECT_TRUE(tagAllocator.usedTags.peekContains(*tagNode));
+    EXPECT_EQ(1u, tagNode->tagForCpuAccess->start);
+
+    auto secondTagNode = tagAllocator.getTag();
+    EXPECT_EQ(0u, magazine.nodes.size());
+    EXPECT_EQ(8u, tagAllocator.getFreeTagsCount());
+
+    tagAllocator.returnTag(tagNode);
+    tagAllocator.returnTag(secondTagNode);
+}
+
+TEST_F(TagAllocatorTest, givenMagazinesEnabledWhenReturningTagThenNodeIsCachedInMagazineInsteadOfFreeList) {
+    debugManager.flags.TagAllocatorMagazineSize.set(4);
+
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 10, 64, deviceBitfield);
+
+    auto tagNode = static_cast<TagNode<TimeStamps> *>(tagAllocator.getTag());
+    tagAllocator.returnTag(tagNode);
+
+    auto &magazine = tagAllocator.getMagazineForCurrentThread();
+    EXPECT_EQ(2u, magazine.nodes.size());
+    EXPECT_EQ(tagNode, magazine.nodes.back());
+    EXPECT_FALSE(tagAllocator.freeTags.peekContains(*tagNode));
+    EXPECT_FALSE(tagAllocator.usedTags.peekContains(*tagNode));
+
+    EXPECT_EQ(tagNode, tagAllocator.getTag());
+    tagAllocator.returnTag(tagNode);
+}
+
+TEST_F(TagAllocatorTest, givenFullMagazineWhenReturningTagThenHalfOfMagazineIsFlushedToFreeList) {
+    debugManager.flags.TagAllocatorMagazineSize.set(4);
+
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 10, 64, deviceBitfield);
+
+    TagNodeBase *tags[5] = {};
+    for (auto &tag : tags) {
+        tag = tagAllocator.getTag();
+    }
+    auto &magazine = tagAllocator.getMagazineForCurrentThread();
+    EXPECT_EQ(1u, magazine.nodes.size());
+    EXPECT_EQ(4u, tagAllocator.getFreeTagsCount());
+
+    for (auto &tag : tags) {
+        tagAllocator.returnTag(tag);
+    }
+
+    EXPECT_EQ(4u, magazine.nodes.size());
+    EXPECT_EQ(6u, tagAllocator.getFreeTagsCount());
+    EXPECT_TRUE(tagAllocator.freeTags.peekContains(*static_cast<TagNode<TimeStamps> *>(tags[1])));
+    EXPECT_TRUE(tagAllocator.freeTags.peekContains(*static_cast<TagNode<TimeStamps> *>(tags[2])));
+    EXPECT_FALSE(tagAllocator.freeTags.peekContains(*static_cast<TagNode<TimeStamps> *>(tags[4])));
+    EXPECT_EQ(tags[4], magazine.nodes.back());
+    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
+}
+
+TEST_F(TagAllocatorTest, givenMagazinesEnabledWhenAllTagsAreUsedThenNewGraphicsAllocationIsCreatedOnDemand) {
+    debugManager.flags.TagAllocatorMagazineSize.set(8);
+
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 3, 64, deviceBitfield);
+
+    TagNodeBase *tags[4] = {};
+    for (auto &tag : tags) {
+        tag = tagAllocator.getTag();
+    }
+    EXPECT_EQ(2u, tagAllocator.getGraphicsAllocationsCount());
+
+    for (auto &tag : tags) {
+        tagAllocator.returnTag(tag);
+    }
+    EXPECT_EQ(6u, tagAllocator.getFreeTagsCount() + tagAllocator.getMagazinedTagsCount());
+}
+
+TEST_F(TagAllocatorTest, givenFreeNodesCachedInOtherMagazineWhenFreeListIsExhaustedThenMagazineIsDrainedInsteadOfCreatingNewGraphicsAllocation) {
+    debugManager.flags.TagAllocatorMagazineSize.set(4);
+
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 4, 64, deviceBitfield);
+
+    auto &currentMagazine = tagAllocator.getMagazineForCurrentThread();
+    auto &otherMagazine = (&currentMagazine == &tagAllocator.magazines[0]) ? tagAllocator.magazines[1] : tagAllocator.magazines[0];
+    auto node = tagAllocator.freeTags.detachNodes();
+    while (node != nullptr) {
+        auto nextNode = node->next;
+        node->prev = nullptr;
+        node->next = nullptr;
+        otherMagazine.nodes.push_back(node);
+        node = nextNode;
+    }
+
+    auto tag = tagAllocator.getTag();
+    EXPECT_EQ(1u, tagAllocator.getGraphicsAllocationsCount());
+    EXPECT_TRUE(otherMagazine.nodes.empty());
+    EXPECT_EQ(1u, currentMagazine.nodes.size());
+    EXPECT_EQ(2u, tagAllocator.getFreeTagsCount());
+
+    tagAllocator.returnTag(tag);
+}
+
+TEST_F(TagAllocatorTest, givenMagazinesEnabledWhenTagsAreAllocatedFromMultipleThreadsThenEachNodeIsOwnedByOneThreadAtATime) {
+    debugManager.flags.TagAllocatorMagazineSize.set(8);
+
+    MockTagAllocator<TimeStamps> tagAllocator(memoryManager, 16, 64, deviceBitfield);
+
+    constexpr uint32_t threadsCount = 4;
+    constexpr uint32_t iterationsCount = 200;
+    constexpr uint32_t tagsPerIteration = 6;
+    std::atomic<uint32_t> ownershipViolations{0};
+
+    auto allocateTags = [&](uint64_t threadMarker) {
+        TagNode<TimeStamps> *tags[tagsPerIteration] = {};
+        for (uint32_t iteration = 0; iteration < iterationsCount; iteration++) {
+            for (auto &tag : tags) {
+                tag = static_cast<TagNode<TimeStamps> *>(tagAllocator.getTag());
+                tag->tagForCpuAccess->end = threadMarker;
+            }
+            std::this_thread::yield();
+            for (auto &tag : tags) {
+                if (tag->tagForCpuAccess->end != threadMarker) {
+                    ownershipViolations++;
+                }
+                tagAllocator.returnTag(tag);
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < threadsCount; i++) {
+        threads.emplace_back(allocateTags, 100u + i);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(0u, ownershipViolations.load());
+    EXPECT_EQ(nullptr, tagAllocator.getUsedTagsHead());
+    EXPECT_EQ(tagAllocator.getTagPoolCount() * tagAllocator.tagCount, tagAllocator.getFreeTagsCount() + tagAllocator.getMagazinedTagsCount());
+}
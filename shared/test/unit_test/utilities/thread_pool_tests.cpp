@@ -0,0 +1,123 @@
+/*
+ * Copyright (C) 2026 Intel Corporation
+ *
+ * SPDX-License-Identifier: MIT
+ *
+ */
+
+#include "shared/source/utilities/thread_pool.h"
+#include "shared/test/common/helpers/debug_manager_state_restore.h"
+#include "shared/test/common/mocks/mock_execution_environment.h"
+
+#include "gtest/gtest.h"
+
+#include <atomic>
+#include <thread>
+
+using namespace NEO;
+
+TEST(ThreadPoolTest, givenDebugFlagSetWhenGettingDefaultThreadsCountThenDebugValueIsReturned) {
+    DebugManagerStateRestore restorer;
+    debugManager.flags.DriverThreadPoolSize.set(3);
+    EXPECT_EQ(3u, ThreadPool::getDefaultThreadsCount());
+}
+
+TEST(ThreadPoolTest, givenDefaultSettingsWhenGettingDefaultThreadsCountThenValueIsLimited) {
+    auto threadsCount = ThreadPool::getDefaultThreadsCount();
+    EXPECT_LE(1u, threadsCount);
+    EXPECT_GE(ThreadPool::defaultMaxThreadsCount, threadsCount);
+}
+
+TEST(ThreadPoolTest, givenMultipleTasksWhenEnqueuedThenEachHandleCanBeAwaitedIndependently) {
+    ThreadPool threadPool(2u);
+    EXPECT_EQ(2u, threadPool.getThreadsCount());
+
+    std::atomic<uint32_t> executedTasks{0u};
+    std::atomic<bool> releaseFirstTask{false};
+
+    auto blockingTask = threadPool.enqueue([&]() {
+        while (!releaseFirstTask.load()) {
+            std::this_thread::yield();
+        }
+        executedTasks++;
+    });
+    auto secondTask = threadPool.enqueue([&]() {
+        executedTasks++;
+    });
+
+    secondTask.wait();
+    EXPECT_EQ(std::future_status::timeout, blockingTask.wait_for(std::chrono::seconds(0)));
+
+    releaseFirstTask.store(true);
+    blockingTask.wait();
+    EXPECT_EQ(2u, executedTasks.load());
+}
+
+TEST(ThreadPoolTest, givenPoolWithoutThreadsWhenTaskIsEnqueuedThenTaskIsExecutedSynchronously) {
+    ThreadPool threadPool(0u);
+    bool executed = false;
+
+    auto handle = threadPool.enqueue([&]() {
+        executed = true;
+    });
+
+    EXPECT_TRUE(executed);
+    EXPECT_EQ(std::future_status::ready, handle.wait_for(std::chrono::seconds(0)));
+}
+
+TEST(ThreadPoolTest, givenPendingTasksWhenPoolIsShutDownThenAllTasksAreCompleted) {
+    std::atomic<uint32_t> executedTasks{0u};
+    std::vector<ThreadPool::TaskHandle> handles;
+    {
+        ThreadPool threadPool(1u);
+        for (auto i = 0u; i < 8u; i++) {
+            handles.push_back(threadPool.enqueue([&]() {
+                executedTasks++;
+            }));
+        }
+        threadPool.shutdown();
+        EXPECT_EQ(0u, threadPool.getPendingTasksCount());
+
+        auto lateTask = threadPool.enqueue([&]() {
+            executedTasks++;
+        });
+        EXPECT_EQ(std::future_status::ready, lateTask.wait_for(std::chrono::seconds(0)));
+    }
+    for (auto &handle : handles) {
+        EXPECT_EQ(std::future_status::ready, handle.wait_for(std::chrono::seconds(0)));
+    }
+    EXPECT_EQ(9u, executedTasks.load());
+}
+
+TEST(ThreadPoolTest, givenParallelForWhenCalledThenEveryIndexIsProcessedOnceBeforeReturn) {
+    ThreadPool threadPool(2u);
+    std::vector<std::atomic<uint32_t>> processedIndices(16u);
+
+    threadPool.parallelFor(processedIndices.size(), [&](size_t index) {
+        processedIndices[index]++;
+    });
+
+    for (auto &processed : processedIndices) {
+        EXPECT_EQ(1u, processed.load());
+    }
+}
+
+TEST(ThreadPoolTest, givenAllPoolThreadsBusyWhenParallelForIsCalledFromPoolTaskThenCallingThreadProcessesAllIndices) {
+    ThreadPool threadPool(1u);
+    std::atomic<uint32_t> processedCount{0u};
+
+    auto outerTask = threadPool.enqueue([&]() {
+        threadPool.parallelFor(8u, [&](size_t index) {
+            processedCount++;
+        });
+    });
+    outerTask.wait();
+    EXPECT_EQ(8u, processedCount.load());
+}
+
+TEST(ThreadPoolTest, givenExecutionEnvironmentWhenGettingThreadPoolThenSamePoolIsReturned) {
+    MockExecutionEnvironment executionEnvironment;
+    auto threadPool = executionEnvironment.getThreadPool();
+    EXPECT_NE(nullptr, threadPool);
+    EXPECT_EQ(threadPool, executionEnvironment.getThreadPool());
+}